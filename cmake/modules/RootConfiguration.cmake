@@ -415,6 +415,11 @@ if(dataframe)
 else()
   set(hasdataframe undef)
 endif()
+if(root7)
+  set(hasroot7 define)
+else()
+  set(hasroot7 undef)
+endif()
 if(dev)
   set(use_less_includes define)
 else()
@@ -167,6 +167,57 @@ public:
       }
       return;
    }
+
+   /// Queue a read event without submitting it to the kernel. The event must stay alive until its completion
+   /// has been reaped with WaitForRead(). Returns false if the submission queue is full; in this case, the
+   /// queued events need to be submitted first. Throws an exception on an invalid read event.
+   bool PrepareRead(RReadEvent *readEvent) {
+      if (readEvent->fFileDes == -1)
+         throw std::runtime_error("bad fd (-1) for read request");
+      if (readEvent->fBuffer == nullptr)
+         throw std::runtime_error("null read buffer for read request");
+      struct io_uring_sqe *sqe = io_uring_get_sqe(&fRing);
+      if (!sqe)
+         return false;
+      io_uring_prep_read(sqe,
+         readEvent->fFileDes,
+         readEvent->fBuffer,
+         readEvent->fSize,
+         readEvent->fOffset
+      );
+      sqe->flags |= IOSQE_ASYNC; // maximize read event throughput
+      io_uring_sqe_set_data(sqe, readEvent);
+      return true;
+   }
+
+   /// Submit all the read events queued by PrepareRead() without waiting for their completion. Returns the
+   /// number of submitted events.
+   unsigned int Submit() {
+      int submitted = io_uring_submit(&fRing);
+      if (submitted < 0) {
+         throw std::runtime_error("ring submit failed, error: " + std::string(std::strerror(-submitted)));
+      }
+      return static_cast<unsigned int>(submitted);
+   }
+
+   /// Block until the next submitted read event completes, in any order, and return it with fOutBytes set.
+   /// Throws an exception if the read failed; the failed event is reaped nevertheless.
+   RReadEvent *WaitForRead() {
+      struct io_uring_cqe *cqe;
+      int ret = io_uring_wait_cqe(&fRing, &cqe);
+      if (ret < 0) {
+         throw std::runtime_error("wait cqe failed, error: " + std::string(std::strerror(-ret)));
+      }
+      auto readEvent = reinterpret_cast<RReadEvent *>(io_uring_cqe_get_data(cqe));
+      auto res = cqe->res;
+      io_uring_cqe_seen(&fRing, cqe);
+      if (res < 0) {
+         throw std::runtime_error("read failed at offset " + std::to_string(readEvent->fOffset) +
+            ", error: " + std::string(std::strerror(-res)));
+      }
+      readEvent->fOutBytes = static_cast<std::size_t>(res);
+      return readEvent;
+   }
 };
 
 } // namespace Internal
@@ -374,16 +374,26 @@ Bool_t TFileMerger::Merge(Bool_t)
 
 namespace {
 
-/// Merge a list of RNTuples
-Long64_t MergeRNTuples(TClass* rntupleHandle, const TString& /* target */, const TList& /* sources */) {
-   if (!rntupleHandle) {
+/// Merge the RNTuple called `ntupleName` of all the source files, starting with `firstFile`, into `target`.
+/// The merge function of the RNTuple receives the name of the ntuple followed by the source files in its input list.
+Long64_t MergeRNTuples(TClass *rntupleHandle, void *ntuple, const char *ntupleName, TList &sources, TFile *firstFile,
+                       TFileMergeInfo &info)
+{
+   ROOT::MergeFunc_t func = rntupleHandle ? rntupleHandle->GetMerge() : nullptr;
+   if (!func) {
       return Long64_t(-1);
    }
-   // todo(max) implement rntuple merger
-   // [ ] build complete list of sources (some sources may actually be a directory with RNTuples inside)
-   // [ ] merge them
-   ROOT::MergeFunc_t func = rntupleHandle->GetMerge();
-   return func(static_cast<void*>(rntupleHandle), nullptr, nullptr);
+
+   TObjString name(ntupleName);
+   TList mergeData;
+   mergeData.Add(&name);
+   for (auto file = firstFile; file; file = static_cast<TFile *>(sources.After(file))) {
+      if (file->FindKey(ntupleName))
+         mergeData.Add(file);
+   }
+   auto result = func(ntuple, &mergeData, &info);
+   mergeData.Clear("nodelete");
+   return result;
 }
 
 Bool_t IsMergeable(TClass *cl)
@@ -597,13 +607,22 @@ Bool_t TFileMerger::MergeOne(TDirectory *target, TList *sourcelist, Int_t type,
       // merge objects that don't derive from TObject
       if (std::string(keyclassname) == "ROOT::Experimental::RNTuple") {
          Warning("MergeRecursive", "merging RNTuples is experimental");
-         // todo(max): check if this works when a TDirectory is passed as the first
-         // input argument
-         Long64_t mergeResult = MergeRNTuples(cl, *path, *sourcelist);
+         if (!current_file || path.Length() > 0) {
+            Error("MergeRecursive", "merging RNTuples is only supported in the top-level directory in non-incremental "
+                                    "mode");
+            return kFALSE;
+         }
+         Long64_t mergeResult = MergeRNTuples(cl, obj, keyname, *sourcelist, current_file, info);
+         if (ownobj)
+            cl->Destructor(obj);
          if (mergeResult < 0) {
             Error("MergeRecursive", "error merging RNTuples");
             return kFALSE;
          }
+         // The merger writes the anchor of the merged RNTuple to the target itself
+         oldkeyname = keyname;
+         info.Reset();
+         return kTRUE;
       } else {
          TFile *nextsource = current_file ? (TFile*)sourcelist->After( current_file ) : (TFile*)sourcelist->First();
          Error("MergeRecursive", "Merging objects that don't inherit from TObject is unimplemented (key: %s of type %s in file %s)",
@@ -142,3 +142,51 @@ TEST(RawUring, FileRegistration)
       free(iovec.fBuffer);
    }
 }
+
+TEST(RawUring, AsyncReads)
+{
+   auto file = "test_uring_async";
+   std::string content;
+   for (int i = 0; i < 4096; ++i)
+      content.push_back('a' + (i % 26));
+   FileRaii fileGuard(file, content);
+   RRawFileUnix f(file, RRawFile::ROptions());
+   f.GetSize(); // files are opened lazily
+
+   RIoUring ring(4);
+   const auto queueDepth = ring.GetQueueDepth();
+
+   // Queue more reads than the ring can hold; PrepareRead() signals a full submission queue
+   std::vector<RIoUring::RReadEvent> events(queueDepth + 1);
+   std::vector<std::vector<char>> buffers(events.size(), std::vector<char>(26));
+   unsigned int nPrepared = 0;
+   for (std::size_t i = 0; i < events.size(); ++i) {
+      events[i].fBuffer = buffers[i].data();
+      events[i].fOffset = i;
+      events[i].fSize = buffers[i].size();
+      events[i].fFileDes = f.GetFd();
+      if (!ring.PrepareRead(&events[i]))
+         break;
+      nPrepared++;
+   }
+   EXPECT_EQ(queueDepth, nPrepared);
+   EXPECT_EQ(nPrepared, ring.Submit());
+
+   for (unsigned int i = 0; i < nPrepared; ++i) {
+      auto ev = ring.WaitForRead();
+      ASSERT_GE(ev, events.data());
+      ASSERT_LT(ev, events.data() + nPrepared);
+      EXPECT_EQ(ev->fSize, ev->fOutBytes);
+      EXPECT_EQ(content.substr(ev->fOffset, ev->fSize), std::string(static_cast<char *>(ev->fBuffer), ev->fOutBytes));
+   }
+
+   // The last event fits into the ring now; reading beyond the end of the file gives a short read
+   events.back().fOffset = content.size() - 10;
+   EXPECT_TRUE(ring.PrepareRead(&events.back()));
+   EXPECT_EQ(1u, ring.Submit());
+   EXPECT_EQ(&events.back(), ring.WaitForRead());
+   EXPECT_EQ(10u, events.back().fOutBytes);
+
+   RIoUring::RReadEvent badEvent;
+   EXPECT_THROW(ring.PrepareRead(&badEvent), std::runtime_error);
+}
@@ -94,6 +94,9 @@
   \note By default histograms are added. However hadd does not support the case where
          histograms have their bit TH1::kIsAverage set.
 
+  \note RNTuples can only be merged if they are in the top-level directory of the files and
+         if all the input files can be kept open at the same time (see option -n).
+
   \authors Rene Brun, Dirk Geppert, Sven A. Schmidt, Toby Burnett
 */
 #include "Compression.h"
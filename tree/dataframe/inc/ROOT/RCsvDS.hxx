@@ -15,11 +15,12 @@
 #include "ROOT/RDataSource.hxx"
 
 #include <cstdint>
+#include <cstddef>
 #include <deque>
-#include <list>
 #include <unordered_map>
 #include <set>
 #include <memory>
+#include <string>
 #include <vector>
 
 #include <TRegexp.h>
@@ -53,18 +54,27 @@ private:
    std::vector<std::string> fHeaders; // the column names
    std::unordered_map<std::string, ColType_t> fColTypes;
    std::set<std::string> fColContainingEmpty; // store columns which had empty entry
-   std::list<ColType_t> fColTypesList; // column types, order is the same as fHeaders, values the same as fColTypes
-   std::vector<std::vector<void *>> fColAddresses;         // fColAddresses[column][slot] (same ordering as fHeaders)
-   std::vector<Record_t> fRecords;                         // fRecords[entry][column] (same ordering as fHeaders)
-   std::vector<std::vector<double>> fDoubleEvtValues;      // one per column per slot
-   std::vector<std::vector<Long64_t>> fLong64EvtValues;    // one per column per slot
-   std::vector<std::vector<std::string>> fStringEvtValues; // one per column per slot
+   std::vector<ColType_t> fColTypesList; // column types, order is the same as fHeaders, values the same as fColTypes
+   std::vector<std::vector<void *>> fColAddresses; // fColAddresses[column][slot] (same ordering as fHeaders)
+   std::string fBuffer; // bytes read from the file but not parsed yet, i.e. the beginning of the next chunk of lines
+   ULong64_t fNRecords = 0ULL; // number of records in the current chunk
+   // The values of the records of the current chunk, e.g. fDoubleColumns[column][record] (same ordering as fHeaders).
+   // Only the vectors of the columns of the corresponding type are filled.
+   std::vector<std::vector<double>> fDoubleColumns;
+   std::vector<std::vector<Long64_t>> fLong64Columns;
+   std::vector<std::vector<std::string>> fStringColumns;
+   // char rather than bool: the elements of a vector<bool> cannot be written concurrently
+   std::vector<std::vector<char>> fBoolColumns;
    // This must be a deque to avoid the specialisation vector<bool>. This would not
    // work given that the pointer to the boolean in that case cannot be taken
    std::vector<std::deque<bool>> fBoolEvtValues; // one per column per slot
 
    void FillHeaders(const std::string &);
-   void FillRecord(const std::string &, Record_t &);
+   std::size_t ReadChunk();
+   void ParseChunk(std::size_t);
+   void ParseRecords(const char *, const char *, ULong64_t, std::vector<char> &);
+   void ParseRecord(const char *, const char *, ULong64_t, std::vector<char> &, std::string &);
+   void StoreValue(std::size_t, ULong64_t, const char *, const char *, bool, std::vector<char> &);
    void GenerateHeaders(size_t);
    std::vector<void *> GetColumnReadersImpl(std::string_view, const std::type_info &) final;
    void ValidateColTypes(std::vector<std::string> &) const;
@@ -46,9 +46,12 @@
 #include "TStatistic.h"
 #include "ROOT/RDF/RActionImpl.hxx"
 #include "ROOT/RDF/RMergeableValue.hxx"
+#include "RConfigure.h" // for R__HAS_ROOT7
+
 
 #include <algorithm>
 #include <functional>
+#include <iterator> // std::begin, std::end
 #include <limits>
 #include <memory>
 #include <stdexcept>
@@ -61,6 +64,12 @@
 
 /// \cond HIDDEN_SYMBOLS
 
+namespace ROOT {
+namespace RDF {
+class RDataSource;
+} // namespace RDF
+} // namespace ROOT
+
 namespace ROOT {
 namespace Internal {
 namespace RDF {
@@ -1525,6 +1534,8 @@ class R__CLING_PTRCHECK(off) SnapshotHelper : public RActionImpl<SnapshotHelper<
    // TODO we might be able to unify fBranches, fBranchAddresses and fOutputBranches
    std::vector<TBranch *> fBranches; // Addresses of branches in output, non-null only for the ones holding C arrays
    std::vector<void *> fBranchAddresses; // Addresses of objects associated to output branches
+   // Addresses of the values passed to the last Exec, they change from entry to entry in bulk mode
+   std::vector<const void *> fValueAddresses;
    RBranchSet fOutputBranches;
    std::vector<bool> fIsDefine;
 
@@ -1535,7 +1546,8 @@ public:
                   std::vector<bool> &&isDefine)
       : fFileName(filename), fDirName(dirname), fTreeName(treename), fOptions(options), fInputBranchNames(vbnames),
         fOutputBranchNames(ReplaceDotWithUnderscore(bnames)), fBranches(vbnames.size(), nullptr),
-        fBranchAddresses(vbnames.size(), nullptr), fIsDefine(std::move(isDefine))
+        fBranchAddresses(vbnames.size(), nullptr), fValueAddresses(vbnames.size(), nullptr),
+        fIsDefine(std::move(isDefine))
    {
       ValidateSnapshotOutput(fOptions, fTreeName, fFileName);
    }
@@ -1558,10 +1570,14 @@ public:
    void Exec(unsigned int /* slot */, ColTypes &... values)
    {
       using ind_t = std::index_sequence_for<ColTypes...>;
-      if (!fBranchAddressesNeedReset) {
+      const void *valueAddresses[] = {&values..., nullptr};
+      // in bulk mode, every entry of a bulk is passed from a different address: the output branches must follow
+      if (!fBranchAddressesNeedReset &&
+          std::equal(fValueAddresses.begin(), fValueAddresses.end(), std::begin(valueAddresses))) {
          UpdateCArraysPtrs(values..., ind_t{});
       } else {
          SetBranches(values..., ind_t{});
+         std::copy(std::begin(valueAddresses), std::end(valueAddresses) - 1, fValueAddresses.begin());
          fBranchAddressesNeedReset = false;
       }
       fOutputTree->Fill();
@@ -1677,6 +1693,8 @@ class R__CLING_PTRCHECK(off) SnapshotHelperMT : public RActionImpl<SnapshotHelpe
    std::vector<std::vector<TBranch *>> fBranches;
    // Addresses associated to output branches per slot, non-null only for the ones holding C arrays
    std::vector<std::vector<void *>> fBranchAddresses;
+   // Addresses of the values passed to the last Exec per slot, they change from entry to entry in bulk mode
+   std::vector<std::vector<const void *>> fValueAddresses;
    std::vector<RBranchSet> fOutputBranches;
    std::vector<bool> fIsDefine;
 
@@ -1689,7 +1707,8 @@ public:
         fFileName(filename), fDirName(dirname), fTreeName(treename), fOptions(options), fInputBranchNames(vbnames),
         fOutputBranchNames(ReplaceDotWithUnderscore(bnames)), fInputTrees(fNSlots),
         fBranches(fNSlots, std::vector<TBranch *>(vbnames.size(), nullptr)),
-        fBranchAddresses(fNSlots, std::vector<void *>(vbnames.size(), nullptr)), fOutputBranches(fNSlots),
+        fBranchAddresses(fNSlots, std::vector<void *>(vbnames.size(), nullptr)),
+        fValueAddresses(fNSlots, std::vector<const void *>(vbnames.size(), nullptr)), fOutputBranches(fNSlots),
         fIsDefine(std::move(isDefine))
    {
       ValidateSnapshotOutput(fOptions, fTreeName, fFileName);
@@ -1743,10 +1762,15 @@ public:
    void Exec(unsigned int slot, ColTypes &... values)
    {
       using ind_t = std::index_sequence_for<ColTypes...>;
-      if (fBranchAddressesNeedReset[slot] == 0) {
+      const void *valueAddresses[] = {&values..., nullptr};
+      auto &slotValueAddresses = fValueAddresses[slot];
+      // in bulk mode, every entry of a bulk is passed from a different address: the output branches must follow
+      if (fBranchAddressesNeedReset[slot] == 0 &&
+          std::equal(slotValueAddresses.begin(), slotValueAddresses.end(), std::begin(valueAddresses))) {
          UpdateCArraysPtrs(slot, values..., ind_t{});
       } else {
          SetBranches(slot, values..., ind_t{});
+         std::copy(std::begin(valueAddresses), std::end(valueAddresses) - 1, slotValueAddresses.begin());
          fBranchAddressesNeedReset[slot] = 0;
       }
       fOutputTrees[slot]->Fill();
@@ -1843,6 +1867,132 @@ public:
    }
 };
 
+#ifdef R__HAS_ROOT7
+/// Whether the given columns can be written by SnapshotRNTupleCopyHelper, i.e. whether the data source is an
+/// RNTupleDS and the columns are top-level fields of its ntuples
+bool CanCopySnapshotColumns(RDataSource *dataSource, const ColumnNames_t &colNames);
+
+/// Writes the RNTuple of a Snapshot action from the addresses of the column values.  Every slot fills its own fill
+/// context of a parallel writer.  Implemented in RDFActionHelpers.cxx, so that the RNTuple headers are not needed to
+/// book a Snapshot.
+class RSnapshotRNTupleWriter {
+   struct RImpl;
+   std::unique_ptr<RImpl> fImpl;
+
+public:
+   RSnapshotRNTupleWriter(unsigned int nSlots, const std::string &fileName, const std::string &ntupleName,
+                          const RSnapshotOptions &options, const ColumnNames_t &inputColumnNames,
+                          const ColumnNames_t &outputFieldNames, const std::vector<std::string> &typeNames);
+   /// Commits the RNTuple
+   ~RSnapshotRNTupleWriter();
+   void InitSlot(unsigned int slot);
+   /// Fills an entry from the addresses of the values of the columns, in the order of the columns
+   void Fill(unsigned int slot, void *const *values);
+};
+
+/// Helper object for a Snapshot action that writes an RNTuple.  The same helper is used for single-thread and
+/// multi-thread event loops.
+template <typename... ColTypes>
+class R__CLING_PTRCHECK(off) SnapshotRNTupleHelper : public RActionImpl<SnapshotRNTupleHelper<ColTypes...>> {
+   unsigned int fNSlots;
+   std::string fFileName;
+   std::string fNTupleName;
+   RSnapshotOptions fOptions;
+   ColumnNames_t fInputColumnNames; // This contains the resolved aliases
+   ColumnNames_t fOutputFieldNames;
+   std::unique_ptr<RSnapshotRNTupleWriter> fWriter;
+   bool fHasRun = false;
+
+public:
+   using ColumnTypes_t = TypeList<ColTypes...>;
+   SnapshotRNTupleHelper(unsigned int nSlots, std::string_view filename, std::string_view dirname,
+                         std::string_view ntuplename, const ColumnNames_t &vbnames, const ColumnNames_t &bnames,
+                         const RSnapshotOptions &options)
+      : fNSlots(nSlots), fFileName(filename), fNTupleName(ntuplename), fOptions(options), fInputColumnNames(vbnames),
+        fOutputFieldNames(ReplaceDotWithUnderscore(bnames))
+   {
+      if (!dirname.empty())
+         throw std::runtime_error("Snapshot: RNTuple output cannot be written into a sub-directory");
+      ValidateSnapshotOutput(fOptions, fNTupleName, fFileName);
+   }
+   SnapshotRNTupleHelper(const SnapshotRNTupleHelper &) = delete;
+   SnapshotRNTupleHelper(SnapshotRNTupleHelper &&) = default;
+   ~SnapshotRNTupleHelper()
+   {
+      if (!fNTupleName.empty() /*not moved from*/ && !fHasRun && fOptions.fLazy)
+         Warning("Snapshot", "A lazy Snapshot action was booked but never triggered.");
+   }
+
+   void InitTask(TTreeReader *, unsigned int slot) { fWriter->InitSlot(slot); }
+
+   void Exec(unsigned int slot, ColTypes &...values)
+   {
+      // The values are bound to their current addresses for every entry; the trailing nullptr avoids an empty array
+      void *const addresses[] = {&values..., nullptr};
+      fWriter->Fill(slot, addresses);
+   }
+
+   void Initialize()
+   {
+      fHasRun = true;
+      const std::vector<std::string> typeNames{TypeID2TypeName(typeid(ColTypes))...};
+      fWriter = std::make_unique<RSnapshotRNTupleWriter>(fNSlots, fFileName, fNTupleName, fOptions, fInputColumnNames,
+                                                         fOutputFieldNames, typeNames);
+   }
+
+   void Finalize() { fWriter.reset(); }
+
+   std::string GetActionName() { return "Snapshot"; }
+
+   /**
+    * @brief Create a new SnapshotRNTupleHelper with a different output file name
+    *
+    * @param newName A type-erased string with the output file name
+    * @return SnapshotRNTupleHelper
+    *
+    * See SnapshotHelper::MakeNew().
+    */
+   SnapshotRNTupleHelper MakeNew(void *newName)
+   {
+      const std::string finalName = *reinterpret_cast<const std::string *>(newName);
+      return SnapshotRNTupleHelper{fNSlots,           finalName,         "",      fNTupleName,
+                                   fInputColumnNames, fOutputFieldNames, fOptions};
+   }
+};
+
+/// Helper object for a Snapshot action that writes an RNTuple from unchanged columns of an RNTupleDS.  The sealed
+/// pages of the columns are copied to the output when the action is finalized; they are only decompressed if the
+/// compression settings of the output differ from the ones of the input.  The action does not need an event loop.
+class R__CLING_PTRCHECK(off) SnapshotRNTupleCopyHelper : public RActionImpl<SnapshotRNTupleCopyHelper> {
+   RDataSource *fDataSource;
+   std::string fFileName;
+   std::string fNTupleName;
+   RSnapshotOptions fOptions;
+   ColumnNames_t fColumnNames;
+
+public:
+   using ColumnTypes_t = TypeList<>;
+   SnapshotRNTupleCopyHelper(RDataSource &dataSource, std::string_view filename, std::string_view dirname,
+                             std::string_view ntuplename, const ColumnNames_t &colNames,
+                             const RSnapshotOptions &options);
+   SnapshotRNTupleCopyHelper(SnapshotRNTupleCopyHelper &&) = default;
+   SnapshotRNTupleCopyHelper(const SnapshotRNTupleCopyHelper &) = delete;
+   void InitTask(TTreeReader *, unsigned int) {}
+   void Exec(unsigned int) {}
+   void Initialize() { /* noop */}
+   void Finalize();
+   bool NeedsEventLoop() const final { return false; }
+
+   std::string GetActionName() { return "Snapshot"; }
+
+   SnapshotRNTupleCopyHelper MakeNew(void *newName)
+   {
+      const std::string finalName = *reinterpret_cast<const std::string *>(newName);
+      return SnapshotRNTupleCopyHelper{*fDataSource, finalName, "", fNTupleName, fColumnNames, fOptions};
+   }
+};
+#endif
+
 template <typename Acc, typename Merge, typename R, typename T, typename U,
           bool MustCopyAssign = std::is_same<R, U>::value>
 class R__CLING_PTRCHECK(off) AggregateHelper
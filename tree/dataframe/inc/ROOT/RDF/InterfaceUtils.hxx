@@ -31,6 +31,7 @@
 #include <TH1.h>
 #include <TROOT.h> // IsImplicitMTEnabled
 
+#include <algorithm>
 #include <deque>
 #include <functional>
 #include <map>
@@ -44,6 +45,7 @@
 class TObjArray;
 class TTree;
 namespace ROOT {
+class RDataFrame;
 namespace Detail {
 namespace RDF {
 class RNodeBase;
@@ -275,7 +277,33 @@ BuildAction(const ColumnNames_t &colNames, const std::shared_ptr<SnapshotHelperA
    std::vector<bool> isDefine = makeIsDefine();
 
    std::unique_ptr<RActionBase> actionPtr;
-   if (!ROOT::IsImplicitMTEnabled()) {
+   if (options.fOutputFormat == ROOT::RDF::ESnapshotOutputFormat::kRNTuple) {
+#ifdef R__HAS_ROOT7
+      // Unchanged RNTupleDS columns of an unfiltered data frame are copied page by page, without an event loop over
+      // their values
+      RDataSource *copySource = nullptr;
+      if constexpr (std::is_same<PrevNodeType, RLoopManager>::value) {
+         if ((outputColNames == colNames) &&
+             std::none_of(isDefine.begin(), isDefine.end(), [](bool b) { return b; }) &&
+             CanCopySnapshotColumns(prevNode->GetDataSource(), colNames)) {
+            copySource = prevNode->GetDataSource();
+         }
+      }
+      if (copySource) {
+         using Helper_t = SnapshotRNTupleCopyHelper;
+         using Action_t = RAction<Helper_t, PrevNodeType>;
+         actionPtr.reset(new Action_t(Helper_t(*copySource, filename, dirname, treename, colNames, options),
+                                      ColumnNames_t{}, prevNode, colRegister));
+      } else {
+         using Helper_t = SnapshotRNTupleHelper<ColTypes...>;
+         using Action_t = RAction<Helper_t, PrevNodeType>;
+         actionPtr.reset(new Action_t(Helper_t(nSlots, filename, dirname, treename, colNames, outputColNames, options),
+                                      colNames, prevNode, colRegister));
+      }
+#else
+      throw std::runtime_error("Snapshot: writing RNTuple requires ROOT built with the root7 option");
+#endif
+   } else if (!ROOT::IsImplicitMTEnabled()) {
       // single-thread snapshot
       using Helper_t = SnapshotHelper<ColTypes...>;
       using Action_t = RAction<Helper_t, PrevNodeType>;
@@ -328,6 +356,24 @@ void CheckForNoVariations(const std::string &where, std::string_view definedColV
 
 std::string PrettyPrintAddr(const void *const addr);
 
+/// Return a key that identifies the values computed by a jitted Define or Filter, for the merging of equivalent nodes:
+/// the jitted function, the resolved input columns and, for Filters, the previous node. Return an empty string if the
+/// function is null.
+std::string GetJittedNodeKey(const void *function, const ColumnNames_t &columns, const RColumnRegister &colRegister,
+                             const RNodeBase *prevNode);
+
+/// Return the address of the function passed to the jitted helpers, or null if the callable is not a function
+template <typename F>
+const void *GetJittedFunctionAddress(F &f)
+{
+   if constexpr (std::is_function<F>::value) {
+      return reinterpret_cast<const void *>(&f);
+   } else {
+      (void)f;
+      return nullptr;
+   }
+}
+
 std::shared_ptr<RJittedFilter> BookFilterJit(std::shared_ptr<RNodeBase> *prevNodeOnHeap, std::string_view name,
                                              std::string_view expression, const ColumnNames_t &branches,
                                              const RColumnRegister &colRegister, TTree *tree, RDataSource *ds);
@@ -450,6 +496,19 @@ void JitFilterHelper(F &&f, const char **colsPtr, std::size_t colsSize, std::str
    CheckFilter(f);
 
    auto &lm = *jittedFilter->GetLoopManagerUnchecked(); // RLoopManager must exist at this time
+
+   // with graph optimization enabled, unnamed filters are merged into an equivalent filter booked before, if any
+   if (lm.IsGraphOptimizationEnabled() && name.empty() && jittedFilter->GetVariations().empty()) {
+      const auto key = GetJittedNodeKey(GetJittedFunctionAddress(f), cols, *colRegister, prevNodeOnHeap->get());
+      if (auto equivalentFilter = lm.MergeJittedFilter(key, jittedFilter)) {
+         jittedFilter->SetEquivalentFilter(std::move(equivalentFilter));
+         delete colRegister;
+         delete prevNodeOnHeap;
+         delete wkJittedFilter;
+         return;
+      }
+   }
+
    auto ds = lm.GetDataSource();
 
    if (ds != nullptr)
@@ -515,6 +574,18 @@ void JitDefineHelper(F &&f, const char **colsPtr, std::size_t colsSize, std::str
    using Callable_t = std::decay_t<F>;
    using ColTypes_t = typename TTraits::CallableTraits<Callable_t>::arg_types;
 
+   // with graph optimization enabled, defines are merged into an equivalent define booked before, if any
+   if constexpr (std::is_same<RDefineTypeTag, DefineTypes::RDefineTag>::value) {
+      if (lm->IsGraphOptimizationEnabled() && jittedDefine->GetVariations().empty()) {
+         const auto key = GetJittedNodeKey(GetJittedFunctionAddress(f), cols, *colRegister, nullptr);
+         if (auto equivalentDefine = lm->MergeJittedDefine(key, jittedDefine)) {
+            jittedDefine->SetEquivalentDefine(std::move(equivalentDefine));
+            doDeletes();
+            return;
+         }
+      }
+   }
+
    auto ds = lm->GetDataSource();
    if (ds != nullptr)
       AddDSColumns(cols, *lm, *ds, ColTypes_t(), *colRegister);
@@ -762,6 +833,11 @@ struct IsDeque_t<std::deque<T>> : std::true_type {};
 
 void CheckForDuplicateSnapshotColumns(const ColumnNames_t &cols);
 
+/// Returns the data frame that reads the RNTuple written by a Snapshot.  As for TTree output, the file is only opened
+/// once the data frame is used, i.e. after the Snapshot has run.
+std::shared_ptr<ROOT::RDataFrame> MakeSnapshotRNTupleDataFrame(const std::string &ntupleName,
+                                                               const std::string &fileName);
+
 template <typename T>
 struct InnerValueType {
    using type = T; // fallback for when T is not a nested RVec
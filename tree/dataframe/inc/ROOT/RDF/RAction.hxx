@@ -17,12 +17,14 @@
 #include "ROOT/RDF/RColumnReaderBase.hxx"
 #include "ROOT/RDF/Utils.hxx" // ColumnNames_t, IsInternalColumn
 #include "ROOT/RDF/RLoopManager.hxx"
+#include "ROOT/RDF/RMaskedEntryRange.hxx"
 #include "ROOT/RDF/RVariedAction.hxx"
 
 #include <array>
 #include <cstddef> // std::size_t
 #include <memory>
 #include <string>
+#include <tuple>
 #include <vector>
 
 namespace ROOT {
@@ -105,6 +107,8 @@ public:
       (void)entry; // avoid unused parameter warning (gcc 12.1)
    }
 
+   std::string GetActionName() final { return fHelper.GetActionName(); }
+
    void Run(unsigned int slot, Long64_t entry) final
    {
       // check if entry passes all filters
@@ -112,6 +116,26 @@ public:
          CallExec(slot, entry, ColumnTypes_t{}, TypeInd_t{});
    }
 
+   /// Call the helper's Exec for the entries selected by the mask, without further virtual calls
+   template <typename... ColTypes, std::size_t... S>
+   void CallExecBulk(unsigned int slot, const RMaskedEntryRange &mask, TypeList<ColTypes...>, std::index_sequence<S...>)
+   {
+      const auto values = std::make_tuple(fValues[slot][S]->template GetBulk<ColTypes>(mask)...);
+      const auto size = mask.Size();
+      for (std::size_t i = 0; i < size; ++i) {
+         if (mask[i])
+            fHelper.Exec(slot, std::get<S>(values)[i]...);
+      }
+      (void)values; // avoid unused variable warning in case of no input columns
+   }
+
+   void RunBulk(unsigned int slot, const RMaskedEntryRange &bulk) final
+   {
+      const auto &mask = fPrevNode.CheckFiltersBulk(slot, bulk);
+      if (mask.Any())
+         CallExecBulk(slot, mask, ColumnTypes_t{}, TypeInd_t{});
+   }
+
    void TriggerChildrenCount() final { fPrevNode.IncrChildrenCount(); }
 
    /// Clean-up operations to be performed at the end of a task.
@@ -181,6 +205,8 @@ public:
 
 private:
    ROOT::RDF::SampleCallback_t GetSampleCallback() final { return fHelper.GetSampleCallback(); }
+
+   bool NeedsEventLoop() const final { return fHelper.NeedsEventLoop(); }
 };
 
 } // namespace RDF
@@ -35,6 +35,9 @@ namespace GraphDrawing {
 class GraphNode;
 }
 
+class RMaskedEntryRange;
+class RNodeProfile;
+
 using namespace ROOT::Detail::RDF;
 
 class RActionBase {
@@ -51,6 +54,8 @@ private:
    std::vector<std::string> fVariations;
 
    RColumnRegister fColRegister;
+   /// The profile of this node, null unless profiling is enabled
+   RNodeProfile *fProfile = nullptr;
 
 public:
    RActionBase(RLoopManager *lm, const ColumnNames_t &colNames, const RColumnRegister &colRegister,
@@ -63,7 +68,12 @@ public:
    RColumnRegister &GetColRegister() { return fColRegister; }
    RLoopManager *GetLoopManager() { return fLoopManager; }
    unsigned int GetNSlots() const { return fNSlots; }
+   RNodeProfile *GetProfile() const { return fProfile; }
+   void SetProfile(RNodeProfile *profile) { fProfile = profile; }
+   virtual std::string GetActionName() = 0;
    virtual void Run(unsigned int slot, Long64_t entry) = 0;
+   /// Bulk counterpart of Run: process the entries of the bulk that pass all the filters upstream
+   virtual void RunBulk(unsigned int slot, const RMaskedEntryRange &bulk) = 0;
    virtual void Initialize() = 0;
    virtual void InitSlot(TTreeReader *r, unsigned int slot) = 0;
    virtual void TriggerChildrenCount() = 0;
@@ -88,6 +98,9 @@ public:
 
    virtual ROOT::RDF::SampleCallback_t GetSampleCallback() = 0;
 
+   /// Whether the action processes the entries of the dataset, see RActionImpl::NeedsEventLoop()
+   virtual bool NeedsEventLoop() const = 0;
+
    const std::vector<std::string> &GetVariations() const { return fVariations; }
 
    virtual std::unique_ptr<RActionBase> MakeVariedAction(std::vector<void *> &&results) = 0;
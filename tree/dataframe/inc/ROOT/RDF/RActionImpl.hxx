@@ -71,6 +71,10 @@ public:
    /// Override this method to register a callback that is executed before the processing a new data sample starts.
    /// The callback will be invoked in the same conditions as with DefinePerSample().
    virtual ROOT::RDF::SampleCallback_t GetSampleCallback() { return {}; }
+
+   /// Override this method to return false if the action computes its result without processing any entry, e.g. from
+   /// the metadata of the dataset.  The event loop is skipped if none of the booked actions needs it.
+   virtual bool NeedsEventLoop() const { return true; }
 };
 
 } // namespace RDF
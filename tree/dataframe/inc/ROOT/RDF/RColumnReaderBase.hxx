@@ -13,7 +13,17 @@
 
 #include <Rtypes.h>
 
+#include <cstddef>
+#include <limits>
+
 namespace ROOT {
+namespace Internal {
+namespace RDF {
+class RMaskedEntryRange;
+class RProfiledColumnReader;
+}
+} // namespace Internal
+
 namespace Detail {
 namespace RDF {
 
@@ -26,7 +36,16 @@ This pure virtual class provides a common base class for the different column re
 RDSColumnReader.
 **/
 class R__CLING_PTRCHECK(off) RColumnReaderBase {
+   friend class ROOT::Internal::RDF::RProfiledColumnReader;
+
 public:
+   /// How the reader provides the values of a bulk of entries in bulk processing mode
+   enum class EBulkMode {
+      kNone,        ///< The reader does not support bulk processing
+      kLoadEntries, ///< The event loop copies the value of every entry of the bulk with LoadBulkEntry()
+      kRandomAccess ///< The reader reads the values of any range of up to GetMaxBulkSize() entries by itself
+   };
+
    virtual ~RColumnReaderBase() = default;
 
    /// Return the column value for the given entry.
@@ -38,8 +57,30 @@ public:
       return *static_cast<T *>(GetImpl(entry));
    }
 
+   /// Return the column values for the entries of a bulk: the i-th element of the returned array is the value of the
+   /// i-th entry of the bulk. Only the values of the entries selected by the mask are guaranteed to be valid.
+   /// \tparam T The column type
+   /// \param mask The range of entries of the bulk and the mask of the requested entries
+   template <typename T>
+   T *GetBulk(const ROOT::Internal::RDF::RMaskedEntryRange &mask)
+   {
+      return static_cast<T *>(GetBulkImpl(mask));
+   }
+
+   virtual EBulkMode GetBulkMode() const { return EBulkMode::kNone; }
+
+   /// Copy the value of the given entry, which the input is currently positioned on, into the idx-th element of the
+   /// bulk. Only called for readers in kLoadEntries mode.
+   void LoadBulkEntry(std::size_t idx, Long64_t entry) { LoadBulkEntryImpl(idx, entry); }
+
+   /// Return the maximum number of entries starting at the given entry that the reader can read as a single bulk.
+   /// Only called for readers in kRandomAccess mode.
+   virtual std::size_t GetMaxBulkSize(Long64_t /* firstEntry */) { return std::numeric_limits<std::size_t>::max(); }
+
 private:
    virtual void *GetImpl(Long64_t entry) = 0;
+   virtual void *GetBulkImpl(const ROOT::Internal::RDF::RMaskedEntryRange & /* mask */) { return nullptr; }
+   virtual void LoadBulkEntryImpl(std::size_t /* idx */, Long64_t /* entry */) {}
 };
 
 } // namespace RDF
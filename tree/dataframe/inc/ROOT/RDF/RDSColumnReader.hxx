@@ -12,8 +12,11 @@
 #define ROOT_RDF_RDSCOLUMNREADER
 
 #include "RColumnReaderBase.hxx"
+#include "RMaskedEntryRange.hxx"
 #include <Rtypes.h>  // Long64_t, R__CLING_PTRCHECK
 
+#include <cstddef>
+
 namespace ROOT {
 namespace Internal {
 namespace RDF {
@@ -22,11 +25,20 @@ namespace RDF {
 template <typename T>
 class R__CLING_PTRCHECK(off) RDSColumnReader final : public ROOT::Detail::RDF::RColumnReaderBase {
    T **fDSValuePtr = nullptr;
+   /// The values of the current bulk in bulk processing mode
+   RBulkValues<T> fBulkValues;
 
    void *GetImpl(Long64_t) final { return *fDSValuePtr; }
+   void *GetBulkImpl(const RMaskedEntryRange &) final { return fBulkValues.Data(); }
+   void LoadBulkEntryImpl(std::size_t idx, Long64_t) final { fBulkValues.Set(idx, **fDSValuePtr); }
 
 public:
    RDSColumnReader(void *DSValuePtr) : fDSValuePtr(static_cast<T **>(DSValuePtr)) {}
+
+   EBulkMode GetBulkMode() const final
+   {
+      return RBulkValues<T>::kIsSupported ? EBulkMode::kLoadEntries : EBulkMode::kNone;
+   }
 };
 
 } // namespace RDF
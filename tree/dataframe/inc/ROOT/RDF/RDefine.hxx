@@ -15,13 +15,18 @@
 #include "ROOT/RDF/RColumnReaderBase.hxx"
 #include "ROOT/RDF/RDefineBase.hxx"
 #include "ROOT/RDF/RLoopManager.hxx"
+#include "ROOT/RDF/RLoopProfiler.hxx"
+#include "ROOT/RDF/RMaskedEntryRange.hxx"
 #include "ROOT/RDF/Utils.hxx"
 #include "ROOT/RStringView.hxx"
+#include "ROOT/RVec.hxx"
 #include "ROOT/TypeTraits.hxx"
 #include "RtypesCore.h"
 
 #include <array>
+#include <cstddef>
 #include <deque>
+#include <tuple>
 #include <type_traits>
 #include <utility> // std::index_sequence
 #include <vector>
@@ -62,6 +67,12 @@ class R__CLING_PTRCHECK(off) RDefine final : public RDefineBase {
 
    F fExpression;
    ValuesPerSlot_t fLastResults;
+   /// Values of the current bulk per slot, used in bulk processing mode
+   std::vector<ROOT::RVec<ret_type>> fBulkResults;
+   /// Per slot, the entries of the current bulk whose value has already been computed
+   std::vector<RDFInternal::RMaskedEntryRange> fBulkComputed;
+   /// Per slot, the entries of the current bulk whose value is computed by the ongoing UpdateBulk() call
+   std::vector<RDFInternal::RMaskedEntryRange> fBulkRequested;
 
    /// Column readers per slot and per input column
    std::vector<std::array<RColumnReaderBase *, ColumnTypes_t::list_size>> fValues;
@@ -94,12 +105,37 @@ class R__CLING_PTRCHECK(off) RDefine final : public RDefineBase {
          fExpression(slot, entry, fValues[slot][S]->template Get<ColTypes>(entry)...);
    }
 
+   /// Evaluate the expression for the entries of the bulk selected by the mask, without further virtual calls
+   template <typename... ColTypes, std::size_t... S>
+   void UpdateBulkHelper(unsigned int slot, const RDFInternal::RMaskedEntryRange &mask, TypeList<ColTypes...>,
+                         std::index_sequence<S...>)
+   {
+      auto &results = fBulkResults[slot];
+      auto &computed = fBulkComputed[slot];
+      const auto values = std::make_tuple(fValues[slot][S]->template GetBulk<ColTypes>(mask)...);
+      const auto size = mask.Size();
+      for (std::size_t i = 0; i < size; ++i) {
+         if (!mask[i])
+            continue;
+         if constexpr (std::is_same<ExtraArgsTag, SlotAndEntryTag>::value) {
+            results[i] = fExpression(slot, mask.FirstEntry() + Long64_t(i), std::get<S>(values)[i]...);
+         } else if constexpr (std::is_same<ExtraArgsTag, SlotTag>::value) {
+            results[i] = fExpression(slot, std::get<S>(values)[i]...);
+         } else {
+            results[i] = fExpression(std::get<S>(values)[i]...);
+         }
+         computed[i] = true;
+      }
+      (void)values; // avoid unused variable warning in case of no input columns
+   }
+
 public:
    RDefine(std::string_view name, std::string_view type, F expression, const ROOT::RDF::ColumnNames_t &columns,
            const RDFInternal::RColumnRegister &colRegister, RLoopManager &lm,
            const std::string &variationName = "nominal")
       : RDefineBase(name, type, colRegister, lm, columns, variationName), fExpression(std::move(expression)),
-        fLastResults(lm.GetNSlots() * RDFInternal::CacheLineStep<ret_type>()), fValues(lm.GetNSlots())
+        fLastResults(lm.GetNSlots() * RDFInternal::CacheLineStep<ret_type>()), fBulkResults(lm.GetNSlots()),
+        fBulkComputed(lm.GetNSlots()), fBulkRequested(lm.GetNSlots()), fValues(lm.GetNSlots())
    {
       fLoopManager->Register(this);
    }
@@ -113,6 +149,7 @@ public:
       RDFInternal::RColumnReadersInfo info{fColumnNames, fColRegister, fIsDefine.data(), *fLoopManager};
       fValues[slot] = RDFInternal::GetColumnReaders(slot, r, ColumnTypes_t{}, info, fVariation);
       fLastCheckedEntry[slot * RDFInternal::CacheLineStep<Long64_t>()] = -1;
+      fBulkComputed[slot].Invalidate();
    }
 
    /// Return the (type-erased) address of the Define'd value for the given processing slot.
@@ -126,6 +163,7 @@ public:
    {
       if (entry != fLastCheckedEntry[slot * RDFInternal::CacheLineStep<Long64_t>()]) {
          // evaluate this define expression, cache the result
+         RDFInternal::RNodeTimer timer(fProfile, slot);
          UpdateHelper(slot, entry, ColumnTypes_t{}, TypeInd_t{}, ExtraArgsTag{});
          fLastCheckedEntry[slot * RDFInternal::CacheLineStep<Long64_t>()] = entry;
       }
@@ -133,6 +171,42 @@ public:
 
    void Update(unsigned int /*slot*/, const ROOT::RDF::RSampleInfo &/*id*/) final {}
 
+   /// Return the (type-erased) address of the array of Define'd values of the current bulk for the given slot.
+   void *GetBulkValuePtr(unsigned int slot) final { return static_cast<void *>(fBulkResults[slot].data()); }
+
+   bool IsBulkSupported() const final { return RDFInternal::RBulkValues<ret_type>::kIsSupported; }
+
+   /// Compute the values of the entries selected by the mask that have not yet been computed for the current bulk
+   void UpdateBulk(unsigned int slot, const RDFInternal::RMaskedEntryRange &mask) final
+   {
+      if constexpr (RDFInternal::RBulkValues<ret_type>::kIsSupported) {
+         auto &computed = fBulkComputed[slot];
+         const auto size = mask.Size();
+         if (mask.FirstEntry() != computed.FirstEntry()) {
+            // a new bulk: nothing has been computed yet
+            computed.Reset(mask.FirstEntry(), size, /*selected=*/false);
+            if (fBulkResults[slot].size() < size)
+               fBulkResults[slot].resize(size);
+         }
+
+         auto &requested = fBulkRequested[slot];
+         requested.Reset(mask.FirstEntry(), size, /*selected=*/false);
+         bool anyRequested = false;
+         for (std::size_t i = 0; i < size; ++i) {
+            requested[i] = mask[i] && !computed[i];
+            anyRequested = anyRequested || requested[i];
+         }
+         if (anyRequested) {
+            RDFInternal::RNodeTimer timer(fProfile, slot);
+            UpdateBulkHelper(slot, requested, ColumnTypes_t{}, TypeInd_t{});
+         }
+      } else {
+         (void)slot;
+         (void)mask;
+         R__ASSERT(false && "UpdateBulk was called for a Define that does not support bulk processing.");
+      }
+   }
+
    const std::type_info &GetTypeId() const final { return typeid(ret_type); }
 
    /// Clean-up operations to be performed at the end of a task.
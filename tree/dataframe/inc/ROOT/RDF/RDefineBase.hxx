@@ -13,6 +13,7 @@
 
 #include "ROOT/RDF/GraphNode.hxx"
 #include "ROOT/RDF/RColumnRegister.hxx"
+#include "ROOT/RDF/RMaskedEntryRange.hxx"
 #include "ROOT/RDF/RSampleInfo.hxx"
 #include "ROOT/RDF/Utils.hxx"
 #include "ROOT/RVec.hxx"
@@ -29,6 +30,11 @@ namespace ROOT {
 namespace RDF {
 class RDataSource;
 }
+namespace Internal {
+namespace RDF {
+class RNodeProfile;
+}
+} // namespace Internal
 namespace Detail {
 namespace RDF {
 
@@ -48,6 +54,8 @@ protected:
    ROOT::RVecB fIsDefine;
    std::vector<std::string> fVariationDeps; ///< List of systematic variations that affect the value of this define.
    std::string fVariation;                  ///< This indicates for what variation this define evaluates values.
+   /// The profile of this node, null unless profiling is enabled
+   RDFInternal::RNodeProfile *fProfile = nullptr;
 
 public:
    RDefineBase(std::string_view name, std::string_view type, const RDFInternal::RColumnRegister &colRegister,
@@ -62,10 +70,19 @@ public:
    virtual const std::type_info &GetTypeId() const = 0;
    std::string GetName() const;
    std::string GetTypeName() const;
+   const ROOT::RDF::ColumnNames_t &GetColumnNames() const { return fColumnNames; }
+   const RDFInternal::RColumnRegister &GetColRegister() const { return fColRegister; }
    /// Update the value at the address returned by GetValuePtr with the content corresponding to the given entry
    virtual void Update(unsigned int slot, Long64_t entry) = 0;
    /// Update function to be called once per sample, used if the derived type is a RDefinePerSample
    virtual void Update(unsigned int /*slot*/, const ROOT::RDF::RSampleInfo &/*id*/) {}
+   /// Return the (type-erased) address of the array of Define'd values of the current bulk for the given processing
+   /// slot.
+   virtual void *GetBulkValuePtr(unsigned int slot) = 0;
+   /// Update the array at the address returned by GetBulkValuePtr with the values of the entries selected by the mask
+   virtual void UpdateBulk(unsigned int slot, const RDFInternal::RMaskedEntryRange &mask) = 0;
+   /// Return false if the values of this Define cannot be stored in bulks, e.g. because their type is not copyable
+   virtual bool IsBulkSupported() const = 0;
    /// Clean-up operations to be performed at the end of a task.
    virtual void FinalizeSlot(unsigned int slot) = 0;
 
@@ -76,6 +93,8 @@ public:
 
    /// Return a clone of this Define that works with values in the variationName "universe".
    virtual RDefineBase &GetVariedDefine(const std::string &variationName) = 0;
+
+   void SetProfile(RDFInternal::RNodeProfile *profile) { fProfile = profile; }
 };
 
 } // ns RDF
@@ -15,9 +15,12 @@
 #include "ROOT/RDF/RSampleInfo.hxx"
 #include "ROOT/RDF/Utils.hxx"
 #include <ROOT/RDF/RDefineBase.hxx>
+#include <ROOT/RDF/RMaskedEntryRange.hxx>
+#include <ROOT/RVec.hxx>
 #include <ROOT/TypeTraits.hxx>
 
 #include <deque>
+#include <type_traits>
 #include <vector>
 
 namespace ROOT {
@@ -36,11 +39,14 @@ class R__CLING_PTRCHECK(off) RDefinePerSample final : public RDefineBase {
 
    F fExpression;
    ValuesPerSlot_t fLastResults;
+   /// Per slot, the value of the current sample repeated for every entry of the current bulk
+   std::vector<ROOT::RVec<RetType_t>> fBulkResults;
 
 public:
    RDefinePerSample(std::string_view name, std::string_view type, F expression, RLoopManager &lm)
       : RDefineBase(name, type, RDFInternal::RColumnRegister{nullptr}, lm, /*columnNames*/ {}),
-        fExpression(std::move(expression)), fLastResults(lm.GetNSlots() * RDFInternal::CacheLineStep<RetType_t>())
+        fExpression(std::move(expression)), fLastResults(lm.GetNSlots() * RDFInternal::CacheLineStep<RetType_t>()),
+        fBulkResults(lm.GetNSlots())
    {
       fLoopManager->Register(this);
       auto callUpdate = [this](unsigned int slot, const ROOT::RDF::RSampleInfo &id) { this->Update(slot, id); };
@@ -69,6 +75,22 @@ public:
       fLastResults[slot * RDFInternal::CacheLineStep<RetType_t>()] = fExpression(slot, id);
    }
 
+   void *GetBulkValuePtr(unsigned int slot) final { return static_cast<void *>(fBulkResults[slot].data()); }
+
+   bool IsBulkSupported() const final { return std::is_copy_constructible<RetType_t>::value; }
+
+   /// Bulks never span more than one sample, so all the entries of the bulk get the value of the current sample
+   void UpdateBulk(unsigned int slot, const RDFInternal::RMaskedEntryRange &mask) final
+   {
+      if constexpr (std::is_copy_constructible<RetType_t>::value) {
+         fBulkResults[slot].assign(mask.Size(), fLastResults[slot * RDFInternal::CacheLineStep<RetType_t>()]);
+      } else {
+         (void)slot;
+         (void)mask;
+         R__ASSERT(false && "UpdateBulk was called for a Define that does not support bulk processing.");
+      }
+   }
+
    const std::type_info &GetTypeId() const final { return typeid(RetType_t); }
 
    void InitSlot(TTreeReader *, unsigned int) final {}
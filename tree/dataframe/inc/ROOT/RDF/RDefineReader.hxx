@@ -13,6 +13,7 @@
 
 #include "RColumnReaderBase.hxx"
 #include "RDefineBase.hxx"
+#include "RMaskedEntryRange.hxx"
 #include <Rtypes.h>  // Long64_t, R__CLING_PTRCHECK
 
 #include <limits>
@@ -41,6 +42,13 @@ class R__CLING_PTRCHECK(off) RDefineReader final : public ROOT::Detail::RDF::RCo
       return fValuePtr;
    }
 
+   void *GetBulkImpl(const RMaskedEntryRange &mask) final
+   {
+      fDefine.UpdateBulk(fSlot, mask);
+      // the array may be reallocated when the bulk size grows, so its address is not cached
+      return fDefine.GetBulkValuePtr(fSlot);
+   }
+
 public:
    RDefineReader(unsigned int slot, RDFDetail::RDefineBase &define)
       : fDefine(define), fValuePtr(define.GetValuePtr(slot)), fSlot(slot)
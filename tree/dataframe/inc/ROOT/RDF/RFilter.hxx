@@ -17,13 +17,16 @@
 #include "ROOT/RDF/Utils.hxx"
 #include "ROOT/RDF/RFilterBase.hxx"
 #include "ROOT/RDF/RLoopManager.hxx"
+#include "ROOT/RDF/RLoopProfiler.hxx"
 #include "ROOT/TypeTraits.hxx"
 #include "RtypesCore.h"
 
 #include <algorithm>
 #include <cassert>
+#include <cstddef>
 #include <memory>
 #include <string>
+#include <tuple>
 #include <unordered_map>
 #include <utility> // std::index_sequence
 #include <vector>
@@ -96,6 +99,7 @@ public:
             fLastResult[slot * RDFInternal::CacheLineStep<int>()] = false;
          } else {
             // evaluate this filter, cache the result
+            RDFInternal::RNodeTimer timer(fProfile, slot);
             auto passed = CheckFilterHelper(slot, entry, ColumnTypes_t{}, TypeInd_t{});
             passed ? ++fAccepted[slot * RDFInternal::CacheLineStep<ULong64_t>()]
                    : ++fRejected[slot * RDFInternal::CacheLineStep<ULong64_t>()];
@@ -106,6 +110,14 @@ public:
       return fLastResult[slot * RDFInternal::CacheLineStep<int>()];
    }
 
+   bool CheckPredicate(unsigned int slot, Long64_t entry) final
+   {
+      RDFInternal::RNodeTimer timer(fProfile, slot);
+      return CheckFilterHelper(slot, entry, ColumnTypes_t{}, TypeInd_t{});
+   }
+
+   RNodeBase *GetPrevNode() const final { return fPrevNodePtr.get(); }
+
    template <typename... ColTypes, std::size_t... S>
    bool CheckFilterHelper(unsigned int slot, Long64_t entry, TypeList<ColTypes...>, std::index_sequence<S...>)
    {
@@ -115,11 +127,48 @@ public:
       (void)entry;
    }
 
+   const RDFInternal::RMaskedEntryRange &
+   CheckFiltersBulk(unsigned int slot, const RDFInternal::RMaskedEntryRange &bulk) final
+   {
+      auto &result = fLastBulkResult[slot];
+      if (bulk.FirstEntry() != result.FirstEntry()) {
+         // start from the entries that passed the filters upstream and evaluate this filter for them
+         result = fPrevNode.CheckFiltersBulk(slot, bulk);
+         if (result.Any()) {
+            RDFInternal::RNodeTimer timer(fProfile, slot);
+            CheckFilterBulkHelper(slot, result, ColumnTypes_t{}, TypeInd_t{});
+         }
+      }
+      return result;
+   }
+
+   /// Evaluate the filter for the entries selected by the mask and deselect the entries that do not pass it
+   template <typename... ColTypes, std::size_t... S>
+   void CheckFilterBulkHelper(unsigned int slot, RDFInternal::RMaskedEntryRange &mask, TypeList<ColTypes...>,
+                              std::index_sequence<S...>)
+   {
+      const auto values = std::make_tuple(fValues[slot][S]->template GetBulk<ColTypes>(mask)...);
+      ULong64_t nAccepted = 0;
+      ULong64_t nRejected = 0;
+      const auto size = mask.Size();
+      for (std::size_t i = 0; i < size; ++i) {
+         if (!mask[i])
+            continue;
+         const bool passed = fFilter(std::get<S>(values)[i]...);
+         mask[i] = passed;
+         passed ? ++nAccepted : ++nRejected;
+      }
+      fAccepted[slot * RDFInternal::CacheLineStep<ULong64_t>()] += nAccepted;
+      fRejected[slot * RDFInternal::CacheLineStep<ULong64_t>()] += nRejected;
+      (void)values; // avoid unused variable warning in case of no input columns
+   }
+
    void InitSlot(TTreeReader *r, unsigned int slot) final
    {
       RDFInternal::RColumnReadersInfo info{fColumnNames, fColRegister, fIsDefine.data(), *fLoopManager};
       fValues[slot] = RDFInternal::GetColumnReaders(slot, r, ColumnTypes_t{}, info, fVariation);
       fLastCheckedEntry[slot * RDFInternal::CacheLineStep<Long64_t>()] = -1;
+      fLastBulkResult[slot].Invalidate();
    }
 
    // recursive chain of `Report`s
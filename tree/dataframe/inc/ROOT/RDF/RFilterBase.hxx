@@ -12,6 +12,7 @@
 #define ROOT_RFILTERBASE
 
 #include "ROOT/RDF/RColumnRegister.hxx"
+#include "ROOT/RDF/RMaskedEntryRange.hxx"
 #include "ROOT/RDF/RNodeBase.hxx"
 #include "ROOT/RDF/Utils.hxx" // ColumnNames_t
 #include "ROOT/RVec.hxx"
@@ -29,6 +30,12 @@ namespace RDF {
 class RCutFlowReport;
 } // ns RDF
 
+namespace Internal {
+namespace RDF {
+class RNodeProfile;
+} // ns RDF
+} // ns Internal
+
 namespace Detail {
 namespace RDF {
 namespace RDFInternal = ROOT::Internal::RDF;
@@ -41,6 +48,8 @@ protected:
    std::vector<int> fLastResult = {true}; // std::vector<bool> cannot be used in a MT context safely
    std::vector<ULong64_t> fAccepted = {0};
    std::vector<ULong64_t> fRejected = {0};
+   /// Per slot, the entries of the last processed bulk that passed this filter (bulk processing mode)
+   std::vector<RDFInternal::RMaskedEntryRange> fLastBulkResult;
    const std::string fName;
    const ROOT::RDF::ColumnNames_t fColumnNames;
    RDFInternal::RColumnRegister fColRegister;
@@ -48,6 +57,8 @@ protected:
    ROOT::RVecB fIsDefine;
    std::string fVariation; ///< This indicates for what variation this filter evaluates values.
    std::unordered_map<std::string, std::shared_ptr<RFilterBase>> fVariedFilters;
+   /// The profile of this node, null unless profiling is enabled
+   RDFInternal::RNodeProfile *fProfile = nullptr;
 
 public:
    RFilterBase(RLoopManager *df, std::string_view name, const unsigned int nSlots,
@@ -58,8 +69,15 @@ public:
    ~RFilterBase() override;
 
    virtual void InitSlot(TTreeReader *r, unsigned int slot) = 0;
+   /// Evaluate the expression of this filter alone for the given entry, without checking the filters upstream and
+   /// without updating the filter statistics
+   virtual bool CheckPredicate(unsigned int slot, Long64_t entry) = 0;
+   /// The node upstream of this filter
+   virtual RNodeBase *GetPrevNode() const = 0;
    bool HasName() const;
    std::string GetName() const;
+   const ColumnNames_t &GetColumnNames() const { return fColumnNames; }
+   const RDFInternal::RColumnRegister &GetColRegister() const { return fColRegister; }
    virtual void FillReport(ROOT::RDF::RCutFlowReport &) const;
    virtual void TriggerChildrenCount() = 0;
    virtual void ResetReportCount()
@@ -72,6 +90,7 @@ public:
    /// Clean-up operations to be performed at the end of a task.
    virtual void FinalizeSlot(unsigned int slot) = 0;
    virtual void InitNode();
+   void SetProfile(RDFInternal::RNodeProfile *profile) { fProfile = profile; }
 };
 
 } // ns RDF
@@ -0,0 +1,79 @@
+/*************************************************************************
+ * Copyright (C) 1995-2024, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RDF_RFILTERCHAIN
+#define ROOT_RDF_RFILTERCHAIN
+
+#include "RtypesCore.h"
+
+#include <cstddef>
+#include <vector>
+
+namespace ROOT {
+namespace Detail {
+namespace RDF {
+class RFilterBase;
+class RNodeBase;
+} // namespace RDF
+} // namespace Detail
+
+namespace Internal {
+namespace RDF {
+
+/**
+\class ROOT::Internal::RDF::RFilterChain
+\ingroup dataframe
+\brief Evaluates a chain of filters in the order of their measured selectivity and cost.
+
+A chain is a sequence of unnamed jitted filters in which every filter but the last one is the only child of the
+previous one. The last filter of the chain passes an entry if the filters upstream of the chain and the expressions of
+all the filters of the chain pass it, so the expressions can be evaluated in any order, as long as none of them relies
+on another one having passed (e.g. `v.size() > 0` followed by `v[0] > 1`).
+
+For each processing slot, the chain evaluates all the expressions for the first kNWarmUpEntries entries that pass the
+filters upstream, measuring the fraction of entries that pass each expression and the time spent evaluating it.
+Afterwards, the expressions are evaluated in ascending order of cost / (1 - pass fraction), stopping at the first one
+that rejects the entry.
+**/
+class RFilterChain {
+public:
+   /// The number of entries per slot for which the selectivity and the cost of the filters are measured
+   static constexpr ULong64_t kNWarmUpEntries = 1000;
+
+private:
+   struct RSlotStats {
+      ULong64_t fNEntries = 0;
+      std::vector<ULong64_t> fNPassed;
+      std::vector<double> fTime;
+      /// The order of evaluation of the filters, empty during the warm-up
+      std::vector<std::size_t> fOrder;
+   };
+
+   /// The node upstream of the first filter of the chain
+   ROOT::Detail::RDF::RNodeBase &fPrevNode;
+   /// The filters of the chain, from the first to the last one
+   std::vector<ROOT::Detail::RDF::RFilterBase *> fFilters;
+   std::vector<Long64_t> fLastCheckedEntry;
+   std::vector<int> fLastResult; // std::vector<bool> cannot be used in a MT context safely
+   std::vector<RSlotStats> fSlotStats;
+
+   void SetOrder(RSlotStats &stats) const;
+
+public:
+   RFilterChain(ROOT::Detail::RDF::RNodeBase &prevNode, const std::vector<ROOT::Detail::RDF::RFilterBase *> &filters,
+                unsigned int nSlots);
+
+   /// Return whether the entry passes the filters upstream of the chain and all the filters of the chain
+   bool CheckFilters(unsigned int slot, Long64_t entry);
+};
+
+} // namespace RDF
+} // namespace Internal
+} // namespace ROOT
+
+#endif
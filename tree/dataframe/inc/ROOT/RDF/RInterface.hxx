@@ -81,6 +81,14 @@ template <typename Proxied, typename DataSource>
 class RInterface;
 
 using RNode = RInterface<::ROOT::Detail::RDF::RNodeBase, void>;
+
+namespace Experimental {
+void SetBulkSize(ROOT::RDF::RNode node, std::size_t bulkSize);
+void EnableGraphOptimization(ROOT::RDF::RNode node, bool reorderFilters);
+void AllowFilterReordering(ROOT::RDF::RNode filter);
+void EnableProfiling(ROOT::RDF::RNode node);
+RProfileReport GetProfileReport(ROOT::RDF::RNode node);
+} // namespace Experimental
 } // namespace RDF
 
 namespace Internal {
@@ -121,6 +129,11 @@ class RInterface : public RInterfaceBase {
    friend void RDFInternal::TriggerRun(RNode node);
    friend void RDFInternal::ChangeEmptyEntryRange(const RNode &node, std::pair<ULong64_t, ULong64_t> &&newRange);
    friend void RDFInternal::ChangeSpec(const RNode &node, ROOT::RDF::Experimental::RDatasetSpec &&spec);
+   friend void ROOT::RDF::Experimental::SetBulkSize(RNode node, std::size_t bulkSize);
+   friend void ROOT::RDF::Experimental::EnableGraphOptimization(RNode node, bool reorderFilters);
+   friend void ROOT::RDF::Experimental::AllowFilterReordering(RNode filter);
+   friend void ROOT::RDF::Experimental::EnableProfiling(RNode node);
+   friend ROOT::RDF::Experimental::RProfileReport ROOT::RDF::Experimental::GetProfileReport(RNode node);
 
    std::shared_ptr<Proxied> fProxiedPtr; ///< Smart pointer to the graph node encapsulated by this RInterface.
 
@@ -1022,7 +1035,12 @@ public:
                                          colListWithAliasesAndSizeBranches, options});
 
       ::TDirectory::TContext ctxt;
-      auto newRDF = std::make_shared<ROOT::RDataFrame>(fullTreeName, filename, colListNoAliasesWithSizeBranches);
+      std::shared_ptr<ROOT::RDataFrame> newRDF;
+      if (options.fOutputFormat == ESnapshotOutputFormat::kRNTuple) {
+         newRDF = RDFInternal::MakeSnapshotRNTupleDataFrame(std::string(treename), std::string(filename));
+      } else {
+         newRDF = std::make_shared<ROOT::RDataFrame>(fullTreeName, filename, colListNoAliasesWithSizeBranches);
+      }
 
       auto resPtr = CreateAction<RDFInternal::ActionTags::Snapshot, RDFDetail::RInferredType>(
          colListNoAliasesWithSizeBranches, newRDF, snapHelperArgs, fProxiedPtr,
@@ -2849,8 +2867,13 @@ private:
          std::string(filename), std::string(dirname), std::string(treename), columnListWithoutSizeColumns, options});
 
       ::TDirectory::TContext ctxt;
-      auto newRDF =
-         std::make_shared<ROOT::RDataFrame>(fullTreeName, filename, /*defaultColumns=*/columnListWithoutSizeColumns);
+      std::shared_ptr<ROOT::RDataFrame> newRDF;
+      if (options.fOutputFormat == ESnapshotOutputFormat::kRNTuple) {
+         newRDF = RDFInternal::MakeSnapshotRNTupleDataFrame(std::string(treename), std::string(filename));
+      } else {
+         newRDF = std::make_shared<ROOT::RDataFrame>(fullTreeName, filename,
+                                                     /*defaultColumns=*/columnListWithoutSizeColumns);
+      }
 
       // The Snapshot helper will use validCols (with aliases resolved) as input columns, and
       // columnListWithoutSizeColumns (still with aliases in it, passed through snapHelperArgs) as output column names.
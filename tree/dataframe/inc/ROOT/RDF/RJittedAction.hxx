@@ -47,7 +47,9 @@ public:
 
    void SetAction(std::unique_ptr<RActionBase> a) { fConcreteAction = std::move(a); }
 
+   std::string GetActionName() final;
    void Run(unsigned int slot, Long64_t entry) final;
+   void RunBulk(unsigned int slot, const RMaskedEntryRange &bulk) final;
    void Initialize() final;
    void InitSlot(TTreeReader *r, unsigned int slot) final;
    void TriggerChildrenCount() final;
@@ -65,6 +67,8 @@ public:
 
    ROOT::RDF::SampleCallback_t GetSampleCallback() final;
 
+   bool NeedsEventLoop() const final;
+
    std::unique_ptr<RActionBase> MakeVariedAction(std::vector<void *> &&results) final;
    std::unique_ptr<ROOT::Internal::RDF::RActionBase> CloneAction(void *newResult) final;
 };
@@ -33,13 +33,18 @@ namespace RDF {
 /// RJittedDefine is a placeholder that is put in the collection of custom columns in place of a RDefine
 /// that will be just-in-time compiled. Jitted code will assign the concrete RDefine to this RJittedDefine
 /// before the event-loop starts.
+/// With graph optimization enabled, a RJittedDefine that computes the same values as one booked before gets no concrete
+/// RDefine and forwards all calls to the equivalent RJittedDefine instead.
 class RJittedDefine : public RDefineBase {
    std::unique_ptr<RDefineBase> fConcreteDefine = nullptr;
+   std::shared_ptr<RJittedDefine> fEquivalentDefine = nullptr;
    /// Type info obtained through TypeName2TypeID based on the column type name.
    /// The expectation is that this always compares equal to fConcreteDefine->GetTypeId() (which however is only
    /// available after jitting). It can be null if TypeName2TypeID failed to figure out this type.
    const std::type_info *fTypeId = nullptr;
 
+   RDefineBase &GetTarget() const;
+
 public:
    RJittedDefine(std::string_view name, std::string_view type, RLoopManager &lm,
                  const RDFInternal::RColumnRegister &colRegister, const ColumnNames_t &columns)
@@ -54,12 +59,17 @@ public:
    ~RJittedDefine();
 
    void SetDefine(std::unique_ptr<RDefineBase> c) { fConcreteDefine = std::move(c); }
+   void SetEquivalentDefine(std::shared_ptr<RJittedDefine> d) { fEquivalentDefine = std::move(d); }
+   RJittedDefine *GetEquivalentDefine() const { return fEquivalentDefine.get(); }
 
    void InitSlot(TTreeReader *r, unsigned int slot) final;
    void *GetValuePtr(unsigned int slot) final;
    const std::type_info &GetTypeId() const final;
    void Update(unsigned int slot, Long64_t entry) final;
    void Update(unsigned int slot, const ROOT::RDF::RSampleInfo &id) final;
+   void *GetBulkValuePtr(unsigned int slot) final;
+   void UpdateBulk(unsigned int slot, const RDFInternal::RMaskedEntryRange &mask) final;
+   bool IsBulkSupported() const final;
    void FinalizeSlot(unsigned int slot) final;
    void MakeVariations(const std::vector<std::string> &variations) final;
    RDefineBase &GetVariedDefine(const std::string &variationName) final;
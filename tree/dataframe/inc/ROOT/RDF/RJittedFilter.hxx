@@ -13,6 +13,7 @@
 
 #include "ROOT/RDF/GraphNode.hxx"
 #include "ROOT/RDF/RFilterBase.hxx"
+#include "ROOT/RDF/RFilterChain.hxx"
 #include "ROOT/RDF/RLoopManager.hxx"
 #include "ROOT/RStringView.hxx"
 #include "RtypesCore.h"
@@ -36,17 +37,36 @@ namespace RDFGraphDrawing = ROOT::Internal::RDF::GraphDrawing;
 /// A wrapper around a concrete RFilter, which forwards all calls to it
 /// RJittedFilter is the type of the node returned by jitted Filter calls: the concrete filter can be created and set
 /// at a later time, from jitted code.
+/// With graph optimization enabled, a RJittedFilter that is equivalent to one booked before gets no concrete filter
+/// and forwards all calls to the equivalent RJittedFilter instead.
 class RJittedFilter final : public RFilterBase {
    std::unique_ptr<RFilterBase> fConcreteFilter = nullptr;
+   std::shared_ptr<RJittedFilter> fEquivalentFilter = nullptr;
+   /// If set, the chain of filters ending with this one evaluates the filters in an optimized order
+   std::unique_ptr<RDFInternal::RFilterChain> fChain = nullptr;
+   /// Whether this filter may be evaluated before the filters it is chained to, see AllowFilterReordering()
+   bool fIsReorderable = false;
+
+   RFilterBase &GetTarget() const;
 
 public:
    RJittedFilter(RLoopManager *lm, std::string_view name, const std::vector<std::string> &variations);
    ~RJittedFilter();
 
    void SetFilter(std::unique_ptr<RFilterBase> f);
+   void SetEquivalentFilter(std::shared_ptr<RJittedFilter> f);
+   RJittedFilter *GetEquivalentFilter() const { return fEquivalentFilter.get(); }
+   RFilterBase *GetConcreteFilter() const { return fConcreteFilter.get(); }
+   void SetChain(std::unique_ptr<RDFInternal::RFilterChain> chain) { fChain = std::move(chain); }
+   void AllowReordering();
+   bool IsReorderable() const { return fIsReorderable; }
 
    void InitSlot(TTreeReader *r, unsigned int slot) final;
    bool CheckFilters(unsigned int slot, Long64_t entry) final;
+   bool CheckPredicate(unsigned int slot, Long64_t entry) final;
+   RNodeBase *GetPrevNode() const final;
+   const RDFInternal::RMaskedEntryRange &
+   CheckFiltersBulk(unsigned int slot, const RDFInternal::RMaskedEntryRange &bulk) final;
    void Report(ROOT::RDF::RCutFlowReport &) const final;
    void PartialReport(ROOT::RDF::RCutFlowReport &) const final;
    void FillReport(ROOT::RDF::RCutFlowReport &) const final;
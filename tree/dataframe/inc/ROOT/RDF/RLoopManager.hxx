@@ -14,10 +14,13 @@
 #include "ROOT/InternalTreeUtils.hxx" // RNoCleanupNotifier
 #include "ROOT/RDF/RColumnReaderBase.hxx"
 #include "ROOT/RDF/RDatasetSpec.hxx"
+#include "ROOT/RDF/RLoopProfiler.hxx"
+#include "ROOT/RDF/RMaskedEntryRange.hxx"
 #include "ROOT/RDF/RNodeBase.hxx"
 #include "ROOT/RDF/RNewSampleNotifier.hxx"
 #include "ROOT/RDF/RSampleInfo.hxx"
 
+#include <cstddef>
 #include <functional>
 #include <limits>
 #include <map>
@@ -101,6 +104,8 @@ namespace RDFInternal = ROOT::Internal::RDF;
 class RFilterBase;
 class RRangeBase;
 class RDefineBase;
+class RJittedDefine;
+class RJittedFilter;
 using ROOT::RDF::RDataSource;
 
 /// The head node of a RDF computation graph.
@@ -152,6 +157,26 @@ class RLoopManager : public RNodeBase {
    /// Readers for TTree/RDataSource columns (one per slot), shared by all nodes in the computation graph.
    std::vector<std::unordered_map<std::string, std::unique_ptr<RColumnReaderBase>>> fDatasetColumnReaders;
 
+   /// Maximum number of entries per bulk in bulk processing mode, 0 if the entries are processed one by one
+   std::size_t fBulkSize{0};
+   /// Per slot, the dataset column readers whose values the event loop copies entry by entry in bulk processing mode
+   std::vector<std::vector<RColumnReaderBase *>> fBulkLoadReaders;
+   /// Per slot, the dataset column readers that read the values of a bulk by themselves
+   std::vector<std::vector<RColumnReaderBase *>> fBulkRandomAccessReaders;
+
+   /// Whether equivalent jitted Defines and Filters are merged at jitting time
+   bool fMergeJittedNodes{false};
+   /// Whether chains of jitted Filters are evaluated in the order of their measured selectivity and cost
+   bool fReorderFilters{false};
+   /// The jitted Defines that equivalent Defines jitted later are merged into, by the key of their values
+   std::unordered_map<std::string, std::weak_ptr<RJittedDefine>> fMergeableDefines;
+   /// The unnamed jitted Filters that equivalent Filters jitted later are merged into, by the key of their results.
+   /// These are also the Filters that can be reordered.
+   std::unordered_map<std::string, std::weak_ptr<RJittedFilter>> fMergeableFilters;
+
+   /// Collects the time spent in the nodes and in the tasks of the event loop, null unless profiling is enabled
+   std::unique_ptr<RDFInternal::RLoopProfiler> fProfiler;
+
    /// Cache of the tree/chain branch names. Never access directy, always use GetBranchNames().
    ColumnNames_t fValidBranchNames;
 
@@ -163,8 +188,20 @@ class RLoopManager : public RNodeBase {
    void RunTreeReader();
    void RunDataSourceMT();
    void RunDataSource();
+   /// The data source columns that the booked filters depend on, directly or through Defines and Aliases
+   ColumnNames_t GetDataSourceFilterColumns() const;
    void RunAndCheckFilters(unsigned int slot, Long64_t entry);
+   bool InitBulkReaders(unsigned int slot);
+   void RunSampleCallbacks(unsigned int slot);
+   void LoadBulkEntry(unsigned int slot, std::size_t idx, Long64_t entry);
+   void RunAndCheckFiltersBulk(unsigned int slot, const RDFInternal::RMaskedEntryRange &bulk);
+   template <typename SetEntry_t>
+   void RunBulks(unsigned int slot, ULong64_t begin, ULong64_t end, SetEntry_t &&setEntry);
+   template <typename GetEntry_t>
+   void RunTreeReaderBulks(TTreeReader &r, unsigned int slot, GetEntry_t &&getEntry);
    void InitNodeSlots(TTreeReader *r, unsigned int slot);
+   void BuildFilterChains();
+   void InitProfiling();
    void InitNodes();
    void CleanUpNodes();
    void CleanUpTask(TTreeReader *r, unsigned int slot);
@@ -201,6 +238,12 @@ public:
    void Register(RDFInternal::RVariationBase *varPtr);
    void Deregister(RDFInternal::RVariationBase *varPtr);
    bool CheckFilters(unsigned int, Long64_t) final;
+   /// End of recursive chain of calls: all the entries of the bulk that the input provides are selected
+   const RDFInternal::RMaskedEntryRange &
+   CheckFiltersBulk(unsigned int, const RDFInternal::RMaskedEntryRange &bulk) final
+   {
+      return bulk;
+   }
    unsigned int GetNSlots() const { return fNSlots; }
    void Report(ROOT::RDF::RCutFlowReport &rep) const final;
    /// End of recursive chain of calls, does nothing
@@ -211,6 +254,31 @@ public:
    void ToJitExec(const std::string &) const;
    void RegisterCallback(ULong64_t everyNEvents, std::function<void(unsigned int)> &&f);
    unsigned int GetNRuns() const { return fNRuns; }
+   /// Set the maximum number of entries per bulk in bulk processing mode; 0 disables bulk processing
+   void SetBulkSize(std::size_t bulkSize) { fBulkSize = bulkSize; }
+   std::size_t GetBulkSize() const { return fBulkSize; }
+
+   /// Enable or disable the merging of equivalent jitted nodes and the reordering of chains of jitted Filters. Only
+   /// nodes that are jitted afterwards are merged.
+   void SetGraphOptimization(bool mergeJittedNodes, bool reorderFilters)
+   {
+      fMergeJittedNodes = mergeJittedNodes;
+      fReorderFilters = mergeJittedNodes && reorderFilters;
+   }
+   bool IsGraphOptimizationEnabled() const { return fMergeJittedNodes; }
+   /// Enable the profiling of the nodes of the computation graph for all the following event loops
+   void EnableProfiling();
+   bool IsProfilingEnabled() const { return fProfiler != nullptr; }
+   /// Return the profile of the last event loop. Must only be called if profiling is enabled.
+   const ROOT::RDF::Experimental::RProfileReport &GetProfileReport() const { return fProfiler->GetReport(); }
+   /// Return the jitted Define registered with the given key, if any, or register the given Define with the key.
+   /// An empty key is never registered.
+   std::shared_ptr<RJittedDefine>
+   MergeJittedDefine(const std::string &key, const std::shared_ptr<RJittedDefine> &define);
+   /// Return the jitted Filter registered with the given key, if any, or register the given Filter with the key.
+   /// An empty key is never registered.
+   std::shared_ptr<RJittedFilter>
+   MergeJittedFilter(const std::string &key, const std::shared_ptr<RJittedFilter> &filter);
    bool HasDataSourceColumnReaders(const std::string &col, const std::type_info &ti) const;
    void AddDataSourceColumnReaders(const std::string &col, std::vector<std::unique_ptr<RColumnReaderBase>> &&readers,
                                    const std::type_info &ti);
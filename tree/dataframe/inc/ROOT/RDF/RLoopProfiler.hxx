@@ -0,0 +1,195 @@
+/*************************************************************************
+ * Copyright (C) 1995-2024, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RDF_RLOOPPROFILER
+#define ROOT_RDF_RLOOPPROFILER
+
+#include "ROOT/RDF/RColumnReaderBase.hxx"
+#include "ROOT/RDF/RProfileReport.hxx"
+#include "ROOT/RDF/Utils.hxx" // CacheLineStep
+#include "RtypesCore.h"
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace ROOT {
+namespace Internal {
+namespace RDF {
+
+class RLoopProfiler;
+
+/// The time spent in a node of the computation graph and the number of times it was evaluated, per processing slot
+class RNodeProfile {
+   friend class RLoopProfiler;
+   friend class RNodeTimer;
+
+   struct RStats {
+      double fTime = 0.;
+      ULong64_t fCalls = 0;
+   };
+
+   std::string fKind;
+   std::string fName;
+   std::vector<RStats> fStats;
+   /// The time spent in the nodes called by the node being timed, per slot: owned by the RLoopProfiler
+   std::vector<double> &fChildTimes;
+
+public:
+   RNodeProfile(const std::string &kind, const std::string &name, unsigned int nSlots, std::vector<double> &childTimes)
+      : fKind(kind), fName(name), fStats(nSlots * CacheLineStep<RStats>()), fChildTimes(childTimes)
+   {
+   }
+};
+
+/**
+\class ROOT::Internal::RDF::RNodeTimer
+\ingroup dataframe
+\brief Adds the time spent in its scope to a node profile, excluding the time spent in nested RNodeTimer scopes.
+
+Does nothing if the profile is null, i.e. if profiling is disabled.
+**/
+class RNodeTimer {
+   using Clock_t = std::chrono::steady_clock;
+
+   RNodeProfile *fProfile;
+   unsigned int fSlot;
+   double fParentChildTime = 0.;
+   Clock_t::time_point fStart;
+
+public:
+   RNodeTimer(RNodeProfile *profile, unsigned int slot) : fProfile(profile), fSlot(slot)
+   {
+      if (fProfile == nullptr)
+         return;
+      auto &childTime = fProfile->fChildTimes[fSlot * CacheLineStep<double>()];
+      fParentChildTime = childTime;
+      childTime = 0.;
+      fStart = Clock_t::now();
+   }
+
+   ~RNodeTimer()
+   {
+      if (fProfile == nullptr)
+         return;
+      const double elapsed = std::chrono::duration<double>(Clock_t::now() - fStart).count();
+      auto &childTime = fProfile->fChildTimes[fSlot * CacheLineStep<double>()];
+      auto &stats = fProfile->fStats[fSlot * CacheLineStep<RNodeProfile::RStats>()];
+      stats.fTime += elapsed - childTime;
+      ++stats.fCalls;
+      // the time spent in this scope is time spent in a child of the enclosing scope
+      childTime = fParentChildTime + elapsed;
+   }
+
+   RNodeTimer(const RNodeTimer &) = delete;
+   RNodeTimer &operator=(const RNodeTimer &) = delete;
+};
+
+/**
+\class ROOT::Internal::RDF::RProfiledColumnReader
+\ingroup dataframe
+\brief A column reader that times the reads of the column reader it wraps.
+
+The event loop replaces the dataset column readers by instances of this class when profiling is enabled, so that
+column readers cost nothing when it is disabled.
+**/
+class RProfiledColumnReader final : public ROOT::Detail::RDF::RColumnReaderBase {
+   std::unique_ptr<RColumnReaderBase> fReader;
+   RNodeProfile &fProfile;
+   const unsigned int fSlot;
+
+   void *GetImpl(Long64_t entry) final
+   {
+      RNodeTimer timer(&fProfile, fSlot);
+      return fReader->GetImpl(entry);
+   }
+
+   void *GetBulkImpl(const RMaskedEntryRange &mask) final
+   {
+      RNodeTimer timer(&fProfile, fSlot);
+      return fReader->GetBulkImpl(mask);
+   }
+
+   void LoadBulkEntryImpl(std::size_t idx, Long64_t entry) final
+   {
+      RNodeTimer timer(&fProfile, fSlot);
+      fReader->LoadBulkEntryImpl(idx, entry);
+   }
+
+public:
+   RProfiledColumnReader(std::unique_ptr<RColumnReaderBase> reader, RNodeProfile &profile, unsigned int slot)
+      : fReader(std::move(reader)), fProfile(profile), fSlot(slot)
+   {
+   }
+
+   EBulkMode GetBulkMode() const final { return fReader->GetBulkMode(); }
+   std::size_t GetMaxBulkSize(Long64_t firstEntry) final { return fReader->GetMaxBulkSize(firstEntry); }
+};
+
+/**
+\class ROOT::Internal::RDF::RLoopProfiler
+\ingroup dataframe
+\brief Collects the time spent in the nodes of a computation graph and in the tasks of the event loop.
+
+The profiles of the nodes are kept across event loops, so that the nodes and the column readers that are reused by the
+next event loop keep pointing to valid profiles; their statistics are reset at the beginning of every event loop.
+**/
+class RLoopProfiler {
+   using Clock_t = std::chrono::steady_clock;
+
+   struct RSlotState {
+      bool fIsInTask = false;
+      Clock_t::time_point fTaskStart;
+      double fTaskCpuStart = 0.;
+      ULong64_t fNEntries = 0;
+      /// The statistics of the nodes of this slot at the beginning of the current task
+      std::vector<RNodeProfile::RStats> fTaskStartStats;
+      std::vector<ROOT::RDF::Experimental::RProfileReport::RTask> fTasks;
+   };
+
+   const unsigned int fNSlots;
+   /// The time spent in the nodes called by the node being timed, per slot
+   std::vector<double> fChildTimes;
+   std::vector<RSlotState> fSlots;
+   /// The profiles of the nodes, in order of creation
+   std::vector<std::unique_ptr<RNodeProfile>> fNodes;
+   std::unordered_map<std::string, RNodeProfile *> fNodesByKey;
+   /// Protects fNodes and fNodesByKey: column readers are created concurrently by the tasks
+   std::mutex fNodesMutex;
+   Clock_t::time_point fLoopStart;
+   ROOT::RDF::Experimental::RProfileReport fReport;
+
+   RNodeProfile *GetNodeProfileImpl(const std::string &key, const std::string &kind, const std::string &name);
+
+public:
+   explicit RLoopProfiler(unsigned int nSlots);
+
+   /// Return the profile of the given node of the computation graph, creating it if needed
+   RNodeProfile *GetNodeProfile(const void *node, const std::string &kind, const std::string &name);
+   /// Return the profile shared by the readers of the given column of the dataset in all slots, creating it if needed
+   RNodeProfile *GetColumnReaderProfile(const std::string &column);
+
+   void BeginLoop();
+   void EndLoop();
+   void BeginTask(unsigned int slot);
+   void EndTask(unsigned int slot);
+   void AddEntries(unsigned int slot, ULong64_t nEntries) { fSlots[slot].fNEntries += nEntries; }
+
+   /// The report of the last event loop
+   const ROOT::RDF::Experimental::RProfileReport &GetReport() const { return fReport; }
+};
+
+} // namespace RDF
+} // namespace Internal
+} // namespace ROOT
+
+#endif
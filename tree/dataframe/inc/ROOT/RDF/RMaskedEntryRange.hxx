@@ -0,0 +1,97 @@
+/*************************************************************************
+ * Copyright (C) 1995-2024, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RDF_RMASKEDENTRYRANGE
+#define ROOT_RDF_RMASKEDENTRYRANGE
+
+#include <ROOT/RVec.hxx>
+#include <Rtypes.h> // Long64_t
+
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+
+namespace ROOT {
+namespace Internal {
+namespace RDF {
+
+/**
+\class ROOT::Internal::RDF::RMaskedEntryRange
+\ingroup dataframe
+\brief A range of consecutive entries together with a mask that selects some of them.
+
+In bulk processing mode, the event loop passes bulks of consecutive entries through the computation graph: each filter
+narrows down the mask of the entries selected by the previous node, and defines and actions only process the entries
+that are selected by their mask. The first entry number identifies the bulk: nodes use it to cache their results for
+the bulk at hand, like they use the entry number in entry-by-entry processing.
+**/
+class RMaskedEntryRange {
+   ROOT::RVecB fMask;   ///< The i-th entry of the range is selected if the i-th element of the mask is true
+   Long64_t fBegin{-1}; ///< The entry number of the first entry of the range, -1 if the range is not set
+
+public:
+   RMaskedEntryRange() = default;
+   RMaskedEntryRange(Long64_t begin, std::size_t size, bool selected = true) : fMask(size, selected), fBegin(begin) {}
+
+   Long64_t FirstEntry() const { return fBegin; }
+   std::size_t Size() const { return fMask.size(); }
+   const bool *Data() const { return fMask.data(); }
+   bool operator[](std::size_t idx) const { return fMask[idx]; }
+   bool &operator[](std::size_t idx) { return fMask[idx]; }
+
+   /// Set the range to `size` entries starting at `begin`, all of them selected or all of them deselected
+   void Reset(Long64_t begin, std::size_t size, bool selected = true)
+   {
+      fBegin = begin;
+      fMask.assign(size, selected);
+   }
+   /// Change the number of entries of the range; added entries are deselected
+   void Resize(std::size_t size) { fMask.resize(size, false); }
+   /// Forget the current range, so that the next range compares unequal even if it starts at the same entry
+   void Invalidate() { fBegin = -1; }
+
+   bool Any() const { return std::find(fMask.begin(), fMask.end(), true) != fMask.end(); }
+   std::size_t Count() const { return std::count(fMask.begin(), fMask.end(), true); }
+};
+
+/**
+\class ROOT::Internal::RDF::RBulkValues
+\ingroup dataframe
+\brief Copies of the values of a column for the entries of the current bulk.
+
+Used by column readers that can only provide the value of the entry that the TTreeReader or the data source is
+positioned on: in bulk processing mode, the event loop asks them to copy the value of every entry of a bulk before the
+bulk is processed. This requires the column type to be default constructible and copy assignable.
+**/
+template <typename T>
+class RBulkValues {
+   ROOT::RVec<T> fValues;
+
+public:
+   static constexpr bool kIsSupported = std::is_default_constructible<T>::value && std::is_copy_assignable<T>::value;
+
+   void Set(std::size_t idx, const T &value)
+   {
+      if constexpr (kIsSupported) {
+         if (idx >= fValues.size())
+            fValues.resize(idx + 1);
+         fValues[idx] = value;
+      } else {
+         (void)idx;
+         (void)value;
+      }
+   }
+
+   T *Data() { return fValues.data(); }
+};
+
+} // namespace RDF
+} // namespace Internal
+} // namespace ROOT
+
+#endif
@@ -26,6 +26,7 @@ class RCutFlowReport;
 
 namespace Internal {
 namespace RDF {
+class RMaskedEntryRange;
 namespace GraphDrawing {
 class GraphNode;
 }
@@ -54,6 +55,10 @@ public:
    }
    virtual ~RNodeBase() {}
    virtual bool CheckFilters(unsigned int, Long64_t) = 0;
+   /// Bulk counterpart of CheckFilters: return the mask of the entries of the bulk that pass all the filters up to
+   /// and including this node.
+   virtual const ROOT::Internal::RDF::RMaskedEntryRange &
+   CheckFiltersBulk(unsigned int slot, const ROOT::Internal::RDF::RMaskedEntryRange &bulk) = 0;
    virtual void Report(ROOT::RDF::RCutFlowReport &) const = 0;
    virtual void PartialReport(ROOT::RDF::RCutFlowReport &) const = 0;
    virtual void IncrChildrenCount() = 0;
@@ -71,6 +76,9 @@ public:
 
    virtual RLoopManager *GetLoopManagerUnchecked() { return fLoopManager; }
 
+   /// The number of active children of this node, as counted before the event loop
+   unsigned int GetNChildren() const { return fNChildren; }
+
    const std::vector<std::string> &GetVariations() const { return fVariations; }
 
    /// Return a clone of this node that acts as a Filter working with values in the variationName "universe".
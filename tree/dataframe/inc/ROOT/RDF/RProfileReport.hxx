@@ -0,0 +1,105 @@
+/*************************************************************************
+ * Copyright (C) 1995-2024, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RDF_RPROFILEREPORT
+#define ROOT_RDF_RPROFILEREPORT
+
+#include "RtypesCore.h"
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace ROOT {
+namespace Internal {
+namespace RDF {
+class RLoopProfiler;
+} // namespace RDF
+} // namespace Internal
+
+namespace RDF {
+namespace Experimental {
+
+/**
+\class ROOT::RDF::Experimental::RProfileReport
+\ingroup dataframe
+\brief The time spent in the nodes of a computation graph during an event loop, see EnableProfiling().
+
+The time of a node is the wall-clock time spent evaluating the node itself, excluding the time spent in the nodes it
+calls: the time of a Filter does not include the time spent reading its input columns or computing the Defines it
+depends on, which are accounted to the corresponding column readers and Defines. The time of a column reader includes
+the time spent waiting for its data to be read and decompressed.
+
+The report also lists the tasks of the event loop. For each task, the I/O wait is the difference between the wall-clock
+time and the CPU time of the thread that ran it.
+**/
+class RProfileReport {
+   friend class ROOT::Internal::RDF::RLoopProfiler;
+
+public:
+   /// The time spent in a node and the number of times it was evaluated, per processing slot. In bulk processing mode,
+   /// a node is evaluated once per bulk.
+   struct RNode {
+      std::string fKind; ///< "Filter", "Define", "Action" or "Column reader"
+      std::string fName;
+      std::vector<double> fTimes; ///< Per slot, in seconds
+      std::vector<ULong64_t> fCalls;
+
+      double GetTime() const;
+      ULong64_t GetCalls() const;
+   };
+
+   /// The time spent in a node during a task
+   struct RNodeInTask {
+      std::size_t fNode; ///< The index of the node in GetNodes()
+      double fTime;      ///< In seconds
+      ULong64_t fCalls;
+   };
+
+   /// A task of the event loop, e.g. a cluster of entries processed by one thread
+   struct RTask {
+      unsigned int fSlot;
+      double fStart;    ///< Time since the beginning of the event loop, in seconds
+      double fWallTime; ///< In seconds
+      double fCpuTime;  ///< CPU time of the thread that processed the task, in seconds
+      ULong64_t fNEntries;
+      std::vector<RNodeInTask> fNodes;
+
+      double GetIOWaitTime() const { return fWallTime > fCpuTime ? fWallTime - fCpuTime : 0.; }
+   };
+
+private:
+   unsigned int fNSlots = 0;
+   double fWallTime = 0.;
+   std::vector<RNode> fNodes;
+   std::vector<RTask> fTasks;
+
+public:
+   unsigned int GetNSlots() const { return fNSlots; }
+   /// The wall-clock time of the event loop, in seconds
+   double GetWallTime() const { return fWallTime; }
+   ULong64_t GetNEntries() const;
+   /// The nodes that were evaluated at least once during the event loop
+   const std::vector<RNode> &GetNodes() const { return fNodes; }
+   /// The tasks of the event loop, sorted by start time
+   const std::vector<RTask> &GetTasks() const { return fTasks; }
+
+   void Print() const;
+   /// Return the report as a JSON document
+   std::string ToJSON() const;
+   /// Return the report in the Chrome trace event format, which can be opened with chrome://tracing or Perfetto.
+   /// Each task is an event on the timeline of its processing slot; the nodes are shown as sub-events of the task that
+   /// last as long as the time spent in them during the task.
+   std::string ToChromeTrace() const;
+};
+
+} // namespace Experimental
+} // namespace RDF
+} // namespace ROOT
+
+#endif
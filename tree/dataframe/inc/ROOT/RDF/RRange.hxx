@@ -87,6 +87,14 @@ public:
       return fLastResult;
    }
 
+   /// Ranges need to see entries one by one: computation graphs with ranges are never processed in bulks
+   const RDFInternal::RMaskedEntryRange &
+   CheckFiltersBulk(unsigned int, const RDFInternal::RMaskedEntryRange &bulk) final
+   {
+      R__ASSERT(false && "CheckFiltersBulk was called on a Range node. This should never happen.");
+      return bulk;
+   }
+
    // recursive chain of `Report`s
    // RRange simply forwards these calls to the previous node
    void Report(ROOT::RDF::RCutFlowReport &rep) const final { fPrevNode.PartialReport(rep); }
@@ -12,12 +12,14 @@
 #define ROOT_RDF_RTREECOLUMNREADER
 
 #include "RColumnReaderBase.hxx"
+#include "RMaskedEntryRange.hxx"
 #include <ROOT/RVec.hxx>
 #include <Rtypes.h>  // Long64_t, R__CLING_PTRCHECK
 #include <TTreeReader.h>
 #include <TTreeReaderValue.h>
 #include <TTreeReaderArray.h>
 
+#include <cstddef>
 #include <memory>
 #include <string>
 
@@ -29,8 +31,13 @@ namespace RDF {
 template <typename T>
 class R__CLING_PTRCHECK(off) RTreeColumnReader final : public ROOT::Detail::RDF::RColumnReaderBase {
    std::unique_ptr<TTreeReaderValue<T>> fTreeValue;
+   /// The values of the current bulk in bulk processing mode
+   RBulkValues<T> fBulkValues;
 
    void *GetImpl(Long64_t) final { return fTreeValue->Get(); }
+   void *GetBulkImpl(const RMaskedEntryRange &) final { return fBulkValues.Data(); }
+   void LoadBulkEntryImpl(std::size_t idx, Long64_t) final { fBulkValues.Set(idx, *fTreeValue->Get()); }
+
 public:
    /// Construct the RTreeColumnReader. Actual initialization is performed lazily by the Init method.
    RTreeColumnReader(TTreeReader &r, const std::string &colName)
@@ -47,6 +54,11 @@ public:
    // - Thread #1) first task deletes TTreeReader
    // See https://github.com/root-project/root/commit/26e8ace6e47de6794ac9ec770c3bbff9b7f2e945
    ~RTreeColumnReader() override { fTreeValue.reset(); }
+
+   EBulkMode GetBulkMode() const final
+   {
+      return RBulkValues<T>::kIsSupported ? EBulkMode::kLoadEntries : EBulkMode::kNone;
+   }
 };
 
 /// RTreeColumnReader specialization for TTree values read via TTreeReaderArrays.
@@ -70,6 +82,15 @@ class R__CLING_PTRCHECK(off) RTreeColumnReader<RVec<T>> final : public ROOT::Det
    /// Whether we already printed a warning about performing a copy of the TTreeReaderArray contents
    bool fCopyWarningPrinted = false;
 
+   /// Copies of the arrays of the current bulk in bulk processing mode
+   RBulkValues<RVec<T>> fBulkValues;
+
+   void *GetBulkImpl(const RMaskedEntryRange &) final { return fBulkValues.Data(); }
+   void LoadBulkEntryImpl(std::size_t idx, Long64_t entry) final
+   {
+      fBulkValues.Set(idx, *static_cast<RVec<T> *>(GetImpl(entry)));
+   }
+
    void *GetImpl(Long64_t entry) final
    {
       if (entry == fLastEntry)
@@ -138,6 +159,8 @@ public:
 
    /// See the other class template specializations for an explanation.
    ~RTreeColumnReader() override { fTreeArray.reset(); }
+
+   EBulkMode GetBulkMode() const final { return EBulkMode::kLoadEntries; }
 };
 
 /// RTreeColumnReader specialization for arrays of boolean values read via TTreeReaderArrays.
@@ -151,6 +174,9 @@ class R__CLING_PTRCHECK(off) RTreeColumnReader<RVec<bool>> final : public ROOT::
    /// We return a reference to this RVec to clients, to guarantee a stable address and contiguous memory layout
    RVec<bool> fRVec;
 
+   /// Copies of the arrays of the current bulk in bulk processing mode
+   RBulkValues<RVec<bool>> fBulkValues;
+
    // We always copy the contents of TTreeReaderArray<bool> into an RVec<bool> (never take a view into the memory
    // buffer) because the underlying memory buffer might be the one of a std::vector<bool>, which is not a contiguous
    // slab of bool values.
@@ -171,6 +197,12 @@ class R__CLING_PTRCHECK(off) RTreeColumnReader<RVec<bool>> final : public ROOT::
       return &fRVec;
    }
 
+   void *GetBulkImpl(const RMaskedEntryRange &) final { return fBulkValues.Data(); }
+   void LoadBulkEntryImpl(std::size_t idx, Long64_t entry) final
+   {
+      fBulkValues.Set(idx, *static_cast<RVec<bool> *>(GetImpl(entry)));
+   }
+
 public:
    RTreeColumnReader(TTreeReader &r, const std::string &colName)
       : fTreeArray(std::make_unique<TTreeReaderArray<bool>>(r, colName.c_str()))
@@ -179,6 +211,8 @@ public:
 
    /// See the other class template specializations for an explanation.
    ~RTreeColumnReader() override { fTreeArray.reset(); }
+
+   EBulkMode GetBulkMode() const final { return EBulkMode::kLoadEntries; }
 };
 
 } // namespace RDF
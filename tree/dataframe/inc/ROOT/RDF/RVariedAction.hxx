@@ -148,6 +148,8 @@ public:
       (void)entry;
    }
 
+   std::string GetActionName() final { return "Varied " + fHelpers[0].GetActionName(); }
+
    void Run(unsigned int slot, Long64_t entry) final
    {
       for (auto varIdx = 0u; varIdx < GetVariations().size(); ++varIdx) {
@@ -156,6 +158,12 @@ public:
       }
    }
 
+   /// Computation graphs with systematic variations are never processed in bulks
+   void RunBulk(unsigned int, const RMaskedEntryRange &) final
+   {
+      R__ASSERT(false && "RunBulk was called on a varied action. This should never happen.");
+   }
+
    void TriggerChildrenCount() final
    {
       std::for_each(fPrevNodes.begin(), fPrevNodes.end(), [](auto &f) { f->IncrChildrenCount(); });
@@ -198,6 +206,8 @@ public:
       return {};
    }
 
+   bool NeedsEventLoop() const final { return fHelpers[0].NeedsEventLoop(); }
+
    std::shared_ptr<RDFGraphDrawing::GraphNode>
    GetGraph(std::unordered_map<void *, std::shared_ptr<RDFGraphDrawing::GraphNode>> &visitedMap) final
    {
@@ -206,8 +216,7 @@ public:
 
       // Action nodes do not need to go through CreateFilterNode: they are never common nodes between multiple branches
       const auto nodeType = HasRun() ? RDFGraphDrawing::ENodeType::kUsedAction : RDFGraphDrawing::ENodeType::kAction;
-      auto thisNode = std::make_shared<RDFGraphDrawing::GraphNode>("Varied " + fHelpers[0].GetActionName(),
-                                                                   visitedMap.size(), nodeType);
+      auto thisNode = std::make_shared<RDFGraphDrawing::GraphNode>(GetActionName(), visitedMap.size(), nodeType);
       visitedMap[(void *)this] = thisNode;
 
       auto upmostNode = AddDefinesToGraph(thisNode, GetColRegister(), prevColumns, visitedMap);
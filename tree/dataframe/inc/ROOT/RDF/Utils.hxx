@@ -197,6 +197,15 @@ void InterpreterDeclare(const std::string &code);
 /// The pointer returned by the call to TInterpreter::Calc is returned in case of success.
 Long64_t InterpreterCalc(const std::string &code, const std::string &context = "");
 
+/// Set the directory of the jit cache, an empty string disables the cache (the default)
+void SetJitCacheDir(const std::string &dir);
+std::string GetJitCacheDir();
+/// Record the declaration of a function that code jitted later might refer to by the given name
+void RegisterJitCacheDeclaration(const std::string &name, const std::string &code);
+/// Run the code to jit with a shared library from the jit cache, compiling the library if it is not in the cache yet.
+/// Return false, without running any code, if the jit cache is disabled or if the code cannot be compiled.
+bool JitCacheCalc(const std::string &code);
+
 /// Whether custom column with name colName is an "internal" column such as rdfentry_ or rdfslot_
 bool IsInternalColumn(std::string_view colName);
 
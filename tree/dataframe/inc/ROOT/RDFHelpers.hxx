@@ -15,12 +15,15 @@
 
 #include <ROOT/RDF/GraphUtils.hxx>
 #include <ROOT/RDF/RActionBase.hxx>
+#include <ROOT/RDF/RProfileReport.hxx>
 #include <ROOT/RDF/RResultMap.hxx>
 #include <ROOT/RResultHandle.hxx> // users of RunGraphs might rely on this transitive include
+#include <ROOT/RStringView.hxx>
 #include <ROOT/TypeTraits.hxx>
 
 #include <array>
 #include <chrono>
+#include <cstddef>
 #include <fstream>
 #include <functional>
 #include <map>
@@ -259,6 +262,55 @@ SnapshotPtr_t VariationsFor(SnapshotPtr_t resPtr);
 void AddProgressbar(ROOT::RDF::RNode df);
 void AddProgressbar(ROOT::RDataFrame df);
 
+/// \brief Process the entries of the dataset in bulks of the given size, or one by one if the bulk size is zero.
+/// \param[in] node Any node of the computation graph.
+/// \param[in] bulkSize The maximum number of consecutive entries that are processed at once.
+///
+/// Bulk processing is disabled by default. See the "Bulk processing" section of the RDataFrame documentation for the
+/// cases in which entries are processed one by one regardless of the bulk size.
+void SetBulkSize(ROOT::RDF::RNode node, std::size_t bulkSize);
+void SetBulkSize(ROOT::RDataFrame df, std::size_t bulkSize);
+
+/// \brief Merge equivalent jitted Defines and Filters and, optionally, reorder chains of jitted Filters.
+/// \param[in] node Any node of the computation graph.
+/// \param[in] reorderFilters Whether chains of jitted Filters are evaluated in the order of their measured
+/// selectivity and cost. Only the Filters marked with AllowFilterReordering() are moved.
+///
+/// Only the nodes that are jitted after the call, i.e. at the start of the next event loop, are merged. See the
+/// "Graph optimization" section of the RDataFrame documentation.
+void EnableGraphOptimization(ROOT::RDF::RNode node, bool reorderFilters = false);
+void EnableGraphOptimization(ROOT::RDataFrame df, bool reorderFilters = false);
+
+/// \brief Allow a jitted Filter to be evaluated before the Filters it is chained to.
+/// \param[in] filter A node returned by a Filter call with a string expression.
+///
+/// Only mark Filters whose expression is valid for entries rejected by the Filter they are booked on, e.g. not
+/// `v[0] > 10` in `Filter("v.size() > 0").Filter("v[0] > 10")`. Without the mark, a chain of Filters is never
+/// reordered across this Filter. Has no effect unless filter reordering is enabled with EnableGraphOptimization().
+void AllowFilterReordering(ROOT::RDF::RNode filter);
+
+/// \brief Measure the time spent in the Filters, Defines, Actions and column readers of the following event loops.
+/// \param[in] node Any node of the computation graph.
+///
+/// Profiling is disabled by default and cannot be disabled once enabled. See the "Profiling the event loop" section of
+/// the RDataFrame documentation.
+void EnableProfiling(ROOT::RDF::RNode node);
+void EnableProfiling(ROOT::RDataFrame df);
+
+/// \brief Return the profile of the last event loop of the computation graph.
+/// \param[in] node Any node of the computation graph.
+///
+/// Throws if profiling was not enabled with EnableProfiling(). The report is empty if no event loop ran since then.
+RProfileReport GetProfileReport(ROOT::RDF::RNode node);
+RProfileReport GetProfileReport(ROOT::RDataFrame df);
+
+/// \brief Store the code that RDataFrame compiles just in time as shared libraries in the given directory.
+/// \param[in] dir The directory of the cache; an empty string disables the cache, which is the default.
+///
+/// Later processes that book the same computation graphs load the compiled code from the cache instead of invoking the
+/// interpreter again. See the "Caching just-in-time compiled code" section of the RDataFrame documentation.
+void SetJitCacheDir(std::string_view dir);
+
 } // namespace Experimental
 
 /// RDF progress helper.
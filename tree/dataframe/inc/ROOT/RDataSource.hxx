@@ -189,6 +189,15 @@ public:
    // clang-format on
    virtual bool SetEntry(unsigned int slot, ULong64_t entry) = 0;
 
+   // clang-format off
+   /// \brief Informs the data source about the columns that the filters of the computation graph depend on.
+   /// \param[in] columnNames The data source columns needed to evaluate the filters, directly or through Defines
+   /// Called before Initialize() in every event-loop.  The filter columns are read for every entry, whereas the other
+   /// columns are only read for the entries that pass the filters.  Data sources can use this to read ahead the filter
+   /// columns and to read the other columns on demand.  An empty list means that the computation graph has no filters.
+   // clang-format on
+   virtual void SetFilterColumns(const std::vector<std::string> & /*columnNames*/) {}
+
    // clang-format off
    /// \brief Convenience method called before starting an event-loop.
    /// This method might be called multiple times over the lifetime of a RDataSource, since
@@ -19,12 +19,17 @@
 
 #include <ROOT/RDataFrame.hxx>
 #include <ROOT/RDataSource.hxx>
+#include <ROOT/RNTupleReadProfile.hxx>
 #include <ROOT/RNTupleUtil.hxx>
 #include <ROOT/RStringView.hxx>
 
 #include <cstdint>
 #include <memory>
+#include <mutex>
+#include <optional>
+#include <ostream>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace ROOT {
@@ -36,6 +41,7 @@ class RNTupleDescriptor;
 namespace Detail {
 class RFieldBase;
 class RFieldValue;
+class RPageSink;
 class RPageSource;
 } // namespace Detail
 
@@ -44,8 +50,34 @@ class RNTupleColumnReader;
 }
 
 class RNTupleDS final : public ROOT::RDF::RDataSource {
-   /// Clones of the first source, one for each slot
-   std::vector<std::unique_ptr<ROOT::Experimental::Detail::RPageSource>> fSources;
+   friend class ROOT::Experimental::Internal::RNTupleColumnReader;
+
+   /// The data source reads a chain of ntuples that share the same schema.  The entry numbers of the chain continue
+   /// from one ntuple to the next.  The first ntuple is opened when the schema is first needed; the other ones are
+   /// opened when the entry ranges are requested.
+   struct RChainElement {
+      /// Empty if the ntuple has been passed to the data source as a page source
+      std::string fFileName;
+      /// Provides the descriptor.  The first slot that reads the ntuple reads from this page source, the other slots
+      /// read from clones of it, see GetSlotSource().  Only kept open between event loops for the first ntuple of the
+      /// chain.
+      std::shared_ptr<ROOT::Experimental::Detail::RPageSource> fSource;
+      /// Whether fSource has been handed to a slot
+      bool fIsSourceInUse = false;
+      /// The chain entry number of the first entry of this ntuple, valid once the ntuple has been opened
+      NTupleSize_t fFirstEntry = 0;
+      NTupleSize_t fNEntries = 0;
+   };
+   /// The maximum number of entry ranges per slot, see GetEntryRanges()
+   static constexpr unsigned int kNRangesPerSlot = 4;
+
+   std::string fNTupleName;
+   std::vector<RChainElement> fChain;
+   /// The number of chain elements whose entry ranges have been handed out in the current event loop, either zero or
+   /// the size of the chain
+   std::size_t fNChainElementsSeen = 0;
+   /// For every slot, the index of the chain element it currently reads and the corresponding page source
+   std::vector<std::pair<std::size_t, std::shared_ptr<ROOT::Experimental::Detail::RPageSource>>> fSlotSources;
 
    /// We prepare a column reader prototype for every column. If a column reader is actually requested
    /// in GetColumnReaders(), we move a clone of the prototype into the hands of RDataFrame.
@@ -56,7 +88,74 @@ class RNTupleDS final : public ROOT::RDF::RDataSource {
    std::vector<size_t> fActiveColumns;
 
    unsigned fNSlots = 0;
-   bool fHasSeenAllRanges = false;
+
+   /// A selection of the form `column <op> value` that is applied by the data source, see AddPushdownFilter()
+   struct RPushdownFilter {
+      enum class EOperator { kLess, kLessEqual, kGreater, kGreaterEqual, kEqual, kNotEqual };
+
+      std::string fColumnName;
+      /// The index of the column in fColumnNames and fColumnReaderPrototypes
+      std::size_t fColumnIndex = 0;
+      /// The on-disk field that backs the RDF column; the statistics of its physical column are used to skip data
+      DescriptorId_t fFieldId = kInvalidDescriptorId;
+      EOperator fOperator = EOperator::kEqual;
+      double fValue = 0.0;
+      /// Converts the value read by the column reader to double
+      double (*fToDouble)(const void *) = nullptr;
+
+      /// Whether the given value passes the filter
+      bool Match(double value) const;
+      /// Whether any of the values summarized by the statistics can pass the filter
+      bool CanMatch(const RValueStatistics &statistics) const;
+   };
+   std::vector<RPushdownFilter> fPushdownFilters;
+   /// The indexes in fColumnNames of the columns that RDataFrame needs to evaluate its filters, see SetFilterColumns()
+   std::vector<std::size_t> fFilterColumns;
+   /// For every slot, one connected column reader per pushdown filter, created in Initialize()
+   std::vector<std::vector<std::unique_ptr<ROOT::Experimental::Internal::RNTupleColumnReader>>> fPushdownReaders;
+
+   bool fIsMetricsEnabled = false;
+   bool fIsLazyColumnsEnabled = false;
+   /// Serializes the hand-over of the page sources of the chain elements to the slots and their clones
+   std::mutex fCloneLock;
+   /// Protects fReadReports, which is filled concurrently by the slots when they switch to another chain element
+   std::mutex fReadReportsLock;
+   /// The reports of the page sources that have been released
+   std::vector<ROOT::Experimental::Detail::RNTupleReadReport> fReadReports;
+
+   /// Enables the metrics of a newly opened page source of a slot if EnableMetrics() was called
+   void PrepareSource(ROOT::Experimental::Detail::RPageSource &source);
+   /// If EnableLazyColumns() was called and RDataFrame has filters, marks the physical columns that are only needed by
+   /// other RDF columns as lazy, such that they are not preloaded with the clusters and only the pages of entries
+   /// passing the filters are read
+   void SetLazyColumns(ROOT::Experimental::Detail::RPageSource &source) const;
+   /// Stores the report of a page source that is about to be released
+   void AddReadReport(ROOT::Experimental::Detail::RPageSource &source, const std::string &location);
+
+   /// Opens the first ntuple of the chain and creates the column reader prototypes, unless already done
+   void EnsureSchema() const;
+   /// Opens the ntuple of the given chain element.  Throws if the schema differs from the one of the first ntuple,
+   /// which must have been opened before.  Can be called concurrently for different chain elements.
+   void OpenChainElement(std::size_t index);
+   /// Opens the ntuple of the given chain element, if necessary, and sets its entry numbers.  The previous chain
+   /// elements must have been opened before.
+   void AttachChainElement(std::size_t index);
+   /// Opens the ntuples of the chain elements that are not open, in parallel if implicit multi-threading is enabled,
+   /// and sets their entry numbers
+   void AttachChain();
+   /// Returns the page source from which the slot reads the given chain element; switches the slot to the chain
+   /// element if it currently reads another one.  The slot takes over the page source of the chain element unless
+   /// another slot already did; then, it reads from a clone that shares the meta-data.  Called by the column readers
+   /// of the slot.
+   std::shared_ptr<ROOT::Experimental::Detail::RPageSource> GetSlotSource(unsigned int slot, std::size_t index);
+   /// Returns the index of the opened chain element that contains the given chain entry number
+   std::size_t FindChainElement(NTupleSize_t entry) const;
+
+   /// Returns the entry ranges of the non-empty clusters of the given chain element, one range per cluster
+   std::vector<std::pair<ULong64_t, ULong64_t>> GetClusterRanges(const RChainElement &element);
+   /// Returns the entry ranges of the pages and clusters of the given chain element whose statistics do not rule out
+   /// entries passing all the pushdown filters.  The ranges do not span more than one cluster.
+   std::vector<std::pair<ULong64_t, ULong64_t>> GetPushdownRanges(const RChainElement &element);
 
    /// Provides the RDF column "colName" given the field identified by fieldID. For records and collections,
    /// AddField recurses into the sub fields. The skeinIDs is the list of field IDs of the outer collections
@@ -73,16 +172,64 @@ class RNTupleDS final : public ROOT::RDF::RDataSource {
 
 public:
    explicit RNTupleDS(std::unique_ptr<ROOT::Experimental::Detail::RPageSource> pageSource);
+   /// Reads the chain of the ntuples with the given name from the given files.  All the ntuples must have the same
+   /// schema as the ntuple in the first file.  The files are not opened before the schema is needed, so that the
+   /// data source can be created before the files are written.
+   RNTupleDS(std::string_view ntupleName, const std::vector<std::string> &fileNames);
    ~RNTupleDS();
    void SetNSlots(unsigned int nSlots) final;
-   const std::vector<std::string> &GetColumnNames() const final { return fColumnNames; }
+   const std::vector<std::string> &GetColumnNames() const final;
    bool HasColumn(std::string_view colName) const final;
    std::string GetTypeName(std::string_view colName) const final;
+   /// Returns entry ranges that are aligned to cluster boundaries and that do not span more than one ntuple of the
+   /// chain.  The first call of an event loop returns the ranges of the entire chain, the next one an empty list.
+   /// The ntuples are opened in parallel if implicit multi-threading is enabled; they stay open until the end of the
+   /// event loop, so that the slots read from the already attached page sources.  There are several ranges per slot,
+   /// so that in multi-threaded event loops, idle slots pick up the remaining ranges of any ntuple while other slots
+   /// process large clusters.
    std::vector<std::pair<ULong64_t, ULong64_t>> GetEntryRanges() final;
    std::string GetLabel() final { return "RNTupleDS"; }
 
+   /// Adds a selection of the form `column <op> value` that is applied by the data source itself, where `<op>` is one
+   /// of `<`, `<=`, `>`, `>=`, `==`, `!=` and `value` is a number.  The column must be a scalar numeric column that is
+   /// not part of a collection, e.g. `pt > 50`.  Entries that do not pass all the pushdown filters are not processed,
+   /// as if they were removed by a corresponding `Filter()`.  Clusters and pages whose value statistics show that
+   /// none of their entries can pass are not read at all; the statistics are stored if the ntuple was written with
+   /// RNTupleWriteOptions::SetHasPageStatistics().  The values are compared as double precision numbers.
+   /// Must not be called during an event loop.
+   void AddPushdownFilter(std::string_view expression);
+
    bool SetEntry(unsigned int slot, ULong64_t entry) final;
 
+   /// Whether CopyFields() can copy the given columns, i.e. whether they are top-level fields and no pushdown filter
+   /// is set
+   bool CanCopyFields(const std::vector<std::string> &columnNames) const;
+   /// Writes the given top-level fields of all the ntuples of the chain to the sink by copying their sealed pages.
+   /// The sink must not be created yet.  Used by RDataFrame::Snapshot() for columns that are passed through unchanged.
+   /// The pages are only recompressed if the compression of the sink differs from the one of the input.
+   void CopyFields(const std::vector<std::string> &columnNames, ROOT::Experimental::Detail::RPageSink &sink);
+   /// Returns the compression settings used by all the columns of the given top-level fields in all the ntuples of the
+   /// chain, or nothing if the settings differ or if there is no data.  Opens the ntuples of the chain.
+   std::optional<std::uint32_t> GetCommonCompression(const std::vector<std::string> &columnNames);
+
+   /// Enables the performance counters and the read profile of all the page sources, including the ones opened for
+   /// the processing slots and for the later ntuples of the chain.  Must not be called during an event loop.
+   void EnableMetrics();
+   /// Returns one report per page source opened so far: the ntuples of the chain and the clones used by the
+   /// processing slots.  Reports of page sources that are still open reflect the current values.
+   std::vector<ROOT::Experimental::Detail::RNTupleReadReport> GetReadReports();
+   /// Prints the reports returned by GetReadReports() as a JSON array or as CSV
+   void PrintMetrics(std::ostream &output, ROOT::Experimental::Detail::RNTupleReadReport::EFormat format);
+
+   /// Only preload the filter columns and the columns of the pushdown filters cluster by cluster.  The pages of the
+   /// other columns are read one by one on demand, i.e. only if they contain an entry that passes the filters.  This
+   /// pays off for selective filters; if most entries pass, the single page reads are slower than reading the whole
+   /// clusters.  In bulk processing mode, the bulks end at the page boundaries of the lazy columns.  Takes effect with
+   /// the next event loop.
+   void EnableLazyColumns();
+
+   /// Remembers the filter columns for EnableLazyColumns()
+   void SetFilterColumns(const std::vector<std::string> &columnNames) final;
    void Initialize() final;
    void Finalize() final;
 
@@ -98,7 +245,14 @@ protected:
 namespace RDF {
 namespace Experimental {
 RDataFrame FromRNTuple(std::string_view ntupleName, std::string_view fileName);
+/// Creates an RDataFrame that only processes the entries passing all the given pushdown filters, which can skip
+/// reading entire clusters and pages. See RNTupleDS::AddPushdownFilter() for the syntax of the filters.
+RDataFrame FromRNTuple(std::string_view ntupleName, std::string_view fileName,
+                       const std::vector<std::string> &pushdownFilters);
 RDataFrame FromRNTuple(ROOT::Experimental::RNTuple *ntuple);
+/// Creates an RDataFrame that processes the chain of the ntuples with the given name from several files, in order.
+/// All the ntuples must have the same schema.
+RDataFrame FromRNTuple(std::string_view ntupleName, const std::vector<std::string> &fileNames);
 } // namespace Experimental
 } // namespace RDF
 
@@ -18,6 +18,13 @@
 namespace ROOT {
 
 namespace RDF {
+/// The data format written by Snapshot()
+enum class ESnapshotOutputFormat {
+   kDefault, ///< Currently TTree
+   kTTree,
+   kRNTuple ///< Requires ROOT built with the root7 option
+};
+
 /// A collection of options to steer the creation of the dataset on file
 struct RSnapshotOptions {
    using ECAlgo = ROOT::ECompressionAlgorithm;
@@ -31,12 +38,15 @@ struct RSnapshotOptions {
    {
    }
    std::string fMode = "RECREATE";             ///< Mode of creation of output file
-   ECAlgo fCompressionAlgorithm = ROOT::kZLIB; ///< Compression algorithm of output file
-   int fCompressionLevel = 1;                  ///< Compression level of output file
+   /// Compression algorithm of output file.  For RNTuple output, the default algorithm and level are taken as not set:
+   /// new data is written with the RNTuple default compression and copied columns keep the compression of the input.
+   ECAlgo fCompressionAlgorithm = ROOT::kZLIB;
+   int fCompressionLevel = 1; ///< Compression level of output file
    int fAutoFlush = 0;                         ///< AutoFlush value for output tree
    int fSplitLevel = 99;                       ///< Split level of output tree
    bool fLazy = false;                         ///< Do not start the event loop when Snapshot is called
    bool fOverwriteIfExists = false; ///< If fMode is "UPDATE", overwrite object in output file if it already exists
+   ESnapshotOutputFormat fOutputFormat = ESnapshotOutputFormat::kDefault; ///< The data format of the output
 };
 } // ns RDF
 } // ns ROOT
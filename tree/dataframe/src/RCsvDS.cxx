@@ -72,22 +72,174 @@ The current implementation of RCsvDS reads the entire CSV file content into memo
 RDataFrame starts processing it. Therefore, before creating a CSV RDataFrame, it is
 important to check both how much memory is available and the size of the CSV file.
 
+When implicit multi-threading is enabled, the records read into memory are parsed in parallel: the content is split
+in ranges of whole lines, one per processing slot, and the values are parsed directly into typed column buffers.
+
 RCsvDS can handle empty cells and also allows the usage of the special keywords "NaN" and "nan" to
 indicate `nan` values. If the column is of type double, these cells are stored internally as `nan`.
 Empty cells and explicit `nan`-s inside columns of type Long64_t/bool are stored as zeros.
+In columns of type std::string, empty cells and `nan`-s are stored as "nan", whereas a quoted empty
+field (`""`) is the empty string.
 */
 // clang-format on
 
 #include <ROOT/TSeq.hxx>
 #include <ROOT/RCsvDS.hxx>
 #include <ROOT/RRawFile.hxx>
+#include <RConfigure.h> // R__USE_IMT
 #include <TError.h>
+#include <TROOT.h> // IsImplicitMTEnabled
+
+#ifdef R__USE_IMT
+#include <ROOT/TThreadExecutor.hxx>
+#endif
 
 #include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
 #include <memory>
+#include <numeric>
 #include <sstream>
 #include <string>
 
+namespace {
+
+/// Return the position of the next line feed in [begin, end), or end
+const char *FindLineFeed(const char *begin, const char *end)
+{
+   const void *lineFeed = std::memchr(begin, '\n', end - begin);
+   return lineFeed ? static_cast<const char *>(lineFeed) : end;
+}
+
+/// Return the end of the content of the line [begin, lineFeed), i.e. without the carriage return of Windows line breaks
+const char *StripCarriageReturn(const char *begin, const char *lineFeed)
+{
+   return (lineFeed != begin && lineFeed[-1] == '\r') ? lineFeed - 1 : lineFeed;
+}
+
+/// Return the number of non-empty lines in [begin, end)
+ULong64_t CountRecords(const char *begin, const char *end)
+{
+   ULong64_t nRecords = 0ULL;
+   while (begin != end) {
+      const char *lineFeed = FindLineFeed(begin, end);
+      if (StripCarriageReturn(begin, lineFeed) != begin)
+         ++nRecords;
+      begin = lineFeed == end ? end : lineFeed + 1;
+   }
+   return nRecords;
+}
+
+/// Return the position of the first delimiter or double quote in [begin, end), or end.
+/// The characters are compared eight at a time: a 64-bit word contains a given byte if and only if the XOR of the
+/// word with that byte repeated eight times contains a zero byte.
+const char *FindDelimiterOrQuote(const char *begin, const char *end, char delimiter)
+{
+   constexpr std::uint64_t kOnes = 0x0101010101010101ULL;
+   constexpr std::uint64_t kHighBits = 0x8080808080808080ULL;
+   const std::uint64_t delimiters = kOnes * static_cast<unsigned char>(delimiter);
+   const std::uint64_t quotes = kOnes * static_cast<unsigned char>('"');
+   auto hasZeroByte = [](std::uint64_t word) { return (word - kOnes) & ~word & kHighBits; };
+
+   for (; end - begin >= 8; begin += 8) {
+      std::uint64_t word;
+      std::memcpy(&word, begin, sizeof(word));
+      if (hasZeroByte(word ^ delimiters) | hasZeroByte(word ^ quotes))
+         break;
+   }
+   for (; begin != end; ++begin) {
+      if (*begin == delimiter || *begin == '"')
+         break;
+   }
+   return begin;
+}
+
+/// Append the value of the quoted field starting at pos to value, resolving the quotes and the escaped double quotes.
+/// Return the position of the delimiter that ends the field, or end.
+const char *UnquoteField(const char *pos, const char *end, char delimiter, std::string &value)
+{
+   bool quoted = false;
+   for (; pos != end; ++pos) {
+      if (*pos == delimiter && !quoted) {
+         break;
+      } else if (*pos == '"') {
+         // Keep just one quote for escaped quotes, none for the normal quotes
+         if (pos + 1 != end && pos[1] == '"') {
+            value += *++pos;
+         } else {
+            quoted = !quoted;
+         }
+      } else {
+         value += *pos;
+      }
+   }
+   return pos;
+}
+
+// The following functions parse the values as std::stod, std::stoll and the extraction of a bool from a stream do,
+// without copying the field to a string except in the corner cases. The fields must be followed by a null character
+// somewhere in memory, which is the case for the values in the buffer of RCsvDS and in std::strings.
+
+double ParseDouble(const char *begin, const char *end)
+{
+   char *numberEnd = nullptr;
+   errno = 0;
+   const double value = std::strtod(begin, &numberEnd);
+   // no conversion, the number extends past the field (e.g. with a delimiter that can be part of a number) or it
+   // is out of range: let std::stod throw or parse just the field
+   if (numberEnd == begin || numberEnd > end || errno == ERANGE)
+      return std::stod(std::string(begin, end));
+   return value;
+}
+
+Long64_t ParseLong64(const char *begin, const char *end)
+{
+   const char *pos = begin;
+   const bool negative = pos != end && *pos == '-';
+   if (pos != end && (*pos == '-' || *pos == '+'))
+      ++pos;
+   const char *digitsBegin = pos;
+   ULong64_t value = 0ULL;
+   // at most 18 digits, which cannot overflow
+   for (; pos != end && pos - digitsBegin < 18 && *pos >= '0' && *pos <= '9'; ++pos)
+      value = value * 10 + (*pos - '0');
+   // e.g. leading spaces or more than 18 digits
+   if (pos == digitsBegin || (pos != end && *pos >= '0' && *pos <= '9'))
+      return std::stoll(std::string(begin, end));
+   return negative ? -static_cast<Long64_t>(value) : static_cast<Long64_t>(value);
+}
+
+bool ParseBool(const char *begin, const char *end)
+{
+   const auto length = end - begin;
+   if (length == 4 && std::memcmp(begin, "true", 4) == 0)
+      return true;
+   if (length == 5 && std::memcmp(begin, "false", 5) == 0)
+      return false;
+   bool value = false;
+   std::istringstream(std::string(begin, end)) >> std::boolalpha >> value;
+   return value;
+}
+
+/// Call task(i) for i in [0, nTasks), in parallel if there is more than one task
+template <typename F>
+void RunTasks(F &&task, unsigned int nTasks)
+{
+#ifdef R__USE_IMT
+   if (nTasks > 1U) {
+      ROOT::TThreadExecutor{}.Foreach(task, ROOT::TSeqU(nTasks));
+      return;
+   }
+#endif
+   for (auto i : ROOT::TSeqU(nTasks))
+      task(i);
+}
+
+} // anonymous namespace
+
 namespace ROOT {
 
 namespace RDF {
@@ -117,46 +269,196 @@ void RCsvDS::FillHeaders(const std::string &line)
    }
 }
 
-void RCsvDS::FillRecord(const std::string &line, Record_t &record)
+////////////////////////////////////////////////////////////////////////
+/// Read the next chunk of lines into the beginning of fBuffer, which might already contain the beginning of the chunk.
+/// Return the size of the chunk in bytes: the bytes that follow it in fBuffer belong to the next chunk.
+std::size_t RCsvDS::ReadChunk()
 {
-   auto i = 0U;
+   if (fLinesChunkSize == -1LL) {
+      // read the rest of the file at once
+      const auto size = fBuffer.size();
+      const auto nBytes = static_cast<std::size_t>(fCsvFile->GetSize() - fCsvFile->GetFilePos());
+      fBuffer.resize(size + nBytes);
+      fBuffer.resize(size + fCsvFile->Read(&fBuffer[size], nBytes));
+      return fBuffer.size();
+   }
 
-   auto columns = ParseColumns(line);
+   constexpr std::size_t kBlockSize = 16 * 1024 * 1024;
+   std::size_t linePos = 0; // the beginning of the first line that was not counted yet
+   Long64_t nLines = 0LL;
+   while (true) {
+      // count the complete lines in the buffer
+      while (nLines < fLinesChunkSize) {
+         const char *line = fBuffer.data() + linePos;
+         const char *lineFeed = FindLineFeed(line, fBuffer.data() + fBuffer.size());
+         if (lineFeed == fBuffer.data() + fBuffer.size())
+            break;
+         if (StripCarriageReturn(line, lineFeed) != line)
+            ++nLines; // skip empty lines
+         linePos = lineFeed + 1 - fBuffer.data();
+      }
+      if (nLines == fLinesChunkSize)
+         return linePos;
+
+      const auto size = fBuffer.size();
+      fBuffer.resize(size + kBlockSize);
+      const auto nRead = fCsvFile->Read(&fBuffer[size], kBlockSize);
+      fBuffer.resize(size + nRead);
+      if (nRead == 0)
+         return fBuffer.size(); // EOF: the last line might not end with a line break
+   }
+}
 
-   for (auto &col : columns) {
-      auto colType = fColTypes[fHeaders[i]];
+////////////////////////////////////////////////////////////////////////
+/// Parse the records in the first nBytes of fBuffer into the column buffers, in parallel if implicit multi-threading
+/// is enabled.
+void RCsvDS::ParseChunk(std::size_t nBytes)
+{
+   const char *begin = fBuffer.data();
+   const char *end = begin + nBytes;
+
+   // Split the chunk in ranges of whole lines, one per task
+   unsigned int nTasks = 1U;
+#ifdef R__USE_IMT
+   constexpr std::size_t kMinBytesPerTask = 64 * 1024;
+   if (ROOT::IsImplicitMTEnabled())
+      nTasks = std::max(1U, std::min(fNSlots, static_cast<unsigned int>(nBytes / kMinBytesPerTask)));
+#endif
+   std::vector<const char *> taskBegins{begin};
+   for (auto i : ROOT::TSeqU(1U, nTasks)) {
+      const char *pos = std::max(begin + nBytes / nTasks * i, taskBegins.back());
+      const char *lineFeed = FindLineFeed(pos, end);
+      taskBegins.emplace_back(lineFeed == end ? end : lineFeed + 1);
+   }
+   taskBegins.emplace_back(end);
 
-      switch (colType) {
+   // Count the records of each range to know where to store their values
+   std::vector<ULong64_t> firstRecords(nTasks + 1, 0ULL);
+   RunTasks([&](unsigned int task) { firstRecords[task + 1] = CountRecords(taskBegins[task], taskBegins[task + 1]); },
+            nTasks);
+   std::partial_sum(firstRecords.begin(), firstRecords.end(), firstRecords.begin());
+   fNRecords = firstRecords.back();
+
+   const auto nColumns = fHeaders.size();
+   fDoubleColumns.resize(nColumns);
+   fLong64Columns.resize(nColumns);
+   fStringColumns.resize(nColumns);
+   fBoolColumns.resize(nColumns);
+   for (auto col : ROOT::TSeqU(nColumns)) {
+      switch (fColTypesList[col]) {
       case 'D': {
-         record.emplace_back(new double((col != "nan") ? std::stod(col) : std::numeric_limits<double>::quiet_NaN()));
+         fDoubleColumns[col].resize(fNRecords);
          break;
       }
       case 'L': {
-         if (col != "nan") {
-            record.emplace_back(new Long64_t(std::stoll(col)));
-         } else {
-            fColContainingEmpty.insert(fHeaders[i]);
-            record.emplace_back(new Long64_t(0));
-         }
+         fLong64Columns[col].resize(fNRecords);
          break;
       }
       case 'O': {
-         auto b = new bool();
-         record.emplace_back(b);
-         if (col != "nan") {
-            std::istringstream(col) >> std::boolalpha >> *b;
-         } else {
-            fColContainingEmpty.insert(fHeaders[i]);
-            *b = false;
-         }
+         fBoolColumns[col].resize(fNRecords);
          break;
       }
       case 'T': {
-         record.emplace_back(new std::string(col));
+         fStringColumns[col].resize(fNRecords);
          break;
       }
       }
-      ++i;
+   }
+
+   // colContainsEmpty[task][column]: whether the column contains empty cells in the range of the task
+   std::vector<std::vector<char>> colContainsEmpty(nTasks, std::vector<char>(nColumns, 0));
+   RunTasks(
+      [&](unsigned int task) {
+         ParseRecords(taskBegins[task], taskBegins[task + 1], firstRecords[task], colContainsEmpty[task]);
+      },
+      nTasks);
+   for (const auto &taskColContainsEmpty : colContainsEmpty) {
+      for (auto col : ROOT::TSeqU(nColumns)) {
+         if (taskColContainsEmpty[col])
+            fColContainingEmpty.insert(fHeaders[col]);
+      }
+   }
+}
+
+/// Parse the lines in [begin, end), storing their values starting at the given record
+void RCsvDS::ParseRecords(const char *begin, const char *end, ULong64_t record, std::vector<char> &colContainsEmpty)
+{
+   std::string value; // the value of the current quoted field, reused for all fields to avoid allocations
+   while (begin != end) {
+      const char *lineFeed = FindLineFeed(begin, end);
+      const char *lineEnd = StripCarriageReturn(begin, lineFeed);
+      if (lineEnd != begin) { // skip empty lines
+         ParseRecord(begin, lineEnd, record, colContainsEmpty, value);
+         ++record;
+      }
+      begin = lineFeed == end ? end : lineFeed + 1;
+   }
+}
+
+void RCsvDS::ParseRecord(const char *begin, const char *end, ULong64_t record, std::vector<char> &colContainsEmpty,
+                         std::string &value)
+{
+   const auto nColumns = fHeaders.size();
+   std::size_t nFields = 0;
+   while (true) {
+      const char *fieldEnd = FindDelimiterOrQuote(begin, end, fDelimiter);
+      if (fieldEnd != end && *fieldEnd == '"') {
+         // quoted field: the value differs from the content of the field, and might contain delimiters
+         value.assign(begin, fieldEnd);
+         fieldEnd = UnquoteField(fieldEnd, end, fDelimiter, value);
+         if (nFields < nColumns)
+            StoreValue(nFields, record, value.data(), value.data() + value.size(), /*isQuoted=*/true, colContainsEmpty);
+      } else if (nFields < nColumns) {
+         StoreValue(nFields, record, begin, fieldEnd, /*isQuoted=*/false, colContainsEmpty);
+      }
+      ++nFields;
+      // if the line ends with the delimiter, the next iteration stores the empty value of the last column
+      if (fieldEnd == end)
+         break;
+      begin = fieldEnd + 1;
+   }
+
+   if (nFields != nColumns) {
+      std::string msg = "The CSV record of entry " + std::to_string(fProcessedLines + record) + " has ";
+      msg += std::to_string(nFields) + " fields, but the CSV file has " + std::to_string(nColumns) + " columns.";
+      throw std::runtime_error(msg);
+   }
+}
+
+/// Store the value of the given column of the given record, converting it to the type of the column.  An unquoted
+/// empty field is a missing value; a quoted empty field is the empty string in string columns.
+void RCsvDS::StoreValue(std::size_t col, ULong64_t record, const char *begin, const char *end, bool isQuoted,
+                        std::vector<char> &colContainsEmpty)
+{
+   const auto length = end - begin;
+   // empty cell or explicit nan/NaN
+   const bool isNaN =
+      length == 0 || (length == 3 && (std::memcmp(begin, "nan", 3) == 0 || std::memcmp(begin, "NaN", 3) == 0));
+
+   switch (fColTypesList[col]) {
+   case 'D': {
+      fDoubleColumns[col][record] = isNaN ? std::numeric_limits<double>::quiet_NaN() : ParseDouble(begin, end);
+      break;
+   }
+   case 'L': {
+      if (isNaN)
+         colContainsEmpty[col] = 1;
+      fLong64Columns[col][record] = isNaN ? 0 : ParseLong64(begin, end);
+      break;
+   }
+   case 'O': {
+      if (isNaN)
+         colContainsEmpty[col] = 1;
+      fBoolColumns[col][record] = !isNaN && ParseBool(begin, end);
+      break;
+   }
+   case 'T': {
+      if (isNaN && !(isQuoted && length == 0))
+         fStringColumns[col][record] = "nan";
+      else
+         fStringColumns[col][record].assign(begin, end);
+      break;
+   }
    }
 }
 
@@ -186,15 +488,9 @@ std::vector<void *> RCsvDS::GetColumnReadersImpl(std::string_view colName, const
    std::vector<void *> ret(fNSlots);
    for (auto slot : ROOT::TSeqU(fNSlots)) {
       auto &val = fColAddresses[index][slot];
-      if (ti == typeid(double)) {
-         val = &fDoubleEvtValues[index][slot];
-      } else if (ti == typeid(Long64_t)) {
-         val = &fLong64EvtValues[index][slot];
-      } else if (ti == typeid(std::string)) {
-         val = &fStringEvtValues[index][slot];
-      } else {
+      // the addresses of the values of the other types point to the parsed records, see SetEntry
+      if (ti == typeid(bool))
          val = &fBoolEvtValues[index][slot];
-      }
       ret[slot] = &val;
    }
    return ret;
@@ -376,46 +672,34 @@ RCsvDS::RCsvDS(std::string_view fileName, bool readHeaders, char delimiter, Long
 
 void RCsvDS::FreeRecords()
 {
-   for (auto &record : fRecords) {
-      for (size_t i = 0; i < record.size(); ++i) {
-         void *p = record[i];
-         const auto colType = fColTypes[fHeaders[i]];
-         switch (colType) {
-         case 'D': {
-            delete static_cast<double *>(p);
-            break;
-         }
-         case 'L': {
-            delete static_cast<Long64_t *>(p);
-            break;
-         }
-         case 'O': {
-            delete static_cast<bool *>(p);
-            break;
-         }
-         case 'T': {
-            delete static_cast<std::string *>(p);
-            break;
-         }
-         }
-      }
-   }
-   fRecords.clear();
+   // keep the memory of the column buffers, which is reused by the next chunk
+   for (auto &col : fDoubleColumns)
+      col.clear();
+   for (auto &col : fLong64Columns)
+      col.clear();
+   for (auto &col : fStringColumns)
+      col.clear();
+   for (auto &col : fBoolColumns)
+      col.clear();
+   fNRecords = 0ULL;
 }
 
 ////////////////////////////////////////////////////////////////////////
 /// Destructor.
-RCsvDS::~RCsvDS()
-{
-   FreeRecords();
-}
+RCsvDS::~RCsvDS() {}
 
 void RCsvDS::Finalize()
 {
    fCsvFile->Seek(fDataPos);
    fProcessedLines = 0ULL;
    fEntryRangesRequested = 0ULL;
-   FreeRecords();
+   fNRecords = 0ULL;
+   // release the memory of the records
+   fBuffer = std::string();
+   fDoubleColumns.clear();
+   fLong64Columns.clear();
+   fStringColumns.clear();
+   fBoolColumns.clear();
 }
 
 const std::vector<std::string> &RCsvDS::GetColumnNames() const
@@ -426,16 +710,11 @@ const std::vector<std::string> &RCsvDS::GetColumnNames() const
 std::vector<std::pair<ULong64_t, ULong64_t>> RCsvDS::GetEntryRanges()
 {
    // Read records and store them in memory
-   auto linesToRead = fLinesChunkSize;
    FreeRecords();
-
-   std::string line;
-   while ((-1LL == fLinesChunkSize || 0 != linesToRead) && fCsvFile->Readln(line)) {
-      if (line.empty()) continue; // skip empty lines
-      fRecords.emplace_back();
-      FillRecord(line, fRecords.back());
-      --linesToRead;
-   }
+   const auto nBytes = ReadChunk();
+   ParseChunk(nBytes);
+   // the values were copied to the column buffers: only keep the bytes that belong to the next chunk
+   fBuffer.erase(0, nBytes);
 
    if (!fColContainingEmpty.empty()) {
       std::string msg = "";
@@ -451,14 +730,14 @@ std::vector<std::pair<ULong64_t, ULong64_t>> RCsvDS::GetEntryRanges()
 
    if (gDebug > 0) {
       if (fLinesChunkSize == -1LL) {
-         Info("GetEntryRanges", "Attempted to read entire CSV file into memory, %zu lines read", fRecords.size());
+         Info("GetEntryRanges", "Attempted to read entire CSV file into memory, %llu lines read", fNRecords);
       } else {
-         Info("GetEntryRanges", "Attempted to read chunk of %lld lines of CSV file into memory, %zu lines read", fLinesChunkSize, fRecords.size());
+         Info("GetEntryRanges", "Attempted to read chunk of %lld lines of CSV file into memory, %llu lines read", fLinesChunkSize, fNRecords);
       }
    }
 
    std::vector<std::pair<ULong64_t, ULong64_t>> entryRanges;
-   const auto nRecords = fRecords.size();
+   const auto nRecords = fNRecords;
    if (0 == nRecords)
       return entryRanges;
 
@@ -507,24 +786,24 @@ bool RCsvDS::SetEntry(unsigned int slot, ULong64_t entry)
    // Here we need to normalise the entry to the number of lines we already processed.
    const auto offset = (fEntryRangesRequested - 1) * fLinesChunkSize;
    const auto recordPos = entry - offset;
+   // Point the readers to the values in the column buffers rather than copying them, except for booleans
    int colIndex = 0;
    for (auto &colType : fColTypesList) {
-      auto dataPtr = fRecords[recordPos][colIndex];
       switch (colType) {
       case 'D': {
-         fDoubleEvtValues[colIndex][slot] = *static_cast<double *>(dataPtr);
+         fColAddresses[colIndex][slot] = &fDoubleColumns[colIndex][recordPos];
          break;
       }
       case 'L': {
-         fLong64EvtValues[colIndex][slot] = *static_cast<Long64_t *>(dataPtr);
+         fColAddresses[colIndex][slot] = &fLong64Columns[colIndex][recordPos];
          break;
       }
       case 'O': {
-         fBoolEvtValues[colIndex][slot] = *static_cast<bool *>(dataPtr);
+         fBoolEvtValues[colIndex][slot] = fBoolColumns[colIndex][recordPos] != 0;
          break;
       }
       case 'T': {
-         fStringEvtValues[colIndex][slot] = *static_cast<std::string *>(dataPtr);
+         fColAddresses[colIndex][slot] = &fStringColumns[colIndex][recordPos];
          break;
       }
       }
@@ -543,10 +822,7 @@ void RCsvDS::SetNSlots(unsigned int nSlots)
    // Initialize the entire set of addresses
    fColAddresses.resize(nColumns, std::vector<void *>(fNSlots, nullptr));
 
-   // Initialize the per event data holders
-   fDoubleEvtValues.resize(nColumns, std::vector<double>(fNSlots));
-   fLong64EvtValues.resize(nColumns, std::vector<Long64_t>(fNSlots));
-   fStringEvtValues.resize(nColumns, std::vector<std::string>(fNSlots));
+   // Initialize the per event data holders of the booleans, the other values are read from the column buffers
    fBoolEvtValues.resize(nColumns, std::deque<bool>(fNSlots));
 }
 
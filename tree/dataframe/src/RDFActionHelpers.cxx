@@ -11,6 +11,17 @@
 #include "ROOT/RDF/ActionHelpers.hxx"
 #include "ROOT/RDF/Utils.hxx" // CacheLineStep
 
+#ifdef R__HAS_ROOT7
+#include "ROOT/REntry.hxx"
+#include "ROOT/RField.hxx"
+#include "ROOT/RNTuple.hxx"
+#include "ROOT/RNTupleDS.hxx"
+#include "ROOT/RNTupleModel.hxx"
+#include "ROOT/RNTupleOptions.hxx"
+#include "ROOT/RNTupleParallelWriter.hxx"
+#include "ROOT/RPageStorageFile.hxx"
+#endif
+
 namespace ROOT {
 namespace Internal {
 namespace RDF {
@@ -254,6 +265,143 @@ void ValidateSnapshotOutput(const RSnapshotOptions &opts, const std::string &tre
    }
 }
 
+#ifdef R__HAS_ROOT7
+namespace {
+/// Whether the compression settings of the snapshot options differ from their defaults.  The defaults are chosen for
+/// TTree output; for RNTuple output, they are taken as not set.
+bool HasExplicitCompression(const RSnapshotOptions &options)
+{
+   const RSnapshotOptions defaults;
+   return options.fCompressionAlgorithm != defaults.fCompressionAlgorithm ||
+          options.fCompressionLevel != defaults.fCompressionLevel;
+}
+
+/// Translates the compression settings of the snapshot options to RNTuple write options.  Without explicit
+/// compression settings, the RNTuple default compression is used.
+ROOT::Experimental::RNTupleWriteOptions GetSnapshotRNTupleWriteOptions(const RSnapshotOptions &options)
+{
+   ROOT::Experimental::RNTupleWriteOptions writeOptions;
+   if (HasExplicitCompression(options))
+      writeOptions.SetCompression(ROOT::CompressionSettings(options.fCompressionAlgorithm, options.fCompressionLevel));
+   return writeOptions;
+}
+} // anonymous namespace
+
+bool CanCopySnapshotColumns(RDataSource *dataSource, const ColumnNames_t &colNames)
+{
+   auto ntupleDS = dynamic_cast<ROOT::Experimental::RNTupleDS *>(dataSource);
+   return ntupleDS && ntupleDS->CanCopyFields(colNames);
+}
+
+struct RSnapshotRNTupleWriter::RImpl {
+   std::unique_ptr<TFile> fOutputFile; // Only used in "UPDATE" mode; must outlive the writer
+   std::unique_ptr<ROOT::Experimental::RNTupleParallelWriter> fWriter;
+   // The fill contexts and their entries are created on the first task of a slot and must be destroyed before fWriter
+   std::vector<std::shared_ptr<ROOT::Experimental::RNTupleFillContext>> fFillContexts;
+   std::vector<std::unique_ptr<ROOT::Experimental::REntry>> fEntries;
+};
+
+RSnapshotRNTupleWriter::RSnapshotRNTupleWriter(unsigned int nSlots, const std::string &fileName,
+                                               const std::string &ntupleName, const RSnapshotOptions &options,
+                                               const ColumnNames_t &inputColumnNames,
+                                               const ColumnNames_t &outputFieldNames,
+                                               const std::vector<std::string> &typeNames)
+   : fImpl(std::make_unique<RImpl>())
+{
+   fImpl->fFillContexts.resize(nSlots);
+   fImpl->fEntries.resize(nSlots);
+
+   auto model = ROOT::Experimental::RNTupleModel::Create();
+   for (std::size_t i = 0; i < typeNames.size(); ++i) {
+      auto field = ROOT::Experimental::Detail::RFieldBase::Create(outputFieldNames[i], typeNames[i]);
+      if (!field) {
+         throw std::runtime_error("Snapshot: cannot write column " + inputColumnNames[i] + " of type " + typeNames[i] +
+                                  " to RNTuple");
+      }
+      model->AddField(field.Unwrap());
+   }
+
+   const auto writeOptions = GetSnapshotRNTupleWriteOptions(options);
+   TString fileMode = options.fMode;
+   fileMode.ToLower();
+   if (fileMode == "update") {
+      fImpl->fOutputFile.reset(TFile::Open(fileName.c_str(), "UPDATE"));
+      if (!fImpl->fOutputFile)
+         throw std::runtime_error("Snapshot: could not create output file " + fileName);
+      fImpl->fWriter = ROOT::Experimental::RNTupleParallelWriter::Append(std::move(model), ntupleName,
+                                                                         *fImpl->fOutputFile, writeOptions);
+   } else {
+      fImpl->fWriter =
+         ROOT::Experimental::RNTupleParallelWriter::Recreate(std::move(model), ntupleName, fileName, writeOptions);
+   }
+}
+
+RSnapshotRNTupleWriter::~RSnapshotRNTupleWriter()
+{
+   // The writer commits the dataset once all the fill contexts are gone
+   fImpl->fEntries.clear();
+   fImpl->fFillContexts.clear();
+   fImpl->fWriter.reset();
+   if (fImpl->fOutputFile)
+      fImpl->fOutputFile->Close();
+}
+
+void RSnapshotRNTupleWriter::InitSlot(unsigned int slot)
+{
+   if (!fImpl->fFillContexts[slot]) {
+      fImpl->fFillContexts[slot] = fImpl->fWriter->CreateFillContext();
+      fImpl->fEntries[slot] = fImpl->fFillContexts[slot]->CreateEntry();
+   }
+}
+
+void RSnapshotRNTupleWriter::Fill(unsigned int slot, void *const *values)
+{
+   // The entry values follow the order of the columns
+   auto &entry = *fImpl->fEntries[slot];
+   std::size_t i = 0;
+   for (auto &value : entry)
+      value = value.GetField()->BindValue(values[i++]);
+   fImpl->fFillContexts[slot]->Fill(entry);
+}
+
+SnapshotRNTupleCopyHelper::SnapshotRNTupleCopyHelper(RDataSource &dataSource, std::string_view filename,
+                                                     std::string_view dirname, std::string_view ntuplename,
+                                                     const ColumnNames_t &colNames, const RSnapshotOptions &options)
+   : fDataSource(&dataSource), fFileName(filename), fNTupleName(ntuplename), fOptions(options), fColumnNames(colNames)
+{
+   if (!dirname.empty())
+      throw std::runtime_error("Snapshot: RNTuple output cannot be written into a sub-directory");
+   ValidateSnapshotOutput(fOptions, fNTupleName, fFileName);
+}
+
+void SnapshotRNTupleCopyHelper::Finalize()
+{
+   auto &ntupleDS = dynamic_cast<ROOT::Experimental::RNTupleDS &>(*fDataSource);
+   auto writeOptions = GetSnapshotRNTupleWriteOptions(fOptions);
+   // Without explicit compression settings, the output keeps the compression of the input such that the sealed pages
+   // are copied verbatim instead of being decompressed and compressed again
+   if (!HasExplicitCompression(fOptions)) {
+      if (auto compression = ntupleDS.GetCommonCompression(fColumnNames))
+         writeOptions.SetCompression(*compression);
+   }
+   TString fileMode = fOptions.fMode;
+   fileMode.ToLower();
+   if (fileMode == "update") {
+      std::unique_ptr<TFile> outputFile{TFile::Open(fFileName.c_str(), "UPDATE")};
+      if (!outputFile)
+         throw std::runtime_error("Snapshot: could not create output file " + fFileName);
+      {
+         ROOT::Experimental::Detail::RPageSinkFile sink(fNTupleName, *outputFile, writeOptions);
+         ntupleDS.CopyFields(fColumnNames, sink);
+      }
+      outputFile->Close();
+   } else {
+      ROOT::Experimental::Detail::RPageSinkFile sink(fNTupleName, fFileName, writeOptions);
+      ntupleDS.CopyFields(fColumnNames, sink);
+   }
+}
+#endif
+
 } // end NS RDF
 } // end NS Internal
 } // end NS ROOT
@@ -14,6 +14,7 @@
 #include "TStopwatch.h"
 #include "RConfigure.h" // R__USE_IMT
 #include "ROOT/RLogger.hxx"
+#include "ROOT/RDF/RJittedFilter.hxx"
 #include "ROOT/RDF/RLoopManager.hxx" // for RLoopManager
 #include "ROOT/RDF/Utils.hxx"
 #include "ROOT/RResultHandle.hxx"    // for RResultHandle, RunGraphs
@@ -23,6 +24,7 @@
 
 #include <algorithm>
 #include <set>
+#include <stdexcept>
 
 // TODO, this function should be part of core libraries
 #include <numeric>
@@ -337,6 +339,63 @@ void AddProgressbar(ROOT::RDataFrame dataframe)
    auto node = ROOT::RDF::AsRNode(dataframe);
    ROOT::RDF::Experimental::AddProgressbar(node);
 }
+
+void SetBulkSize(ROOT::RDF::RNode node, std::size_t bulkSize)
+{
+   node.GetLoopManager()->SetBulkSize(bulkSize);
+}
+
+void SetBulkSize(ROOT::RDataFrame dataframe, std::size_t bulkSize)
+{
+   ROOT::RDF::Experimental::SetBulkSize(ROOT::RDF::AsRNode(dataframe), bulkSize);
+}
+
+void EnableGraphOptimization(ROOT::RDF::RNode node, bool reorderFilters)
+{
+   node.GetLoopManager()->SetGraphOptimization(true, reorderFilters);
+}
+
+void EnableGraphOptimization(ROOT::RDataFrame dataframe, bool reorderFilters)
+{
+   ROOT::RDF::Experimental::EnableGraphOptimization(ROOT::RDF::AsRNode(dataframe), reorderFilters);
+}
+
+void AllowFilterReordering(ROOT::RDF::RNode filter)
+{
+   auto *jittedFilter = dynamic_cast<ROOT::Detail::RDF::RJittedFilter *>(filter.GetProxiedPtr().get());
+   if (jittedFilter == nullptr)
+      throw std::runtime_error("AllowFilterReordering: the node is not a Filter booked with a string expression.");
+   jittedFilter->AllowReordering();
+}
+
+void EnableProfiling(ROOT::RDF::RNode node)
+{
+   node.GetLoopManager()->EnableProfiling();
+}
+
+void EnableProfiling(ROOT::RDataFrame dataframe)
+{
+   ROOT::RDF::Experimental::EnableProfiling(ROOT::RDF::AsRNode(dataframe));
+}
+
+ROOT::RDF::Experimental::RProfileReport GetProfileReport(ROOT::RDF::RNode node)
+{
+   auto *lm = node.GetLoopManager();
+   if (!lm->IsProfilingEnabled())
+      throw std::runtime_error(
+         "GetProfileReport: profiling is not enabled, call EnableProfiling before the event loop.");
+   return lm->GetProfileReport();
+}
+
+ROOT::RDF::Experimental::RProfileReport GetProfileReport(ROOT::RDataFrame dataframe)
+{
+   return ROOT::RDF::Experimental::GetProfileReport(ROOT::RDF::AsRNode(dataframe));
+}
+
+void SetJitCacheDir(std::string_view dir)
+{
+   ROOT::Internal::RDF::SetJitCacheDir(std::string(dir));
+}
 } // namespace Experimental
 } // namespace RDF
 } // namespace ROOT
@@ -19,6 +19,7 @@
 #include <ROOT/RDF/RLoopManager.hxx>
 #include <ROOT/RDF/RNodeBase.hxx>
 #include <ROOT/RDF/Utils.hxx>
+#include <ROOT/RDataFrame.hxx>
 #include <ROOT/RStringView.hxx>
 #include <TBranch.h>
 #include <TClass.h>
@@ -32,6 +33,11 @@
 #include <TString.h>
 #include <TTree.h>
 #include <TVirtualMutex.h>
+#include "RConfigure.h" // for R__HAS_ROOT7
+
+#ifdef R__HAS_ROOT7
+#include <ROOT/RNTupleDS.hxx>
+#endif
 
 // pragma to disable warnings on Rcpp which have
 // so many noise compiling
@@ -325,6 +331,7 @@ static std::string DeclareFunction(const std::string &expr, const ColumnNames_t
 
    // InterpreterDeclare could throw. If it doesn't, mark the function as already jitted
    exprMap.insert({funcCode, funcFullName});
+   ROOT::Internal::RDF::RegisterJitCacheDeclaration(funcFullName, toDeclare);
 
    return funcFullName;
 }
@@ -638,6 +645,35 @@ std::string PrettyPrintAddr(const void *const addr)
    return s.str();
 }
 
+std::string GetJittedNodeKey(const void *function, const ColumnNames_t &columns, const RColumnRegister &colRegister,
+                             const RNodeBase *prevNode)
+{
+   if (function == nullptr)
+      return "";
+
+   std::string key = PrettyPrintAddr(function);
+   if (prevNode != nullptr) {
+      // filters merged into another filter are equivalent to it also as previous nodes
+      const auto *prevFilter = dynamic_cast<const RDFDetail::RJittedFilter *>(prevNode);
+      if (prevFilter != nullptr && prevFilter->GetEquivalentFilter() != nullptr)
+         prevNode = prevFilter->GetEquivalentFilter();
+      key += " prev:" + PrettyPrintAddr(prevNode);
+   }
+   for (const auto &column : columns) {
+      const auto resolvedColumn = colRegister.ResolveAlias(column);
+      const RDFDetail::RDefineBase *define = colRegister.GetDefine(resolvedColumn);
+      if (define == nullptr) {
+         key += " col:" + resolvedColumn;
+         continue;
+      }
+      const auto *jittedDefine = dynamic_cast<const RDFDetail::RJittedDefine *>(define);
+      if (jittedDefine != nullptr && jittedDefine->GetEquivalentDefine() != nullptr)
+         define = jittedDefine->GetEquivalentDefine();
+      key += " def:" + PrettyPrintAddr(define);
+   }
+   return key;
+}
+
 /// Book the jitting of a Filter call
 std::shared_ptr<RDFDetail::RJittedFilter>
 BookFilterJit(std::shared_ptr<RDFDetail::RNodeBase> *prevNodeOnHeap, std::string_view name, std::string_view expression,
@@ -966,6 +1002,19 @@ void CheckForDuplicateSnapshotColumns(const ColumnNames_t &cols)
    }
 }
 
+std::shared_ptr<ROOT::RDataFrame>
+MakeSnapshotRNTupleDataFrame(const std::string &ntupleName, const std::string &fileName)
+{
+#ifdef R__HAS_ROOT7
+   return std::make_shared<ROOT::RDataFrame>(
+      std::make_unique<ROOT::Experimental::RNTupleDS>(ntupleName, std::vector<std::string>{fileName}));
+#else
+   (void)ntupleName;
+   (void)fileName;
+   throw std::runtime_error("Snapshot: writing RNTuple requires ROOT built with the root7 option");
+#endif
+}
+
 /// Return copies of colsWithoutAliases and colsWithAliases with size branches for variable-sized array branches added
 /// in the right positions (i.e. before the array branches that need them).
 std::pair<std::vector<std::string>, std::vector<std::string>>
@@ -0,0 +1,268 @@
+/*************************************************************************
+ * Copyright (C) 1995-2024, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "ROOT/RDF/Utils.hxx"
+#include "ROOT/RLogger.hxx"
+#include "RVersion.h"
+#include "TMD5.h"
+#include "TROOT.h" // gROOTMutex, GetGitCommit
+#include "TSystem.h"
+#include "TVirtualMutex.h"
+
+#include <cctype>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+// The jit cache stores the code that RLoopManager::Jit() would pass to the interpreter, compiled with ACLiC into a
+// shared library. The code to jit calls helper functions such as JitFilterHelper with the addresses of heap-allocated
+// objects of the current process, e.g. `reinterpret_cast<std::weak_ptr<RJittedFilter>*>(0x55d0c2a4f7e0)`: these
+// addresses are replaced by the elements of an array of pointers that is passed to the compiled code, so that the code
+// does not depend on the process and the same library can be used by later runs of the same analysis.
+//
+// Libraries are identified by the MD5 sum of their source code, of the ROOT version and of the compiler flags. They are
+// built in a private temporary directory and then renamed into the cache directory, so that concurrent processes never
+// load an incomplete library: processes that miss the cache at the same time build the same library independently and
+// the last rename wins.
+//
+// Code that cannot be compiled outside of the interpreter is marked by a `.failed` file next to where the library
+// would be, so that later processes fall back to the interpreter right away. The marker records the ROOT version and
+// the compiler; it is ignored, and the compilation is retried, after any of them changed. Deleting the `.failed` files
+// from the cache directory clears the markers.
+
+namespace {
+
+std::string &GetJitCacheDirImpl()
+{
+   static std::string dir;
+   return dir;
+}
+
+/// The names and the declarations of the functions that the code to jit might refer to, in order of declaration
+std::vector<std::pair<std::string, std::string>> &GetJitCacheDeclarations()
+{
+   static std::vector<std::pair<std::string, std::string>> declarations;
+   return declarations;
+}
+
+/// Whether the code contains the given name, not as part of a longer identifier
+bool ContainsName(const std::string &code, const std::string &name)
+{
+   for (auto pos = code.find(name); pos != std::string::npos; pos = code.find(name, pos + 1)) {
+      const auto end = pos + name.size();
+      if (end == code.size() || !(std::isalnum(static_cast<unsigned char>(code[end])) || code[end] == '_'))
+         return true;
+   }
+   return false;
+}
+
+/// The code to jit with the object addresses replaced by `args[i]`, and the addresses
+struct RAddressFreeCode {
+   std::string fCode;
+   std::vector<void *> fArgs;
+};
+
+/// Replace the arguments of the casts `reinterpret_cast<T *>(0x...)` by the elements of the array `args`
+RAddressFreeCode RemoveAddresses(const std::string &code)
+{
+   RAddressFreeCode result;
+   const std::string castArgBegin = ">(0x";
+   std::size_t pos = 0;
+   while (true) {
+      const auto addrBegin = code.find(castArgBegin, pos);
+      if (addrBegin == std::string::npos)
+         break;
+      auto addrEnd = addrBegin + castArgBegin.size();
+      while (addrEnd < code.size() && std::isxdigit(static_cast<unsigned char>(code[addrEnd])))
+         ++addrEnd;
+      // `>(0x` followed by something else than an address and a closing parenthesis is copied verbatim
+      if (addrEnd == addrBegin + castArgBegin.size() || addrEnd == code.size() || code[addrEnd] != ')') {
+         result.fCode.append(code, pos, addrEnd - pos);
+         pos = addrEnd;
+         continue;
+      }
+      const auto addr = code.substr(addrBegin + 2, addrEnd - addrBegin - 2);
+      result.fCode.append(code, pos, addrBegin + 2 - pos);
+      result.fCode += "args[" + std::to_string(result.fArgs.size()) + "]";
+      result.fArgs.emplace_back(reinterpret_cast<void *>(std::strtoull(addr.c_str(), nullptr, 16)));
+      pos = addrEnd;
+   }
+   result.fCode.append(code, pos, std::string::npos);
+   return result;
+}
+
+std::string MD5Sum(const std::string &str)
+{
+   TMD5 md5;
+   md5.Update(reinterpret_cast<const UChar_t *>(str.data()), str.size());
+   md5.Final();
+   return md5.AsString();
+}
+
+/// The source of the cached library: the declarations of the functions that the code refers to and a function with C
+/// linkage that runs the code. Everything lives in a namespace of its own so that the library does not clash with the
+/// declarations that the interpreter has already seen.
+std::string MakeLibrarySource(const std::string &name, const std::string &code)
+{
+   std::string source = "// Generated by RDataFrame, do not edit.\n"
+                        "#include \"ROOT/RDataFrame.hxx\"\n"
+                        "#include \"ROOT/RVec.hxx\"\n"
+                        "#include \"TMath.h\"\n\n"
+                        "namespace " +
+                        name + " {\nusing namespace std;\nusing namespace ROOT::VecOps;\n\n";
+   for (const auto &decl : GetJitCacheDeclarations()) {
+      if (ContainsName(code, decl.first))
+         source += decl.second + "\n";
+   }
+   source += "\nextern \"C\" void " + name + "_run(void **args)\n{\n" + code + "\n}\n} // namespace " + name + "\n";
+   return source;
+}
+
+/// Identifies the ROOT build and the compiler that ACLiC uses, which a compilation failure is only valid for
+std::string GetBuildStamp()
+{
+   return std::string(ROOT_RELEASE) + " " + gROOT->GetGitCommit() + " " + gSystem->GetBuildCompiler() + " " +
+          gSystem->GetBuildCompilerVersionStr() + " " + gSystem->GetMakeSharedLib();
+}
+
+/// Whether the failure marker exists and was written by the same ROOT build with the same compiler
+bool IsMarkedAsFailed(const std::string &failedPath)
+{
+   std::ifstream failedFile(failedPath);
+   std::string stamp;
+   if (!failedFile || !std::getline(failedFile, stamp))
+      return false;
+   // The stamp might contain new lines itself
+   for (std::string line; std::getline(failedFile, line);)
+      stamp += "\n" + line;
+   return stamp == GetBuildStamp();
+}
+
+enum class EBuildResult { kSuccess, kCompilationError, kIOError };
+
+/// Compile the library in a temporary directory and move it into the cache directory
+EBuildResult BuildLibrary(const std::string &cacheDir, const std::string &name, const std::string &source)
+{
+   const std::string tmpDir = cacheDir + "/" + name + ".tmp" + std::to_string(gSystem->GetPid());
+   // the temporary directory might be a leftover of a crashed process with the same process id
+   if (gSystem->AccessPathName(tmpDir.c_str()) && gSystem->mkdir(tmpDir.c_str(), /*recursive=*/true) != 0)
+      return EBuildResult::kIOError;
+   const std::string sourcePath = tmpDir + "/" + name + ".cxx";
+   {
+      std::ofstream sourceFile(sourcePath);
+      sourceFile << source;
+      if (!sourceFile)
+         return EBuildResult::kIOError;
+   }
+
+   // k: keep the library, O: optimize, c: do not load, s: silent, -: build directly in tmpDir
+   const bool isBuilt = gSystem->CompileMacro(sourcePath.c_str(), "kOcs-", "", tmpDir.c_str()) == 1;
+
+   // Move the library last: its existence tells the other processes that the cache entry is complete
+   const std::string libFileName = name + "_cxx." + gSystem->GetSoExt();
+   std::vector<std::string> files;
+   if (auto dir = gSystem->OpenDirectory(tmpDir.c_str())) {
+      while (const char *entry = gSystem->GetDirEntry(dir)) {
+         const std::string fileName = entry;
+         if (fileName != "." && fileName != "..")
+            files.emplace_back(fileName);
+      }
+      gSystem->FreeDirectory(dir);
+   }
+   for (const auto &fileName : files) {
+      const auto path = tmpDir + "/" + fileName;
+      if (isBuilt && fileName != libFileName && fileName.rfind(name + "_cxx", 0) == 0)
+         gSystem->Rename(path.c_str(), (cacheDir + "/" + fileName).c_str());
+      else if (fileName != libFileName)
+         gSystem->Unlink(path.c_str());
+   }
+   const std::string tmpLibPath = tmpDir + "/" + libFileName;
+   const bool isMoved = isBuilt && gSystem->Rename(tmpLibPath.c_str(), (cacheDir + "/" + libFileName).c_str()) == 0;
+   gSystem->Unlink(tmpLibPath.c_str());
+   gSystem->Unlink(tmpDir.c_str());
+   if (!isBuilt)
+      return EBuildResult::kCompilationError;
+   return isMoved ? EBuildResult::kSuccess : EBuildResult::kIOError;
+}
+
+} // anonymous namespace
+
+namespace ROOT {
+namespace Internal {
+namespace RDF {
+
+void SetJitCacheDir(const std::string &dir)
+{
+   R__LOCKGUARD(gROOTMutex);
+   GetJitCacheDirImpl() = dir;
+}
+
+std::string GetJitCacheDir()
+{
+   R__LOCKGUARD(gROOTMutex);
+   return GetJitCacheDirImpl();
+}
+
+void RegisterJitCacheDeclaration(const std::string &name, const std::string &code)
+{
+   R__LOCKGUARD(gROOTMutex);
+   GetJitCacheDeclarations().emplace_back(name, code);
+}
+
+/// Like the interpreter, ACLiC and the dynamic loader must be used under gROOTMutex, so the lock is held throughout,
+/// including while the library is compiled.
+bool JitCacheCalc(const std::string &code)
+{
+   R__LOCKGUARD(gROOTMutex);
+   const auto cacheDir = GetJitCacheDirImpl();
+   if (cacheDir.empty())
+      return false;
+
+   const auto addressFreeCode = RemoveAddresses(code);
+   const auto sourceWithoutName = MakeLibrarySource("R_rdf_jit", addressFreeCode.fCode);
+   const auto name = "R_rdf_jit_" + MD5Sum(std::string(ROOT_RELEASE) + gROOT->GetGitCommit() +
+                                           gSystem->GetIncludePath() + gSystem->GetFlagsOpt() + sourceWithoutName);
+   const auto librarySource = MakeLibrarySource(name, addressFreeCode.fCode);
+
+   const std::string libPath = cacheDir + "/" + name + "_cxx." + gSystem->GetSoExt();
+   // Marks libraries that failed to compile, e.g. because the code refers to functions only known to the interpreter
+   const std::string failedPath = cacheDir + "/" + name + ".failed";
+
+   if (gSystem->AccessPathName(libPath.c_str())) {
+      if (IsMarkedAsFailed(failedPath))
+         return false;
+      R__LOG_INFO(ROOT::Detail::RDF::RDFLogChannel()) << "Compiling " << libPath << " for the jit cache.";
+      const auto result = BuildLibrary(cacheDir, name, librarySource);
+      if (result != EBuildResult::kSuccess) {
+         R__LOG_WARNING(ROOT::Detail::RDF::RDFLogChannel())
+            << "The jitted code could not be " << (result == EBuildResult::kIOError ? "stored in" : "compiled for")
+            << " the jit cache in " << cacheDir << ", falling back to the interpreter.";
+         if (result == EBuildResult::kCompilationError)
+            std::ofstream{failedPath} << GetBuildStamp() << "\n";
+         return false;
+      }
+   } else {
+      R__LOG_INFO(ROOT::Detail::RDF::RDFLogChannel()) << "Using " << libPath << " from the jit cache.";
+   }
+
+   if (gSystem->Load(libPath.c_str()) < 0)
+      return false;
+   auto run = reinterpret_cast<void (*)(void **)>(gSystem->DynFindSymbol(libPath.c_str(), (name + "_run").c_str()));
+   if (run == nullptr)
+      return false;
+
+   auto args = addressFreeCode.fArgs;
+   run(args.data());
+   return true;
+}
+
+} // namespace RDF
+} // namespace Internal
+} // namespace ROOT
@@ -888,6 +888,92 @@ before the first event loop is triggered: just-in-time compilation will happen o
 
 Also make sure not to count the just-in-time compilation time (which happens once before the event loop and does not depend on the size of the dataset) as part of the event loop runtime (which scales with the size of the dataset). RDataFrame has an experimental logging feature that simplifies measuring the time spent in just-in-time compilation and in the event loop (as well as providing some more interesting information). See [Activating RDataFrame execution logs](\ref rdf-logging).
 
+### Bulk processing
+
+By default, RDataFrame passes the entries of the dataset through the computation graph one by one. With `ROOT::RDF::Experimental::SetBulkSize(df, n)`, entries are processed in bulks of up to `n` consecutive entries instead:
+each filter evaluates its expression for all the entries of a bulk that passed the upstream filters, then the defines and actions downstream of it process the entries of the bulk that passed all filters in one go.
+This reduces the per-entry overhead of the event loop, and data sources that can read the values of many entries at once, such as RNTuple, do so.
+
+~~~{.cpp}
+ROOT::RDataFrame df("Events", "file.root");
+ROOT::RDF::Experimental::SetBulkSize(df, 256);
+auto h = df.Filter([](float pt) { return pt > 10.f; }, {"pt"}).Histo1D<float>("pt");
+~~~
+
+The results do not change, but callbacks registered with `OnPartialResult` are called once per processed entry after the whole bulk has been processed.
+Entries are still processed one by one if the computation graph contains [ranges](\ref ranges) or [systematic variations](\ref systematics), or if the values of a column cannot be copied.
+Note that bulk processing reads eagerly: the values of all the columns used in the computation graph are copied into the bulk for every entry before the filters run, including the columns that are only needed by the entries that pass the filters.
+For selective filters on datasets with large columns that are only used downstream of the filters, entry-by-entry processing, which reads a column only when it is needed, can be faster.
+
+### Caching just-in-time compiled code
+
+Analyses that are run many times with the same computation graph, e.g. on different subsets of a dataset, pay the cost of just-in-time compilation in every process.
+With `ROOT::RDF::Experimental::SetJitCacheDir(dir)`, the code that RDataFrame generates right before the event loop is compiled once into a shared library that is stored in `dir`; later processes that generate the same code load the library instead of invoking the interpreter.
+
+~~~{.cpp}
+ROOT::RDF::Experimental::SetJitCacheDir("/tmp/rdf-jit-cache");
+ROOT::RDataFrame df("Events", "file.root");
+auto h = df.Filter("pt > 10").Histo1D("pt"); // the generated code is compiled and stored on the first run only
+~~~
+
+Libraries are identified by a hash of their source code, of the ROOT version and of the compiler flags, so that a change in any of them results in a new library.
+The cache directory can be shared by concurrent processes: libraries are built in a private temporary directory and only then moved into the cache.
+If the generated code cannot be compiled outside of the interpreter, e.g. because an expression calls a function that was only declared to the interpreter, RDataFrame falls back to the interpreter and remembers the failure in the cache.
+The failure is remembered in a `.failed` file that records the ROOT version and the compiler; the compilation is retried after any of them changed, and deleting the `.failed` files from the cache directory makes RDataFrame retry right away.
+The cache does not reduce the cost of booking operations with string expressions, which are still declared to the interpreter.
+
+### Graph optimization
+
+Computation graphs that are built programmatically often contain the same string expression several times, e.g. the same Define in different branches of the graph.
+With `ROOT::RDF::Experimental::EnableGraphOptimization(df)`, RDataFrame merges equivalent nodes of the computation graph when it compiles them just in time, so that their expressions are evaluated once per entry:
+- Defines with the same expression and the same input columns, possibly with different names;
+- unnamed Filters with the same expression, the same input columns and the same previous node.
+
+~~~{.cpp}
+ROOT::RDataFrame df("Events", "file.root");
+ROOT::RDF::Experimental::EnableGraphOptimization(df, true); // also reorder chains of Filters
+auto dd = df.Define("pt2", "pt * pt");
+auto h1 = dd.Filter("pt2 > 100").Histo1D("pt");
+auto h2 = dd.Define("ptSquared", "pt * pt").Filter("ptSquared > 100").Histo1D("eta"); // evaluates "pt * pt" and the filter once
+~~~
+
+Nodes are only merged if they are booked with string expressions and are not affected by [systematic variations](\ref systematics); named Filters are never merged, as they appear in [cutflow reports](\ref named-filters-and-cutflow-reports).
+Expressions must not have side effects, e.g. calling `gRandom->Rndm()` in two Defines yields the same value for both with graph optimization enabled.
+After just-in-time compilation, GetFilterNames() lists merged Filters once.
+
+If `reorderFilters` is true, chains of unnamed Filters booked with string expressions, in which each Filter is the only child of the previous one, are evaluated in an optimized order: for each processing slot, the first 1000 entries are used to measure the fraction of entries that pass each Filter and the time spent evaluating it, then the Filters that reject the most entries for the least time are evaluated first.
+A Filter is only chained to the one it is booked on if it is marked with `ROOT::RDF::Experimental::AllowFilterReordering()`, which states that its expression is valid for any entry, including the ones rejected by the previous Filters.
+Do not mark a Filter that is guarded by a previous one, e.g. the second Filter of `Filter("v.size() > 0").Filter("v[0] > 10")`:
+
+~~~{.cpp}
+auto df2 = df.Filter("nMuon > 1");
+auto df3 = df2.Filter("nElectron == 0");
+ROOT::RDF::Experimental::AllowFilterReordering(df3); // "nElectron == 0" can be evaluated before "nMuon > 1"
+~~~
+
+The selected entries do not change.
+Reordering applies to entry-by-entry processing; [bulk processing](\ref parallel-execution) keeps the booking order.
+
+### Profiling the event loop
+
+`ROOT::RDF::Experimental::EnableProfiling(df)` makes the following event loops measure the time spent in each Filter, Define, Action and dataset column reader, per processing slot, as well as the wall-clock time, the CPU time and the number of entries of each task:
+
+~~~{.cpp}
+ROOT::RDataFrame df("Events", {"file1.root", "file2.root"});
+ROOT::RDF::Experimental::EnableProfiling(df);
+auto h = df.Define("pt2", "pt * pt").Filter("pt2 > 100").Histo1D("eta");
+h->Draw(); // runs the event loop
+auto profile = ROOT::RDF::Experimental::GetProfileReport(df);
+profile.Print(); // the nodes, sorted by the time spent in them
+std::ofstream("profile.json") << profile.ToChromeTrace(); // open with chrome://tracing or https://ui.perfetto.dev
+~~~
+
+The time of a node excludes the time spent in the nodes it depends on: the time spent reading and decompressing the input columns of a Filter is accounted to the column readers, the time spent computing the Defines it uses to the Defines.
+The I/O wait of a task is the difference between its wall-clock time and the CPU time of the thread that processed it, e.g. the time spent waiting for data to be read from a remote file.
+ROOT::RDF::Experimental::RProfileReport::ToJSON() returns the complete report, ToChromeTrace() shows the tasks of each slot on a timeline, each task split into the time spent in the nodes.
+
+Profiling adds two clock readings to every evaluation of a node, which is significant for very cheap expressions. When profiling is not enabled, the nodes only check a null pointer.
+
 ### Memory usage
 
 There are two reasons why RDataFrame may consume more memory than expected. Firstly, each result is duplicated for each worker thread, which e.g. in case of many (possibly multi-dimensional) histograms with fine binning can result in visible memory consumption during the event loop. The thread-local copies of the results are destroyed when the final result is produced. Reducing the number of threads or using coarser binning will reduce the memory usage.
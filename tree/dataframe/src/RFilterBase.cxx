@@ -23,7 +23,8 @@ RFilterBase::RFilterBase(RLoopManager *implPtr, std::string_view name, const uns
      fLastCheckedEntry(nSlots * RDFInternal::CacheLineStep<Long64_t>(), -1),
      fLastResult(nSlots * RDFInternal::CacheLineStep<int>()),
      fAccepted(nSlots * RDFInternal::CacheLineStep<ULong64_t>()),
-     fRejected(nSlots * RDFInternal::CacheLineStep<ULong64_t>()), fName(name), fColumnNames(columns),
+     fRejected(nSlots * RDFInternal::CacheLineStep<ULong64_t>()), fLastBulkResult(nSlots), fName(name),
+     fColumnNames(columns),
      fColRegister(colRegister), fIsDefine(columns.size()), fVariation(variation)
 {
    const auto nColumns = fColumnNames.size();
@@ -0,0 +1,85 @@
+/*************************************************************************
+ * Copyright (C) 1995-2024, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "ROOT/RDF/RFilterChain.hxx"
+#include "ROOT/RDF/RFilterBase.hxx"
+#include "ROOT/RDF/Utils.hxx" // CacheLineStep
+
+#include <algorithm>
+#include <chrono>
+#include <limits>
+#include <numeric>
+
+using ROOT::Internal::RDF::RFilterChain;
+
+RFilterChain::RFilterChain(ROOT::Detail::RDF::RNodeBase &prevNode,
+                           const std::vector<ROOT::Detail::RDF::RFilterBase *> &filters, unsigned int nSlots)
+   : fPrevNode(prevNode),
+     fFilters(filters),
+     fLastCheckedEntry(nSlots * CacheLineStep<Long64_t>(), -1),
+     fLastResult(nSlots * CacheLineStep<int>()),
+     fSlotStats(nSlots)
+{
+   for (auto &stats : fSlotStats) {
+      stats.fNPassed.resize(fFilters.size(), 0);
+      stats.fTime.resize(fFilters.size(), 0.);
+   }
+}
+
+void RFilterChain::SetOrder(RSlotStats &stats) const
+{
+   const auto nFilters = fFilters.size();
+   // The expected cost of evaluating filter i and all the filters after it is minimal if the filters are sorted by
+   // cost_i / (1 - passFraction_i), assuming that the filters are independent
+   std::vector<double> ranks(nFilters);
+   for (std::size_t i = 0; i < nFilters; ++i) {
+      const double rejectedFraction = 1. - double(stats.fNPassed[i]) / double(stats.fNEntries);
+      ranks[i] = rejectedFraction > 0. ? stats.fTime[i] / rejectedFraction : std::numeric_limits<double>::infinity();
+   }
+   std::vector<std::size_t> order(nFilters);
+   std::iota(order.begin(), order.end(), 0);
+   std::stable_sort(order.begin(), order.end(), [&ranks](std::size_t i, std::size_t j) { return ranks[i] < ranks[j]; });
+   stats.fOrder = std::move(order);
+}
+
+bool RFilterChain::CheckFilters(unsigned int slot, Long64_t entry)
+{
+   auto &lastCheckedEntry = fLastCheckedEntry[slot * CacheLineStep<Long64_t>()];
+   auto &lastResult = fLastResult[slot * CacheLineStep<int>()];
+   if (entry == lastCheckedEntry)
+      return lastResult;
+   lastCheckedEntry = entry;
+
+   if (!fPrevNode.CheckFilters(slot, entry)) {
+      lastResult = false;
+      return false;
+   }
+
+   auto &stats = fSlotStats[slot];
+   if (!stats.fOrder.empty()) {
+      lastResult = std::all_of(stats.fOrder.begin(), stats.fOrder.end(),
+                               [&](std::size_t i) { return fFilters[i]->CheckPredicate(slot, entry); });
+      return lastResult;
+   }
+
+   // warm-up: evaluate all filters, so that the fraction of passing entries of each filter is measured independently
+   // of the others
+   bool passed = true;
+   for (std::size_t i = 0; i < fFilters.size(); ++i) {
+      const auto start = std::chrono::steady_clock::now();
+      const bool passedThis = fFilters[i]->CheckPredicate(slot, entry);
+      stats.fTime[i] += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+      if (passedThis)
+         ++stats.fNPassed[i];
+      passed = passed && passedThis;
+   }
+   if (++stats.fNEntries == kNWarmUpEntries)
+      SetOrder(stats);
+   lastResult = passed;
+   return passed;
+}
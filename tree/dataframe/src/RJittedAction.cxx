@@ -67,12 +67,24 @@ RJittedAction::RJittedAction(RLoopManager &lm, const ROOT::RDF::ColumnNames_t &c
 
 RJittedAction::~RJittedAction() {}
 
+std::string RJittedAction::GetActionName()
+{
+   assert(fConcreteAction != nullptr);
+   return fConcreteAction->GetActionName();
+}
+
 void RJittedAction::Run(unsigned int slot, Long64_t entry)
 {
    assert(fConcreteAction != nullptr);
    fConcreteAction->Run(slot, entry);
 }
 
+void RJittedAction::RunBulk(unsigned int slot, const RMaskedEntryRange &bulk)
+{
+   assert(fConcreteAction != nullptr);
+   fConcreteAction->RunBulk(slot, bulk);
+}
+
 void RJittedAction::Initialize()
 {
    assert(fConcreteAction != nullptr);
@@ -148,6 +160,12 @@ ROOT::RDF::SampleCallback_t RJittedAction::GetSampleCallback()
    return fConcreteAction->GetSampleCallback();
 }
 
+bool RJittedAction::NeedsEventLoop() const
+{
+   assert(fConcreteAction != nullptr);
+   return fConcreteAction->NeedsEventLoop();
+}
+
 std::unique_ptr<ROOT::Internal::RDF::RActionBase> RJittedAction::MakeVariedAction(std::vector<void *> &&results)
 {
    assert(fConcreteAction != nullptr);
@@ -16,22 +16,28 @@ using namespace ROOT::Detail::RDF;
 
 RJittedDefine::~RJittedDefine() {}
 
-void RJittedDefine::InitSlot(TTreeReader *r, unsigned int slot)
+RDefineBase &RJittedDefine::GetTarget() const
 {
+   if (fEquivalentDefine)
+      return *fEquivalentDefine;
    assert(fConcreteDefine != nullptr);
-   fConcreteDefine->InitSlot(r, slot);
+   return *fConcreteDefine;
+}
+
+void RJittedDefine::InitSlot(TTreeReader *r, unsigned int slot)
+{
+   GetTarget().InitSlot(r, slot);
 }
 
 void *RJittedDefine::GetValuePtr(unsigned int slot)
 {
-   assert(fConcreteDefine != nullptr);
-   return fConcreteDefine->GetValuePtr(slot);
+   return GetTarget().GetValuePtr(slot);
 }
 
 const std::type_info &RJittedDefine::GetTypeId() const
 {
-   if (fConcreteDefine)
-      return fConcreteDefine->GetTypeId();
+   if (fConcreteDefine || fEquivalentDefine)
+      return GetTarget().GetTypeId();
    else if (fTypeId)
       return *fTypeId;
    else
@@ -41,30 +47,40 @@ const std::type_info &RJittedDefine::GetTypeId() const
 
 void RJittedDefine::Update(unsigned int slot, Long64_t entry)
 {
-   assert(fConcreteDefine != nullptr);
-   fConcreteDefine->Update(slot, entry);
+   GetTarget().Update(slot, entry);
 }
 
 void RJittedDefine::Update(unsigned int slot, const ROOT::RDF::RSampleInfo &id)
 {
-   assert(fConcreteDefine != nullptr);
-   fConcreteDefine->Update(slot, id);
+   GetTarget().Update(slot, id);
+}
+
+void *RJittedDefine::GetBulkValuePtr(unsigned int slot)
+{
+   return GetTarget().GetBulkValuePtr(slot);
+}
+
+void RJittedDefine::UpdateBulk(unsigned int slot, const ROOT::Internal::RDF::RMaskedEntryRange &mask)
+{
+   GetTarget().UpdateBulk(slot, mask);
+}
+
+bool RJittedDefine::IsBulkSupported() const
+{
+   return GetTarget().IsBulkSupported();
 }
 
 void RJittedDefine::FinalizeSlot(unsigned int slot)
 {
-   assert(fConcreteDefine != nullptr);
-   fConcreteDefine->FinalizeSlot(slot);
+   GetTarget().FinalizeSlot(slot);
 }
 
 void RJittedDefine::MakeVariations(const std::vector<std::string> &variations)
 {
-   assert(fConcreteDefine != nullptr);
-   return fConcreteDefine->MakeVariations(variations);
+   return GetTarget().MakeVariations(variations);
 }
 
 RDefineBase &RJittedDefine::GetVariedDefine(const std::string &variationName)
 {
-   assert(fConcreteDefine != nullptr);
-   return fConcreteDefine->GetVariedDefine(variationName);
+   return GetTarget().GetVariedDefine(variationName);
 }
@@ -47,99 +47,129 @@ void RJittedFilter::SetFilter(std::unique_ptr<RFilterBase> f)
    fConcreteFilter = std::move(f);
 }
 
-void RJittedFilter::InitSlot(TTreeReader *r, unsigned int slot)
+void RJittedFilter::SetEquivalentFilter(std::shared_ptr<RJittedFilter> f)
+{
+   // like SetFilter: the equivalent filter stands in for this one from now on
+   fLoopManager->Deregister(this);
+   fEquivalentFilter = std::move(f);
+   // the equivalent filter has the same expression and the same previous node
+   if (fIsReorderable)
+      fEquivalentFilter->AllowReordering();
+}
+
+void RJittedFilter::AllowReordering()
 {
+   fIsReorderable = true;
+   if (fEquivalentFilter)
+      fEquivalentFilter->AllowReordering();
+}
+
+RFilterBase &RJittedFilter::GetTarget() const
+{
+   if (fEquivalentFilter)
+      return *fEquivalentFilter;
    assert(fConcreteFilter != nullptr);
-   fConcreteFilter->InitSlot(r, slot);
+   return *fConcreteFilter;
+}
+
+void RJittedFilter::InitSlot(TTreeReader *r, unsigned int slot)
+{
+   GetTarget().InitSlot(r, slot);
 }
 
 bool RJittedFilter::CheckFilters(unsigned int slot, Long64_t entry)
 {
-   assert(fConcreteFilter != nullptr);
-   return fConcreteFilter->CheckFilters(slot, entry);
+   if (fChain)
+      return fChain->CheckFilters(slot, entry);
+   return GetTarget().CheckFilters(slot, entry);
+}
+
+bool RJittedFilter::CheckPredicate(unsigned int slot, Long64_t entry)
+{
+   return GetTarget().CheckPredicate(slot, entry);
+}
+
+RNodeBase *RJittedFilter::GetPrevNode() const
+{
+   return GetTarget().GetPrevNode();
+}
+
+const ROOT::Internal::RDF::RMaskedEntryRange &
+RJittedFilter::CheckFiltersBulk(unsigned int slot, const ROOT::Internal::RDF::RMaskedEntryRange &bulk)
+{
+   return GetTarget().CheckFiltersBulk(slot, bulk);
 }
 
 void RJittedFilter::Report(ROOT::RDF::RCutFlowReport &cr) const
 {
-   assert(fConcreteFilter != nullptr);
-   fConcreteFilter->Report(cr);
+   GetTarget().Report(cr);
 }
 
 void RJittedFilter::PartialReport(ROOT::RDF::RCutFlowReport &cr) const
 {
-   assert(fConcreteFilter != nullptr);
-   fConcreteFilter->PartialReport(cr);
+   GetTarget().PartialReport(cr);
 }
 
 void RJittedFilter::FillReport(ROOT::RDF::RCutFlowReport &cr) const
 {
-   assert(fConcreteFilter != nullptr);
-   fConcreteFilter->FillReport(cr);
+   GetTarget().FillReport(cr);
 }
 
 void RJittedFilter::IncrChildrenCount()
 {
-   assert(fConcreteFilter != nullptr);
-   fConcreteFilter->IncrChildrenCount();
+   GetTarget().IncrChildrenCount();
 }
 
 void RJittedFilter::StopProcessing()
 {
-   assert(fConcreteFilter != nullptr);
-   fConcreteFilter->StopProcessing();
+   GetTarget().StopProcessing();
 }
 
 void RJittedFilter::ResetChildrenCount()
 {
-   assert(fConcreteFilter != nullptr);
-   fConcreteFilter->ResetChildrenCount();
+   GetTarget().ResetChildrenCount();
 }
 
 void RJittedFilter::TriggerChildrenCount()
 {
-   assert(fConcreteFilter != nullptr);
-   fConcreteFilter->TriggerChildrenCount();
+   GetTarget().TriggerChildrenCount();
 }
 
 void RJittedFilter::ResetReportCount()
 {
-   assert(fConcreteFilter != nullptr);
-   fConcreteFilter->ResetReportCount();
+   GetTarget().ResetReportCount();
 }
 
 void RJittedFilter::FinalizeSlot(unsigned int slot)
 {
-   assert(fConcreteFilter != nullptr);
-   fConcreteFilter->FinalizeSlot(slot);
+   GetTarget().FinalizeSlot(slot);
 }
 
 void RJittedFilter::InitNode()
 {
-   assert(fConcreteFilter != nullptr);
-   fConcreteFilter->InitNode();
+   GetTarget().InitNode();
 }
 
 void RJittedFilter::AddFilterName(std::vector<std::string> &filters)
 {
-   if (fConcreteFilter == nullptr) {
+   if (fConcreteFilter == nullptr && fEquivalentFilter == nullptr) {
       // No event loop performed yet, but the JITTING must be performed.
       GetLoopManagerUnchecked()->Jit();
    }
-   fConcreteFilter->AddFilterName(filters);
+   GetTarget().AddFilterName(filters);
 }
 
 std::shared_ptr<RDFGraphDrawing::GraphNode>
 RJittedFilter::GetGraph(std::unordered_map<void *, std::shared_ptr<RDFGraphDrawing::GraphNode>> &visitedMap)
 {
-   if (fConcreteFilter != nullptr) {
+   if (fConcreteFilter != nullptr || fEquivalentFilter != nullptr) {
       // Here the filter exists, so it can be served
-      return fConcreteFilter->GetGraph(visitedMap);
+      return GetTarget().GetGraph(visitedMap);
    }
    throw std::runtime_error("The Jitting should have been invoked before this method.");
 }
 
 std::shared_ptr<RNodeBase> RJittedFilter::GetVariedFilter(const std::string &variationName)
 {
-   assert(fConcreteFilter != nullptr);
-   return fConcreteFilter->GetVariedFilter(variationName);
+   return GetTarget().GetVariedFilter(variationName);
 }
@@ -13,6 +13,9 @@
 #include "ROOT/RDF/RActionBase.hxx"
 #include "ROOT/RDF/RDefineBase.hxx"
 #include "ROOT/RDF/RFilterBase.hxx"
+#include "ROOT/RDF/RFilterChain.hxx"
+#include "ROOT/RDF/RJittedDefine.hxx"
+#include "ROOT/RDF/RJittedFilter.hxx"
 #include "ROOT/RDF/RLoopManager.hxx"
 #include "ROOT/RDF/RRangeBase.hxx"
 #include "ROOT/RDF/RVariationBase.hxx"
@@ -41,11 +44,13 @@
 #include <functional>
 #include <iostream>
 #include <memory>
+#include <mutex>
 #include <stdexcept>
 #include <string>
 #include <sstream>
 #include <thread>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 #include <set>
 #include <limits> // For MaxTreeSizeRAII. Revert when #6640 will be solved.
@@ -346,7 +351,8 @@ RLoopManager::RLoopManager(TTree *tree, const ColumnNames_t &defaultBranches)
    : fTree(std::shared_ptr<TTree>(tree, [](TTree *) {})), fDefaultColumns(defaultBranches),
      fNSlots(RDFInternal::GetNSlots()),
      fLoopType(ROOT::IsImplicitMTEnabled() ? ELoopType::kROOTFilesMT : ELoopType::kROOTFiles),
-     fNewSampleNotifier(fNSlots), fSampleInfos(fNSlots), fDatasetColumnReaders(fNSlots)
+     fNewSampleNotifier(fNSlots), fSampleInfos(fNSlots), fDatasetColumnReaders(fNSlots),
+     fBulkLoadReaders(fNSlots), fBulkRandomAccessReaders(fNSlots)
 {
 }
 
@@ -356,14 +362,17 @@ RLoopManager::RLoopManager(ULong64_t nEmptyEntries)
      fLoopType(ROOT::IsImplicitMTEnabled() ? ELoopType::kNoFilesMT : ELoopType::kNoFiles),
      fNewSampleNotifier(fNSlots),
      fSampleInfos(fNSlots),
-     fDatasetColumnReaders(fNSlots)
+     fDatasetColumnReaders(fNSlots),
+     fBulkLoadReaders(fNSlots),
+     fBulkRandomAccessReaders(fNSlots)
 {
 }
 
 RLoopManager::RLoopManager(std::unique_ptr<RDataSource> ds, const ColumnNames_t &defaultBranches)
    : fDefaultColumns(defaultBranches), fNSlots(RDFInternal::GetNSlots()),
      fLoopType(ROOT::IsImplicitMTEnabled() ? ELoopType::kDataSourceMT : ELoopType::kDataSource),
-     fDataSource(std::move(ds)), fNewSampleNotifier(fNSlots), fSampleInfos(fNSlots), fDatasetColumnReaders(fNSlots)
+     fDataSource(std::move(ds)), fNewSampleNotifier(fNSlots), fSampleInfos(fNSlots), fDatasetColumnReaders(fNSlots),
+     fBulkLoadReaders(fNSlots), fBulkRandomAccessReaders(fNSlots)
 {
    fDataSource->SetNSlots(fNSlots);
 }
@@ -373,7 +382,9 @@ RLoopManager::RLoopManager(ROOT::RDF::Experimental::RDatasetSpec &&spec)
      fLoopType(ROOT::IsImplicitMTEnabled() ? ELoopType::kROOTFilesMT : ELoopType::kROOTFiles),
      fNewSampleNotifier(fNSlots),
      fSampleInfos(fNSlots),
-     fDatasetColumnReaders(fNSlots)
+     fDatasetColumnReaders(fNSlots),
+     fBulkLoadReaders(fNSlots),
+     fBulkRandomAccessReaders(fNSlots)
 {
    ChangeSpec(std::move(spec));
 }
@@ -429,6 +440,138 @@ void RLoopManager::ChangeSpec(ROOT::RDF::Experimental::RDatasetSpec &&spec)
    }
 }
 
+/// Prepare the bulk processing of the entries of the given slot and return true, or return false if the entries need
+/// to be processed one by one. This is the case if bulk processing is disabled, if the computation graph has ranges or
+/// systematic variations, if the values of a Define cannot be stored in bulks, or if one of the dataset column readers
+/// cannot provide the values of a bulk.
+bool RLoopManager::InitBulkReaders(unsigned int slot)
+{
+   auto &loadReaders = fBulkLoadReaders[slot];
+   auto &randomAccessReaders = fBulkRandomAccessReaders[slot];
+   loadReaders.clear();
+   randomAccessReaders.clear();
+   if (fBulkSize == 0 || !fBookedRanges.empty() || !fBookedVariations.empty())
+      return false;
+   for (auto *define : fBookedDefines) {
+      if (!define->IsBulkSupported())
+         return false;
+   }
+
+   for (auto &keyAndReader : fDatasetColumnReaders[slot]) {
+      auto *reader = keyAndReader.second.get();
+      if (reader == nullptr)
+         continue; // a TTree column reader of a previous task that is not used anymore
+      switch (reader->GetBulkMode()) {
+      case RColumnReaderBase::EBulkMode::kLoadEntries: loadReaders.emplace_back(reader); break;
+      case RColumnReaderBase::EBulkMode::kRandomAccess: randomAccessReaders.emplace_back(reader); break;
+      case RColumnReaderBase::EBulkMode::kNone:
+         R__LOG_DEBUG(0, RDFLogChannel()) << "Column reader " << keyAndReader.first
+                                          << " does not support bulk reading, processing entries one by one.";
+         loadReaders.clear();
+         randomAccessReaders.clear();
+         return false;
+      }
+   }
+   return true;
+}
+
+/// Run the data-block callbacks if the slot moved on to a new data block.
+void RLoopManager::RunSampleCallbacks(unsigned int slot)
+{
+   if (fNewSampleNotifier.CheckFlag(slot)) {
+      for (auto &callback : fSampleCallbacks)
+         callback.second(slot, fSampleInfos[slot]);
+      fNewSampleNotifier.UnsetFlag(slot);
+   }
+}
+
+/// Copy the values of the entry that the input is positioned on into the idx-th element of the current bulk.
+void RLoopManager::LoadBulkEntry(unsigned int slot, std::size_t idx, Long64_t entry)
+{
+   for (auto *reader : fBulkLoadReaders[slot])
+      reader->LoadBulkEntry(idx, entry);
+}
+
+/// Bulk counterpart of RunAndCheckFilters(). The data-block callbacks need to be run before the first bulk of every
+/// data block, bulks never span more than one data block.
+void RLoopManager::RunAndCheckFiltersBulk(unsigned int slot, const RMaskedEntryRange &bulk)
+{
+   if (fProfiler)
+      fProfiler->AddEntries(slot, bulk.Count());
+   for (auto *actionPtr : fBookedActions) {
+      // the time spent in the Filters, Defines and column readers upstream is accounted to them by their own timers
+      RDFInternal::RNodeTimer timer(actionPtr->GetProfile(), slot);
+      actionPtr->RunBulk(slot, bulk);
+   }
+   for (auto *namedFilterPtr : fBookedNamedFilters)
+      namedFilterPtr->CheckFiltersBulk(slot, bulk);
+   if (!fCallbacks.empty()) {
+      const auto nEntries = bulk.Count();
+      for (std::size_t i = 0; i < nEntries; ++i) {
+         for (auto &callback : fCallbacks)
+            callback(slot);
+      }
+   }
+}
+
+/// Process the entries [begin, end) in bulks. `setEntry(entry)` positions the input on the given entry and returns
+/// false if the entry must be skipped.
+template <typename SetEntry_t>
+void RLoopManager::RunBulks(unsigned int slot, ULong64_t begin, ULong64_t end, SetEntry_t &&setEntry)
+{
+   RMaskedEntryRange bulk;
+   for (auto bulkBegin = begin; bulkBegin < end && fNStopsReceived < fNChildren;) {
+      std::size_t bulkSize = std::min<ULong64_t>(fBulkSize, end - bulkBegin);
+      for (auto *reader : fBulkRandomAccessReaders[slot])
+         bulkSize = std::min(bulkSize, reader->GetMaxBulkSize(bulkBegin));
+      R__ASSERT(bulkSize > 0);
+
+      RunSampleCallbacks(slot);
+      bulk.Reset(bulkBegin, bulkSize);
+      for (std::size_t i = 0; i < bulkSize; ++i) {
+         if (setEntry(bulkBegin + i))
+            LoadBulkEntry(slot, i, bulkBegin + i);
+         else
+            bulk[i] = false;
+      }
+      RunAndCheckFiltersBulk(slot, bulk);
+      bulkBegin += bulkSize;
+   }
+}
+
+/// Process the entries of the TTreeReader in bulks. `getEntry()` returns the entry number of the entry that the
+/// TTreeReader has just moved to. A bulk ends when it is full, at the end of a data block, or at the first entry that
+/// does not fit in the bulk because entries were skipped, e.g. by an entry list.
+template <typename GetEntry_t>
+void RLoopManager::RunTreeReaderBulks(TTreeReader &r, unsigned int slot, GetEntry_t &&getEntry)
+{
+   RMaskedEntryRange bulk;
+   std::size_t nLoaded = 0; // the size of the current bulk, including skipped entries
+   while (r.Next() && fNStopsReceived < fNChildren) {
+      const Long64_t entry = getEntry();
+      const bool isNewSample = fNewSampleNotifier.CheckFlag(slot);
+      if (nLoaded > 0 && (isNewSample || entry - bulk.FirstEntry() >= static_cast<Long64_t>(fBulkSize))) {
+         bulk.Resize(nLoaded);
+         RunAndCheckFiltersBulk(slot, bulk);
+         nLoaded = 0;
+      }
+      if (nLoaded == 0) {
+         if (isNewSample)
+            UpdateSampleInfo(slot, r);
+         RunSampleCallbacks(slot);
+         bulk.Reset(entry, fBulkSize, /*selected=*/false);
+      }
+      const std::size_t idx = entry - bulk.FirstEntry();
+      bulk[idx] = true;
+      LoadBulkEntry(slot, idx, entry);
+      nLoaded = idx + 1;
+   }
+   if (nLoaded > 0) {
+      bulk.Resize(nLoaded);
+      RunAndCheckFiltersBulk(slot, bulk);
+   }
+}
+
 /// Run event loop with no source files, in parallel.
 void RLoopManager::RunEmptySourceMT()
 {
@@ -460,8 +603,12 @@ void RLoopManager::RunEmptySourceMT()
       R__LOG_DEBUG(0, RDFLogChannel()) << LogRangeProcessing({"an empty source", range.first, range.second, slot});
       try {
          UpdateSampleInfo(slot, range);
-         for (auto currEntry = range.first; currEntry < range.second; ++currEntry) {
-            RunAndCheckFilters(slot, currEntry);
+         if (InitBulkReaders(slot)) {
+            RunBulks(slot, range.first, range.second, [](ULong64_t) { return true; });
+         } else {
+            for (auto currEntry = range.first; currEntry < range.second; ++currEntry) {
+               RunAndCheckFilters(slot, currEntry);
+            }
          }
       } catch (...) {
          // Error might throw in experiment frameworks like CMSSW
@@ -485,9 +632,13 @@ void RLoopManager::RunEmptySource()
    RCallCleanUpTask cleanup(*this);
    try {
       UpdateSampleInfo(/*slot*/ 0, fEmptyEntryRange);
-      for (ULong64_t currEntry = fEmptyEntryRange.first;
-           currEntry < fEmptyEntryRange.second && fNStopsReceived < fNChildren; ++currEntry) {
-         RunAndCheckFilters(0, currEntry);
+      if (InitBulkReaders(0)) {
+         RunBulks(0, fEmptyEntryRange.first, fEmptyEntryRange.second, [](ULong64_t) { return true; });
+      } else {
+         for (ULong64_t currEntry = fEmptyEntryRange.first;
+              currEntry < fEmptyEntryRange.second && fNStopsReceived < fNChildren; ++currEntry) {
+            RunAndCheckFilters(0, currEntry);
+         }
       }
    } catch (...) {
       std::cerr << "RDataFrame::Run: event loop was interrupted\n";
@@ -520,11 +671,15 @@ void RLoopManager::RunTreeProcessorMT()
       auto count = entryCount.fetch_add(nEntries);
       try {
          // recursive call to check filters and conditionally execute actions
-         while (r.Next()) {
-            if (fNewSampleNotifier.CheckFlag(slot)) {
-               UpdateSampleInfo(slot, r);
+         if (InitBulkReaders(slot)) {
+            RunTreeReaderBulks(r, slot, [&count]() { return count++; });
+         } else {
+            while (r.Next()) {
+               if (fNewSampleNotifier.CheckFlag(slot)) {
+                  UpdateSampleInfo(slot, r);
+               }
+               RunAndCheckFilters(slot, count++);
             }
-            RunAndCheckFilters(slot, count++);
          }
       } catch (...) {
          std::cerr << "RDataFrame::Run: event loop was interrupted\n";
@@ -561,11 +716,15 @@ void RLoopManager::RunTreeReader()
    // recursive call to check filters and conditionally execute actions
    // in the non-MT case processing can be stopped early by ranges, hence the check on fNStopsReceived
    try {
-      while (r.Next() && fNStopsReceived < fNChildren) {
-         if (fNewSampleNotifier.CheckFlag(0)) {
-            UpdateSampleInfo(/*slot*/0, r);
+      if (InitBulkReaders(0)) {
+         RunTreeReaderBulks(r, 0, [&r]() { return r.GetCurrentEntry(); });
+      } else {
+         while (r.Next() && fNStopsReceived < fNChildren) {
+            if (fNewSampleNotifier.CheckFlag(0)) {
+               UpdateSampleInfo(/*slot*/0, r);
+            }
+            RunAndCheckFilters(0, r.GetCurrentEntry());
          }
-         RunAndCheckFilters(0, r.GetCurrentEntry());
       }
    } catch (...) {
       std::cerr << "RDataFrame::Run: event loop was interrupted\n";
@@ -578,21 +737,53 @@ void RLoopManager::RunTreeReader()
    }
 }
 
+ColumnNames_t RLoopManager::GetDataSourceFilterColumns() const
+{
+   std::set<std::string> columnNames;
+   std::set<const RDefineBase *> visitedDefines;
+   // Pairs of column names and the column register in which they are to be looked up
+   std::vector<std::pair<std::string, const RColumnRegister *>> todo;
+   for (const auto *filter : fBookedFilters) {
+      for (const auto &name : filter->GetColumnNames())
+         todo.emplace_back(name, &filter->GetColRegister());
+   }
+   while (!todo.empty()) {
+      const auto name = todo.back().second->ResolveAlias(todo.back().first);
+      const auto *colRegister = todo.back().second;
+      todo.pop_back();
+      if (const auto *define = colRegister->GetDefine(name)) {
+         if (visitedDefines.insert(define).second) {
+            for (const auto &defineInput : define->GetColumnNames())
+               todo.emplace_back(defineInput, &define->GetColRegister());
+         }
+      } else if (fDataSource->HasColumn(name)) {
+         columnNames.insert(name);
+      }
+   }
+   return ColumnNames_t(columnNames.begin(), columnNames.end());
+}
+
 /// Run event loop over data accessed through a DataSource, in sequence.
 void RLoopManager::RunDataSource()
 {
    assert(fDataSource != nullptr);
+   fDataSource->SetFilterColumns(GetDataSourceFilterColumns());
    fDataSource->Initialize();
    auto ranges = fDataSource->GetEntryRanges();
    while (!ranges.empty() && fNStopsReceived < fNChildren) {
       InitNodeSlots(nullptr, 0u);
       fDataSource->InitSlot(0u, 0ull);
       RCallCleanUpTask cleanup(*this);
+      const bool isBulk = InitBulkReaders(0u);
       try {
          for (const auto &range : ranges) {
             const auto start = range.first;
             const auto end = range.second;
             R__LOG_DEBUG(0, RDFLogChannel()) << LogRangeProcessing({fDataSource->GetLabel(), start, end, 0u});
+            if (isBulk) {
+               RunBulks(0u, start, end, [this](ULong64_t entry) { return fDataSource->SetEntry(0u, entry); });
+               continue;
+            }
             for (auto entry = start; entry < end && fNStopsReceived < fNChildren; ++entry) {
                if (fDataSource->SetEntry(0u, entry)) {
                   RunAndCheckFilters(0u, entry);
@@ -628,9 +819,13 @@ void RLoopManager::RunDataSourceMT()
       const auto end = range.second;
       R__LOG_DEBUG(0, RDFLogChannel()) << LogRangeProcessing({fDataSource->GetLabel(), start, end, slot});
       try {
-         for (auto entry = start; entry < end; ++entry) {
-            if (fDataSource->SetEntry(slot, entry)) {
-               RunAndCheckFilters(slot, entry);
+         if (InitBulkReaders(slot)) {
+            RunBulks(slot, start, end, [this, slot](ULong64_t entry) { return fDataSource->SetEntry(slot, entry); });
+         } else {
+            for (auto entry = start; entry < end; ++entry) {
+               if (fDataSource->SetEntry(slot, entry)) {
+                  RunAndCheckFilters(slot, entry);
+               }
             }
          }
       } catch (...) {
@@ -640,6 +835,7 @@ void RLoopManager::RunDataSourceMT()
       fDataSource->FinalizeSlot(slot);
    };
 
+   fDataSource->SetFilterColumns(GetDataSourceFilterColumns());
    fDataSource->Initialize();
    auto ranges = fDataSource->GetEntryRanges();
    while (!ranges.empty()) {
@@ -655,14 +851,14 @@ void RLoopManager::RunDataSourceMT()
 void RLoopManager::RunAndCheckFilters(unsigned int slot, Long64_t entry)
 {
    // data-block callbacks run before the rest of the graph
-   if (fNewSampleNotifier.CheckFlag(slot)) {
-      for (auto &callback : fSampleCallbacks)
-         callback.second(slot, fSampleInfos[slot]);
-      fNewSampleNotifier.UnsetFlag(slot);
-   }
+   RunSampleCallbacks(slot);
 
-   for (auto *actionPtr : fBookedActions)
+   if (fProfiler)
+      fProfiler->AddEntries(slot, 1);
+   for (auto *actionPtr : fBookedActions) {
+      RDFInternal::RNodeTimer timer(actionPtr->GetProfile(), slot);
       actionPtr->Run(slot, entry);
+   }
    for (auto *namedFilterPtr : fBookedNamedFilters)
       namedFilterPtr->CheckFilters(slot, entry);
    for (auto &callback : fCallbacks)
@@ -674,6 +870,8 @@ void RLoopManager::RunAndCheckFilters(unsigned int slot, Long64_t entry)
 /// calls their `InitSlot` method, to get them ready for running a task.
 void RLoopManager::InitNodeSlots(TTreeReader *r, unsigned int slot)
 {
+   if (fProfiler)
+      fProfiler->BeginTask(slot);
    SetupSampleCallbacks(r, slot);
    for (auto *ptr : fBookedActions)
       ptr->InitSlot(r, slot);
@@ -724,6 +922,82 @@ void RLoopManager::UpdateSampleInfo(unsigned int slot, TTreeReader &r) {
    fSampleInfos[slot] = fSampleMap.empty() ? RSampleInfo(id, range) : RSampleInfo(id, range, fSampleMap[id]);
 }
 
+/// Find the chains of jitted Filters that can be reordered and let the last Filter of each chain evaluate the chain.
+/// A chain is a sequence of unnamed jitted Filters without variations in which each Filter but the last one has the
+/// next one as its only active child. Must be called after EvalChildrenCounts().
+void RLoopManager::BuildFilterChains()
+{
+   // the candidates for the chains, i.e. the active mergeable filters, by their concrete filter
+   std::unordered_map<RFilterBase *, RJittedFilter *> candidates;
+   for (auto it = fMergeableFilters.begin(); it != fMergeableFilters.end();) {
+      auto filter = it->second.lock();
+      if (!filter) {
+         it = fMergeableFilters.erase(it);
+         continue;
+      }
+      auto *concrete = filter->GetConcreteFilter();
+      if (concrete != nullptr && concrete->GetNChildren() > 0)
+         candidates[concrete] = filter.get();
+      ++it;
+   }
+
+   std::unordered_map<RFilterBase *, RFilterBase *> nextInChain;
+   std::unordered_set<RFilterBase *> hasPrevInChain;
+   for (const auto &candidate : candidates) {
+      // a filter that is not marked as reorderable may rely on the previous one, e.g. as a guard: the chain breaks
+      if (!candidate.second->IsReorderable())
+         continue;
+      auto *prev = dynamic_cast<RJittedFilter *>(candidate.first->GetPrevNode());
+      if (prev == nullptr)
+         continue;
+      if (prev->GetEquivalentFilter() != nullptr)
+         prev = prev->GetEquivalentFilter();
+      auto *prevConcrete = prev->GetConcreteFilter();
+      if (candidates.count(prevConcrete) > 0 && prevConcrete->GetNChildren() == 1) {
+         nextInChain[prevConcrete] = candidate.first;
+         hasPrevInChain.insert(candidate.first);
+      }
+   }
+
+   for (const auto &candidate : candidates) {
+      if (hasPrevInChain.count(candidate.first) > 0 || nextInChain.count(candidate.first) == 0)
+         continue;
+      std::vector<RFilterBase *> chain{candidate.first};
+      for (auto it = nextInChain.find(chain.back()); it != nextInChain.end(); it = nextInChain.find(chain.back()))
+         chain.emplace_back(it->second);
+      R__LOG_INFO(RDFLogChannel()) << "Reordering a chain of " << chain.size() << " filters.";
+      auto *head = chain.front()->GetPrevNode();
+      candidates[chain.back()]->SetChain(std::make_unique<RDFInternal::RFilterChain>(*head, chain, fNSlots));
+   }
+}
+
+/// Attach the profiles of the profiler to the booked nodes and to the dataset column readers.
+/// The readers of TTree columns are created by the tasks, they are wrapped by AddTreeColumnReader().
+void RLoopManager::InitProfiling()
+{
+   fProfiler->BeginLoop();
+   for (auto *filter : fBookedFilters) {
+      const auto name = filter->HasName() ? filter->GetName() : "Unnamed Filter";
+      filter->SetProfile(fProfiler->GetNodeProfile(filter, "Filter", name));
+   }
+   for (auto *define : fBookedDefines)
+      define->SetProfile(fProfiler->GetNodeProfile(define, "Define", define->GetName()));
+   for (auto *action : fBookedActions)
+      action->SetProfile(fProfiler->GetNodeProfile(action, "Action", action->GetActionName()));
+
+   for (unsigned int slot = 0; slot < fNSlots; ++slot) {
+      for (auto &keyAndReader : fDatasetColumnReaders[slot]) {
+         auto &reader = keyAndReader.second;
+         if (reader == nullptr || dynamic_cast<RDFInternal::RProfiledColumnReader *>(reader.get()) != nullptr)
+            continue;
+         // the key is the column name followed by ':' and the name of the column type
+         const auto column = keyAndReader.first.substr(0, keyAndReader.first.find(':'));
+         reader = std::make_unique<RDFInternal::RProfiledColumnReader>(
+            std::move(reader), *fProfiler->GetColumnReaderProfile(column), slot);
+      }
+   }
+}
+
 /// Initialize all nodes of the functional graph before running the event loop.
 /// This method is called once per event-loop and performs generic initialization
 /// operations that do not depend on the specific processing slot (i.e. operations
@@ -731,6 +1005,10 @@ void RLoopManager::UpdateSampleInfo(unsigned int slot, TTreeReader &r) {
 void RLoopManager::InitNodes()
 {
    EvalChildrenCounts();
+   if (fReorderFilters)
+      BuildFilterChains();
+   if (fProfiler)
+      InitProfiling();
    for (auto *filter : fBookedFilters)
       filter->InitNode();
    for (auto *range : fBookedRanges)
@@ -759,6 +1037,12 @@ void RLoopManager::CleanUpNodes()
    for (auto *ptr : fBookedRanges)
       ptr->ResetChildrenCount();
 
+   // the chains of filters depend on the children counts, they are built again for the next event loop
+   for (auto &filter : fMergeableFilters) {
+      if (auto ptr = filter.second.lock())
+         ptr->SetChain(nullptr);
+   }
+
    fCallbacks.clear();
    fCallbacksOnce.clear();
    fSampleCallbacks.clear();
@@ -767,6 +1051,8 @@ void RLoopManager::CleanUpNodes()
 /// Perform clean-up operations. To be called at the end of each task execution.
 void RLoopManager::CleanUpTask(TTreeReader *r, unsigned int slot)
 {
+   if (fProfiler)
+      fProfiler->EndTask(slot);
    if (r != nullptr)
       fNewSampleNotifier.GetChainNotifyLink(slot).RemoveLink(*r->GetTree());
    for (auto *ptr : fBookedActions)
@@ -788,10 +1074,19 @@ void RLoopManager::CleanUpTask(TTreeReader *r, unsigned int slot)
 /// This method also clears the contents of GetCodeToJit().
 void RLoopManager::Jit()
 {
-   // TODO this should be a read lock unless we find GetCodeToJit non-empty
-   R__LOCKGUARD(gROOTMutex);
+   // The code to jit is shared by all the computation graphs: another graph must not start its event loop before the
+   // code that we take out here has run.  Unlike gROOTMutex, this mutex does not block the rest of ROOT while a
+   // library is compiled for the jit cache.
+   static std::mutex jitMutex;
+   std::lock_guard<std::mutex> jitGuard(jitMutex);
 
-   const std::string code = std::move(GetCodeToJit());
+   std::string code;
+   {
+      // TODO this should be a read lock unless we find GetCodeToJit non-empty
+      R__LOCKGUARD(gROOTMutex);
+      code = std::move(GetCodeToJit());
+      GetCodeToJit().clear();
+   }
    if (code.empty()) {
       R__LOG_INFO(RDFLogChannel()) << "Nothing to jit and execute.";
       return;
@@ -799,7 +1094,10 @@ void RLoopManager::Jit()
 
    TStopwatch s;
    s.Start();
-   RDFInternal::InterpreterCalc(code, "RLoopManager::Run");
+   if (!RDFInternal::JitCacheCalc(code)) {
+      R__LOCKGUARD(gROOTMutex);
+      RDFInternal::InterpreterCalc(code, "RLoopManager::Run");
+   }
    s.Stop();
    R__LOG_INFO(RDFLogChannel()) << "Just-in-time compilation phase completed"
                                 << (s.RealTime() > 1e-3 ? " in " + std::to_string(s.RealTime()) + " seconds."
@@ -839,16 +1137,27 @@ void RLoopManager::Run(bool jit)
 
    TStopwatch s;
    s.Start();
-   switch (fLoopType) {
-   case ELoopType::kNoFilesMT: RunEmptySourceMT(); break;
-   case ELoopType::kROOTFilesMT: RunTreeProcessorMT(); break;
-   case ELoopType::kDataSourceMT: RunDataSourceMT(); break;
-   case ELoopType::kNoFiles: RunEmptySource(); break;
-   case ELoopType::kROOTFiles: RunTreeReader(); break;
-   case ELoopType::kDataSource: RunDataSource(); break;
+   // Actions such as a Snapshot that copies the data without reading it compute their results in Finalize()
+   const bool needsEventLoop =
+      fMustRunNamedFilters || std::any_of(fBookedActions.begin(), fBookedActions.end(),
+                                          [](RDFInternal::RActionBase *a) { return a->NeedsEventLoop(); });
+   if (!needsEventLoop) {
+      R__LOG_INFO(RDFLogChannel()) << "Skipping the event loop, none of the actions processes entries.";
+   } else {
+      switch (fLoopType) {
+      case ELoopType::kNoFilesMT: RunEmptySourceMT(); break;
+      case ELoopType::kROOTFilesMT: RunTreeProcessorMT(); break;
+      case ELoopType::kDataSourceMT: RunDataSourceMT(); break;
+      case ELoopType::kNoFiles: RunEmptySource(); break;
+      case ELoopType::kROOTFiles: RunTreeReader(); break;
+      case ELoopType::kDataSource: RunDataSource(); break;
+      }
    }
    s.Stop();
 
+   if (fProfiler)
+      fProfiler->EndLoop();
+
    CleanUpNodes();
 
    fNRuns++;
@@ -917,6 +1226,36 @@ void RLoopManager::Deregister(RDefineBase *ptr)
    fSampleCallbacks.erase(ptr);
 }
 
+void RLoopManager::EnableProfiling()
+{
+   if (!fProfiler)
+      fProfiler = std::make_unique<RDFInternal::RLoopProfiler>(fNSlots);
+}
+
+std::shared_ptr<RJittedDefine>
+RLoopManager::MergeJittedDefine(const std::string &key, const std::shared_ptr<RJittedDefine> &define)
+{
+   if (key.empty())
+      return nullptr;
+   auto &registered = fMergeableDefines[key];
+   if (auto equivalent = registered.lock())
+      return equivalent;
+   registered = define;
+   return nullptr;
+}
+
+std::shared_ptr<RJittedFilter>
+RLoopManager::MergeJittedFilter(const std::string &key, const std::shared_ptr<RJittedFilter> &filter)
+{
+   if (key.empty())
+      return nullptr;
+   auto &registered = fMergeableFilters[key];
+   if (auto equivalent = registered.lock())
+      return equivalent;
+   registered = filter;
+   return nullptr;
+}
+
 void RLoopManager::Register(RDFInternal::RVariationBase *v)
 {
    fBookedVariations.emplace_back(v);
@@ -1056,6 +1395,9 @@ RColumnReaderBase *RLoopManager::AddTreeColumnReader(unsigned int slot, const st
    const auto key = MakeDatasetColReadersKey(col, ti);
    // if a reader for this column and this slot was already there, we are doing something wrong
    assert(readers.find(key) == readers.end() || readers[key] == nullptr);
+   if (fProfiler)
+      reader = std::make_unique<RDFInternal::RProfiledColumnReader>(std::move(reader),
+                                                                    *fProfiler->GetColumnReaderProfile(col), slot);
    auto *rptr = reader.get();
    readers[key] = std::move(reader);
    return rptr;
@@ -0,0 +1,170 @@
+/*************************************************************************
+ * Copyright (C) 1995-2024, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "ROOT/RDF/RLoopProfiler.hxx"
+
+#include <algorithm>
+#include <cstdint>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <Windows.h>
+#else
+#include <ctime>
+#endif
+
+using ROOT::Internal::RDF::RLoopProfiler;
+using ROOT::Internal::RDF::RNodeProfile;
+using ROOT::RDF::Experimental::RProfileReport;
+
+namespace {
+/// The CPU time spent by the calling thread, in seconds
+double GetThreadCpuTime()
+{
+#ifdef _WIN32
+   FILETIME creationTime, exitTime, kernelTime, userTime;
+   if (!GetThreadTimes(GetCurrentThread(), &creationTime, &exitTime, &kernelTime, &userTime))
+      return 0.;
+   // FILETIMEs count 100 ns intervals
+   auto toSeconds = [](const FILETIME &t) {
+      return double((ULONGLONG(t.dwHighDateTime) << 32) | t.dwLowDateTime) * 1e-7;
+   };
+   return toSeconds(kernelTime) + toSeconds(userTime);
+#else
+   timespec ts;
+   if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts) != 0)
+      return 0.;
+   return double(ts.tv_sec) + 1e-9 * double(ts.tv_nsec);
+#endif
+}
+} // anonymous namespace
+
+RLoopProfiler::RLoopProfiler(unsigned int nSlots)
+   : fNSlots(nSlots), fChildTimes(nSlots * CacheLineStep<double>()), fSlots(nSlots)
+{
+}
+
+RNodeProfile *
+RLoopProfiler::GetNodeProfileImpl(const std::string &key, const std::string &kind, const std::string &name)
+{
+   std::lock_guard<std::mutex> lock(fNodesMutex);
+   auto it = fNodesByKey.find(key);
+   if (it != fNodesByKey.end()) {
+      // the node might be a new node at the address of a node that was deleted
+      it->second->fKind = kind;
+      it->second->fName = name;
+      return it->second;
+   }
+   fNodes.emplace_back(std::make_unique<RNodeProfile>(kind, name, fNSlots, fChildTimes));
+   fNodesByKey[key] = fNodes.back().get();
+   return fNodes.back().get();
+}
+
+RNodeProfile *RLoopProfiler::GetNodeProfile(const void *node, const std::string &kind, const std::string &name)
+{
+   return GetNodeProfileImpl("node:" + std::to_string(reinterpret_cast<std::uintptr_t>(node)), kind, name);
+}
+
+RNodeProfile *RLoopProfiler::GetColumnReaderProfile(const std::string &column)
+{
+   return GetNodeProfileImpl("column:" + column, "Column reader", column);
+}
+
+void RLoopProfiler::BeginLoop()
+{
+   {
+      std::lock_guard<std::mutex> lock(fNodesMutex);
+      for (auto &node : fNodes)
+         std::fill(node->fStats.begin(), node->fStats.end(), RNodeProfile::RStats{});
+   }
+   std::fill(fChildTimes.begin(), fChildTimes.end(), 0.);
+   for (auto &state : fSlots) {
+      state.fIsInTask = false;
+      state.fTasks.clear();
+   }
+   fLoopStart = Clock_t::now();
+}
+
+void RLoopProfiler::BeginTask(unsigned int slot)
+{
+   auto &state = fSlots[slot];
+   {
+      std::lock_guard<std::mutex> lock(fNodesMutex);
+      state.fTaskStartStats.resize(fNodes.size());
+      for (std::size_t i = 0; i < fNodes.size(); ++i)
+         state.fTaskStartStats[i] = fNodes[i]->fStats[slot * CacheLineStep<RNodeProfile::RStats>()];
+   }
+   state.fIsInTask = true;
+   state.fNEntries = 0;
+   state.fTaskCpuStart = GetThreadCpuTime();
+   state.fTaskStart = Clock_t::now();
+}
+
+void RLoopProfiler::EndTask(unsigned int slot)
+{
+   auto &state = fSlots[slot];
+   if (!state.fIsInTask)
+      return; // the task failed before it started
+   const auto end = Clock_t::now();
+   const double cpuTime = GetThreadCpuTime() - state.fTaskCpuStart;
+
+   RProfileReport::RTask task{slot,
+                              std::chrono::duration<double>(state.fTaskStart - fLoopStart).count(),
+                              std::chrono::duration<double>(end - state.fTaskStart).count(),
+                              cpuTime,
+                              state.fNEntries,
+                              {}};
+   {
+      std::lock_guard<std::mutex> lock(fNodesMutex);
+      for (std::size_t i = 0; i < fNodes.size(); ++i) {
+         const auto &stats = fNodes[i]->fStats[slot * CacheLineStep<RNodeProfile::RStats>()];
+         // nodes created during the task, e.g. TTree column readers, had no statistics at the beginning of the task
+         const auto startStats = i < state.fTaskStartStats.size() ? state.fTaskStartStats[i] : RNodeProfile::RStats{};
+         if (stats.fCalls > startStats.fCalls)
+            task.fNodes.push_back({i, stats.fTime - startStats.fTime, stats.fCalls - startStats.fCalls});
+      }
+   }
+   state.fTasks.emplace_back(std::move(task));
+   state.fIsInTask = false;
+}
+
+void RLoopProfiler::EndLoop()
+{
+   RProfileReport report;
+   report.fNSlots = fNSlots;
+   report.fWallTime = std::chrono::duration<double>(Clock_t::now() - fLoopStart).count();
+
+   std::lock_guard<std::mutex> lock(fNodesMutex);
+   // the indices of the profiler's nodes in the report, which only lists the nodes that were evaluated
+   std::vector<std::size_t> reportIndices(fNodes.size(), std::size_t(-1));
+   for (std::size_t i = 0; i < fNodes.size(); ++i) {
+      RProfileReport::RNode node{fNodes[i]->fKind, fNodes[i]->fName, {}, {}};
+      for (unsigned int slot = 0; slot < fNSlots; ++slot) {
+         const auto &stats = fNodes[i]->fStats[slot * CacheLineStep<RNodeProfile::RStats>()];
+         node.fTimes.emplace_back(stats.fTime);
+         node.fCalls.emplace_back(stats.fCalls);
+      }
+      if (node.GetCalls() == 0)
+         continue;
+      reportIndices[i] = report.fNodes.size();
+      report.fNodes.emplace_back(std::move(node));
+   }
+
+   for (auto &state : fSlots) {
+      for (auto &task : state.fTasks) {
+         for (auto &node : task.fNodes)
+            node.fNode = reportIndices[node.fNode];
+         report.fTasks.emplace_back(std::move(task));
+      }
+      state.fTasks.clear();
+   }
+   std::sort(report.fTasks.begin(), report.fTasks.end(),
+             [](const RProfileReport::RTask &t1, const RProfileReport::RTask &t2) { return t1.fStart < t2.fStart; });
+
+   fReport = std::move(report);
+}
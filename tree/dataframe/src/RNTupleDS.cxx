@@ -15,17 +15,33 @@
  *************************************************************************/
 
 #include <ROOT/RDF/RColumnReaderBase.hxx>
+#include <ROOT/RDF/RMaskedEntryRange.hxx>
 #include <ROOT/RField.hxx>
 #include <ROOT/RNTuple.hxx>
 #include <ROOT/RNTupleDescriptor.hxx>
 #include <ROOT/RNTupleDS.hxx>
+#include <ROOT/RNTupleMerger.hxx>
 #include <ROOT/RNTupleUtil.hxx>
 #include <ROOT/RPageStorage.hxx>
 #include <ROOT/RStringView.hxx>
+#include <ROOT/TSeq.hxx>
+#include <RConfigure.h> // R__USE_IMT
 
 #include <TError.h>
+#include <TROOT.h> // IsImplicitMTEnabled
 
+#ifdef R__USE_IMT
+#include <ROOT/TThreadExecutor.hxx>
+#endif
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <set>
+#include <stdexcept>
 #include <string>
+#include <unordered_map>
 #include <vector>
 #include <typeinfo>
 #include <utility>
@@ -107,50 +123,322 @@ public:
       fPrincipalColumn->GetCollectionInfo(clusterIndex, &collectionStart, &size);
       *static_cast<std::size_t *>(to) = size;
    }
+
+   /// Get the number of elements of consecutive collections, going page by page through the offset column
+   std::size_t ReadBulkImpl(const RBulkSpec &bulkSpec) final
+   {
+      RClusterIndex collectionStart;
+      ClusterSize_t collectionSize;
+      fPrincipalColumn->GetCollectionInfo(bulkSpec.fFirstIndex, &collectionStart, &collectionSize);
+
+      auto typedValues = static_cast<std::size_t *>(bulkSpec.fValues);
+      typedValues[0] = collectionSize;
+
+      auto lastOffset = collectionStart.GetIndex() + collectionSize;
+      ClusterSize_t::ValueType nRemainingEntries = bulkSpec.fCount - 1;
+      std::size_t nEntries = 1;
+      while (nRemainingEntries > 0) {
+         NTupleSize_t nItemsUntilPageEnd;
+         auto offsets = fPrincipalColumn->MapV<ClusterSize_t>(bulkSpec.fFirstIndex + nEntries, nItemsUntilPageEnd);
+         std::size_t nBatch = std::min(nRemainingEntries, nItemsUntilPageEnd);
+         for (std::size_t i = 0; i < nBatch; ++i) {
+            typedValues[nEntries + i] = offsets[i] - lastOffset;
+            lastOffset = offsets[i];
+         }
+         nRemainingEntries -= nBatch;
+         nEntries += nBatch;
+      }
+      return RBulkSpec::kAllSet;
+   }
 };
 
-/// Every RDF column is represented by exactly one RNTuple field
+/// Every RDF column is represented by exactly one RNTuple field.  The values are read in bulks of consecutive entries
+/// of the same cluster, so that simple fields and collections of simple fields are read with a few memcpy calls per
+/// page instead of one virtual call per entry.  For lazy columns, whose pages are only loaded on demand, a bulk also
+/// ends at the end of the page of the field's principal column, so that reading the values of the selected entries of
+/// a bulk loads a single page of that column.  The column reader connects a clone of its field to the ntuple of the
+/// chain that contains the requested entry; it reconnects when the slot moves on to another ntuple of the chain.
 class RNTupleColumnReader : public ROOT::Detail::RDF::RColumnReaderBase {
    using RFieldBase = ROOT::Experimental::Detail::RFieldBase;
    using RPageSource = ROOT::Experimental::Detail::RPageSource;
 
-   std::unique_ptr<RFieldBase> fField; ///< The field backing the RDF column
-   RFieldBase::RValue fValue;          ///< The memory location used to read from fField
-   Long64_t fLastEntry;                ///< Last entry number that was read
+   /// The maximum number of entries in a bulk
+   static constexpr std::size_t kMaxBulkSize = 1024;
 
-public:
-   RNTupleColumnReader(std::unique_ptr<RFieldBase> f)
-      : fField(std::move(f)), fValue(fField->GenerateValue()), fLastEntry(-1)
+   /// The entry range of a cluster
+   struct RClusterRange {
+      DescriptorId_t fClusterId;
+      NTupleSize_t fFirstEntry;
+      NTupleSize_t fNEntries;
+   };
+
+   RNTupleDS *fDataSource = nullptr;         ///< Provides the page sources of the chain, unset for prototypes
+   unsigned int fSlot = 0;                   ///< The slot that uses the column reader
+   NTupleSize_t fFirstEntry = 0;             ///< The chain entry number of the first entry of fSource
+   NTupleSize_t fNEntries = 0;               ///< The number of entries of fSource
+   std::shared_ptr<RPageSource> fSource;     ///< Kept alive for as long as fField is connected to it
+   std::unique_ptr<RFieldBase> fProtoField;  ///< The unconnected field backing the RDF column
+   std::unique_ptr<RFieldBase> fField;       ///< A clone of fProtoField that is connected to fSource
+   std::unique_ptr<RFieldBase::RBulk> fBulk; ///< Values of consecutive entries, created when connected
+   /// Request mask for fBulk.  Only the value of the entry at hand is requested, so that complex fields without an
+   /// optimized bulk read don't read values that RDF does not need.
+   std::unique_ptr<bool[]> fBulkMask;
+   std::vector<RClusterRange> fClusterRanges; ///< Sorted by first entry
+   RClusterIndex fBulkFirstIndex;             ///< Index of the first value in fBulk
+   NTupleSize_t fBulkFirstEntry = 0;          ///< Entry number of the first value in fBulk
+   std::size_t fBulkSize = 0;                 ///< Number of entries in the current bulk
+   /// The physical principal column of a field with lazy columns, whose page boundaries cap the bulk range.  Unset
+   /// for fields whose pages are preloaded with the cluster and for fields without columns of their own.
+   DescriptorId_t fLazyColumnId = kInvalidDescriptorId;
+
+   /// Returns the number of elements of fLazyColumnId from the given index to the end of its page
+   std::size_t GetNElementsUntilPageEnd(DescriptorId_t clusterId, NTupleSize_t index) const
    {
+      auto descriptorGuard = fSource->GetSharedDescriptorGuard();
+      const auto &clusterDesc = descriptorGuard->GetClusterDescriptor(clusterId);
+      if (!clusterDesc.ContainsColumn(fLazyColumnId))
+         return kMaxBulkSize;
+      NTupleSize_t pageEnd = 0;
+      for (const auto &pageInfo : clusterDesc.GetPageRange(fLazyColumnId).fPageInfos) {
+         pageEnd += pageInfo.fNElements;
+         if (index < pageEnd)
+            return pageEnd - index;
+      }
+      return kMaxBulkSize;
    }
-   ~RNTupleColumnReader() = default;
 
-   /// Column readers are created as prototype and then cloned for every slot
-   std::unique_ptr<RNTupleColumnReader> Clone()
+   /// Sets the bulk range to start at the given entry and to end at the end of the entry's cluster, at most.  For
+   /// lazy columns, the range ends at the end of the entry's page, at most.
+   void SetBulkRange(NTupleSize_t entry)
    {
-      return std::make_unique<RNTupleColumnReader>(fField->Clone(fField->GetName()));
+      auto itr = std::upper_bound(fClusterRanges.begin(), fClusterRanges.end(), entry,
+                                  [](NTupleSize_t e, const RClusterRange &r) { return e < r.fFirstEntry; });
+      R__ASSERT(itr != fClusterRanges.begin());
+      --itr;
+      R__ASSERT(entry < itr->fFirstEntry + itr->fNEntries);
+      fBulkFirstEntry = entry;
+      fBulkFirstIndex = RClusterIndex(itr->fClusterId, entry - itr->fFirstEntry);
+      fBulkSize = std::min<NTupleSize_t>(kMaxBulkSize, itr->fFirstEntry + itr->fNEntries - entry);
+      // The entries of a top-level field are the elements of its principal column
+      if (fLazyColumnId != kInvalidDescriptorId)
+         fBulkSize = std::min(fBulkSize, GetNElementsUntilPageEnd(itr->fClusterId, entry - itr->fFirstEntry));
    }
 
-   /// Connect the field and its subfields to the page source
-   void Connect(RPageSource &source)
+   /// Connects a fresh clone of the field and its subfields to the chain element that contains the given entry
+   void Connect(NTupleSize_t entry)
    {
-      fField->ConnectPageSource(source);
+      const auto chainIndex = fDataSource->FindChainElement(entry);
+      const auto &element = fDataSource->fChain[chainIndex];
+      auto source = fDataSource->GetSlotSource(fSlot, chainIndex);
+
+      // The bulk and the field refer to the previous source, which is only released afterwards
+      fBulk.reset();
+      fField = fProtoField->Clone(fProtoField->GetName());
+      fField->ConnectPageSource(*source);
       for (auto &f : *fField)
-         f.ConnectPageSource(source);
+         f.ConnectPageSource(*source);
+
+      fClusterRanges.clear();
+      fLazyColumnId = kInvalidDescriptorId;
+      {
+         auto descriptorGuard = source->GetSharedDescriptorGuard();
+         const auto &lazyColumns = source->GetLazyPhysicalColumns();
+         if (!lazyColumns.empty() && (fField->GetOnDiskId() != kInvalidDescriptorId)) {
+            const auto columnId = descriptorGuard->FindPhysicalColumnId(fField->GetOnDiskId(), 0);
+            if (lazyColumns.count(columnId) > 0)
+               fLazyColumnId = columnId;
+         }
+         for (const auto &c : descriptorGuard->GetClusterIterable()) {
+            fClusterRanges.emplace_back(
+               RClusterRange{c.GetId(), element.fFirstEntry + c.GetFirstEntryIndex(), c.GetNEntries()});
+         }
+      }
+      std::sort(fClusterRanges.begin(), fClusterRanges.end(),
+                [](const RClusterRange &a, const RClusterRange &b) { return a.fFirstEntry < b.fFirstEntry; });
+
+      fFirstEntry = element.fFirstEntry;
+      fNEntries = element.fNEntries;
+      fSource = std::move(source);
+      fBulk = std::make_unique<RFieldBase::RBulk>(fField->GenerateBulk());
+      if (!fBulkMask)
+         fBulkMask = std::make_unique<bool[]>(kMaxBulkSize);
+      fBulkSize = 0;
+   }
+
+public:
+   RNTupleColumnReader(std::unique_ptr<RFieldBase> f) : fProtoField(std::move(f)) {}
+   ~RNTupleColumnReader() = default;
+
+   /// Column readers are created as prototype and then cloned for every slot.  The clone connects to the page source
+   /// of the slot when the first value is read.
+   std::unique_ptr<RNTupleColumnReader> Clone(RNTupleDS *dataSource, unsigned int slot)
+   {
+      auto clone = std::make_unique<RNTupleColumnReader>(fProtoField->Clone(fProtoField->GetName()));
+      clone->fDataSource = dataSource;
+      clone->fSlot = slot;
+      return clone;
    }
 
+   const RFieldBase &GetField() const { return *fProtoField; }
+
    void *GetImpl(Long64_t entry) final
    {
-      if (entry != fLastEntry) {
-         fValue.Read(entry);
-         fLastEntry = entry;
+      if ((static_cast<NTupleSize_t>(entry) < fBulkFirstEntry) ||
+          (static_cast<NTupleSize_t>(entry) >= fBulkFirstEntry + fBulkSize)) {
+         if (!fSource || (static_cast<NTupleSize_t>(entry) < fFirstEntry) ||
+             (static_cast<NTupleSize_t>(entry) >= fFirstEntry + fNEntries)) {
+            Connect(entry);
+         }
+         SetBulkRange(entry);
+      }
+      const auto offset = entry - fBulkFirstEntry;
+      fBulkMask[offset] = true;
+      auto values = fBulk->ReadBulk(fBulkFirstIndex, fBulkMask.get(), fBulkSize);
+      fBulkMask[offset] = false;
+      return static_cast<unsigned char *>(values) + offset * fField->GetValueSize();
+   }
+
+   /// The values of a bulk of RDF entries are read at once with an RBulk, so the bulk must not cross a cluster boundary
+   EBulkMode GetBulkMode() const final { return EBulkMode::kRandomAccess; }
+
+   std::size_t GetMaxBulkSize(Long64_t entry) final
+   {
+      if (!fSource || (static_cast<NTupleSize_t>(entry) < fFirstEntry) ||
+          (static_cast<NTupleSize_t>(entry) >= fFirstEntry + fNEntries)) {
+         Connect(entry);
       }
-      return fValue.GetRawPtr();
+      SetBulkRange(entry);
+      return fBulkSize;
+   }
+
+private:
+   void *GetBulkImpl(const ROOT::Internal::RDF::RMaskedEntryRange &mask) final
+   {
+      const auto firstEntry = static_cast<NTupleSize_t>(mask.FirstEntry());
+      if ((firstEntry < fBulkFirstEntry) || (firstEntry + mask.Size() > fBulkFirstEntry + fBulkSize))
+         GetMaxBulkSize(mask.FirstEntry());
+      R__ASSERT(firstEntry + mask.Size() <= fBulkFirstEntry + fBulkSize);
+      const auto offset = firstEntry - fBulkFirstEntry;
+      return fBulk->ReadBulk(RClusterIndex(fBulkFirstIndex.GetClusterId(), fBulkFirstIndex.GetIndex() + offset),
+                             mask.Data(), mask.Size());
    }
 };
 
 } // namespace Internal
 
+namespace {
+
+template <typename T>
+double ValueToDouble(const void *value)
+{
+   return static_cast<double>(*static_cast<const T *>(value));
+}
+
+/// Returns the converter to double for the numeric column types supported by pushdown filters, or nullptr
+double (*GetValueToDouble(const std::string &typeName))(const void *)
+{
+   using ROOT::Experimental::RField;
+   static const std::unordered_map<std::string, double (*)(const void *)> converters{
+      {RField<float>::TypeName(), &ValueToDouble<float>},
+      {RField<double>::TypeName(), &ValueToDouble<double>},
+      {RField<std::int8_t>::TypeName(), &ValueToDouble<std::int8_t>},
+      {RField<std::uint8_t>::TypeName(), &ValueToDouble<std::uint8_t>},
+      {RField<std::int16_t>::TypeName(), &ValueToDouble<std::int16_t>},
+      {RField<std::uint16_t>::TypeName(), &ValueToDouble<std::uint16_t>},
+      {RField<std::int32_t>::TypeName(), &ValueToDouble<std::int32_t>},
+      {RField<std::uint32_t>::TypeName(), &ValueToDouble<std::uint32_t>},
+      {RField<std::int64_t>::TypeName(), &ValueToDouble<std::int64_t>},
+      {RField<std::uint64_t>::TypeName(), &ValueToDouble<std::uint64_t>}};
+   auto itr = converters.find(typeName);
+   return (itr == converters.end()) ? nullptr : itr->second;
+}
+
+std::string_view TrimWhitespace(std::string_view str)
+{
+   const auto first = str.find_first_not_of(" \t");
+   if (first == std::string_view::npos)
+      return {};
+   const auto last = str.find_last_not_of(" \t");
+   return str.substr(first, last - first + 1);
+}
+
+using EntryRanges_t = std::vector<std::pair<ULong64_t, ULong64_t>>;
+
+/// Intersects two sorted lists of disjoint entry ranges
+EntryRanges_t IntersectRanges(const EntryRanges_t &a, const EntryRanges_t &b)
+{
+   EntryRanges_t result;
+   auto itrA = a.begin();
+   auto itrB = b.begin();
+   while (itrA != a.end() && itrB != b.end()) {
+      const auto start = std::max(itrA->first, itrB->first);
+      const auto end = std::min(itrA->second, itrB->second);
+      if (start < end)
+         result.emplace_back(start, end);
+      if (itrA->second < itrB->second)
+         ++itrA;
+      else
+         ++itrB;
+   }
+   return result;
+}
+
+/// Throws if the field with the given id and its subfields differ between the two descriptors, including their ids
+/// and the types of their columns
+void CheckSameSchema(const RNTupleDescriptor &first, const RNTupleDescriptor &other, DescriptorId_t fieldId,
+                     const std::string &fileName)
+{
+   auto fnColumnTypes = [](const RNTupleDescriptor &desc, DescriptorId_t id) {
+      std::vector<EColumnType> types;
+      for (const auto &c : desc.GetColumnIterable(id))
+         types.emplace_back(c.GetModel().GetType());
+      return types;
+   };
+   for (const auto &f : first.GetFieldIterable(fieldId)) {
+      const auto otherId = other.FindFieldId(f.GetFieldName(), fieldId);
+      if (otherId != f.GetId() || other.GetFieldDescriptor(otherId).GetTypeName() != f.GetTypeName() ||
+          fnColumnTypes(other, otherId) != fnColumnTypes(first, f.GetId())) {
+         throw std::runtime_error("RNTupleDS: the ntuple in " + fileName +
+                                  " has a different schema than the first one of the chain, field " +
+                                  f.GetFieldName());
+      }
+      CheckSameSchema(first, other, f.GetId(), fileName);
+   }
+}
+
+} // anonymous namespace
+
+bool RNTupleDS::RPushdownFilter::Match(double value) const
+{
+   switch (fOperator) {
+   case EOperator::kLess: return value < fValue;
+   case EOperator::kLessEqual: return value <= fValue;
+   case EOperator::kGreater: return value > fValue;
+   case EOperator::kGreaterEqual: return value >= fValue;
+   case EOperator::kEqual: return value == fValue;
+   case EOperator::kNotEqual: return value != fValue;
+   }
+   return true;
+}
+
+bool RNTupleDS::RPushdownFilter::CanMatch(const RValueStatistics &statistics) const
+{
+   // NaN values only pass the != comparison
+   if (fOperator == EOperator::kNotEqual && statistics.fNNaN > 0)
+      return true;
+   if (!statistics.HasRange())
+      return false;
+   switch (fOperator) {
+   case EOperator::kLess: return statistics.fMin < fValue;
+   case EOperator::kLessEqual: return statistics.fMin <= fValue;
+   case EOperator::kGreater: return statistics.fMax > fValue;
+   case EOperator::kGreaterEqual: return statistics.fMax >= fValue;
+   case EOperator::kEqual: return statistics.fMin <= fValue && fValue <= statistics.fMax;
+   case EOperator::kNotEqual: return !(statistics.fMin == fValue && statistics.fMax == fValue);
+   }
+   return true;
+}
+
 RNTupleDS::~RNTupleDS() = default;
 
 void RNTupleDS::AddField(const RNTupleDescriptor &desc, std::string_view colName, DescriptorId_t fieldId,
@@ -270,12 +558,206 @@ void RNTupleDS::AddField(const RNTupleDescriptor &desc, std::string_view colName
 RNTupleDS::RNTupleDS(std::unique_ptr<Detail::RPageSource> pageSource)
 {
    pageSource->Attach();
-   auto descriptorGuard = pageSource->GetSharedDescriptorGuard();
-   fSources.emplace_back(std::move(pageSource));
+   fChain.emplace_back();
+   fChain[0].fSource = std::move(pageSource);
+   AttachChainElement(0);
 
+   auto descriptorGuard = fChain[0].fSource->GetSharedDescriptorGuard();
    AddField(descriptorGuard.GetRef(), "", descriptorGuard->GetFieldZeroId(), std::vector<DescriptorId_t>());
 }
 
+RNTupleDS::RNTupleDS(std::string_view ntupleName, const std::vector<std::string> &fileNames)
+   : fNTupleName(ntupleName)
+{
+   if (fileNames.empty())
+      throw std::runtime_error("RNTupleDS: empty list of files for ntuple " + fNTupleName);
+   for (const auto &fileName : fileNames) {
+      fChain.emplace_back();
+      fChain.back().fFileName = fileName;
+   }
+}
+
+void RNTupleDS::EnsureSchema() const
+{
+   if (fChain[0].fSource)
+      return;
+   // Reading the schema does not change the observable state of the data source
+   auto self = const_cast<RNTupleDS *>(this);
+   self->AttachChainElement(0);
+   auto descriptorGuard = fChain[0].fSource->GetSharedDescriptorGuard();
+   self->AddField(descriptorGuard.GetRef(), "", descriptorGuard->GetFieldZeroId(), std::vector<DescriptorId_t>());
+}
+
+void RNTupleDS::OpenChainElement(std::size_t index)
+{
+   auto &element = fChain[index];
+   auto source = Detail::RPageSource::Create(fNTupleName, element.fFileName);
+   source->Attach();
+   if (index > 0) {
+      // The column readers connect the fields of the first ntuple by their on-disk ids
+      auto firstGuard = fChain[0].fSource->GetSharedDescriptorGuard();
+      auto descriptorGuard = source->GetSharedDescriptorGuard();
+      CheckSameSchema(firstGuard.GetRef(), descriptorGuard.GetRef(), firstGuard->GetFieldZeroId(), element.fFileName);
+   }
+   element.fSource = std::move(source);
+   element.fIsSourceInUse = false;
+}
+
+void RNTupleDS::AttachChainElement(std::size_t index)
+{
+   auto &element = fChain[index];
+   if (!element.fSource)
+      OpenChainElement(index);
+   element.fFirstEntry = (index == 0) ? 0 : fChain[index - 1].fFirstEntry + fChain[index - 1].fNEntries;
+   element.fNEntries = element.fSource->GetNEntries();
+}
+
+void RNTupleDS::AttachChain()
+{
+   // The schema of the other ntuples is checked against the first one
+   AttachChainElement(0);
+   std::vector<std::size_t> closedElements;
+   for (std::size_t i = 1; i < fChain.size(); ++i) {
+      if (!fChain[i].fSource)
+         closedElements.emplace_back(i);
+   }
+   // Opening an ntuple reads and parses its meta-data, which is independent for every ntuple of the chain
+   auto fnOpen = [this, &closedElements](unsigned int i) { OpenChainElement(closedElements[i]); };
+   bool isOpened = false;
+#ifdef R__USE_IMT
+   if (ROOT::IsImplicitMTEnabled() && closedElements.size() > 1) {
+      ROOT::TThreadExecutor{}.Foreach(fnOpen, ROOT::TSeqU(closedElements.size()));
+      isOpened = true;
+   }
+#endif
+   if (!isOpened) {
+      for (auto i : ROOT::TSeqU(closedElements.size()))
+         fnOpen(i);
+   }
+
+   for (std::size_t i = 1; i < fChain.size(); ++i)
+      AttachChainElement(i);
+}
+
+void RNTupleDS::PrepareSource(Detail::RPageSource &source)
+{
+   if (fIsMetricsEnabled)
+      source.GetMetrics().Enable();
+}
+
+void RNTupleDS::SetLazyColumns(Detail::RPageSource &source) const
+{
+   if (!fIsLazyColumnsEnabled || fFilterColumns.empty()) {
+      source.SetLazyPhysicalColumns({});
+      return;
+   }
+
+   std::vector<std::size_t> eagerColumns = fFilterColumns;
+   for (const auto &filter : fPushdownFilters)
+      eagerColumns.emplace_back(filter.fColumnIndex);
+
+   Detail::RCluster::ColumnSet_t lazyPhysicalColumns;
+   {
+      auto descriptorGuard = source.GetSharedDescriptorGuard();
+      for (const auto &c : descriptorGuard->GetColumnIterable())
+         lazyPhysicalColumns.insert(c.GetPhysicalId());
+      auto fnMarkEager = [&](DescriptorId_t fieldId) {
+         if (fieldId == kInvalidDescriptorId)
+            return;
+         for (const auto &c : descriptorGuard->GetColumnIterable(fieldId))
+            lazyPhysicalColumns.erase(c.GetPhysicalId());
+      };
+      // The prototype fields of collection items are wrapped in fields of the outer collections, whose offset
+      // columns are needed as well
+      for (auto i : eagerColumns) {
+         const auto &protoField = fColumnReaderPrototypes[i]->GetField();
+         fnMarkEager(protoField.GetOnDiskId());
+         for (auto itr = protoField.cbegin(); itr != protoField.cend(); ++itr)
+            fnMarkEager(itr->GetOnDiskId());
+      }
+   }
+   source.SetLazyPhysicalColumns(lazyPhysicalColumns);
+}
+
+void RNTupleDS::AddReadReport(Detail::RPageSource &source, const std::string &location)
+{
+   auto report = source.GetReadReport();
+   report.fLocation = location;
+   std::lock_guard<std::mutex> lockGuard(fReadReportsLock);
+   fReadReports.emplace_back(std::move(report));
+}
+
+void RNTupleDS::EnableMetrics()
+{
+   fIsMetricsEnabled = true;
+   for (auto &slotSource : fSlotSources) {
+      if (slotSource.second)
+         PrepareSource(*slotSource.second);
+   }
+}
+
+std::vector<Detail::RNTupleReadReport> RNTupleDS::GetReadReports()
+{
+   std::vector<Detail::RNTupleReadReport> reports;
+   {
+      std::lock_guard<std::mutex> lockGuard(fReadReportsLock);
+      reports = fReadReports;
+   }
+   if (!fIsMetricsEnabled)
+      return reports;
+
+   auto fnAddOpenSource = [&reports](Detail::RPageSource &source, const std::string &location) {
+      reports.emplace_back(source.GetReadReport());
+      reports.back().fLocation = location;
+   };
+   for (std::size_t slot = 0; slot < fSlotSources.size(); ++slot) {
+      if (fSlotSources[slot].second)
+         fnAddOpenSource(*fSlotSources[slot].second, fChain[fSlotSources[slot].first].fFileName);
+   }
+   return reports;
+}
+
+void RNTupleDS::PrintMetrics(std::ostream &output, Detail::RNTupleReadReport::EFormat format)
+{
+   Detail::RNTupleReadReport::Print(GetReadReports(), output, format);
+}
+
+std::size_t RNTupleDS::FindChainElement(NTupleSize_t entry) const
+{
+   // Empty ntuples share their first entry number with the next ntuple, which is the one that contains the entry
+   auto itr = std::upper_bound(fChain.begin(), fChain.begin() + fNChainElementsSeen, entry,
+                               [](NTupleSize_t e, const RChainElement &element) { return e < element.fFirstEntry; });
+   R__ASSERT(itr != fChain.begin());
+   return std::distance(fChain.begin(), itr) - 1;
+}
+
+std::shared_ptr<Detail::RPageSource> RNTupleDS::GetSlotSource(unsigned int slot, std::size_t index)
+{
+   auto &slotSource = fSlotSources[slot];
+   if (!slotSource.second || slotSource.first != index) {
+      if (slotSource.second && fIsMetricsEnabled)
+         AddReadReport(*slotSource.second, fChain[slotSource.first].fFileName);
+      auto &element = fChain[index];
+      std::shared_ptr<Detail::RPageSource> source;
+      {
+         std::lock_guard<std::mutex> lockGuard(fCloneLock);
+         if (element.fIsSourceInUse) {
+            // The clone copies the descriptor of the attached page source and only opens the file again
+            source = element.fSource->Clone();
+         } else {
+            source = element.fSource;
+            element.fIsSourceInUse = true;
+         }
+      }
+      PrepareSource(*source);
+      source->Attach();
+      slotSource.second = std::move(source);
+      SetLazyColumns(*slotSource.second);
+      slotSource.first = index;
+   }
+   return slotSource.second;
+}
+
 RDF::RDataSource::Record_t RNTupleDS::GetColumnReadersImpl(std::string_view /* name */, const std::type_info & /* ti */)
 {
    // This datasource uses the GetColumnReaders2 API instead (better name in the works)
@@ -285,71 +767,318 @@ RDF::RDataSource::Record_t RNTupleDS::GetColumnReadersImpl(std::string_view /* n
 std::unique_ptr<ROOT::Detail::RDF::RColumnReaderBase>
 RNTupleDS::GetColumnReaders(unsigned int slot, std::string_view name, const std::type_info & /*tid*/)
 {
+   EnsureSchema();
    // at this point we can assume that `name` will be found in fColumnNames, RDF is in charge validation
    // TODO(jblomer): check incoming type
    const auto index = std::distance(fColumnNames.begin(), std::find(fColumnNames.begin(), fColumnNames.end(), name));
-   auto clone = fColumnReaderPrototypes[index]->Clone();
-   clone->Connect(*fSources[slot]);
-   return clone;
+   return fColumnReaderPrototypes[index]->Clone(this, slot);
+}
+
+void RNTupleDS::AddPushdownFilter(std::string_view expression)
+{
+   EnsureSchema();
+   const auto posOperator = expression.find_first_of("<>=!");
+   if (posOperator == std::string_view::npos)
+      throw std::runtime_error("invalid pushdown filter, missing comparison: " + std::string(expression));
+
+   RPushdownFilter filter;
+   filter.fColumnName = std::string(TrimWhitespace(expression.substr(0, posOperator)));
+   auto posValue = posOperator + 1;
+   const bool hasEqualSign = (posValue < expression.size()) && (expression[posValue] == '=');
+   using EOperator = RPushdownFilter::EOperator;
+   switch (expression[posOperator]) {
+   case '<': filter.fOperator = hasEqualSign ? EOperator::kLessEqual : EOperator::kLess; break;
+   case '>': filter.fOperator = hasEqualSign ? EOperator::kGreaterEqual : EOperator::kGreater; break;
+   case '=': filter.fOperator = EOperator::kEqual; break;
+   case '!': filter.fOperator = EOperator::kNotEqual; break;
+   }
+   if (hasEqualSign)
+      ++posValue;
+   else if (expression[posOperator] == '=' || expression[posOperator] == '!')
+      throw std::runtime_error("invalid pushdown filter, unknown comparison: " + std::string(expression));
+
+   const std::string valueStr(TrimWhitespace(expression.substr(posValue)));
+   std::size_t nParsed = 0;
+   try {
+      filter.fValue = std::stod(valueStr, &nParsed);
+   } catch (const std::logic_error &) {
+      nParsed = 0;
+   }
+   if (valueStr.empty() || nParsed != valueStr.size())
+      throw std::runtime_error("invalid pushdown filter, expected a number: " + std::string(expression));
+
+   const auto itrColumn = std::find(fColumnNames.begin(), fColumnNames.end(), filter.fColumnName);
+   if (itrColumn == fColumnNames.end())
+      throw std::runtime_error("unknown column in pushdown filter: " + filter.fColumnName);
+   filter.fColumnIndex = std::distance(fColumnNames.begin(), itrColumn);
+   // Numeric columns of collections are exposed as RVecs and thus rejected here.  All the accepted columns are backed
+   // by fields whose element index equals the entry number.
+   filter.fToDouble = GetValueToDouble(fColumnTypes[filter.fColumnIndex]);
+   if (!filter.fToDouble || filter.fColumnName.rfind("R_rdf_sizeof_", 0) == 0) {
+      throw std::runtime_error("unsupported column type in pushdown filter: " + filter.fColumnName + " [" +
+                               fColumnTypes[filter.fColumnIndex] + "]");
+   }
+   filter.fFieldId = fColumnReaderPrototypes[filter.fColumnIndex]->GetField().GetOnDiskId();
+
+   fPushdownFilters.emplace_back(std::move(filter));
+   fPushdownReaders.clear();
+}
+
+bool RNTupleDS::SetEntry(unsigned int slot, ULong64_t entry)
+{
+   if (fPushdownFilters.empty())
+      return true;
+   auto &readers = fPushdownReaders[slot];
+   for (std::size_t i = 0; i < fPushdownFilters.size(); ++i) {
+      const auto &filter = fPushdownFilters[i];
+      if (!filter.Match(filter.fToDouble(readers[i]->GetImpl(entry))))
+         return false;
+   }
+   return true;
 }
 
-bool RNTupleDS::SetEntry(unsigned int, ULong64_t)
+bool RNTupleDS::CanCopyFields(const std::vector<std::string> &columnNames) const
 {
+   if (!fPushdownFilters.empty())
+      return false;
+   EnsureSchema();
+   auto descriptorGuard = fChain[0].fSource->GetSharedDescriptorGuard();
+   for (const auto &name : columnNames) {
+      if (descriptorGuard->FindFieldId(name, descriptorGuard->GetFieldZeroId()) == kInvalidDescriptorId)
+         return false;
+   }
    return true;
 }
 
+void RNTupleDS::CopyFields(const std::vector<std::string> &columnNames, Detail::RPageSink &sink)
+{
+   // The merger attaches its own page sources, independent of the ones used by the slots
+   std::vector<std::unique_ptr<Detail::RPageSource>> sources;
+   std::vector<Detail::RPageSource *> sourcePtrs;
+   for (const auto &element : fChain) {
+      // Clones of attached page sources do not parse the meta-data again
+      if (element.fSource)
+         sources.emplace_back(element.fSource->Clone());
+      else
+         sources.emplace_back(Detail::RPageSource::Create(fNTupleName, element.fFileName));
+      sourcePtrs.emplace_back(sources.back().get());
+   }
+   Internal::RNTupleMerger merger;
+   merger.Merge(sourcePtrs, sink, columnNames);
+}
+
+std::optional<std::uint32_t> RNTupleDS::GetCommonCompression(const std::vector<std::string> &columnNames)
+{
+   EnsureSchema();
+   AttachChain();
+   std::set<std::uint32_t> compressions;
+   for (const auto &element : fChain) {
+      auto descriptorGuard = element.fSource->GetSharedDescriptorGuard();
+      std::vector<DescriptorId_t> physicalColumnIds;
+      std::function<void(DescriptorId_t)> fnAddColumns = [&](DescriptorId_t fieldId) {
+         for (const auto &c : descriptorGuard->GetColumnIterable(fieldId)) {
+            if (!c.IsAliasColumn())
+               physicalColumnIds.emplace_back(c.GetPhysicalId());
+         }
+         for (const auto &f : descriptorGuard->GetFieldIterable(fieldId))
+            fnAddColumns(f.GetId());
+      };
+      for (const auto &name : columnNames) {
+         const auto fieldId = descriptorGuard->FindFieldId(name, descriptorGuard->GetFieldZeroId());
+         if (fieldId != kInvalidDescriptorId)
+            fnAddColumns(fieldId);
+      }
+      for (const auto &c : descriptorGuard->GetClusterIterable()) {
+         for (auto physicalColumnId : physicalColumnIds) {
+            if (c.ContainsColumn(physicalColumnId))
+               compressions.insert(c.GetColumnRange(physicalColumnId).fCompressionSettings);
+         }
+      }
+   }
+   if (compressions.size() != 1)
+      return std::nullopt;
+   return *compressions.begin();
+}
+
+std::vector<std::pair<ULong64_t, ULong64_t>> RNTupleDS::GetClusterRanges(const RChainElement &element)
+{
+   auto descriptorGuard = element.fSource->GetSharedDescriptorGuard();
+   std::vector<const RClusterDescriptor *> clusters;
+   for (const auto &c : descriptorGuard->GetClusterIterable())
+      clusters.emplace_back(&c);
+   std::sort(clusters.begin(), clusters.end(),
+             [](auto a, auto b) { return a->GetFirstEntryIndex() < b->GetFirstEntryIndex(); });
+
+   EntryRanges_t ranges;
+   for (const auto c : clusters) {
+      if (c->GetNEntries() == 0)
+         continue;
+      const auto firstEntry = element.fFirstEntry + c->GetFirstEntryIndex();
+      ranges.emplace_back(firstEntry, firstEntry + c->GetNEntries());
+   }
+   return ranges;
+}
+
+std::vector<std::pair<ULong64_t, ULong64_t>> RNTupleDS::GetPushdownRanges(const RChainElement &element)
+{
+   auto descriptorGuard = element.fSource->GetSharedDescriptorGuard();
+   std::vector<const RClusterDescriptor *> clusters;
+   for (const auto &c : descriptorGuard->GetClusterIterable())
+      clusters.emplace_back(&c);
+   std::sort(clusters.begin(), clusters.end(),
+             [](auto a, auto b) { return a->GetFirstEntryIndex() < b->GetFirstEntryIndex(); });
+   std::vector<DescriptorId_t> physicalColumnIds;
+   for (const auto &filter : fPushdownFilters)
+      physicalColumnIds.emplace_back(descriptorGuard->FindPhysicalColumnId(filter.fFieldId, 0));
+
+   EntryRanges_t ranges;
+   for (const auto c : clusters) {
+      const auto firstEntry = element.fFirstEntry + c->GetFirstEntryIndex();
+      EntryRanges_t clusterRanges{{firstEntry, firstEntry + c->GetNEntries()}};
+      for (std::size_t i = 0; i < fPushdownFilters.size(); ++i) {
+         const auto &filter = fPushdownFilters[i];
+         const auto physicalColumnId = physicalColumnIds[i];
+         if (physicalColumnId == kInvalidDescriptorId || !c->ContainsColumn(physicalColumnId))
+            continue;
+         const auto &columnRange = c->GetColumnRange(physicalColumnId);
+         if (!columnRange.fStatistics)
+            continue;
+         if (!filter.CanMatch(*columnRange.fStatistics)) {
+            clusterRanges.clear();
+            break;
+         }
+         if (columnRange.fNElements != c->GetNEntries())
+            continue;
+
+         // Narrow down the cluster to the pages that may contain matching entries
+         EntryRanges_t pageRanges;
+         auto pageFirstEntry = firstEntry;
+         for (const auto &pi : c->GetPageRange(physicalColumnId).fPageInfos) {
+            const auto pageEndEntry = pageFirstEntry + pi.fNElements;
+            if (!pi.fStatistics || filter.CanMatch(*pi.fStatistics)) {
+               if (!pageRanges.empty() && pageRanges.back().second == pageFirstEntry)
+                  pageRanges.back().second = pageEndEntry;
+               else
+                  pageRanges.emplace_back(pageFirstEntry, pageEndEntry);
+            }
+            pageFirstEntry = pageEndEntry;
+         }
+         clusterRanges = IntersectRanges(clusterRanges, pageRanges);
+         if (clusterRanges.empty())
+            break;
+      }
+      ranges.insert(ranges.end(), clusterRanges.begin(), clusterRanges.end());
+   }
+   return ranges;
+}
+
 std::vector<std::pair<ULong64_t, ULong64_t>> RNTupleDS::GetEntryRanges()
 {
-   // TODO(jblomer): use cluster boundaries for the entry ranges
    std::vector<std::pair<ULong64_t, ULong64_t>> ranges;
-   if (fHasSeenAllRanges)
+   if (fNChainElementsSeen == fChain.size())
       return ranges;
 
-   auto nEntries = fSources[0]->GetNEntries();
-   const auto chunkSize = nEntries / fNSlots;
-   const auto reminder = 1U == fNSlots ? 0 : nEntries % fNSlots;
-   auto start = 0UL;
-   auto end = 0UL;
-   for (auto i : ROOT::TSeqU(fNSlots)) {
-      start = end;
-      end += chunkSize;
-      ranges.emplace_back(start, end);
-      (void)i;
-   }
-   ranges.back().second += reminder;
-   fHasSeenAllRanges = true;
-   return ranges;
+   // Handing out the ranges of all the ntuples at once lets the slots move on to the next ntuple whenever they are
+   // done, instead of waiting for the slowest ntuple of a batch.  Only the entry ranges are kept in memory, the
+   // ntuples are closed as soon as they are known.
+   AttachChain();
+   std::vector<std::size_t> nElementRanges;
+   for (const auto &element : fChain) {
+      auto elementRanges = fPushdownFilters.empty() ? GetClusterRanges(element) : GetPushdownRanges(element);
+      ranges.insert(ranges.end(), elementRanges.begin(), elementRanges.end());
+      nElementRanges.emplace_back(elementRanges.size());
+   }
+   fNChainElementsSeen = fChain.size();
+   if (!fPushdownFilters.empty())
+      return ranges;
+
+   // Consecutive clusters of the same ntuple are merged into a single range as long as the range has less than
+   // nMinEntries entries
+   const NTupleSize_t nMinEntries =
+      (fChain.back().fFirstEntry + fChain.back().fNEntries) / (fNSlots * kNRangesPerSlot);
+   std::vector<std::pair<ULong64_t, ULong64_t>> mergedRanges;
+   std::size_t r = 0;
+   for (auto n : nElementRanges) {
+      for (std::size_t i = 0; i < n; ++i, ++r) {
+         if (i > 0 && (mergedRanges.back().second - mergedRanges.back().first < nMinEntries))
+            mergedRanges.back().second = ranges[r].second;
+         else
+            mergedRanges.emplace_back(ranges[r]);
+      }
+   }
+   return mergedRanges;
+}
+
+const std::vector<std::string> &RNTupleDS::GetColumnNames() const
+{
+   EnsureSchema();
+   return fColumnNames;
 }
 
 std::string RNTupleDS::GetTypeName(std::string_view colName) const
 {
+   EnsureSchema();
    const auto index = std::distance(fColumnNames.begin(), std::find(fColumnNames.begin(), fColumnNames.end(), colName));
    return fColumnTypes[index];
 }
 
 bool RNTupleDS::HasColumn(std::string_view colName) const
 {
+   EnsureSchema();
    return std::find(fColumnNames.begin(), fColumnNames.end(), colName) != fColumnNames.end();
 }
 
+void RNTupleDS::EnableLazyColumns()
+{
+   fIsLazyColumnsEnabled = true;
+}
+
+void RNTupleDS::SetFilterColumns(const std::vector<std::string> &columnNames)
+{
+   EnsureSchema();
+   fFilterColumns.clear();
+   for (const auto &name : columnNames) {
+      auto itr = std::find(fColumnNames.begin(), fColumnNames.end(), name);
+      if (itr != fColumnNames.end())
+         fFilterColumns.emplace_back(std::distance(fColumnNames.begin(), itr));
+   }
+   // The page sources that are already open are reused by the coming event loop
+   for (auto &slotSource : fSlotSources) {
+      if (slotSource.second)
+         SetLazyColumns(*slotSource.second);
+   }
+}
+
 void RNTupleDS::Initialize()
 {
-   fHasSeenAllRanges = false;
+   EnsureSchema();
+   fNChainElementsSeen = 0;
+
+   if (fPushdownFilters.empty() || !fPushdownReaders.empty())
+      return;
+   fPushdownReaders.resize(fNSlots);
+   for (unsigned int slot = 0; slot < fNSlots; ++slot) {
+      for (const auto &filter : fPushdownFilters)
+         fPushdownReaders[slot].emplace_back(fColumnReaderPrototypes[filter.fColumnIndex]->Clone(this, slot));
+   }
 }
 
-void RNTupleDS::Finalize() {}
+void RNTupleDS::Finalize()
+{
+   // Only the ntuples that the slots still read stay open; the others are opened again by the next event loop
+   for (std::size_t i = 1; i < fChain.size(); ++i) {
+      if (!fChain[i].fFileName.empty())
+         fChain[i].fSource.reset();
+   }
+}
 
 void RNTupleDS::SetNSlots(unsigned int nSlots)
 {
    R__ASSERT(fNSlots == 0);
    R__ASSERT(nSlots > 0);
    fNSlots = nSlots;
-
-   for (unsigned int i = 1; i < fNSlots; ++i) {
-      fSources.emplace_back(fSources[0]->Clone());
-      assert(i == (fSources.size() - 1));
-      fSources[i]->Attach();
-   }
+   // The page sources of the slots are opened on first use
+   fSlotSources.resize(fNSlots);
 }
 } // namespace Experimental
 } // namespace ROOT
@@ -361,8 +1090,26 @@ ROOT::RDataFrame ROOT::RDF::Experimental::FromRNTuple(std::string_view ntupleNam
    return rdf;
 }
 
+ROOT::RDataFrame ROOT::RDF::Experimental::FromRNTuple(std::string_view ntupleName, std::string_view fileName,
+                                                      const std::vector<std::string> &pushdownFilters)
+{
+   auto pageSource = ROOT::Experimental::Detail::RPageSource::Create(ntupleName, fileName);
+   auto ds = std::make_unique<ROOT::Experimental::RNTupleDS>(std::move(pageSource));
+   for (const auto &f : pushdownFilters)
+      ds->AddPushdownFilter(f);
+   ROOT::RDataFrame rdf(std::move(ds));
+   return rdf;
+}
+
 ROOT::RDataFrame ROOT::RDF::Experimental::FromRNTuple(ROOT::Experimental::RNTuple *ntuple)
 {
    ROOT::RDataFrame rdf(std::make_unique<ROOT::Experimental::RNTupleDS>(ntuple->MakePageSource()));
    return rdf;
 }
+
+ROOT::RDataFrame
+ROOT::RDF::Experimental::FromRNTuple(std::string_view ntupleName, const std::vector<std::string> &fileNames)
+{
+   ROOT::RDataFrame rdf(std::make_unique<ROOT::Experimental::RNTupleDS>(ntupleName, fileNames));
+   return rdf;
+}
@@ -0,0 +1,139 @@
+/*************************************************************************
+ * Copyright (C) 1995-2024, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "ROOT/RDF/RProfileReport.hxx"
+#include "TString.h" // Printf
+
+#include <algorithm>
+#include <nlohmann/json.hpp>
+#include <numeric>
+
+using ROOT::RDF::Experimental::RProfileReport;
+
+double RProfileReport::RNode::GetTime() const
+{
+   return std::accumulate(fTimes.begin(), fTimes.end(), 0.);
+}
+
+ULong64_t RProfileReport::RNode::GetCalls() const
+{
+   return std::accumulate(fCalls.begin(), fCalls.end(), ULong64_t(0));
+}
+
+ULong64_t RProfileReport::GetNEntries() const
+{
+   ULong64_t nEntries = 0;
+   for (const auto &task : fTasks)
+      nEntries += task.fNEntries;
+   return nEntries;
+}
+
+/// Print the totals of the event loop and the nodes sorted by decreasing time
+void RProfileReport::Print() const
+{
+   double ioWaitTime = 0.;
+   for (const auto &task : fTasks)
+      ioWaitTime += task.GetIOWaitTime();
+   const auto nEntries = GetNEntries();
+   Printf("Event loop: %llu entries in %.3f s (%.0f entries/s), %zu tasks on %u slots, %.3f s of I/O wait",
+          nEntries, fWallTime, fWallTime > 0. ? nEntries / fWallTime : 0., fTasks.size(), fNSlots, ioWaitTime);
+
+   std::vector<const RNode *> nodes;
+   for (const auto &node : fNodes)
+      nodes.emplace_back(&node);
+   std::stable_sort(nodes.begin(), nodes.end(),
+                    [](const RNode *n1, const RNode *n2) { return n1->GetTime() > n2->GetTime(); });
+   Printf("%-14s %-30s %12s %14s", "Kind", "Name", "Time [s]", "Calls");
+   for (const auto *node : nodes)
+      Printf("%-14s %-30s %12.6f %14llu", node->fKind.c_str(), node->fName.c_str(), node->GetTime(), node->GetCalls());
+}
+
+std::string RProfileReport::ToJSON() const
+{
+   nlohmann::ordered_json json;
+   json["nSlots"] = fNSlots;
+   json["wallTime"] = fWallTime;
+   json["nEntries"] = GetNEntries();
+
+   json["nodes"] = nlohmann::ordered_json::array();
+   for (const auto &node : fNodes) {
+      nlohmann::ordered_json jsonNode;
+      jsonNode["kind"] = node.fKind;
+      jsonNode["name"] = node.fName;
+      jsonNode["time"] = node.GetTime();
+      jsonNode["calls"] = node.GetCalls();
+      jsonNode["timePerSlot"] = node.fTimes;
+      jsonNode["callsPerSlot"] = node.fCalls;
+      json["nodes"].push_back(std::move(jsonNode));
+   }
+
+   json["tasks"] = nlohmann::ordered_json::array();
+   for (const auto &task : fTasks) {
+      nlohmann::ordered_json jsonTask;
+      jsonTask["slot"] = task.fSlot;
+      jsonTask["start"] = task.fStart;
+      jsonTask["wallTime"] = task.fWallTime;
+      jsonTask["cpuTime"] = task.fCpuTime;
+      jsonTask["ioWaitTime"] = task.GetIOWaitTime();
+      jsonTask["nEntries"] = task.fNEntries;
+      jsonTask["nodes"] = nlohmann::ordered_json::array();
+      for (const auto &node : task.fNodes)
+         jsonTask["nodes"].push_back({{"node", node.fNode}, {"time", node.fTime}, {"calls", node.fCalls}});
+      json["tasks"].push_back(std::move(jsonTask));
+   }
+
+   return json.dump(1);
+}
+
+std::string RProfileReport::ToChromeTrace() const
+{
+   // Times are in microseconds in the trace event format
+   constexpr double kMicroseconds = 1e6;
+   auto events = nlohmann::ordered_json::array();
+   for (unsigned int slot = 0; slot < fNSlots; ++slot) {
+      events.push_back({{"name", "thread_name"},
+                        {"ph", "M"},
+                        {"pid", 0},
+                        {"tid", slot},
+                        {"args", {{"name", "slot " + std::to_string(slot)}}}});
+   }
+   for (const auto &task : fTasks) {
+      const double start = task.fStart * kMicroseconds;
+      events.push_back({{"name", "Task"},
+                        {"cat", "task"},
+                        {"ph", "X"},
+                        {"ts", start},
+                        {"dur", task.fWallTime * kMicroseconds},
+                        {"pid", 0},
+                        {"tid", task.fSlot},
+                        {"args",
+                         {{"nEntries", task.fNEntries},
+                          {"cpuTime", task.fCpuTime},
+                          {"ioWaitTime", task.GetIOWaitTime()}}}});
+      // the nodes are laid out one after the other within the task
+      double nodeStart = start;
+      for (const auto &nodeInTask : task.fNodes) {
+         const auto &node = fNodes[nodeInTask.fNode];
+         const double duration = std::max(nodeInTask.fTime, 0.) * kMicroseconds;
+         events.push_back({{"name", node.fKind + ": " + node.fName},
+                           {"cat", node.fKind},
+                           {"ph", "X"},
+                           {"ts", nodeStart},
+                           {"dur", duration},
+                           {"pid", 0},
+                           {"tid", task.fSlot},
+                           {"args", {{"calls", nodeInTask.fCalls}}}});
+         nodeStart += duration;
+      }
+   }
+
+   nlohmann::ordered_json json;
+   json["traceEvents"] = std::move(events);
+   json["displayTimeUnit"] = "ms";
+   return json.dump();
+}
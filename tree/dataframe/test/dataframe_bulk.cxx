@@ -0,0 +1,206 @@
+#include <ROOT/RDataFrame.hxx>
+#include <ROOT/RDFHelpers.hxx>
+#include <ROOT/RTrivialDS.hxx>
+#include <TFile.h>
+#include <TSystem.h>
+#include <TTree.h>
+
+#include <gtest/gtest.h>
+
+// Backward compatibility for gtest version < 1.10.0
+#ifndef INSTANTIATE_TEST_SUITE_P
+#define INSTANTIATE_TEST_SUITE_P INSTANTIATE_TEST_CASE_P
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <string>
+#include <thread> // std::thread::hardware_concurrency
+#include <vector>
+
+using ROOT::RDF::Experimental::SetBulkSize;
+
+// fixture for all tests in this file
+struct RDFBulk : ::testing::TestWithParam<bool> {
+   RDFBulk()
+   {
+      if (GetParam())
+         ROOT::EnableImplicitMT(std::min(4u, std::thread::hardware_concurrency()));
+   }
+
+   ~RDFBulk() override
+   {
+      if (GetParam())
+         ROOT::DisableImplicitMT();
+   }
+};
+
+namespace {
+/// The results of the same computation graph, processed in bulks or entry by entry
+struct RResults {
+   ULong64_t fNPassed = 0;
+   double fSumX = 0;
+   double fSumY = 0;
+   ULong64_t fSumEntries = 0;
+   ULong64_t fSumPerSample = 0;
+   double fHistoMean = 0;
+   ULong64_t fNAllCuts = 0;
+
+   void Check(const RResults &other) const
+   {
+      EXPECT_EQ(fNPassed, other.fNPassed);
+      EXPECT_DOUBLE_EQ(fSumX, other.fSumX);
+      EXPECT_DOUBLE_EQ(fSumY, other.fSumY);
+      EXPECT_EQ(fSumEntries, other.fSumEntries);
+      EXPECT_EQ(fSumPerSample, other.fSumPerSample);
+      EXPECT_DOUBLE_EQ(fHistoMean, other.fHistoMean);
+      EXPECT_EQ(fNAllCuts, other.fNAllCuts);
+   }
+};
+
+/// Books filters, defines and actions on a column `x` of type T and runs the event loop
+template <typename T>
+RResults RunGraph(ROOT::RDF::RNode df)
+{
+   std::atomic<ULong64_t> nDefineCalls{0};
+   auto timesTwo = [&nDefineCalls](T x) {
+      ++nDefineCalls;
+      return double(x) * 2;
+   };
+   ROOT::RDF::RNode dd = df.Define("y", timesTwo, {"x"});
+   dd = dd.DefinePerSample("one", [](unsigned int, const ROOT::RDF::RSampleInfo &) { return 1ull; });
+   dd = dd.DefineSlotEntry("entry", [](unsigned int, ULong64_t entry) { return entry; });
+   ROOT::RDF::RNode f1 = dd.Filter([](T x) { return x % 3 != 0; }, {"x"}, "notDivisibleBy3");
+   ROOT::RDF::RNode f2 = f1.Filter([](double y) { return y < 150.; }, {"y"}, "yLessThan150");
+   auto count = f2.Count();
+   auto sumX = f2.Sum<T>("x");
+   auto sumY = f2.Sum<double>("y");
+   auto sumEntries = dd.Filter("rdfentry_ % 2 == 0").Sum<ULong64_t>("entry");
+   auto sumPerSample = dd.Sum<ULong64_t>("one");
+   auto histo = f1.Histo1D<double>("y");
+   auto report = dd.Report();
+
+   RResults results;
+   results.fNPassed = *count;
+   results.fSumX = *sumX;
+   results.fSumY = *sumY;
+   results.fSumEntries = *sumEntries;
+   results.fSumPerSample = *sumPerSample;
+   results.fHistoMean = histo->GetMean();
+   results.fNAllCuts = report->At("yLessThan150").GetPass();
+   // Defines are evaluated only once per entry, also in bulk mode
+   EXPECT_LE(nDefineCalls.load(), df.Count().GetValue());
+   return results;
+}
+
+/// Runs the graph entry by entry and in bulks of different sizes
+template <typename T, typename MakeDF_t>
+void CheckBulkResults(MakeDF_t &&makeDF)
+{
+   const auto expected = RunGraph<T>(makeDF());
+   for (std::size_t bulkSize : {1u, 7u, 64u, 1000u}) {
+      auto df = makeDF();
+      SetBulkSize(df, bulkSize);
+      RunGraph<T>(df).Check(expected);
+   }
+}
+
+/// A RAII object that ensures the existence of a ROOT file with a TTree called "t" with one `int` branch called "x"
+/// that takes the values 0 to nEntries - 1
+struct InputFileRAII {
+   std::string fFileName;
+
+   InputFileRAII(const std::string &fileName, int nEntries) : fFileName(fileName)
+   {
+      TFile f(fFileName.c_str(), "recreate");
+      TTree t("t", "t");
+      int x = 0;
+      t.Branch("x", &x);
+      for (x = 0; x < nEntries; ++x)
+         t.Fill();
+      t.Write();
+   }
+
+   ~InputFileRAII() { gSystem->Unlink(fFileName.c_str()); }
+};
+} // anonymous namespace
+
+TEST_P(RDFBulk, EmptySource)
+{
+   CheckBulkResults<ULong64_t>([] { return ROOT::RDF::RNode(ROOT::RDataFrame(100).Define("x", "rdfentry_")); });
+}
+
+TEST_P(RDFBulk, DataSource)
+{
+   CheckBulkResults<ULong64_t>([] {
+      return ROOT::RDF::RNode(ROOT::RDF::MakeTrivialDataFrame(100).Alias("x", "col0"));
+   });
+}
+
+TEST_P(RDFBulk, TTree)
+{
+   InputFileRAII file1("dataframe_bulk_ttree_1.root", 100);
+   InputFileRAII file2("dataframe_bulk_ttree_2.root", 57);
+   CheckBulkResults<int>(
+      [] { return ROOT::RDF::RNode(ROOT::RDataFrame("t", {"dataframe_bulk_ttree_*.root"})); });
+}
+
+TEST_P(RDFBulk, Fallback)
+{
+   // Ranges and systematic variations force entry-by-entry processing
+   ROOT::RDataFrame df(100);
+   SetBulkSize(df, 16);
+   auto dd = df.Define("x", [](ULong64_t e) { return int(e); }, {"rdfentry_"});
+   auto sumVaried = ROOT::RDF::Experimental::VariationsFor(
+      dd.Vary("x", [](int x) { return ROOT::RVecI{x - 1, x + 1}; }, {"x"}, 2).Sum<int>("x"));
+   EXPECT_EQ(4950, sumVaried["nominal"]);
+   EXPECT_EQ(4850, sumVaried["x:0"]);
+   EXPECT_EQ(5050, sumVaried["x:1"]);
+
+   if (!GetParam()) {
+      auto sumRange = dd.Range(10, 20).Sum<int>("x");
+      EXPECT_EQ(145, *sumRange);
+   }
+}
+
+TEST_P(RDFBulk, Snapshot)
+{
+   // in bulk mode, every entry of a bulk is passed to Snapshot from a different address
+   const std::string fileName = "dataframe_bulk_snapshot.root";
+   ROOT::RDataFrame df(100);
+   SetBulkSize(df, 16);
+   auto out = df.Define("x", [](ULong64_t e) { return int(e); }, {"rdfentry_"})
+                 .Define("y", [](int x) { return x * 0.5; }, {"x"})
+                 .Define("v", [](int x) { return ROOT::RVecI(x % 4, x); }, {"x"})
+                 .Filter([](int x) { return x % 3 != 0; }, {"x"})
+                 .Snapshot<int, double, ROOT::RVecI>("t", fileName, {"x", "y", "v"});
+
+   auto xs = out->Take<int>("x");
+   auto ys = out->Take<double>("y");
+   auto vs = out->Take<ROOT::RVecI>("v");
+   ASSERT_EQ(66u, xs->size());
+   std::vector<int> sortedXs;
+   for (std::size_t i = 0; i < xs->size(); ++i) {
+      const int x = (*xs)[i];
+      sortedXs.emplace_back(x);
+      EXPECT_DOUBLE_EQ(x * 0.5, (*ys)[i]);
+      EXPECT_TRUE(ROOT::VecOps::All((*vs)[i] == x));
+      EXPECT_EQ(std::size_t(x % 4), (*vs)[i].size());
+   }
+   // with multiple threads, the order of the entries in the output is not guaranteed
+   std::sort(sortedXs.begin(), sortedXs.end());
+   std::vector<int> expectedXs;
+   for (int x = 0; x < 100; ++x) {
+      if (x % 3 != 0)
+         expectedXs.emplace_back(x);
+   }
+   EXPECT_EQ(expectedXs, sortedXs);
+
+   gSystem->Unlink(fileName.c_str());
+}
+
+INSTANTIATE_TEST_SUITE_P(Seq, RDFBulk, ::testing::Values(false));
+
+#ifdef R__USE_IMT
+INSTANTIATE_TEST_SUITE_P(MT, RDFBulk, ::testing::Values(true));
+#endif
@@ -3,14 +3,17 @@
 
 #include "ROOT/RCsvDS.hxx"
 #include "ROOT/RDataFrame.hxx"
+#include "ROOT/RDFHelpers.hxx"
 #include "ROOT/RStringView.hxx"
 #include "ROOT/RTrivialDS.hxx"
+#include "TInterpreter.h"
 #include "TMemFile.h"
 #include "TSystem.h"
 #include "TTree.h"
 
 #include "gtest/gtest.h"
 
+#include <fstream>
 #include <thread>
 
 using namespace ROOT;
@@ -877,3 +880,67 @@ TEST(RDataFrameUtils, RegexWithFriendsInJittedFilters)
    EXPECT_EQ(df.Filter("fr.x < 0 && x > 0").Count().GetValue(), 1);
    EXPECT_EQ(df.Filter("x > 0 && fr.x < 0").Count().GetValue(), 1);
 }
+
+TEST(RDataFrameInterface, JitCache)
+{
+   const std::string cacheDir = "dataframe_interface_jitcache";
+   auto listFiles = [&cacheDir]() {
+      std::vector<std::string> fileNames;
+      if (auto dir = gSystem->OpenDirectory(cacheDir.c_str())) {
+         while (const char *entry = gSystem->GetDirEntry(dir)) {
+            const std::string fileName = entry;
+            if (fileName != "." && fileName != "..")
+               fileNames.emplace_back(fileName);
+         }
+         gSystem->FreeDirectory(dir);
+      }
+      return fileNames;
+   };
+   auto countFiles = [&listFiles](const std::string &suffix) {
+      int n = 0;
+      for (const auto &fileName : listFiles()) {
+         if (fileName.size() > suffix.size() &&
+             fileName.compare(fileName.size() - suffix.size(), suffix.size(), suffix) == 0)
+            ++n;
+      }
+      return n;
+   };
+
+   ROOT::RDF::Experimental::SetJitCacheDir(cacheDir);
+   const std::string soExt = std::string(".") + gSystem->GetSoExt();
+   // The second computation graph is identical up to the addresses of its nodes, so it reuses the library of the first
+   for (int i = 0; i < 2; ++i) {
+      RDataFrame df(10);
+      auto sum = df.Define("x", "rdfentry_ * 2").Filter("x > 4").Sum<ULong64_t>("x");
+      EXPECT_EQ(84ull, *sum);
+      EXPECT_EQ(1, countFiles(soExt));
+   }
+
+   // Code that refers to functions only known to the interpreter cannot be compiled: fall back to the interpreter
+   gInterpreter->Declare("int dataframe_interface_jitcache_triple(int x) { return 3 * x; }");
+   RDataFrame df(10);
+   auto count = df.Filter("dataframe_interface_jitcache_triple(rdfentry_) > 20").Count();
+   EXPECT_EQ(3ull, *count);
+   EXPECT_EQ(1, countFiles(".failed"));
+
+   // A failure marker of another ROOT build or compiler is ignored: the compilation is retried and the marker renewed
+   std::string failedPath;
+   for (const auto &fileName : listFiles()) {
+      if (fileName.size() > 7 && fileName.compare(fileName.size() - 7, 7, ".failed") == 0)
+         failedPath = cacheDir + "/" + fileName;
+   }
+   std::ofstream(failedPath) << "stale\n";
+   RDataFrame dfRetry(10);
+   auto countRetry = dfRetry.Filter("dataframe_interface_jitcache_triple(rdfentry_) > 20").Count();
+   EXPECT_EQ(3ull, *countRetry);
+   std::string stamp;
+   std::getline(std::ifstream(failedPath), stamp);
+   EXPECT_FALSE(stamp.empty());
+   EXPECT_NE("stale", stamp);
+
+   ROOT::RDF::Experimental::SetJitCacheDir("");
+   // The cache directory is flat
+   for (const auto &fileName : listFiles())
+      gSystem->Unlink((cacheDir + "/" + fileName).c_str());
+   gSystem->Unlink(cacheDir.c_str());
+}
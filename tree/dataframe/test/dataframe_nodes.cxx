@@ -1,6 +1,9 @@
 #include "ROOT/TestSupport.hxx"
 
 #include <ROOT/RDataFrame.hxx>
+#include <ROOT/RDFHelpers.hxx>
+#include <ROOT/RTrivialDS.hxx>
+#include <TInterpreter.h>
 #include <TStatistic.h> // To check reading of columns with types which are mothers of the column type
 #include <TSystem.h>
 
@@ -103,3 +106,127 @@ TEST(RDataFrameNodes, InheritanceOfDefines)
    ROOT::RDataFrame(1).Define("x", createStat).Snapshot<TStatistic>("t", ofileName, {"x"})->Foreach(checkStat, {"x"});
    gSystem->Unlink(ofileName);
 }
+
+namespace {
+/// Declares functions that count how many times they are called, to be used in jitted expressions
+void DeclareCountingFunctions()
+{
+   static const bool isDeclared =
+      gInterpreter->Declare("namespace RDFNodesTest { int nCalls = 0; "
+                            "double Twice(ULong64_t x) { ++nCalls; return 2. * x; } "
+                            "bool IsEven(ULong64_t x) { ++nCalls; return x % 2 == 0; } "
+                            "bool IsSmall(ULong64_t x) { ++nCalls; return x < 1000000; } }");
+   ASSERT_TRUE(isDeclared);
+}
+
+int GetNCalls()
+{
+   return gInterpreter->Calc("RDFNodesTest::nCalls");
+}
+
+void ResetNCalls()
+{
+   gInterpreter->ProcessLine("RDFNodesTest::nCalls = 0;");
+}
+} // anonymous namespace
+
+TEST(RDataFrameNodes, GraphOptimizationMergesDefinesAndFilters)
+{
+   DeclareCountingFunctions();
+   for (bool optimize : {false, true}) {
+      ResetNCalls();
+      ROOT::RDataFrame df(100);
+      if (optimize)
+         ROOT::RDF::Experimental::EnableGraphOptimization(df);
+      auto dx = df.Define("x", [](ULong64_t e) { return e; }, {"rdfentry_"});
+      auto sum1 = dx.Define("y", "RDFNodesTest::Twice(x)").Sum<double>("y");
+      auto sum2 = dx.Define("z", "RDFNodesTest::Twice(x)").Filter("z < 100").Sum<double>("z");
+      auto count1 = dx.Filter("RDFNodesTest::IsEven(x)").Count();
+      auto count2 = dx.Filter("RDFNodesTest::IsEven(x)").Filter("x > 10").Count();
+      // named filters are never merged, as they appear in the cutflow report
+      auto count3 = dx.Filter("RDFNodesTest::IsEven(x)", "even").Count();
+      EXPECT_DOUBLE_EQ(9900., *sum1);
+      EXPECT_DOUBLE_EQ(2450., *sum2);
+      EXPECT_EQ(50u, *count1);
+      EXPECT_EQ(44u, *count2);
+      EXPECT_EQ(50u, *count3);
+      EXPECT_EQ(optimize ? 300 : 500, GetNCalls());
+   }
+}
+
+TEST(RDataFrameNodes, GraphOptimizationReordersFilters)
+{
+   DeclareCountingFunctions();
+   for (bool reorder : {false, true}) {
+      ResetNCalls();
+      ROOT::RDataFrame df(10000);
+      ROOT::RDF::Experimental::EnableGraphOptimization(df, reorder);
+      auto dx = df.Define("x", [](ULong64_t e) { return e; }, {"rdfentry_"});
+      // the first filter passes all entries, the second one 20% of them: after the warm-up, the second filter is
+      // evaluated first and the first filter only for the entries that pass the second one
+      auto filter = dx.Filter("RDFNodesTest::IsSmall(x)").Filter("x % 10 == 1 || x % 10 == 2");
+      ROOT::RDF::Experimental::AllowFilterReordering(filter);
+      auto count = filter.Count();
+      EXPECT_EQ(2000u, *count);
+      const auto nWarmUp = ROOT::Internal::RDF::RFilterChain::kNWarmUpEntries;
+      EXPECT_EQ(reorder ? nWarmUp + (10000 - nWarmUp) / 5 : 10000, GetNCalls());
+   }
+}
+
+TEST(RDataFrameNodes, GraphOptimizationKeepsGuardedFilters)
+{
+   ROOT::RDataFrame df(10000);
+   ROOT::RDF::Experimental::EnableGraphOptimization(df, true);
+   auto dv = df.Define("v", [](ULong64_t e) { return e % 100 == 0 ? ROOT::RVecI() : ROOT::RVecI(1, e % 2); },
+                       {"rdfentry_"});
+   // the guard rejects 1% of the entries and the second filter half of them, but the second filter is not marked as
+   // reorderable: it is never evaluated for an empty v
+   auto count = dv.Filter("v.size() > 0").Filter("v.at(0) > 0").Count();
+   EXPECT_EQ(5000u, *count);
+
+   auto notJitted = df.Filter([] { return true; });
+   EXPECT_THROW(ROOT::RDF::Experimental::AllowFilterReordering(notJitted), std::runtime_error);
+}
+
+TEST(RDataFrameNodes, Profiling)
+{
+   auto df = ROOT::RDF::MakeTrivialDataFrame(100);
+   EXPECT_THROW(ROOT::RDF::Experimental::GetProfileReport(df), std::runtime_error);
+   ROOT::RDF::Experimental::EnableProfiling(df);
+
+   auto dd = df.Define("x", [](ULong64_t c) { return c * 2; }, {"col0"});
+   auto sum = dd.Filter([](ULong64_t x) { return x % 4 == 0; }, {"x"}, "multipleOf4").Sum<ULong64_t>("x");
+   EXPECT_EQ(4900ull, *sum);
+
+   auto getCalls = [](const ROOT::RDF::Experimental::RProfileReport &report, const std::string &kind,
+                      const std::string &name) {
+      for (const auto &node : report.GetNodes()) {
+         if (node.fKind == kind && node.fName == name)
+            return node.GetCalls();
+      }
+      return ULong64_t(0);
+   };
+   auto report = ROOT::RDF::Experimental::GetProfileReport(df);
+   EXPECT_EQ(100ull, report.GetNEntries());
+   // the input column is only read by the Define, whose value is computed once per entry
+   EXPECT_EQ(100ull, getCalls(report, "Column reader", "col0"));
+   EXPECT_EQ(100ull, getCalls(report, "Define", "x"));
+   EXPECT_EQ(100ull, getCalls(report, "Filter", "multipleOf4"));
+   EXPECT_EQ(100ull, getCalls(report, "Action", "Sum"));
+   EXPECT_FALSE(report.GetTasks().empty());
+   for (const auto &task : report.GetTasks())
+      EXPECT_GE(task.fWallTime, 0.);
+   EXPECT_NE(std::string::npos, report.ToJSON().find("\"multipleOf4\""));
+   const auto trace = report.ToChromeTrace();
+   EXPECT_NE(std::string::npos, trace.find("\"traceEvents\""));
+   EXPECT_NE(std::string::npos, trace.find("\"Filter: multipleOf4\""));
+
+   // the statistics are reset at every event loop. Named filters run in every event loop.
+   auto count = dd.Count();
+   EXPECT_EQ(100ull, *count);
+   report = ROOT::RDF::Experimental::GetProfileReport(df);
+   EXPECT_EQ(100ull, getCalls(report, "Action", "Count"));
+   EXPECT_EQ(0ull, getCalls(report, "Action", "Sum"));
+   EXPECT_EQ(100ull, getCalls(report, "Filter", "multipleOf4"));
+   EXPECT_EQ(100ull, getCalls(report, "Define", "x"));
+}
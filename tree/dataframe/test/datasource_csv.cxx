@@ -6,6 +6,9 @@
 
 #include <gtest/gtest.h>
 
+#include <cstdio>
+#include <fstream>
+
 using namespace ROOT::RDF;
 
 auto fileName0 = "RCsvDS_test_headers.csv";
@@ -249,6 +252,27 @@ TEST(RCsvDS, WindowsLinebreaks)
    EXPECT_EQ(6U, *tdf.Count());
 }
 
+TEST(RCsvDS, WrongNumberOfFields)
+{
+   const auto fileName = "RCsvDS_test_wrongnfields.csv";
+   {
+      std::ofstream f(fileName);
+      f << "a,b\n1,2\n3\n";
+   }
+   RCsvDS tds(fileName);
+   tds.SetNSlots(1);
+   tds.Initialize();
+   EXPECT_THROW(
+      try {
+         tds.GetEntryRanges();
+      } catch (const std::runtime_error &err) {
+         EXPECT_STREQ("The CSV record of entry 1 has 1 fields, but the CSV file has 2 columns.", err.what());
+         throw;
+      },
+      std::runtime_error);
+   std::remove(fileName);
+}
+
 TEST(RCsvDS, Remote)
 {
 #ifdef R__HAS_DAVIX
@@ -422,4 +446,52 @@ TEST(RCsvDS, NanWarningChecks)
    EXPECT_EQ(d->AsString(), AsString);
 }
 
+TEST(RCsvDS, QuotedEmptyStrings)
+{
+   ROOT::DisableImplicitMT(); // to keep the order of the values
+
+   auto rdf = ROOT::RDF::FromCSV(fileName4);
+   auto col7 = rdf.Take<std::string>("col7");
+   ASSERT_EQ(13u, col7->size());
+   EXPECT_EQ("hello", col7->at(0));
+   // quoted empty fields are empty strings
+   EXPECT_EQ("", col7->at(1));
+   EXPECT_EQ("", col7->at(3));
+   // unquoted empty fields are missing values
+   EXPECT_EQ("nan", col7->at(11));
+}
+
+TEST(RCsvDS, ParallelParsingMT)
+{
+   ROOT::EnableImplicitMT(4);
+
+   // large enough to be parsed by several tasks
+   const auto fileName = "RCsvDS_test_parallel.csv";
+   const auto nLines = 100000LL;
+   {
+      std::ofstream f(fileName);
+      f << "i,x,flag,name\r\n";
+      for (auto i : ROOT::TSeqL(nLines)) {
+         if (i % 1000 == 0)
+            f << "\r\n"; // empty lines are skipped
+         f << i << ',' << i * 0.5 << ',' << (i % 2 ? "true" : "false") << ",\"n," << i << "\"\r\n";
+      }
+   }
+
+   for (auto chunkSize : {-1LL, 30000LL}) {
+      auto df = ROOT::RDF::FromCSV(fileName, true, ',', chunkSize);
+      auto sumI = df.Sum<Long64_t>("i");
+      auto sumX = df.Sum<double>("x");
+      auto nTrue = df.Filter([](bool flag) { return flag; }, {"flag"}).Count();
+      auto nGoodNames =
+         df.Filter([](Long64_t i, const std::string &name) { return name == "n," + std::to_string(i); }, {"i", "name"})
+            .Count();
+      EXPECT_EQ(nLines * (nLines - 1) / 2, *sumI);
+      EXPECT_DOUBLE_EQ(0.5 * nLines * (nLines - 1) / 2, *sumX);
+      EXPECT_EQ(nLines / 2, *nTrue);
+      EXPECT_EQ(nLines, *nGoodNames);
+   }
+   std::remove(fileName);
+}
+
 #endif // R__USE_IMT
@@ -1,4 +1,5 @@
 #include <ROOT/RDataFrame.hxx>
+#include <ROOT/RDFHelpers.hxx>
 #include <ROOT/RNTupleDS.hxx>
 #include <ROOT/RVec.hxx>
 
@@ -7,10 +8,15 @@
 #include <ROOT/RPageStorage.hxx>
 
 #include <NTupleStruct.hxx>
+#include <TSystem.h>
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <sstream>
+
 using ROOT::Experimental::RNTupleDS;
+using ROOT::Experimental::RNTupleReader;
 using ROOT::Experimental::RNTupleWriter;
 using ROOT::Experimental::RNTupleModel;
 using ROOT::Experimental::Detail::RPageSource;
@@ -160,3 +166,442 @@ TEST_F(RNTupleDSTest, ReadMT)
    ReadTest(fNtplName, fFileName);
 }
 #endif
+
+TEST(RNTupleDS, ReadManyClusters)
+{
+   // Exercise reading the values in bulks that end at cluster boundaries and at the maximum bulk size
+   std::string fileName = "RNTupleDS_test_manyclusters.root";
+   {
+      auto model = RNTupleModel::Create();
+      auto fldPt = model->MakeField<float>("pt");
+      auto fldJets = model->MakeField<std::vector<float>>("jets");
+      auto fldTag = model->MakeField<std::string>("tag");
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntuple", fileName);
+      for (int i = 0; i < 5000; ++i) {
+         *fldPt = i;
+         fldJets->assign(i % 3, float(i));
+         *fldTag = std::to_string(i);
+         ntuple->Fill();
+         if (i % 1500 == 1499)
+            ntuple->CommitCluster();
+      }
+   }
+
+   auto df = ROOT::RDF::Experimental::FromRNTuple("ntuple", fileName);
+   auto sumPt = df.Sum<float>("pt");
+   auto sumJets = df.Sum<ROOT::RVec<float>>("jets");
+   auto sumNJets = df.Sum<std::size_t>("R_rdf_sizeof_jets");
+   // Only every seventh entry reads the tag column
+   auto nTagMatch = df.Filter([](float pt) { return static_cast<int>(pt) % 7 == 0; }, {"pt"})
+                       .Filter([](float pt, const std::string &tag) { return std::to_string(int(pt)) == tag; },
+                               {"pt", "tag"})
+                       .Count();
+
+   double expectedSumPt = 0;
+   double expectedSumJets = 0;
+   std::size_t expectedSumNJets = 0;
+   for (int i = 0; i < 5000; ++i) {
+      expectedSumPt += i;
+      expectedSumJets += (i % 3) * float(i);
+      expectedSumNJets += i % 3;
+   }
+   EXPECT_DOUBLE_EQ(expectedSumPt, sumPt.GetValue());
+   EXPECT_DOUBLE_EQ(expectedSumJets, sumJets.GetValue());
+   EXPECT_EQ(expectedSumNJets, sumNJets.GetValue());
+   EXPECT_EQ(715u, nTagMatch.GetValue());
+
+   // The same in bulk processing mode, with bulks that do not align with the clusters
+   ROOT::RDF::Experimental::SetBulkSize(df, 1000);
+   auto sumPtBulk = df.Sum<float>("pt");
+   auto sumJetsBulk = df.Sum<ROOT::RVec<float>>("jets");
+   auto sumNJetsBulk = df.Sum<std::size_t>("R_rdf_sizeof_jets");
+   auto nTagMatchBulk = df.Filter([](float pt) { return static_cast<int>(pt) % 7 == 0; }, {"pt"})
+                           .Filter([](float pt, const std::string &tag) { return std::to_string(int(pt)) == tag; },
+                                   {"pt", "tag"})
+                           .Count();
+   EXPECT_DOUBLE_EQ(expectedSumPt, sumPtBulk.GetValue());
+   EXPECT_DOUBLE_EQ(expectedSumJets, sumJetsBulk.GetValue());
+   EXPECT_EQ(expectedSumNJets, sumNJetsBulk.GetValue());
+   EXPECT_EQ(715u, nTagMatchBulk.GetValue());
+
+   std::remove(fileName.c_str());
+}
+
+TEST(RNTupleDS, PushdownFilter)
+{
+   std::string fileName = "RNTupleDS_test_pushdown.root";
+   {
+      auto model = RNTupleModel::Create();
+      auto fldPt = model->MakeField<float>("pt");
+      auto fldId = model->MakeField<std::int32_t>("id");
+      auto fldJets = model->MakeField<std::vector<float>>("jets");
+      ROOT::Experimental::RNTupleWriteOptions options;
+      options.SetApproxUnzippedPageSize(64);
+      options.SetHasPageStatistics(true);
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntuple", fileName, options);
+      for (int i = 0; i < 1000; ++i) {
+         *fldPt = i;
+         *fldId = i % 10;
+         fldJets->assign(i % 3, float(i));
+         ntuple->Fill();
+         if (i % 100 == 99)
+            ntuple->CommitCluster();
+      }
+   }
+
+   {
+      RNTupleDS ds(RPageSource::Create("ntuple", fileName));
+      EXPECT_THROW(ds.AddPushdownFilter("pt"), std::runtime_error);
+      EXPECT_THROW(ds.AddPushdownFilter("pt = 1"), std::runtime_error);
+      EXPECT_THROW(ds.AddPushdownFilter("pt > x"), std::runtime_error);
+      EXPECT_THROW(ds.AddPushdownFilter("eta > 1"), std::runtime_error);
+      EXPECT_THROW(ds.AddPushdownFilter("jets > 1"), std::runtime_error);
+      EXPECT_THROW(ds.AddPushdownFilter("R_rdf_sizeof_jets > 1"), std::runtime_error);
+
+      ds.AddPushdownFilter(" pt >= 250 ");
+      ds.AddPushdownFilter("pt<420");
+      ds.SetNSlots(1);
+      ds.Initialize();
+      // Only the pages that overlap with [250, 420) are processed
+      auto ranges = ds.GetEntryRanges();
+      ASSERT_FALSE(ranges.empty());
+      EXPECT_LE(200u, ranges.front().first);
+      EXPECT_GE(250u, ranges.front().first);
+      EXPECT_LT(420u, ranges.back().second);
+      EXPECT_GE(500u, ranges.back().second);
+      for (const auto &r : ranges) {
+         EXPECT_LT(r.first, r.second);
+         EXPECT_EQ(r.first / 100, (r.second - 1) / 100);
+      }
+      EXPECT_TRUE(ds.GetEntryRanges().empty());
+      ds.Finalize();
+   }
+
+   {
+      RNTupleDS ds(RPageSource::Create("ntuple", fileName));
+      ds.AddPushdownFilter("pt < 0");
+      ds.SetNSlots(1);
+      ds.Initialize();
+      EXPECT_TRUE(ds.GetEntryRanges().empty());
+      ds.Finalize();
+   }
+
+   auto df = ROOT::RDF::Experimental::FromRNTuple("ntuple", fileName, {"pt >= 250", "pt < 420"});
+   auto count = df.Count();
+   auto sumPt = df.Sum<float>("pt");
+   auto sumJets = df.Sum<ROOT::RVec<float>>("jets");
+   auto nId = ROOT::RDF::Experimental::FromRNTuple("ntuple", fileName, {"id == 3"}).Count();
+   auto nNotId = ROOT::RDF::Experimental::FromRNTuple("ntuple", fileName, {"id != 3", "pt <= 99"}).Count();
+
+   double expectedSumPt = 0;
+   double expectedSumJets = 0;
+   for (int i = 250; i < 420; ++i) {
+      expectedSumPt += i;
+      expectedSumJets += (i % 3) * float(i);
+   }
+   EXPECT_EQ(170u, count.GetValue());
+   EXPECT_DOUBLE_EQ(expectedSumPt, sumPt.GetValue());
+   EXPECT_DOUBLE_EQ(expectedSumJets, sumJets.GetValue());
+   EXPECT_EQ(100u, nId.GetValue());
+   EXPECT_EQ(90u, nNotId.GetValue());
+
+   std::remove(fileName.c_str());
+}
+
+TEST(RNTupleDS, Chain)
+{
+   std::vector<std::string> fileNames;
+   for (int f = 0; f < 3; ++f) {
+      fileNames.emplace_back("RNTupleDS_test_chain" + std::to_string(f) + ".root");
+      auto model = RNTupleModel::Create();
+      auto fldPt = model->MakeField<float>("pt");
+      auto fldJets = model->MakeField<std::vector<float>>("jets");
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntuple", fileNames.back());
+      // The second file is empty
+      const int nEntries = (f == 1) ? 0 : 1000 * (f + 1);
+      for (int i = 0; i < nEntries; ++i) {
+         *fldPt = i;
+         fldJets->assign(i % 3, float(i));
+         ntuple->Fill();
+         if (i % 100 == 99)
+            ntuple->CommitCluster();
+      }
+   }
+
+   {
+      RNTupleDS ds("ntuple", fileNames);
+      ds.SetNSlots(2);
+      ds.Initialize();
+      // The ranges of all the files are handed out at once and do not span more than one file
+      auto ranges = ds.GetEntryRanges();
+      ASSERT_FALSE(ranges.empty());
+      EXPECT_EQ(0u, ranges.front().first);
+      EXPECT_EQ(4000u, ranges.back().second);
+      for (std::size_t i = 0; i < ranges.size(); ++i) {
+         EXPECT_EQ(0u, ranges[i].first % 100);
+         EXPECT_EQ(0u, ranges[i].second % 100);
+         EXPECT_FALSE(ranges[i].first < 1000u && ranges[i].second > 1000u);
+         if (i > 0) {
+            EXPECT_EQ(ranges[i - 1].second, ranges[i].first);
+         }
+      }
+      EXPECT_LT(2u, ranges.size());
+      EXPECT_TRUE(ds.GetEntryRanges().empty());
+      ds.Finalize();
+   }
+
+   EXPECT_THROW(RNTupleDS("ntuple", std::vector<std::string>()), std::runtime_error);
+
+   const std::string otherSchemaFileName = "RNTupleDS_test_chain_other_schema.root";
+   {
+      auto model = RNTupleModel::Create();
+      *model->MakeField<double>("pt") = 1.0;
+      model->MakeField<std::vector<float>>("jets");
+      RNTupleWriter::Recreate(std::move(model), "ntuple", otherSchemaFileName)->Fill();
+   }
+   {
+      RNTupleDS ds("ntuple", {fileNames[0], otherSchemaFileName});
+      ds.SetNSlots(1);
+      ds.Initialize();
+      EXPECT_THROW(ds.GetEntryRanges(), std::runtime_error);
+   }
+   std::remove(otherSchemaFileName.c_str());
+
+   double expectedSumPt = 0;
+   double expectedSumJets = 0;
+   for (int f : {0, 2}) {
+      for (int i = 0; i < 1000 * (f + 1); ++i) {
+         expectedSumPt += i;
+         expectedSumJets += (i % 3) * float(i);
+      }
+   }
+
+   auto df = ROOT::RDF::Experimental::FromRNTuple("ntuple", fileNames);
+   auto count = df.Count();
+   auto sumPt = df.Sum<float>("pt");
+   auto sumJets = df.Sum<ROOT::RVec<float>>("jets");
+   auto dsPushdown = std::make_unique<RNTupleDS>("ntuple", std::vector<std::string>{fileNames[2], fileNames[0]});
+   dsPushdown->AddPushdownFilter("pt >= 1500");
+   auto nPushdown = ROOT::RDataFrame(std::move(dsPushdown)).Count();
+   EXPECT_EQ(4000u, count.GetValue());
+   EXPECT_DOUBLE_EQ(expectedSumPt, sumPt.GetValue());
+   EXPECT_DOUBLE_EQ(expectedSumJets, sumJets.GetValue());
+   EXPECT_EQ(1500u, nPushdown.GetValue());
+
+#ifdef R__USE_IMT
+   {
+      IMTRAII _;
+      auto dfMT = ROOT::RDF::Experimental::FromRNTuple("ntuple", fileNames);
+      auto countMT = dfMT.Count();
+      auto sumPtMT = dfMT.Sum<float>("pt");
+      EXPECT_EQ(4000u, countMT.GetValue());
+      EXPECT_DOUBLE_EQ(expectedSumPt, sumPtMT.GetValue());
+   }
+#endif
+
+   for (const auto &f : fileNames)
+      std::remove(f.c_str());
+}
+
+TEST(RNTupleDS, SnapshotRNTuple)
+{
+   const std::string inFileName = "RNTupleDS_test_snapshot_in.root";
+   const std::string outFileName = "RNTupleDS_test_snapshot_out.root";
+   {
+      auto model = RNTupleModel::Create();
+      auto fldPt = model->MakeField<float>("pt");
+      auto fldJets = model->MakeField<std::vector<float>>("jets");
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntuple", inFileName);
+      for (int i = 0; i < 100; ++i) {
+         *fldPt = i;
+         fldJets->assign(i % 3, float(i));
+         ntuple->Fill();
+      }
+   }
+
+   ROOT::RDF::RSnapshotOptions options;
+   options.fOutputFormat = ROOT::RDF::ESnapshotOutputFormat::kRNTuple;
+
+   // Defined columns are written through a model and an RNTupleParallelWriter
+   auto df = ROOT::RDataFrame(10).Define("x", [](ULong64_t e) { return float(e); }, {"rdfentry_"});
+   auto snapshot = df.Snapshot<float>("ntuple", outFileName, {"x"}, options);
+   EXPECT_EQ(10u, snapshot->Count().GetValue());
+   EXPECT_FLOAT_EQ(45.f, snapshot->Sum<float>("x").GetValue());
+   EXPECT_EQ(10u, RNTupleReader::Open("ntuple", outFileName)->GetNEntries());
+
+   // Returns the compression and the on-disk sizes of the pages of the given field
+   auto fnGetPages = [](const std::string &fileName, const std::string &fieldName) {
+      auto reader = RNTupleReader::Open("ntuple", fileName);
+      auto desc = reader->GetDescriptor();
+      const auto columnId = desc->FindPhysicalColumnId(desc->FindFieldId(fieldName), 0);
+      std::uint32_t compression = 0;
+      std::vector<std::uint32_t> pageSizes;
+      for (const auto &c : desc->GetClusterIterable()) {
+         compression = c.GetColumnRange(columnId).fCompressionSettings;
+         for (const auto &pi : c.GetPageRange(columnId).fPageInfos)
+            pageSizes.emplace_back(pi.fLocator.fBytesOnStorage);
+      }
+      return std::make_pair(compression, pageSizes);
+   };
+   // Without compression settings in the snapshot options, the RNTuple default compression is used
+   EXPECT_EQ(ROOT::Experimental::RNTupleWriteOptions().GetCompression(), fnGetPages(outFileName, "x").first);
+
+   // The returned data frame opens the output file only once it is used
+   const std::string lazyFileName = "RNTupleDS_test_snapshot_lazy.root";
+   auto lazyOptions = options;
+   lazyOptions.fLazy = true;
+   auto lazySnapshot = df.Snapshot<float>("ntuple", lazyFileName, {"x"}, lazyOptions);
+   EXPECT_TRUE(gSystem->AccessPathName(lazyFileName.c_str()));
+   EXPECT_EQ(10u, lazySnapshot->Count().GetValue());
+   std::remove(lazyFileName.c_str());
+
+   // Unchanged columns of an RNTuple data source are copied page by page, without an event loop
+   auto dsIn = std::make_unique<RNTupleDS>(RPageSource::Create("ntuple", inFileName));
+   auto dsInPtr = dsIn.get();
+   dsInPtr->EnableMetrics();
+   ROOT::RDataFrame dfIn(std::move(dsIn));
+   auto copy = dfIn.Snapshot<float, ROOT::RVec<float>>("ntuple", outFileName, {"pt", "jets"}, options);
+   EXPECT_EQ(1u, dfIn.GetNRuns());
+   EXPECT_TRUE(dsInPtr->GetReadReports().empty());
+   EXPECT_EQ(100u, copy->Count().GetValue());
+   EXPECT_FLOAT_EQ(4950.f, copy->Sum<float>("pt").GetValue());
+   EXPECT_EQ(dfIn.Sum<ROOT::RVec<float>>("jets").GetValue(), copy->Sum<ROOT::RVec<float>>("jets").GetValue());
+   // The copy keeps the compression of the input, so the sealed pages are copied verbatim instead of being recompressed
+   EXPECT_EQ(fnGetPages(inFileName, "pt"), fnGetPages(outFileName, "pt"));
+
+   // Explicit compression settings are applied to the copied pages
+   auto zlibOptions = options;
+   zlibOptions.fCompressionAlgorithm = ROOT::kZLIB;
+   zlibOptions.fCompressionLevel = 9;
+   auto copyZlib = dfIn.Snapshot<float>("ntuple", outFileName, {"pt"}, zlibOptions);
+   EXPECT_FLOAT_EQ(4950.f, copyZlib->Sum<float>("pt").GetValue());
+   EXPECT_EQ(109u, fnGetPages(outFileName, "pt").first);
+
+   // Filtered input goes through the typed writer
+   auto filtered =
+      dfIn.Filter([](float pt) { return pt < 10; }, {"pt"}).Snapshot("ntuple", outFileName, {"pt"}, options);
+   EXPECT_EQ(10u, filtered->Count().GetValue());
+   EXPECT_FLOAT_EQ(45.f, filtered->Sum<float>("pt").GetValue());
+
+   EXPECT_THROW(df.Snapshot<float>("dir/ntuple", outFileName, {"x"}, options), std::runtime_error);
+
+   std::remove(inFileName.c_str());
+   std::remove(outFileName.c_str());
+}
+
+TEST(RNTupleDS, Metrics)
+{
+   std::vector<std::string> fileNames;
+   for (int f = 0; f < 2; ++f) {
+      fileNames.emplace_back("RNTupleDS_test_metrics" + std::to_string(f) + ".root");
+      auto model = RNTupleModel::Create();
+      auto fldPt = model->MakeField<float>("pt");
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntuple", fileNames.back());
+      for (int i = 0; i < 100; ++i) {
+         *fldPt = i;
+         ntuple->Fill();
+      }
+   }
+
+   auto ds = std::make_unique<RNTupleDS>("ntuple", fileNames);
+   auto dsPtr = ds.get();
+   dsPtr->EnableMetrics();
+   ROOT::RDataFrame df(std::move(ds));
+   EXPECT_FLOAT_EQ(2 * 4950.f, df.Sum<float>("pt").GetValue());
+
+   // One report per file, the first one of which is still open
+   const auto reports = dsPtr->GetReadReports();
+   ASSERT_EQ(2u, reports.size());
+   std::vector<std::string> locations;
+   for (const auto &r : reports) {
+      locations.emplace_back(r.fLocation);
+      EXPECT_EQ("ntuple", r.fNTupleName);
+      ASSERT_EQ(1u, r.fColumns.size());
+      EXPECT_EQ("pt", r.fColumns[0].fFieldName);
+      EXPECT_EQ(1u, r.fColumns[0].fStats.fNPages);
+      EXPECT_FALSE(r.fCounters.empty());
+   }
+   std::sort(locations.begin(), locations.end());
+   EXPECT_EQ(fileNames, locations);
+
+   std::ostringstream os;
+   dsPtr->PrintMetrics(os, ROOT::Experimental::Detail::RNTupleReadReport::EFormat::kJSON);
+   EXPECT_EQ('[', os.str()[0]);
+   EXPECT_NE(std::string::npos, os.str().find("\"location\": \"" + fileNames[1] + "\""));
+
+   for (const auto &f : fileNames)
+      std::remove(f.c_str());
+}
+
+TEST(RNTupleDS, LazyColumns)
+{
+   std::string fileName = "RNTupleDS_test_lazycolumns.root";
+   {
+      auto model = RNTupleModel::Create();
+      auto fldPt = model->MakeField<float>("pt");
+      auto fldEnergy = model->MakeField<float>("energy");
+      ROOT::Experimental::RNTupleWriteOptions options;
+      options.SetApproxUnzippedPageSize(64);
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntuple", fileName, options);
+      for (int i = 0; i < 2000; ++i) {
+         *fldPt = i;
+         *fldEnergy = 2 * i;
+         ntuple->Fill();
+         if (i % 500 == 499)
+            ntuple->CommitCluster();
+      }
+   }
+
+   // The number of pages of the energy column that hold the selected entries 1000 to 1009
+   std::uint64_t nPagesSelected = 0;
+   {
+      auto reader = RNTupleReader::Open("ntuple", fileName);
+      auto desc = reader->GetDescriptor();
+      const auto columnId = desc->FindPhysicalColumnId(desc->FindFieldId("energy"), 0);
+      const auto &clusterDesc = desc->GetClusterDescriptor(desc->FindClusterId(columnId, 1000));
+      const auto firstIndex = 1000 - clusterDesc.GetFirstEntryIndex();
+      std::uint64_t pageBegin = 0;
+      for (const auto &pi : clusterDesc.GetPageRange(columnId).fPageInfos) {
+         const auto pageEnd = pageBegin + pi.fNElements;
+         if (pageEnd > firstIndex && pageBegin < firstIndex + 10)
+            nPagesSelected++;
+         pageBegin = pageEnd;
+      }
+   }
+   EXPECT_LE(1u, nPagesSelected);
+
+   // Lazy columns are opt-in; by default, all the columns are preloaded with the clusters
+   for (bool isLazy : {false, true}) {
+      auto ds = std::make_unique<RNTupleDS>(RPageSource::Create("ntuple", fileName));
+      auto dsPtr = ds.get();
+      dsPtr->EnableMetrics();
+      if (isLazy)
+         dsPtr->EnableLazyColumns();
+      ROOT::RDataFrame df(std::move(ds));
+      auto sumEnergy = df.Filter([](float pt) { return pt >= 1000 && pt < 1010; }, {"pt"}).Sum<float>("energy");
+      EXPECT_FLOAT_EQ(2 * 10045.f, sumEnergy.GetValue());
+
+      // All the pages of the filter column are read but, if lazy, only the pages of the selected entries of the
+      // other column.  Lazy bulks end at page boundaries, so no other page of the energy column is read.
+      const auto reports = dsPtr->GetReadReports();
+      ASSERT_EQ(1u, reports.size());
+      std::uint64_t nPagesPt = 0;
+      for (const auto &c : reports[0].fColumns) {
+         if (c.fFieldName == "pt")
+            nPagesPt = c.fStats.fNPages;
+      }
+      EXPECT_LT(100u, nPagesPt);
+      double nPagesLoaded = 0;
+      for (const auto &c : reports[0].fCounters) {
+         if (c.fName.size() >= 11 && c.fName.compare(c.fName.size() - 11, 11, "nPageLoaded") == 0)
+            nPagesLoaded = c.fValue;
+      }
+      if (isLazy) {
+         EXPECT_EQ(nPagesPt + nPagesSelected, nPagesLoaded);
+      } else {
+         EXPECT_LE(2 * nPagesPt, nPagesLoaded);
+      }
+   }
+
+   std::remove(fileName.c_str());
+}
@@ -105,6 +105,7 @@ public:
    {
       auto column = std::unique_ptr<RColumn>(new RColumn(model, index));
       column->fElement = RColumnElementBase::Generate<CppT>(model.GetType());
+      column->fElement->ApplyColumnModel(model);
       return column;
    }
 
@@ -318,6 +319,10 @@ public:
    }
 
    void Flush();
+   std::uint32_t GetApproxNElementsPerPage() const { return fApproxNElementsPerPage; }
+   /// Changes the target number of elements of the write pages.  Must only be called when the write pages are empty,
+   /// i.e. after Flush().  Used to adapt the page size to the compressibility of the column.
+   void SetApproxNElementsPerPage(std::uint32_t nElements);
    void MapPage(const NTupleSize_t index);
    void MapPage(const RClusterIndex &clusterIndex);
    NTupleSize_t GetNElements() const { return fNElements; }
@@ -24,8 +24,10 @@
 #include <Byteswap.h>
 #include <TError.h>
 
+#include <cmath>
 #include <cstring> // for memcpy
 #include <cstdint>
+#include <limits>
 #include <memory>
 #include <string>
 #include <type_traits>
@@ -40,6 +42,52 @@
 #endif
 #endif /* R__LITTLE_ENDIAN */
 
+namespace ROOT {
+namespace Experimental {
+namespace Internal {
+
+/// The instruction set used by the vectorized packing and unpacking kernels below.  On first use, the highest level
+/// supported by the CPU is selected.
+enum class EColumnElementSIMDLevel {
+   kScalar,
+   kSSE41,
+   kAVX2,
+   /// AVX-512F and AVX-512BW
+   kAVX512
+};
+
+EColumnElementSIMDLevel GetColumnElementSIMDLevel();
+/// The highest level supported by the CPU (and by the compiler that built ROOT)
+EColumnElementSIMDLevel GetMaxColumnElementSIMDLevel();
+/// Selects the kernels of the given level, or of the maximum supported level if the given one is not supported.
+/// Mostly useful for testing and benchmarking.
+void SetColumnElementSIMDLevel(EColumnElementSIMDLevel level);
+
+/// Rearranges `count` elements of `elementSize` (2, 4, or 8) bytes each such that the first bytes of all the elements
+/// are stored first, followed by all the second bytes, etc.  The elements are not byte-swapped.
+void SplitBytes(void *destination, const void *source, std::size_t count, std::size_t elementSize);
+/// Reverses SplitBytes()
+void UnsplitBytes(void *destination, const void *source, std::size_t count, std::size_t elementSize);
+/// Packs `count` bools into (count + 7) / 8 bytes, the first bool into the least significant bit of the first byte
+void PackBits(void *destination, const bool *source, std::size_t count);
+/// Reverses PackBits()
+void UnpackBits(bool *destination, const void *source, std::size_t count);
+/// Keeps the 16 most significant bits, i.e. the sign, the exponent, and 7 bits of the mantissa, of `count` floats
+/// This is the Real16 conversion of `Real32Trunc` columns with 16 bits on storage; `EColumnType::kReal16` itself has
+/// no column element yet and is only known to the serialization.
+void TruncateFloatsTo16Bits(std::uint16_t *destination, const float *source, std::size_t count);
+/// Reverses TruncateFloatsTo16Bits(); the dropped mantissa bits are set to zero
+void ExpandFloatsFrom16Bits(float *destination, const std::uint16_t *source, std::size_t count);
+/// Writes `count` values of `width` bits each (0 < width <= 64) as the bit stream of (count * width + 7) / 8 bytes
+/// that WriteBitStream() produces.  The values must not have bits set beyond `width`.
+void PackBitStream(void *destination, const std::uint64_t *source, std::size_t count, std::size_t width);
+/// Reverses PackBitStream()
+void UnpackBitStream(std::uint64_t *destination, const void *source, std::size_t count, std::size_t width);
+
+} // namespace Internal
+} // namespace Experimental
+} // namespace ROOT
+
 namespace {
 
 // In this namespace, common routines are defined for element packing and unpacking of ints and floats.
@@ -50,18 +98,29 @@ namespace {
 //                For instance, for Double32_t, an in-memory double value is stored as a float on disk.
 //   - Split:     rearranges the bytes of an array of elements such that all the first bytes are stored first,
 //                followed by all the second bytes, etc. This often clusters similar values, e.g. all the zero bytes
-//                for arrays of small integers.
+//                for arrays of small integers.  On little-endian machines, the splitting is done by the vectorized
+//                Internal::SplitBytes() and Internal::UnsplitBytes() kernels, after the other encodings.
 //   - Delta:     Delta encoding stores on disk the delta to the previous element.  This is useful for offsets,
 //                because it transforms potentially large offset values into small deltas, which are then better
 //                suited for split encoding.
 //   - Zigzag:    Zigzag encoding is used on signed integers only. It maps x to 2x if x is positive and to -(2x+1) if
 //                x is negative. For series of positive and negative values of small absolute value, it will produce
 //                a bit pattern that is favorable for split encoding.
+//   - BitPack:   stores every element of a page with the minimal number of bits required for the largest element
+//                of that page.  The bit width is stored in the first byte of the page, followed by the bit stream of
+//                the elements.  The on-disk element reserves one bit more than the width of the type, such that the
+//                bit width byte always fits; the unused tail of the page is zero and vanishes under compression.
+//   - Truncate:  lossy float encoding that keeps only the sign, the exponent, and the most significant mantissa bits
+//                of 32bit floats.  The remaining bits are bit-packed.
+//   - Quantize:  lossy float encoding that maps the values of a given range linearly onto n-bit integers, which are
+//                bit-packed.
 //
 // Encodings/conversions can be fused:
 //
 //  - Delta/Zigzag + Splitting (there is no only-delta/zigzag encoding)
 //  - (Delta/Zigzag + ) Splitting + Casting
+//  - Delta + (Zigzag + ) BitPack + Casting
+//  - Casting + Truncate/Quantize + BitPack
 //  - Everything + Byteswap
 
 /// \brief Copy and byteswap `count` elements of size `N` from `source` to `destination`.
@@ -125,6 +184,10 @@ static void CastUnpack(void *destination, const void *source, std::size_t count)
    }
 }
 
+/// Whether the byte splitting of elements of type T can use the vectorized kernels, which do not byte-swap
+template <typename T>
+constexpr bool kHasSplitKernel = (R__LITTLE_ENDIAN == 1) && (sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8);
+
 /// \brief Split encoding of elements, possibly into narrower column
 ///
 /// Used to first cast and then split-encode in-memory values to the on-disk column. Swap bytes if necessary.
@@ -132,8 +195,20 @@ template <typename DestT, typename SourceT>
 static void CastSplitPack(void *destination, const void *source, std::size_t count)
 {
    constexpr std::size_t N = sizeof(DestT);
-   auto splitArray = reinterpret_cast<char *>(destination);
    auto src = reinterpret_cast<const SourceT *>(source);
+   if constexpr (kHasSplitKernel<DestT>) {
+      if constexpr (std::is_same_v<DestT, SourceT>) {
+         ROOT::Experimental::Internal::SplitBytes(destination, source, count, N);
+      } else {
+         std::unique_ptr<DestT[]> narrowed(new DestT[count]);
+         for (std::size_t i = 0; i < count; ++i)
+            narrowed[i] = src[i];
+         ROOT::Experimental::Internal::SplitBytes(destination, narrowed.get(), count, N);
+      }
+      return;
+   }
+
+   auto splitArray = reinterpret_cast<char *>(destination);
    for (std::size_t i = 0; i < count; ++i) {
       DestT val = src[i];
       ByteSwapIfNecessary(val);
@@ -151,6 +226,18 @@ static void CastSplitUnpack(void *destination, const void *source, std::size_t c
 {
    constexpr std::size_t N = sizeof(SourceT);
    auto dst = reinterpret_cast<DestT *>(destination);
+   if constexpr (kHasSplitKernel<SourceT>) {
+      if constexpr (std::is_same_v<DestT, SourceT>) {
+         ROOT::Experimental::Internal::UnsplitBytes(destination, source, count, N);
+      } else {
+         std::unique_ptr<SourceT[]> narrow(new SourceT[count]);
+         ROOT::Experimental::Internal::UnsplitBytes(narrow.get(), source, count, N);
+         for (std::size_t i = 0; i < count; ++i)
+            dst[i] = narrow[i];
+      }
+      return;
+   }
+
    auto splitArray = reinterpret_cast<const char *>(source);
    for (std::size_t i = 0; i < count; ++i) {
       SourceT val = 0;
@@ -170,6 +257,14 @@ static void CastDeltaSplitPack(void *destination, const void *source, std::size_
 {
    constexpr std::size_t N = sizeof(DestT);
    auto src = reinterpret_cast<const SourceT *>(source);
+   if constexpr (kHasSplitKernel<DestT>) {
+      std::unique_ptr<DestT[]> deltas(new DestT[count]);
+      for (std::size_t i = 0; i < count; ++i)
+         deltas[i] = (i == 0) ? src[0] : src[i] - src[i - 1];
+      ROOT::Experimental::Internal::SplitBytes(destination, deltas.get(), count, N);
+      return;
+   }
+
    auto splitArray = reinterpret_cast<char *>(destination);
    for (std::size_t i = 0; i < count; ++i) {
       DestT val = (i == 0) ? src[0] : src[i] - src[i - 1];
@@ -187,8 +282,16 @@ template <typename DestT, typename SourceT>
 static void CastDeltaSplitUnpack(void *destination, const void *source, std::size_t count)
 {
    constexpr std::size_t N = sizeof(SourceT);
-   auto splitArray = reinterpret_cast<const char *>(source);
    auto dst = reinterpret_cast<DestT *>(destination);
+   if constexpr (kHasSplitKernel<SourceT>) {
+      std::unique_ptr<SourceT[]> deltas(new SourceT[count]);
+      ROOT::Experimental::Internal::UnsplitBytes(deltas.get(), source, count, N);
+      for (std::size_t i = 0; i < count; ++i)
+         dst[i] = (i == 0) ? deltas[0] : dst[i - 1] + deltas[i];
+      return;
+   }
+
+   auto splitArray = reinterpret_cast<const char *>(source);
    for (std::size_t i = 0; i < count; ++i) {
       SourceT val = 0;
       for (std::size_t b = 0; b < N; ++b) {
@@ -209,6 +312,14 @@ static void CastZigzagSplitPack(void *destination, const void *source, std::size
    constexpr std::size_t kNBitsDestT = sizeof(DestT) * 8;
    constexpr std::size_t N = sizeof(DestT);
    auto src = reinterpret_cast<const SourceT *>(source);
+   if constexpr (kHasSplitKernel<DestT>) {
+      std::unique_ptr<UDestT[]> encoded(new UDestT[count]);
+      for (std::size_t i = 0; i < count; ++i)
+         encoded[i] = (static_cast<DestT>(src[i]) << 1) ^ (static_cast<DestT>(src[i]) >> (kNBitsDestT - 1));
+      ROOT::Experimental::Internal::SplitBytes(destination, encoded.get(), count, N);
+      return;
+   }
+
    auto splitArray = reinterpret_cast<char *>(destination);
    for (std::size_t i = 0; i < count; ++i) {
       UDestT val = (static_cast<DestT>(src[i]) << 1) ^ (static_cast<DestT>(src[i]) >> (kNBitsDestT - 1));
@@ -227,8 +338,18 @@ static void CastZigzagSplitUnpack(void *destination, const void *source, std::si
 {
    using USourceT = std::make_unsigned_t<SourceT>;
    constexpr std::size_t N = sizeof(SourceT);
-   auto splitArray = reinterpret_cast<const char *>(source);
    auto dst = reinterpret_cast<DestT *>(destination);
+   if constexpr (kHasSplitKernel<SourceT>) {
+      std::unique_ptr<USourceT[]> encoded(new USourceT[count]);
+      ROOT::Experimental::Internal::UnsplitBytes(encoded.get(), source, count, N);
+      for (std::size_t i = 0; i < count; ++i) {
+         const USourceT val = encoded[i];
+         dst[i] = static_cast<SourceT>((val >> 1) ^ -(static_cast<SourceT>(val) & 1));
+      }
+      return;
+   }
+
+   auto splitArray = reinterpret_cast<const char *>(source);
    for (std::size_t i = 0; i < count; ++i) {
       USourceT val = 0;
       for (std::size_t b = 0; b < N; ++b) {
@@ -239,6 +360,256 @@ static void CastZigzagSplitUnpack(void *destination, const void *source, std::si
    }
 }
 
+/// \brief Write `count` values of `width` bits each (0 < width <= 64) as a bit stream of (count * width + 7) / 8 bytes
+///
+/// The values are provided by `fnValue(i)` and must not have bits set beyond `width`.  The bit stream is written
+/// byte by byte, least significant bits first, and is thus endianess independent.
+template <typename FnValueT>
+static void WriteBitStream(unsigned char *dst, std::size_t count, std::size_t width, FnValueT fnValue)
+{
+   // Fewer than 8 bits are pending in `acc` at the beginning of every iteration
+   std::uint64_t acc = 0;
+   std::size_t nAcc = 0;
+   for (std::size_t i = 0; i < count; ++i) {
+      const std::uint64_t val = fnValue(i);
+      acc |= val << nAcc;
+      nAcc += width;
+      if (nAcc > 64) {
+         for (unsigned b = 0; b < 8; ++b, acc >>= 8)
+            *dst++ = static_cast<unsigned char>(acc & 0xff);
+         nAcc -= 64;
+         acc = val >> (width - nAcc);
+      }
+      for (; nAcc >= 8; nAcc -= 8, acc >>= 8)
+         *dst++ = static_cast<unsigned char>(acc & 0xff);
+   }
+   if (nAcc > 0)
+      *dst = static_cast<unsigned char>(acc & 0xff);
+}
+
+/// \brief Read `count` values of `width` bits each from a bit stream written by WriteBitStream()
+///
+/// Every value is passed to `fnSink(i, value)`.
+template <typename FnSinkT>
+static void ReadBitStream(const unsigned char *src, std::size_t count, std::size_t width, FnSinkT fnSink)
+{
+   const std::uint64_t mask = (width == 64) ? ~std::uint64_t(0) : ((std::uint64_t(1) << width) - 1);
+   std::uint64_t acc = 0;
+   std::size_t nAcc = 0;
+   for (std::size_t i = 0; i < count; ++i) {
+      std::uint64_t val = 0;
+      for (; (nAcc < width) && (nAcc <= 56); nAcc += 8)
+         acc |= static_cast<std::uint64_t>(*src++) << nAcc;
+      if (nAcc >= width) {
+         val = acc & mask;
+         acc = (width == 64) ? 0 : (acc >> width);
+         nAcc -= width;
+      } else {
+         // Wide elements that straddle more than 64 bits of the stream
+         const std::uint64_t next = *src++;
+         const auto nMissing = width - nAcc;
+         val = (acc | (next << nAcc)) & mask;
+         acc = next >> nMissing;
+         nAcc = 8 - nMissing;
+      }
+      fnSink(i, val);
+   }
+}
+
+/// \brief Packing of columns with delta + (zigzag +) bit-packed encoding
+///
+/// The deltas to the previous element are computed in the (unsigned) on-disk type with wrap-around, so that any
+/// sequence of values can be encoded.  For index columns, the deltas are non-negative and stored as is; for integer
+/// columns, the deltas are zigzag encoded.  The encoding is a separate loop over the whole page such that the compiler
+/// can vectorize it; the bit stream is written by the Internal::PackBitStream() kernels.
+template <typename DestT, typename SourceT, bool kZigzag>
+static void CastDeltaBitPack(void *destination, const void *source, std::size_t count)
+{
+   using UDestT = std::make_unsigned_t<DestT>;
+   constexpr std::size_t kNBitsDestT = sizeof(DestT) * 8;
+   if (count == 0)
+      return;
+
+   auto src = reinterpret_cast<const SourceT *>(source);
+   auto fnNarrow = [src](std::size_t i) { return static_cast<UDestT>(static_cast<DestT>(src[i])); };
+   auto fnEncode = [](UDestT delta) -> std::uint64_t {
+      if constexpr (kZigzag) {
+         return static_cast<UDestT>(static_cast<UDestT>(delta << 1) ^
+                                    static_cast<UDestT>(static_cast<DestT>(delta) >> (kNBitsDestT - 1)));
+      }
+      return delta;
+   };
+
+   // Encode the deltas and find the bit width required by the largest encoded element
+   std::unique_ptr<std::uint64_t[]> encoded(new std::uint64_t[count]);
+   encoded[0] = fnEncode(fnNarrow(0));
+   std::uint64_t allBits = encoded[0];
+   for (std::size_t i = 1; i < count; ++i) {
+      encoded[i] = fnEncode(static_cast<UDestT>(fnNarrow(i) - fnNarrow(i - 1)));
+      allBits |= encoded[i];
+   }
+   std::uint8_t width = 0;
+   for (; allBits != 0; allBits >>= 1)
+      ++width;
+
+   auto dst = reinterpret_cast<unsigned char *>(destination);
+   std::memset(dst, 0, (count * (kNBitsDestT + 1) + 7) / 8);
+   *dst++ = width;
+   if (width == 0)
+      return;
+
+   ROOT::Experimental::Internal::PackBitStream(dst, encoded.get(), count, width);
+}
+
+/// \brief Unpack a bit-packed column and unwind the (zigzag +) delta encoding
+template <typename DestT, typename SourceT, bool kZigzag>
+static void CastDeltaBitUnpack(void *destination, const void *source, std::size_t count)
+{
+   using USourceT = std::make_unsigned_t<SourceT>;
+   constexpr std::size_t kNBitsSourceT = sizeof(SourceT) * 8;
+   if (count == 0)
+      return;
+
+   auto src = reinterpret_cast<const unsigned char *>(source);
+   auto dst = reinterpret_cast<DestT *>(destination);
+   const std::size_t width = *src++;
+   R__ASSERT(width <= kNBitsSourceT);
+
+   std::unique_ptr<std::uint64_t[]> encoded(new std::uint64_t[count]);
+   if (width == 0)
+      std::memset(encoded.get(), 0, count * sizeof(std::uint64_t));
+   else
+      ROOT::Experimental::Internal::UnpackBitStream(encoded.get(), src, count, width);
+
+   // The zigzag decoding is vectorized by the compiler; only the prefix sum of the deltas is sequential
+   if constexpr (kZigzag) {
+      for (std::size_t i = 0; i < count; ++i) {
+         const auto val = static_cast<USourceT>(encoded[i]);
+         encoded[i] = static_cast<USourceT>((val >> 1) ^ static_cast<USourceT>(-static_cast<SourceT>(val & 1)));
+      }
+   }
+   USourceT prev = 0;
+   for (std::size_t i = 0; i < count; ++i) {
+      prev = static_cast<USourceT>(prev + static_cast<USourceT>(encoded[i]));
+      dst[i] = static_cast<SourceT>(prev);
+   }
+}
+
+/// \brief Pack floats (or doubles converted to floats) keeping only the `nBits` most significant bits
+///
+/// The kept bits are the sign, the exponent, and the `nBits - 9` most significant bits of the mantissa; the remaining
+/// mantissa bits are dropped, i.e. the values are rounded towards zero.  The float conversion and the truncation are
+/// done in a separate loop over the whole page such that the compiler can vectorize it.
+template <typename SourceT>
+static void TruncReal32Pack(void *destination, const void *source, std::size_t count, std::size_t nBits)
+{
+   if (count == 0)
+      return;
+   auto src = reinterpret_cast<const SourceT *>(source);
+   if constexpr (R__LITTLE_ENDIAN == 1) {
+      // With 16 bits, the bit stream is an array of the upper halves of the floats, i.e. of Real16 values
+      if (nBits == 16) {
+         auto dst = reinterpret_cast<std::uint16_t *>(destination);
+         if constexpr (std::is_same_v<SourceT, float>) {
+            ROOT::Experimental::Internal::TruncateFloatsTo16Bits(dst, src, count);
+         } else {
+            std::unique_ptr<float[]> floats(new float[count]);
+            for (std::size_t i = 0; i < count; ++i)
+               floats[i] = static_cast<float>(src[i]);
+            ROOT::Experimental::Internal::TruncateFloatsTo16Bits(dst, floats.get(), count);
+         }
+         return;
+      }
+   }
+   const auto shift = 32 - nBits;
+   std::unique_ptr<std::uint32_t[]> truncated(new std::uint32_t[count]);
+   for (std::size_t i = 0; i < count; ++i) {
+      const float value = static_cast<float>(src[i]);
+      std::uint32_t bits;
+      std::memcpy(&bits, &value, sizeof(bits));
+      truncated[i] = bits >> shift;
+   }
+   WriteBitStream(reinterpret_cast<unsigned char *>(destination), count, nBits,
+                  [&truncated](std::size_t i) -> std::uint64_t { return truncated[i]; });
+}
+
+/// \brief Unpack truncated floats; the dropped mantissa bits are set to zero
+template <typename DestT>
+static void TruncReal32Unpack(void *destination, const void *source, std::size_t count, std::size_t nBits)
+{
+   if (count == 0)
+      return;
+   auto dst = reinterpret_cast<DestT *>(destination);
+   if constexpr (R__LITTLE_ENDIAN == 1) {
+      if (nBits == 16) {
+         auto src = reinterpret_cast<const std::uint16_t *>(source);
+         if constexpr (std::is_same_v<DestT, float>) {
+            ROOT::Experimental::Internal::ExpandFloatsFrom16Bits(dst, src, count);
+         } else {
+            std::unique_ptr<float[]> floats(new float[count]);
+            ROOT::Experimental::Internal::ExpandFloatsFrom16Bits(floats.get(), src, count);
+            for (std::size_t i = 0; i < count; ++i)
+               dst[i] = floats[i];
+         }
+         return;
+      }
+   }
+   const auto shift = 32 - nBits;
+   std::unique_ptr<std::uint32_t[]> truncated(new std::uint32_t[count]);
+   ReadBitStream(reinterpret_cast<const unsigned char *>(source), count, nBits,
+                 [&truncated](std::size_t i, std::uint64_t val) { truncated[i] = static_cast<std::uint32_t>(val); });
+   for (std::size_t i = 0; i < count; ++i) {
+      const std::uint32_t bits = truncated[i] << shift;
+      float value;
+      std::memcpy(&value, &bits, sizeof(value));
+      dst[i] = value;
+   }
+}
+
+/// \brief Pack floats or doubles in [min, max] as `nBits` wide integers that map linearly onto the value range
+///
+/// Values outside of the range (including NaN) cannot be represented.  The quantized fields reject them on Append(), so
+/// the exception thrown here only guards against pages that bypass the fields.  As for truncation, the
+/// conversion to integers is done in a separate loop over the whole page such that the compiler can vectorize it.
+template <typename SourceT>
+static void QuantizeReal32Pack(void *destination, const void *source, std::size_t count, std::size_t nBits,
+                               double min, double max)
+{
+   if (count == 0)
+      return;
+   auto src = reinterpret_cast<const SourceT *>(source);
+   std::size_t nOutOfRange = 0;
+   for (std::size_t i = 0; i < count; ++i)
+      nOutOfRange += !(src[i] >= min && src[i] <= max);
+   if (nOutOfRange > 0) {
+      throw ROOT::Experimental::RException(R__FAIL(std::to_string(nOutOfRange) +
+                                                   " value(s) outside of the range of a quantized column"));
+   }
+
+   const double scale = static_cast<double>((std::uint64_t(1) << nBits) - 1) / (max - min);
+   std::unique_ptr<std::uint32_t[]> quantized(new std::uint32_t[count]);
+   for (std::size_t i = 0; i < count; ++i)
+      quantized[i] = static_cast<std::uint32_t>((src[i] - min) * scale + 0.5);
+   WriteBitStream(reinterpret_cast<unsigned char *>(destination), count, nBits,
+                  [&quantized](std::size_t i) -> std::uint64_t { return quantized[i]; });
+}
+
+/// \brief Unpack quantized floats or doubles
+template <typename DestT>
+static void QuantizeReal32Unpack(void *destination, const void *source, std::size_t count, std::size_t nBits,
+                                 double min, double max)
+{
+   if (count == 0)
+      return;
+   auto dst = reinterpret_cast<DestT *>(destination);
+   std::unique_ptr<std::uint32_t[]> quantized(new std::uint32_t[count]);
+   ReadBitStream(reinterpret_cast<const unsigned char *>(source), count, nBits,
+                 [&quantized](std::size_t i, std::uint64_t val) { quantized[i] = static_cast<std::uint32_t>(val); });
+   const double step = (max - min) / static_cast<double>((std::uint64_t(1) << nBits) - 1);
+   for (std::size_t i = 0; i < count; ++i)
+      dst[i] = static_cast<DestT>(min + quantized[i] * step);
+}
+
 } // anonymous namespace
 
 namespace ROOT {
@@ -278,12 +649,27 @@ public:
    template <typename CppT = void>
    static std::unique_ptr<RColumnElementBase> Generate(EColumnType type);
    static std::size_t GetBitsOnStorage(EColumnType type);
+   /// Takes into account the configurable bit width of the column model, if set
+   static std::size_t GetBitsOnStorage(const RColumnModel &model);
    static std::string GetTypeName(EColumnType type);
 
    /// Derived, typed classes tell whether the on-storage layout is bitwise identical to the memory layout
    virtual bool IsMappable() const { R__ASSERT(false); return false; }
    virtual std::size_t GetBitsOnStorage() const { R__ASSERT(false); return 0; }
 
+   /// Only supported by column types with a configurable element width; throws an exception otherwise
+   virtual void SetBitsOnStorage(std::size_t /* bitsOnStorage */)
+   {
+      throw RException(R__FAIL("invalid call: the column type does not support a configurable bit width"));
+   }
+   /// Only supported by quantized column types; throws an exception otherwise
+   virtual void SetValueRange(double /* min */, double /* max */)
+   {
+      throw RException(R__FAIL("invalid call: the column type does not support a value range"));
+   }
+   /// Sets the bit width and the value range of the element from the column model, if they are set in the model
+   void ApplyColumnModel(const RColumnModel &model);
+
    /// If the on-storage layout and the in-memory layout differ, packing creates an on-disk page from an in-memory page
    virtual void Pack(void *destination, void *source, std::size_t count) const
    {
@@ -296,8 +682,75 @@ public:
       std::memcpy(destination, source, count);
    }
 
+   /// Computes the range of `count` in-memory values as they are represented on storage.  Returns false for column
+   /// elements whose values have no meaningful order, such as index, switch, bit, and character columns.
+   virtual bool GetValueStatistics(const void * /* values */, std::size_t /* count */,
+                                   RValueStatistics & /* statistics */) const
+   {
+      return false;
+   }
+
    std::size_t GetSize() const { return fSize; }
    std::size_t GetPackedSize(std::size_t nElements = 1U) const { return (nElements * GetBitsOnStorage() + 7) / 8; }
+
+protected:
+   /// Implements GetValueStatistics() for the typed column elements
+   template <typename CppT>
+   bool ComputeValueStatistics(const void *values, std::size_t count, RValueStatistics &statistics) const
+   {
+      if constexpr (!std::is_arithmetic_v<CppT> || std::is_same_v<CppT, bool> || std::is_same_v<CppT, char>) {
+         return false;
+      } else {
+         const auto typedValues = static_cast<const CppT *>(values);
+         std::uint64_t nNaN = 0;
+         std::size_t i = 0;
+         if constexpr (std::is_floating_point_v<CppT>) {
+            for (; i < count && std::isnan(typedValues[i]); ++i)
+               nNaN++;
+         }
+         if (i == count) {
+            statistics.fMin = std::numeric_limits<double>::infinity();
+            statistics.fMax = -std::numeric_limits<double>::infinity();
+            statistics.fNNaN = nNaN;
+            return true;
+         }
+
+         CppT bounds[2] = {typedValues[i], typedValues[i]};
+         for (++i; i < count; ++i) {
+            const auto v = typedValues[i];
+            if constexpr (std::is_floating_point_v<CppT>) {
+               if (std::isnan(v)) {
+                  nNaN++;
+                  continue;
+               }
+            }
+            bounds[0] = (v < bounds[0]) ? v : bounds[0];
+            bounds[1] = (v > bounds[1]) ? v : bounds[1];
+         }
+
+         if constexpr (std::is_floating_point_v<CppT>) {
+            // Narrowing, truncating, and quantizing floating point values is monotonic, so that the range on storage
+            // is spanned by the packed minimum and maximum
+            if (!IsMappable()) {
+               auto packed = std::make_unique<unsigned char[]>(GetPackedSize(2));
+               Pack(packed.get(), bounds, 2);
+               Unpack(bounds, packed.get(), 2);
+            }
+         }
+         statistics.fMin = static_cast<double>(bounds[0]);
+         statistics.fMax = static_cast<double>(bounds[1]);
+         statistics.fNNaN = nNaN;
+         if constexpr (std::is_integral_v<CppT> && (sizeof(CppT) > 4)) {
+            // Beyond 2^53, the conversion to double can round towards the inside of the range
+            constexpr double kMaxExactInteger = 9007199254740992.0;
+            if (std::abs(statistics.fMin) >= kMaxExactInteger)
+               statistics.fMin = std::nextafter(statistics.fMin, -std::numeric_limits<double>::infinity());
+            if (std::abs(statistics.fMax) >= kMaxExactInteger)
+               statistics.fMax = std::nextafter(statistics.fMax, std::numeric_limits<double>::infinity());
+         }
+         return true;
+      }
+   }
 };
 
 /**
@@ -409,6 +862,141 @@ public:
    }
 }; // class RColumnElementZigzagSplitLE
 
+/**
+ * Base class for delta + bit-packed columns (index columns).
+ * As part of the encoding, can also narrow down the type to NarrowT, which should be an unsigned integer.
+ */
+template <typename CppT, typename NarrowT>
+class RColumnElementDeltaBitPack : public RColumnElementBase {
+protected:
+   explicit RColumnElementDeltaBitPack(std::size_t size) : RColumnElementBase(size) {}
+
+public:
+   static constexpr bool kIsMappable = false;
+
+   void Pack(void *dst, void *src, std::size_t count) const final
+   {
+      CastDeltaBitPack<NarrowT, CppT, false>(dst, src, count);
+   }
+   void Unpack(void *dst, void *src, std::size_t count) const final
+   {
+      CastDeltaBitUnpack<CppT, NarrowT, false>(dst, src, count);
+   }
+}; // class RColumnElementDeltaBitPack
+
+/**
+ * Base class for delta + zigzag + bit-packed columns (integer columns).
+ * The NarrowT target type should be an signed integer, which can be smaller than the CppT source type.
+ */
+template <typename CppT, typename NarrowT>
+class RColumnElementZigzagBitPack : public RColumnElementBase {
+protected:
+   explicit RColumnElementZigzagBitPack(std::size_t size) : RColumnElementBase(size) {}
+
+public:
+   static constexpr bool kIsMappable = false;
+
+   void Pack(void *dst, void *src, std::size_t count) const final
+   {
+      CastDeltaBitPack<NarrowT, CppT, true>(dst, src, count);
+   }
+   void Unpack(void *dst, void *src, std::size_t count) const final
+   {
+      CastDeltaBitUnpack<CppT, NarrowT, true>(dst, src, count);
+   }
+}; // class RColumnElementZigzagBitPack
+
+/**
+ * Base class for lossy float columns that keep only the most significant bits of 32bit floats.
+ * Double values are converted to float before truncation.
+ */
+template <typename CppT>
+class RColumnElementTruncReal32 : public RColumnElementBase {
+protected:
+   std::size_t fBitsOnStorage = kMaxBitsOnStorage;
+
+   explicit RColumnElementTruncReal32(std::size_t size) : RColumnElementBase(size) {}
+
+public:
+   static constexpr bool kIsMappable = false;
+   /// Sign, exponent, and at least one bit of mantissa
+   static constexpr std::size_t kMinBitsOnStorage = 10;
+   static constexpr std::size_t kMaxBitsOnStorage = 32;
+
+   bool IsMappable() const final { return kIsMappable; }
+   std::size_t GetBitsOnStorage() const final { return fBitsOnStorage; }
+   void SetBitsOnStorage(std::size_t bitsOnStorage) final
+   {
+      if (bitsOnStorage < kMinBitsOnStorage || bitsOnStorage > kMaxBitsOnStorage) {
+         throw RException(R__FAIL("invalid number of bits for a truncated float column: " +
+                                  std::to_string(bitsOnStorage)));
+      }
+      fBitsOnStorage = bitsOnStorage;
+   }
+
+   void Pack(void *dst, void *src, std::size_t count) const final
+   {
+      TruncReal32Pack<CppT>(dst, src, count, fBitsOnStorage);
+   }
+   void Unpack(void *dst, void *src, std::size_t count) const final
+   {
+      TruncReal32Unpack<CppT>(dst, src, count, fBitsOnStorage);
+   }
+   bool GetValueStatistics(const void *values, std::size_t count, RValueStatistics &statistics) const final
+   {
+      return ComputeValueStatistics<CppT>(values, count, statistics);
+   }
+}; // class RColumnElementTruncReal32
+
+/**
+ * Base class for lossy float columns that store the values of the range [min, max] as n-bit integers.
+ */
+template <typename CppT>
+class RColumnElementQuantReal32 : public RColumnElementBase {
+protected:
+   std::size_t fBitsOnStorage = kMaxBitsOnStorage;
+   double fMin = 0.0;
+   double fMax = 1.0;
+
+   explicit RColumnElementQuantReal32(std::size_t size) : RColumnElementBase(size) {}
+
+public:
+   static constexpr bool kIsMappable = false;
+   static constexpr std::size_t kMinBitsOnStorage = 1;
+   static constexpr std::size_t kMaxBitsOnStorage = 32;
+
+   bool IsMappable() const final { return kIsMappable; }
+   std::size_t GetBitsOnStorage() const final { return fBitsOnStorage; }
+   void SetBitsOnStorage(std::size_t bitsOnStorage) final
+   {
+      if (bitsOnStorage < kMinBitsOnStorage || bitsOnStorage > kMaxBitsOnStorage) {
+         throw RException(R__FAIL("invalid number of bits for a quantized float column: " +
+                                  std::to_string(bitsOnStorage)));
+      }
+      fBitsOnStorage = bitsOnStorage;
+   }
+   void SetValueRange(double min, double max) final
+   {
+      if (!(min < max))
+         throw RException(R__FAIL("invalid value range for a quantized float column"));
+      fMin = min;
+      fMax = max;
+   }
+
+   void Pack(void *dst, void *src, std::size_t count) const final
+   {
+      QuantizeReal32Pack<CppT>(dst, src, count, fBitsOnStorage, fMin, fMax);
+   }
+   void Unpack(void *dst, void *src, std::size_t count) const final
+   {
+      QuantizeReal32Unpack<CppT>(dst, src, count, fBitsOnStorage, fMin, fMax);
+   }
+   bool GetValueStatistics(const void *values, std::size_t count, RValueStatistics &statistics) const final
+   {
+      return ComputeValueStatistics<CppT>(values, count, statistics);
+   }
+}; // class RColumnElementQuantReal32
+
 ////////////////////////////////////////////////////////////////////////////////
 // Pairs of C++ type and column type, like float and EColumnType::kReal32
 ////////////////////////////////////////////////////////////////////////////////
@@ -583,17 +1171,22 @@ public:
    void Unpack(void *dst, void *src, std::size_t count) const final;
 };
 
-#define __RCOLUMNELEMENT_SPEC_BODY(CppT, BaseT, BitsOnStorage)  \
-   static constexpr std::size_t kSize = sizeof(CppT);           \
-   static constexpr std::size_t kBitsOnStorage = BitsOnStorage; \
-   RColumnElement() : BaseT(kSize) {}                           \
-   bool IsMappable() const final                                \
-   {                                                            \
-      return kIsMappable;                                       \
-   }                                                            \
-   std::size_t GetBitsOnStorage() const final                   \
-   {                                                            \
-      return kBitsOnStorage;                                    \
+#define __RCOLUMNELEMENT_SPEC_BODY(CppT, BaseT, BitsOnStorage)        \
+   static constexpr std::size_t kSize = sizeof(CppT);                 \
+   static constexpr std::size_t kBitsOnStorage = BitsOnStorage;       \
+   RColumnElement() : BaseT(kSize) {}                                 \
+   bool IsMappable() const final                                      \
+   {                                                                  \
+      return kIsMappable;                                             \
+   }                                                                  \
+   std::size_t GetBitsOnStorage() const final                         \
+   {                                                                  \
+      return kBitsOnStorage;                                          \
+   }                                                                  \
+   bool GetValueStatistics(const void *values, std::size_t count,     \
+                           RValueStatistics &statistics) const final  \
+   {                                                                  \
+      return ComputeValueStatistics<CppT>(values, count, statistics); \
    }
 /// These macros are used to declare `RColumnElement` template specializations below.  Additional arguments can be used
 /// to forward template parameters to the base class, e.g.
@@ -632,6 +1225,8 @@ DECLARE_RCOLUMNELEMENT_SPEC(std::int16_t, EColumnType::kSplitInt16, 16, RColumnE
                             <std::int16_t, std::int16_t>);
 DECLARE_RCOLUMNELEMENT_SPEC(std::int16_t, EColumnType::kSplitUInt16, 16, RColumnElementSplitLE,
                             <std::int16_t, std::uint16_t>);
+DECLARE_RCOLUMNELEMENT_SPEC(std::int16_t, EColumnType::kPackedInt16, 17, RColumnElementZigzagBitPack,
+                            <std::int16_t, std::int16_t>);
 
 DECLARE_RCOLUMNELEMENT_SPEC(std::uint16_t, EColumnType::kUInt16, 16, RColumnElementLE, <std::uint16_t>);
 DECLARE_RCOLUMNELEMENT_SPEC(std::uint16_t, EColumnType::kInt16, 16, RColumnElementLE, <std::uint16_t>);
@@ -639,6 +1234,8 @@ DECLARE_RCOLUMNELEMENT_SPEC(std::uint16_t, EColumnType::kSplitUInt16, 16, RColum
                             <std::uint16_t, std::uint16_t>);
 DECLARE_RCOLUMNELEMENT_SPEC(std::uint16_t, EColumnType::kSplitInt16, 16, RColumnElementZigzagSplitLE,
                             <std::uint16_t, std::int16_t>);
+DECLARE_RCOLUMNELEMENT_SPEC(std::uint16_t, EColumnType::kPackedInt16, 17, RColumnElementZigzagBitPack,
+                            <std::uint16_t, std::int16_t>);
 
 DECLARE_RCOLUMNELEMENT_SPEC(std::int32_t, EColumnType::kInt32, 32, RColumnElementLE, <std::int32_t>);
 DECLARE_RCOLUMNELEMENT_SPEC(std::int32_t, EColumnType::kUInt32, 32, RColumnElementLE, <std::int32_t>);
@@ -646,6 +1243,8 @@ DECLARE_RCOLUMNELEMENT_SPEC(std::int32_t, EColumnType::kSplitInt32, 32, RColumnE
                             <std::int32_t, std::int32_t>);
 DECLARE_RCOLUMNELEMENT_SPEC(std::int32_t, EColumnType::kSplitUInt32, 32, RColumnElementSplitLE,
                             <std::int32_t, std::uint32_t>);
+DECLARE_RCOLUMNELEMENT_SPEC(std::int32_t, EColumnType::kPackedInt32, 33, RColumnElementZigzagBitPack,
+                            <std::int32_t, std::int32_t>);
 
 DECLARE_RCOLUMNELEMENT_SPEC(std::uint32_t, EColumnType::kUInt32, 32, RColumnElementLE, <std::uint32_t>);
 DECLARE_RCOLUMNELEMENT_SPEC(std::uint32_t, EColumnType::kInt32, 32, RColumnElementLE, <std::uint32_t>);
@@ -653,6 +1252,8 @@ DECLARE_RCOLUMNELEMENT_SPEC(std::uint32_t, EColumnType::kSplitUInt32, 32, RColum
                             <std::uint32_t, std::uint32_t>);
 DECLARE_RCOLUMNELEMENT_SPEC(std::uint32_t, EColumnType::kSplitInt32, 32, RColumnElementZigzagSplitLE,
                             <std::uint32_t, std::int32_t>);
+DECLARE_RCOLUMNELEMENT_SPEC(std::uint32_t, EColumnType::kPackedInt32, 33, RColumnElementZigzagBitPack,
+                            <std::uint32_t, std::int32_t>);
 
 DECLARE_RCOLUMNELEMENT_SPEC(std::int64_t, EColumnType::kInt64, 64, RColumnElementLE, <std::int64_t>);
 DECLARE_RCOLUMNELEMENT_SPEC(std::int64_t, EColumnType::kUInt64, 64, RColumnElementLE, <std::int64_t>);
@@ -667,6 +1268,8 @@ DECLARE_RCOLUMNELEMENT_SPEC(std::int64_t, EColumnType::kSplitInt32, 32, RColumnE
                             <std::int64_t, std::int32_t>);
 DECLARE_RCOLUMNELEMENT_SPEC(std::int64_t, EColumnType::kSplitUInt32, 32, RColumnElementSplitLE,
                             <std::int64_t, std::uint32_t>);
+DECLARE_RCOLUMNELEMENT_SPEC(std::int64_t, EColumnType::kPackedInt64, 65, RColumnElementZigzagBitPack,
+                            <std::int64_t, std::int64_t>);
 
 DECLARE_RCOLUMNELEMENT_SPEC(std::uint64_t, EColumnType::kUInt64, 64, RColumnElementLE, <std::uint64_t>);
 DECLARE_RCOLUMNELEMENT_SPEC(std::uint64_t, EColumnType::kInt64, 64, RColumnElementLE, <std::uint64_t>);
@@ -674,6 +1277,8 @@ DECLARE_RCOLUMNELEMENT_SPEC(std::uint64_t, EColumnType::kSplitUInt64, 64, RColum
                             <std::uint64_t, std::uint64_t>);
 DECLARE_RCOLUMNELEMENT_SPEC(std::uint64_t, EColumnType::kSplitInt64, 64, RColumnElementZigzagSplitLE,
                             <std::uint64_t, std::int64_t>);
+DECLARE_RCOLUMNELEMENT_SPEC(std::uint64_t, EColumnType::kPackedInt64, 65, RColumnElementZigzagBitPack,
+                            <std::uint64_t, std::int64_t>);
 
 DECLARE_RCOLUMNELEMENT_SPEC(float, EColumnType::kReal32, 32, RColumnElementLE, <float>);
 DECLARE_RCOLUMNELEMENT_SPEC(float, EColumnType::kSplitReal32, 32, RColumnElementSplitLE, <float, float>);
@@ -683,6 +1288,21 @@ DECLARE_RCOLUMNELEMENT_SPEC(double, EColumnType::kSplitReal64, 64, RColumnElemen
 DECLARE_RCOLUMNELEMENT_SPEC(double, EColumnType::kReal32, 32, RColumnElementCastLE, <double, float>);
 DECLARE_RCOLUMNELEMENT_SPEC(double, EColumnType::kSplitReal32, 32, RColumnElementSplitLE, <double, float>);
 
+/// The lossy float columns have a configurable number of bits on storage; kBitsOnStorage is the default.
+#define DECLARE_RCOLUMNELEMENT_SPEC_LOSSY(CppT, ColumnT, BaseT)      \
+   template <>                                                       \
+   class RColumnElement<CppT, ColumnT> : public BaseT<CppT> {        \
+   public:                                                           \
+      static constexpr std::size_t kSize = sizeof(CppT);             \
+      static constexpr std::size_t kBitsOnStorage = 32;              \
+      RColumnElement() : BaseT(kSize) {}                             \
+   }
+
+DECLARE_RCOLUMNELEMENT_SPEC_LOSSY(float, EColumnType::kReal32Trunc, RColumnElementTruncReal32);
+DECLARE_RCOLUMNELEMENT_SPEC_LOSSY(float, EColumnType::kReal32Quant, RColumnElementQuantReal32);
+DECLARE_RCOLUMNELEMENT_SPEC_LOSSY(double, EColumnType::kReal32Trunc, RColumnElementTruncReal32);
+DECLARE_RCOLUMNELEMENT_SPEC_LOSSY(double, EColumnType::kReal32Quant, RColumnElementQuantReal32);
+
 DECLARE_RCOLUMNELEMENT_SPEC(ClusterSize_t, EColumnType::kIndex64, 64, RColumnElementLE, <std::uint64_t>);
 DECLARE_RCOLUMNELEMENT_SPEC(ClusterSize_t, EColumnType::kIndex32, 32, RColumnElementCastLE,
                             <std::uint64_t, std::uint32_t>);
@@ -690,6 +1310,10 @@ DECLARE_RCOLUMNELEMENT_SPEC(ClusterSize_t, EColumnType::kSplitIndex64, 64, RColu
                             <std::uint64_t, std::uint64_t>);
 DECLARE_RCOLUMNELEMENT_SPEC(ClusterSize_t, EColumnType::kSplitIndex32, 32, RColumnElementDeltaSplitLE,
                             <std::uint64_t, std::uint32_t>);
+DECLARE_RCOLUMNELEMENT_SPEC(ClusterSize_t, EColumnType::kPackedIndex64, 65, RColumnElementDeltaBitPack,
+                            <std::uint64_t, std::uint64_t>);
+DECLARE_RCOLUMNELEMENT_SPEC(ClusterSize_t, EColumnType::kPackedIndex32, 33, RColumnElementDeltaBitPack,
+                            <std::uint64_t, std::uint32_t>);
 
 template <typename CppT>
 std::unique_ptr<RColumnElementBase> RColumnElementBase::Generate(EColumnType type)
@@ -721,6 +1345,13 @@ std::unique_ptr<RColumnElementBase> RColumnElementBase::Generate(EColumnType typ
    case EColumnType::kSplitUInt32: return std::make_unique<RColumnElement<CppT, EColumnType::kSplitUInt32>>();
    case EColumnType::kSplitInt16: return std::make_unique<RColumnElement<CppT, EColumnType::kSplitInt16>>();
    case EColumnType::kSplitUInt16: return std::make_unique<RColumnElement<CppT, EColumnType::kSplitUInt16>>();
+   case EColumnType::kPackedIndex64: return std::make_unique<RColumnElement<CppT, EColumnType::kPackedIndex64>>();
+   case EColumnType::kPackedIndex32: return std::make_unique<RColumnElement<CppT, EColumnType::kPackedIndex32>>();
+   case EColumnType::kPackedInt64: return std::make_unique<RColumnElement<CppT, EColumnType::kPackedInt64>>();
+   case EColumnType::kPackedInt32: return std::make_unique<RColumnElement<CppT, EColumnType::kPackedInt32>>();
+   case EColumnType::kPackedInt16: return std::make_unique<RColumnElement<CppT, EColumnType::kPackedInt16>>();
+   case EColumnType::kReal32Trunc: return std::make_unique<RColumnElement<CppT, EColumnType::kReal32Trunc>>();
+   case EColumnType::kReal32Quant: return std::make_unique<RColumnElement<CppT, EColumnType::kReal32Quant>>();
    default: R__ASSERT(false);
    }
    // never here
@@ -18,7 +18,10 @@
 
 #include <ROOT/RStringView.hxx>
 
+#include <cstdint>
+#include <optional>
 #include <string>
+#include <utility>
 
 namespace ROOT {
 namespace Experimental {
@@ -72,6 +75,14 @@ enum class EColumnType {
    kSplitUInt32,
    kSplitInt16,
    kSplitUInt16,
+   kPackedIndex64,
+   kPackedIndex32,
+   kPackedInt64,
+   kPackedInt32,
+   kPackedInt16,
+   // lossy float columns with a configurable number of bits on storage, see RColumnModel::SetBitsOnStorage()
+   kReal32Trunc,
+   kReal32Quant,
    kMax,
 };
 
@@ -83,9 +94,17 @@ enum class EColumnType {
 */
 // clang-format on
 class RColumnModel {
+public:
+   /// The [min, max] interval of the values of a quantized column
+   using ValueRange_t = std::pair<double, double>;
+
 private:
    EColumnType fType;
    bool fIsSorted;
+   /// For column types with a configurable element width; zero means that the width is given by the column type
+   std::uint16_t fBitsOnStorage = 0;
+   /// Only set for quantized columns
+   std::optional<ValueRange_t> fValueRange;
 
 public:
    RColumnModel() : fType(EColumnType::kUnknown), fIsSorted(false) {}
@@ -97,9 +116,16 @@ public:
 
    EColumnType GetType() const { return fType; }
    bool GetIsSorted() const { return fIsSorted; }
+   std::uint16_t GetBitsOnStorage() const { return fBitsOnStorage; }
+   /// Only valid for the column types kReal32Trunc and kReal32Quant
+   void SetBitsOnStorage(std::uint16_t bitsOnStorage) { fBitsOnStorage = bitsOnStorage; }
+   const std::optional<ValueRange_t> &GetValueRange() const { return fValueRange; }
+   /// Only valid for the column type kReal32Quant
+   void SetValueRange(double min, double max) { fValueRange = ValueRange_t(min, max); }
 
    bool operator ==(const RColumnModel &other) const {
-      return (fType == other.fType) && (fIsSorted == other.fIsSorted);
+      return (fType == other.fType) && (fIsSorted == other.fIsSorted) && (fBitsOnStorage == other.fBitsOnStorage) &&
+             (fValueRange == other.fValueRange);
    }
    bool operator!=(const RColumnModel &other) const { return !(other == *this); }
 };
@@ -35,12 +35,15 @@
 #include <functional>
 #include <iostream>
 #include <iterator>
+#include <map>
 #include <memory>
 #include <new>
+#include <optional>
 #include <set>
 #include <string>
 #include <type_traits>
 #include <typeinfo>
+#include <unordered_map>
 #include <variant>
 #include <vector>
 #include <utility>
@@ -932,6 +935,7 @@ protected:
 
    std::size_t AppendImpl(const void *from) final;
    void ReadGlobalImpl(NTupleSize_t globalIndex, void *to) final;
+   std::size_t ReadBulkImpl(const RBulkSpec &bulkSpec) final;
 
 public:
    RVectorField(std::string_view fieldName, std::unique_ptr<Detail::RFieldBase> itemField);
@@ -1126,6 +1130,130 @@ public:
    size_t GetAlignment() const override { return std::alignment_of<std::set<std::max_align_t>>(); }
 };
 
+/// The generic field for a std::map<KeyType, ValueType> and a std::unordered_map<KeyType, ValueType>.
+/// A map is stored as a collection of std::pair<KeyType, ValueType> items, i.e. as an offset column and a pair item
+/// field whose two subfields store the keys and the values.  The generic field fills the map through its collection
+/// proxy; the RField<std::map<...>> and RField<std::unordered_map<...>> specializations use the same on-disk
+/// representation without the collection proxy (see RMapFieldBase).
+class RMapField : public RProxiedCollectionField {
+protected:
+   std::unique_ptr<Detail::RFieldBase> CloneImpl(std::string_view newName) const final;
+
+public:
+   RMapField(std::string_view fieldName, std::string_view typeName, std::unique_ptr<Detail::RFieldBase> itemField);
+   RMapField(RMapField &&other) = default;
+   RMapField &operator=(RMapField &&other) = default;
+   ~RMapField() override = default;
+
+   size_t GetAlignment() const override
+   {
+      return std::max(alignof(std::map<char, std::max_align_t>), alignof(std::unordered_map<char, std::max_align_t>));
+   }
+};
+
+/// The base class of the RField<std::map<...>> and RField<std::unordered_map<...>> specializations.  The on-disk
+/// representation is the same as the one of RMapField but the keys and the values are written and read by the key
+/// and value fields directly, bypassing the per-item dispatch of the collection proxy and of the pair item field.
+/// If both the key and the value field are simple, a map is read as two contiguous bulk reads of its keys and values.
+class RMapFieldBase : public Detail::RFieldBase {
+private:
+   /// The subfields of the std::pair item field
+   Detail::RFieldBase *fKeyField;
+   Detail::RFieldBase *fValueField;
+   /// Staging areas for the bulk read of the keys and the values of simple fields
+   std::vector<unsigned char> fKeyBuffer;
+   std::vector<unsigned char> fValueBuffer;
+   ClusterSize_t fNWritten;
+
+protected:
+   RMapFieldBase(std::string_view fieldName, std::string_view typeName, std::unique_ptr<Detail::RFieldBase> itemField);
+
+   const RColumnRepresentations &GetColumnRepresentations() const final;
+   void GenerateColumnsImpl() final;
+   void GenerateColumnsImpl(const RNTupleDescriptor &desc) final;
+
+   template <typename ContainerT>
+   std::size_t AppendMap(const ContainerT &map)
+   {
+      std::size_t nbytes = 0;
+      for (const auto &item : map) {
+         nbytes += CallAppendOn(*fKeyField, &item.first);
+         nbytes += CallAppendOn(*fValueField, &item.second);
+      }
+      fNWritten += map.size();
+      fColumns[0]->Append(&fNWritten);
+      return nbytes + fColumns[0]->GetElement()->GetPackedSize();
+   }
+
+   template <typename ContainerT>
+   void ReadMap(NTupleSize_t globalIndex, ContainerT &map)
+   {
+      using KeyT = typename ContainerT::key_type;
+      using ValueT = typename ContainerT::mapped_type;
+
+      ClusterSize_t nItems;
+      RClusterIndex collectionStart;
+      fPrincipalColumn->GetCollectionInfo(globalIndex, &collectionStart, &nItems);
+
+      map.clear();
+      if constexpr (std::is_same_v<ContainerT, std::unordered_map<KeyT, ValueT>>)
+         map.reserve(nItems);
+
+      // Items are stored in iteration order, so that the items of a std::map are inserted in ascending key order
+      // and the end() hint makes every insertion constant time
+      if constexpr (std::is_arithmetic_v<KeyT> && std::is_arithmetic_v<ValueT>) {
+         if (fKeyField->IsSimple() && fValueField->IsSimple()) {
+            fKeyBuffer.resize(nItems * sizeof(KeyT));
+            fValueBuffer.resize(nItems * sizeof(ValueT));
+            // The collection start of an empty map may point past the last item of the cluster
+            if (nItems > 0) {
+               GetPrincipalColumnOf(*fKeyField)->ReadV(collectionStart, nItems, fKeyBuffer.data());
+               GetPrincipalColumnOf(*fValueField)->ReadV(collectionStart, nItems, fValueBuffer.data());
+            }
+            auto keys = reinterpret_cast<const KeyT *>(fKeyBuffer.data());
+            auto values = reinterpret_cast<const ValueT *>(fValueBuffer.data());
+            for (std::size_t i = 0; i < nItems; ++i)
+               map.emplace_hint(map.end(), keys[i], values[i]);
+            return;
+         }
+      }
+
+      for (std::size_t i = 0; i < nItems; ++i) {
+         std::pair<KeyT, ValueT> item;
+         CallReadOn(*fKeyField, collectionStart + i, &item.first);
+         CallReadOn(*fValueField, collectionStart + i, &item.second);
+         map.emplace_hint(map.end(), std::move(item));
+      }
+   }
+
+   template <typename ContainerT>
+   std::vector<RValue> SplitMap(const RValue &value) const
+   {
+      std::vector<RValue> result;
+      for (auto &item : *value.Get<ContainerT>()) {
+         // The in-memory std::pair<const KeyT, ValueT> has the same layout as the std::pair<KeyT, ValueT> item
+         result.emplace_back(fSubFields[0]->BindValue(&item));
+      }
+      return result;
+   }
+
+public:
+   RMapFieldBase(RMapFieldBase &&other) = default;
+   RMapFieldBase &operator=(RMapFieldBase &&other) = default;
+   ~RMapFieldBase() override = default;
+
+   void CommitCluster() final;
+   void AcceptVisitor(Detail::RFieldVisitor &visitor) const final;
+   void GetCollectionInfo(NTupleSize_t globalIndex, RClusterIndex *collectionStart, ClusterSize_t *size) const
+   {
+      fPrincipalColumn->GetCollectionInfo(globalIndex, collectionStart, size);
+   }
+   void GetCollectionInfo(const RClusterIndex &clusterIndex, RClusterIndex *collectionStart, ClusterSize_t *size) const
+   {
+      fPrincipalColumn->GetCollectionInfo(clusterIndex, collectionStart, size);
+   }
+};
+
 /// The field for values that may or may not be present in an entry. Parent class for unique pointer field and
 /// optional field. A nullable field cannot be instantiated itself but only its descendants.
 /// The RNullableField takes care of the on-disk representation. Child classes are responsible for the in-memory
@@ -1576,9 +1704,19 @@ public:
 
 template <>
 class RField<float> : public Detail::RFieldBase {
+private:
+   /// Bit width of truncated and quantized columns
+   std::uint16_t fBitsOnStorage = 0;
+   /// Only set for quantized columns
+   std::optional<RColumnModel::ValueRange_t> fValueRange;
+
 protected:
-   std::unique_ptr<Detail::RFieldBase> CloneImpl(std::string_view newName) const final {
-      return std::make_unique<RField>(newName);
+   std::unique_ptr<Detail::RFieldBase> CloneImpl(std::string_view newName) const final
+   {
+      auto clone = std::make_unique<RField>(newName);
+      clone->fBitsOnStorage = fBitsOnStorage;
+      clone->fValueRange = fValueRange;
+      return clone;
    }
 
    const RColumnRepresentations &GetColumnRepresentations() const final;
@@ -1586,6 +1724,14 @@ protected:
    void GenerateColumnsImpl(const RNTupleDescriptor &desc) final;
    void GenerateValue(void *where) const final { new (where) float(0.0); }
 
+   /// Only used for quantized columns, whose values need to be range-checked before they are handed to the column
+   std::size_t AppendImpl(const void *from) final;
+   void ReadGlobalImpl(NTupleSize_t globalIndex, void *to) final { fPrincipalColumn->Read(globalIndex, to); }
+   void ReadInClusterImpl(const RClusterIndex &clusterIndex, void *to) final
+   {
+      fPrincipalColumn->Read(clusterIndex, to);
+   }
+
 public:
    static std::string TypeName() { return "float"; }
    explicit RField(std::string_view name)
@@ -1614,14 +1760,33 @@ public:
    size_t GetValueSize() const final { return sizeof(float); }
    size_t GetAlignment() const final { return alignof(float); }
    void AcceptVisitor(Detail::RFieldVisitor &visitor) const final;
+
+   /// Lossy storage: keep only the sign, the exponent, and the `nBits - 9` most significant mantissa bits, with
+   /// 10 <= nBits <= 32.  Sets the column representative to kReal32Trunc.
+   void SetTruncated(std::size_t nBits);
+   /// Lossy storage: store the values, which must be in [min, max], as `nBits` wide integers, with 1 <= nBits <= 32.
+   /// Sets the column representative to kReal32Quant.  Filling a value outside of the range, including NaN, throws an
+   /// exception from RNTupleWriter::Fill().  Other fields of that entry may have been written already, so the writer
+   /// should not be filled any further.
+   void SetQuantized(double min, double max, std::size_t nBits);
 };
 
 
 template <>
 class RField<double> : public Detail::RFieldBase {
+private:
+   /// Bit width of truncated and quantized columns
+   std::uint16_t fBitsOnStorage = 0;
+   /// Only set for quantized columns
+   std::optional<RColumnModel::ValueRange_t> fValueRange;
+
 protected:
-   std::unique_ptr<Detail::RFieldBase> CloneImpl(std::string_view newName) const final {
-      return std::make_unique<RField>(newName);
+   std::unique_ptr<Detail::RFieldBase> CloneImpl(std::string_view newName) const final
+   {
+      auto clone = std::make_unique<RField>(newName);
+      clone->fBitsOnStorage = fBitsOnStorage;
+      clone->fValueRange = fValueRange;
+      return clone;
    }
 
    const RColumnRepresentations &GetColumnRepresentations() const final;
@@ -1629,6 +1794,14 @@ protected:
    void GenerateColumnsImpl(const RNTupleDescriptor &desc) final;
    void GenerateValue(void *where) const final { new (where) double(0.0); }
 
+   /// Only used for quantized columns, whose values need to be range-checked before they are handed to the column
+   std::size_t AppendImpl(const void *from) final;
+   void ReadGlobalImpl(NTupleSize_t globalIndex, void *to) final { fPrincipalColumn->Read(globalIndex, to); }
+   void ReadInClusterImpl(const RClusterIndex &clusterIndex, void *to) final
+   {
+      fPrincipalColumn->Read(clusterIndex, to);
+   }
+
 public:
    static std::string TypeName() { return "double"; }
    explicit RField(std::string_view name)
@@ -1660,6 +1833,14 @@ public:
 
    // Set the column representation to 32 bit floating point and the type alias to Double32_t
    void SetDouble32();
+   /// Lossy storage: convert to float and keep only the sign, the exponent, and the `nBits - 9` most significant
+   /// mantissa bits, with 10 <= nBits <= 32.  Sets the column representative to kReal32Trunc.
+   void SetTruncated(std::size_t nBits);
+   /// Lossy storage: store the values, which must be in [min, max], as `nBits` wide integers, with 1 <= nBits <= 32.
+   /// Sets the column representative to kReal32Quant.  Filling a value outside of the range, including NaN, throws an
+   /// exception from RNTupleWriter::Fill().  Other fields of that entry may have been written already, so the writer
+   /// should not be filled any further.
+   void SetQuantized(double min, double max, std::size_t nBits);
 };
 
 template <>
@@ -2131,6 +2312,94 @@ public:
    size_t GetAlignment() const final { return std::alignment_of<ContainerT>(); }
 };
 
+template <typename KeyT, typename ValueT>
+class RField<std::map<KeyT, ValueT>> : public RMapFieldBase {
+   using ContainerT = typename std::map<KeyT, ValueT>;
+
+protected:
+   std::unique_ptr<Detail::RFieldBase> CloneImpl(std::string_view newName) const final
+   {
+      return std::make_unique<RField>(newName, fSubFields[0]->Clone(fSubFields[0]->GetName()));
+   }
+
+   void GenerateValue(void *where) const final { new (where) ContainerT(); }
+   void DestroyValue(void *objPtr, bool dtorOnly = false) const final
+   {
+      std::destroy_at(static_cast<ContainerT *>(objPtr));
+      Detail::RFieldBase::DestroyValue(objPtr, dtorOnly);
+   }
+
+   std::size_t AppendImpl(const void *from) final { return AppendMap(*static_cast<const ContainerT *>(from)); }
+   void ReadGlobalImpl(NTupleSize_t globalIndex, void *to) final
+   {
+      ReadMap(globalIndex, *static_cast<ContainerT *>(to));
+   }
+
+public:
+   static std::string TypeName()
+   {
+      return "std::map<" + RField<KeyT>::TypeName() + "," + RField<ValueT>::TypeName() + ">";
+   }
+
+   RField(std::string_view name, std::unique_ptr<Detail::RFieldBase> itemField)
+      : RMapFieldBase(name, TypeName(), std::move(itemField))
+   {
+   }
+   explicit RField(std::string_view name) : RField(name, std::make_unique<RField<std::pair<KeyT, ValueT>>>("_0")) {}
+   RField(RField &&other) = default;
+   RField &operator=(RField &&other) = default;
+   ~RField() override = default;
+
+   using Detail::RFieldBase::GenerateValue;
+   std::vector<RValue> SplitValue(const RValue &value) const final { return SplitMap<ContainerT>(value); }
+   size_t GetValueSize() const final { return sizeof(ContainerT); }
+   size_t GetAlignment() const final { return std::alignment_of<ContainerT>(); }
+};
+
+template <typename KeyT, typename ValueT>
+class RField<std::unordered_map<KeyT, ValueT>> : public RMapFieldBase {
+   using ContainerT = typename std::unordered_map<KeyT, ValueT>;
+
+protected:
+   std::unique_ptr<Detail::RFieldBase> CloneImpl(std::string_view newName) const final
+   {
+      return std::make_unique<RField>(newName, fSubFields[0]->Clone(fSubFields[0]->GetName()));
+   }
+
+   void GenerateValue(void *where) const final { new (where) ContainerT(); }
+   void DestroyValue(void *objPtr, bool dtorOnly = false) const final
+   {
+      std::destroy_at(static_cast<ContainerT *>(objPtr));
+      Detail::RFieldBase::DestroyValue(objPtr, dtorOnly);
+   }
+
+   std::size_t AppendImpl(const void *from) final { return AppendMap(*static_cast<const ContainerT *>(from)); }
+   void ReadGlobalImpl(NTupleSize_t globalIndex, void *to) final
+   {
+      ReadMap(globalIndex, *static_cast<ContainerT *>(to));
+   }
+
+public:
+   static std::string TypeName()
+   {
+      return "std::unordered_map<" + RField<KeyT>::TypeName() + "," + RField<ValueT>::TypeName() + ">";
+   }
+
+   RField(std::string_view name, std::unique_ptr<Detail::RFieldBase> itemField)
+      : RMapFieldBase(name, TypeName(), std::move(itemField))
+   {
+   }
+   explicit RField(std::string_view name) : RField(name, std::make_unique<RField<std::pair<KeyT, ValueT>>>("_0")) {}
+   RField(RField &&other) = default;
+   RField &operator=(RField &&other) = default;
+   ~RField() override = default;
+
+   using Detail::RFieldBase::GenerateValue;
+   std::vector<RValue> SplitValue(const RValue &value) const final { return SplitMap<ContainerT>(value); }
+   size_t GetValueSize() const final { return sizeof(ContainerT); }
+   size_t GetAlignment() const final { return std::alignment_of<ContainerT>(); }
+};
+
 template <typename... ItemTs>
 class RField<std::variant<ItemTs...>> : public RVariantField {
    using ContainerT = typename std::variant<ItemTs...>;
@@ -141,6 +141,8 @@ private:
       void Write(const void *buffer, size_t nbytes, std::int64_t offset);
       /// Writes an RBlob opaque key with the provided buffer as data record and returns the offset of the record
       std::uint64_t WriteKey(const void *buffer, size_t nbytes, size_t len);
+      /// Reads back a byte range of the file, e.g. the header of an existing RNTuple
+      void Read(void *buffer, size_t nbytes, std::int64_t offset);
       operator bool() const { return fFile; }
    };
 
@@ -185,6 +187,8 @@ private:
    std::string fFileName;
    /// Header and footer location of the ntuple, written on Commit()
    RFileNTupleAnchor fNTupleAnchor;
+   /// Set if the writer continues an existing RNTuple, in which case Commit() replaces the existing anchor
+   bool fIsUpdate = false;
 
    explicit RNTupleFileWriter(std::string_view name);
 
@@ -212,6 +216,10 @@ public:
                                       std::unique_ptr<TFile> &file);
    /// Add a new RNTuple identified by ntupleName to the existing TFile.
    static RNTupleFileWriter *Append(std::string_view ntupleName, TFile &file);
+   /// Continue the existing RNTuple identified by ntupleName in the TFile, which must be writable.  The anchor of the
+   /// existing RNTuple provides the header location.  New blobs are added to the file and Commit() writes the new anchor
+   /// as a new key before it deletes the previous one.  Until then, the previous anchor is untouched.
+   static RNTupleFileWriter *Update(std::string_view ntupleName, TFile &file);
 
    RNTupleFileWriter(const RNTupleFileWriter &other) = delete;
    RNTupleFileWriter(RNTupleFileWriter &&other) = delete;
@@ -227,6 +235,13 @@ public:
    std::uint64_t WriteBlob(const void *data, size_t nbytes, size_t len);
    /// Writes the RNTuple key to the file so that the header and footer keys can be found
    void Commit();
+
+   /// Whether the writer continues an existing RNTuple, see Update()
+   bool IsUpdate() const { return fIsUpdate; }
+   /// The anchor of the RNTuple; for a writer created by Update(), it initially locates the existing header and footer
+   const RFileNTupleAnchor &GetNTupleAnchor() const { return fNTupleAnchor; }
+   /// Reads back a blob of the existing RNTuple; only valid for writers created by Update()
+   void ReadBuffer(void *buffer, size_t nbytes, std::uint64_t offset);
 };
 
 } // namespace Internal
@@ -33,7 +33,10 @@
 #include <iterator>
 #include <memory>
 #include <sstream>
+#include <string>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 class TFile;
 
@@ -42,6 +45,7 @@ namespace Experimental {
 
 class REntry;
 class RNTuple;
+class RNTupleIndex;
 class RNTupleModel;
 
 namespace Detail {
@@ -50,6 +54,7 @@ class RPageSource;
 }
 
 namespace Internal {
+class RNTupleJoinTable;
 struct RNTupleTester; // friend of RNTuple
 }
 
@@ -60,6 +65,8 @@ enum class ENTupleInfo {
    kSummary,  // The ntuple name, description, number of entries
    kStorageDetails, // size on storage, page sizes, compression factor, etc.
    kMetrics, // internals performance counters, requires that EnableMetrics() was called
+   kMetricsJSON, // performance counters, per-column statistics, and per-cluster timeline as JSON; requires metrics
+   kMetricsCSV,  // same as kMetricsJSON but in CSV format
 };
 
 #ifdef R__USE_IMT
@@ -117,11 +124,20 @@ private:
    /// Retrieving descriptor data from an RNTupleReader is supposed to be for testing and information purposes,
    /// not on a hot code path.
    std::unique_ptr<RNTupleDescriptor> fCachedDescriptor;
+   /// An optional index that maps keys to entry numbers, see SetIndex()
+   std::unique_ptr<RNTupleIndex> fIndex;
+   /// For friends opened with join fields, maps the virtual top-level field of every joined friend to the table
+   /// that translates entry numbers into entry numbers of that friend.  Needs to be destructed before fSource.
+   std::unordered_map<DescriptorId_t, std::unique_ptr<Internal::RNTupleJoinTable>> fJoinTables;
    Detail::RNTupleMetrics fMetrics;
 
    void ConnectModel(const RNTupleModel &model);
    RNTupleReader *GetDisplayReader();
    void InitPageSource();
+   /// Used by LoadEntry() if there are joined friends
+   void LoadJoinedEntry(NTupleSize_t index, REntry &entry);
+   /// Views use the entry numbers of the reader and thus cannot be created for the fields of a joined friend
+   void EnsureNotJoined(DescriptorId_t fieldId);
 
 public:
    // Browse through the entries
@@ -153,9 +169,16 @@ public:
       std::string fNTupleName;
       std::string fStorage;
       RNTupleReadOptions fOptions;
+      /// If set, the entries of this RNTuple are joined to the entries of the first RNTuple by the values of these
+      /// integral key fields, which must exist in both RNTuples.  Ignored for the first RNTuple.
+      std::vector<std::string> fJoinFields;
 
       ROpenSpec() = default;
       ROpenSpec(std::string_view n, std::string_view s) : fNTupleName(n), fStorage(s) {}
+      ROpenSpec(std::string_view n, std::string_view s, const std::vector<std::string> &joinFields)
+         : fNTupleName(n), fStorage(s), fJoinFields(joinFields)
+      {
+      }
    };
 
    /// Throws an exception if the model is null.
@@ -185,6 +208,17 @@ public:
    /// Open RNTuples as one virtual, horizontally combined ntuple.  The underlying RNTuples must
    /// have an identical number of entries.  Fields in the combined RNTuple are named with the ntuple name
    /// as a prefix, e.g. myNTuple1.px and myNTuple2.pt (see tutorial ntpl006_friends)
+   ///
+   /// RNTuples with join fields in their ROpenSpec instead can have any number of entries in any order.  Their
+   /// entries are matched to the entries of the first RNTuple by key, using the RNTupleIndex stored next to the
+   /// joined RNTuple if it has the same key fields, or else building one.  LoadEntry() throws an exception if a joined
+   /// RNTuple has no entry with the key of the loaded entry.  Views of the fields of joined RNTuples are not supported.
+   ///
+   /// **Example: join the calibration data of the runs to the events**
+   /// ~~~ {.cpp}
+   /// std::vector<RNTupleReader::ROpenSpec> friends{{"Events", "events.root"}, {"Runs", "runs.root", {"run"}}};
+   /// auto ntuple = RNTupleReader::OpenFriends(friends);
+   /// ~~~
    static std::unique_ptr<RNTupleReader> OpenFriends(std::span<ROpenSpec> ntuples);
 
    /// The user imposes an ntuple model, which must be compatible with the model found in the data on
@@ -196,7 +230,7 @@ public:
    ///
    /// Throws an exception if the source is null.
    explicit RNTupleReader(std::unique_ptr<Detail::RPageSource> source);
-   std::unique_ptr<RNTupleReader> Clone() { return std::make_unique<RNTupleReader>(fSource->Clone()); }
+   std::unique_ptr<RNTupleReader> Clone();
    ~RNTupleReader();
 
    RNTupleModel *GetModel();
@@ -253,6 +287,10 @@ public:
    }
    /// Fills a user provided entry after checking that the entry has been instantiated from the ntuple model
    void LoadEntry(NTupleSize_t index, REntry &entry) {
+      if (R__unlikely(!fJoinTables.empty())) {
+         LoadJoinedEntry(index, entry);
+         return;
+      }
       for (auto& value : entry) {
          value.Read(index);
       }
@@ -302,6 +340,8 @@ public:
          throw RException(R__FAIL("no field named '" + std::string(fieldName) + "' in RNTuple '" +
                                   fSource->GetSharedDescriptorGuard()->GetName() + "'"));
       }
+      if (R__unlikely(!fJoinTables.empty()))
+         EnsureNotJoined(fieldId);
       return RNTupleView<T>(fieldId, fSource.get());
    }
 
@@ -314,12 +354,37 @@ public:
          throw RException(R__FAIL("no field named '" + std::string(fieldName) + "' in RNTuple '" +
                                   fSource->GetSharedDescriptorGuard()->GetName() + "'"));
       }
+      if (R__unlikely(!fJoinTables.empty()))
+         EnsureNotJoined(fieldId);
       return RNTupleViewCollection(fieldId, fSource.get());
    }
 
    RIterator begin() { return RIterator(0); }
    RIterator end() { return RIterator(GetNEntries()); }
 
+   /// Attaches an index over key fields of this ntuple, built by RNTupleIndex::Create() or read by
+   /// RNTupleIndex::Open().  Throws an exception if the index does not cover all the entries of this ntuple.
+   ///
+   /// **Example: load the entry of a given run and event number**
+   /// ~~~ {.cpp}
+   /// #include <ROOT/RNTuple.hxx>
+   /// #include <ROOT/RNTupleIndex.hxx>
+   /// using ROOT::Experimental::RNTupleIndex;
+   /// using ROOT::Experimental::RNTupleReader;
+   ///
+   /// auto ntuple = RNTupleReader::Open("myNTuple", "some/file.root");
+   /// ntuple->SetIndex(RNTupleIndex::Create({"run", "event"}, *ntuple));
+   /// auto entryNumber = ntuple->FindEntry({1, 42});
+   /// if (entryNumber != ROOT::Experimental::kInvalidNTupleIndex)
+   ///    ntuple->Show(entryNumber);
+   /// ~~~
+   void SetIndex(std::unique_ptr<RNTupleIndex> index);
+   /// Returns the attached index or nullptr if no index has been set
+   const RNTupleIndex *GetIndex() const { return fIndex.get(); }
+   /// Returns the smallest entry number with the given key, one value per key field of the attached index, or
+   /// kInvalidNTupleIndex if there is no such entry.  Throws an exception if no index has been set.
+   NTupleSize_t FindEntry(const std::vector<std::uint64_t> &key) const;
+
    /// Enable performance measurements (decompression time, bytes read from storage, etc.)
    ///
    /// **Example: inspect the reader metrics after loading every entry**
@@ -339,23 +404,32 @@ public:
    /// }
    /// ntuple->PrintInfo(ENTupleInfo::kMetrics);
    /// ~~~
+   ///
+   /// With ENTupleInfo::kMetricsJSON or ENTupleInfo::kMetricsCSV, the counters are printed in a machine-readable form
+   /// together with the per-column read statistics and the per-cluster timeline of reading, decompressing, and
+   /// unpacking pages (see Detail::RNTupleReadReport).
    void EnableMetrics() { fMetrics.Enable(); }
    const Detail::RNTupleMetrics &GetMetrics() const { return fMetrics; }
 };
 
 // clang-format off
 /**
-\class ROOT::Experimental::RNTupleWriter
+\class ROOT::Experimental::RNTupleFillContext
 \ingroup NTuple
-\brief An RNTuple that gets filled with entries (data) and writes them to storage
+\brief A context for filling entries (data) into clusters of an RNTuple
 
-An output ntuple can be filled with entries. The caller has to make sure that the data that gets filled into an ntuple
+An output cluster can be filled with entries. The caller has to make sure that the data that gets filled into a cluster
 is not modified for the time of the Fill() call. The fill call serializes the C++ object into the column format and
 writes data into the corresponding column page buffers.  Writing of the buffers to storage is deferred and can be
-triggered by Flush() or by destructing the ntuple.  On I/O errors, an exception is thrown.
+triggered by CommitCluster() or by destructing the context.  On I/O errors, an exception is thrown.
+
+Instances of this class are not meant to be used in isolation and can be created from an RNTupleParallelWriter. For
+sequential writing, please refer to RNTupleWriter.
 */
 // clang-format on
-class RNTupleWriter {
+class RNTupleFillContext {
+   friend class RNTupleWriter;
+   friend class RNTupleParallelWriter;
    friend RNTupleModel::RUpdater;
 
 private:
@@ -367,7 +441,6 @@ private:
    std::unique_ptr<RNTupleModel> fModel;
    Detail::RNTupleMetrics fMetrics;
    NTupleSize_t fLastCommitted = 0;
-   NTupleSize_t fLastCommittedClusterGroup = 0;
    NTupleSize_t fNEntries = 0;
    /// Keeps track of the number of bytes written into the current cluster
    std::size_t fUnzippedClusterSize = 0;
@@ -381,6 +454,77 @@ private:
    /// Estimator of uncompressed cluster size, taking into account the estimated compression ratio
    NTupleSize_t fUnzippedClusterSizeEst;
 
+   RNTupleFillContext(std::unique_ptr<RNTupleModel> model, std::unique_ptr<Detail::RPageSink> sink);
+
+public:
+   RNTupleFillContext(const RNTupleFillContext &) = delete;
+   RNTupleFillContext &operator=(const RNTupleFillContext &) = delete;
+   ~RNTupleFillContext();
+
+   /// Fill an entry into this context.  This method will perform a light check whether the entry comes from the
+   /// context's own model.
+   /// \return The number of uncompressed bytes written.
+   std::size_t Fill(REntry &entry)
+   {
+      if (R__unlikely(entry.GetModelId() != fModel->GetModelId()))
+         throw RException(R__FAIL("mismatch between entry and model"));
+
+      std::size_t bytesWritten = 0;
+      for (auto &value : entry) {
+         bytesWritten += value.Append();
+      }
+      fUnzippedClusterSize += bytesWritten;
+      fNEntries++;
+      if ((fUnzippedClusterSize >= fMaxUnzippedClusterSize) || (fUnzippedClusterSize >= fUnzippedClusterSizeEst))
+         CommitCluster();
+      return bytesWritten;
+   }
+   /// Ensure that the data from the so far seen Fill calls has been written to storage
+   void CommitCluster();
+
+   std::unique_ptr<REntry> CreateEntry() { return fModel->CreateEntry(); }
+
+   /// Return the entry number that was last flushed in a cluster.
+   NTupleSize_t GetLastCommitted() const { return fLastCommitted; }
+   /// Return the number of entries filled so far, including the existing entries if the sink updates an ntuple.
+   NTupleSize_t GetNEntries() const { return fNEntries; }
+
+   void EnableMetrics() { fMetrics.Enable(); }
+   const Detail::RNTupleMetrics &GetMetrics() const { return fMetrics; }
+
+   const RNTupleModel *GetModel() const { return fModel.get(); }
+};
+
+// clang-format off
+/**
+\class ROOT::Experimental::RNTupleWriter
+\ingroup NTuple
+\brief An RNTuple that gets filled with entries (data) and writes them to storage
+
+An output ntuple can be filled with entries. The caller has to make sure that the data that gets filled into an ntuple
+is not modified for the time of the Fill() call. The fill call serializes the C++ object into the column format and
+writes data into the corresponding column page buffers.  Writing of the buffers to storage is deferred and can be
+triggered by Flush() or by destructing the ntuple.  On I/O errors, an exception is thrown.
+
+A writer created by Update() adds entries to an ntuple that already exists in a ROOT file, e.g. to append the data
+of a new run to the file of the previous runs instead of writing a new file:
+~~~ {.cpp}
+auto file = std::unique_ptr<TFile>(TFile::Open("data.root", "UPDATE"));
+auto model = RNTupleModel::Create();
+auto fldPt = model->MakeField<float>("pt");
+auto writer = RNTupleWriter::Update(std::move(model), "Events", *file);
+// Entry numbers continue after the existing entries
+~~~
+*/
+// clang-format on
+class RNTupleWriter {
+   friend RNTupleModel::RUpdater;
+
+private:
+   RNTupleFillContext fFillContext;
+   Detail::RNTupleMetrics fMetrics;
+   NTupleSize_t fLastCommittedClusterGroup = 0;
+
    // Helper function that is called from CommitCluster() when necessary
    void CommitClusterGroup();
 
@@ -395,6 +539,15 @@ public:
                                                 std::string_view ntupleName,
                                                 TFile &file,
                                                 const RNTupleWriteOptions &options = RNTupleWriteOptions());
+   /// Add entries to the existing ntuple in the file, which must be writable.  The fields of the model must match the
+   /// fields of the ntuple.  New clusters and cluster groups follow the existing ones.  When the writer is destructed,
+   /// a new footer is written and the anchor of the ntuple is replaced afterwards; an update that ends before, e.g.
+   /// because the process is killed, leaves the previous ntuple readable.  Throws an exception if the model is null,
+   /// if the file has no ntuple of the given name, or if the model does not match.
+   static std::unique_ptr<RNTupleWriter> Update(std::unique_ptr<RNTupleModel> model,
+                                                std::string_view ntupleName,
+                                                TFile &file,
+                                                const RNTupleWriteOptions &options = RNTupleWriteOptions());
    /// Throws an exception if the model or the sink is null.
    RNTupleWriter(std::unique_ptr<RNTupleModel> model, std::unique_ptr<Detail::RPageSink> sink);
    RNTupleWriter(const RNTupleWriter&) = delete;
@@ -403,33 +556,28 @@ public:
 
    /// The simplest user interface if the default entry that comes with the ntuple model is used.
    /// \return The number of uncompressed bytes written.
-   std::size_t Fill() { return Fill(*fModel->GetDefaultEntry()); }
+   std::size_t Fill() { return fFillContext.Fill(*fFillContext.fModel->GetDefaultEntry()); }
    /// Multiple entries can have been instantiated from the ntuple model.  This method will perform
    /// a light check whether the entry comes from the ntuple's own model.
    /// \return The number of uncompressed bytes written.
-   std::size_t Fill(REntry &entry) {
-      if (R__unlikely(entry.GetModelId() != fModel->GetModelId()))
-         throw RException(R__FAIL("mismatch between entry and model"));
-
-      std::size_t bytesWritten = 0;
-      for (auto& value : entry) {
-         bytesWritten += value.Append();
-      }
-      fUnzippedClusterSize += bytesWritten;
-      fNEntries++;
-      if ((fUnzippedClusterSize >= fMaxUnzippedClusterSize) || (fUnzippedClusterSize >= fUnzippedClusterSizeEst))
-         CommitCluster();
-      return bytesWritten;
-   }
+   std::size_t Fill(REntry &entry) { return fFillContext.Fill(entry); }
    /// Ensure that the data from the so far seen Fill calls has been written to storage
-   void CommitCluster(bool commitClusterGroup = false);
+   void CommitCluster(bool commitClusterGroup = false)
+   {
+      fFillContext.CommitCluster();
+      if (commitClusterGroup)
+         CommitClusterGroup();
+   }
 
-   std::unique_ptr<REntry> CreateEntry() { return fModel->CreateEntry(); }
+   std::unique_ptr<REntry> CreateEntry() { return fFillContext.CreateEntry(); }
+
+   /// Return the number of entries filled so far, including the existing entries of an ntuple opened by Update().
+   NTupleSize_t GetNEntries() const { return fFillContext.GetNEntries(); }
 
    void EnableMetrics() { fMetrics.Enable(); }
    const Detail::RNTupleMetrics &GetMetrics() const { return fMetrics; }
 
-   const RNTupleModel *GetModel() const { return fModel.get(); }
+   const RNTupleModel *GetModel() const { return fFillContext.GetModel(); }
 
    /// Get a `RNTupleModel::RUpdater` that provides limited support for incremental updates to the underlying
    /// model, e.g. addition of new fields.
@@ -532,6 +680,10 @@ public:
 
    /// RNTuple implements the hadd MergeFile interface
    /// Merge this NTuple with the input list entries
+   ///
+   /// Only ntuples in the top-level directory of the output file can be merged, and only in non-incremental mode:
+   /// TFileMerger reports an error for ntuples in subdirectories and when it merges into an existing output file,
+   /// which also happens if hadd has to merge more input files than it is allowed to keep open (see `hadd -n`).
    Long64_t Merge(TCollection *input, TFileMergeInfo *mergeInfo);
 
    // The version must match the RFileNTupleAnchor version in the LinkDef.h
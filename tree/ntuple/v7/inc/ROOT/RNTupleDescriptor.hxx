@@ -30,11 +30,13 @@
 #include <iterator>
 #include <map>
 #include <memory>
+#include <optional>
 #include <ostream>
 #include <vector>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
+#include <utility>
 
 namespace ROOT {
 namespace Experimental {
@@ -222,13 +224,14 @@ public:
       /// The usual format for ROOT compression settings (see Compression.h).
       /// The pages of a particular column in a particular cluster are all compressed with the same settings.
       std::int64_t fCompressionSettings = 0;
-
-      // TODO(jblomer): we perhaps want to store summary information, such as average, min/max, etc.
-      // Should this be done on the field level?
+      /// The value range of the column in the cluster, merged from the statistics of the pages.  Only set for
+      /// numeric columns if all the pages of the column in the cluster have statistics.
+      std::optional<RValueStatistics> fStatistics;
 
       bool operator==(const RColumnRange &other) const {
          return fPhysicalColumnId == other.fPhysicalColumnId && fFirstElementIndex == other.fFirstElementIndex &&
-                fNElements == other.fNElements && fCompressionSettings == other.fCompressionSettings;
+                fNElements == other.fNElements && fCompressionSettings == other.fCompressionSettings &&
+                fStatistics == other.fStatistics;
       }
 
       bool Contains(NTupleSize_t index) const {
@@ -245,9 +248,11 @@ public:
          std::uint32_t fNElements = std::uint32_t(-1);
          /// The meaning of fLocator depends on the storage backend.
          RNTupleLocator fLocator;
+         /// The value range of the elements in the page; only set for numeric columns
+         std::optional<RValueStatistics> fStatistics;
 
          bool operator==(const RPageInfo &other) const {
-            return fNElements == other.fNElements && fLocator == other.fLocator;
+            return fNElements == other.fNElements && fLocator == other.fLocator && fStatistics == other.fStatistics;
          }
       };
       struct RPageInfoExtended : RPageInfo {
@@ -424,6 +429,8 @@ private:
 
    std::uint64_t fNEntries = 0; ///< Updated by the descriptor builder when the cluster summaries are added
    std::uint64_t fNPhysicalColumns = 0; ///< Updated by the descriptor builder when columns are added
+   /// Set from the footer feature flags; if set, the page lists contain a block of page value statistics per column
+   bool fHasPageStatistics = false;
 
    /**
     * Once constructed by an RNTupleDescriptorBuilder, the descriptor is mostly immutable except for set of
@@ -689,6 +696,7 @@ public:
 
    std::uint64_t GetOnDiskHeaderSize() const { return fOnDiskHeaderSize; }
    std::uint64_t GetOnDiskFooterSize() const { return fOnDiskFooterSize; }
+   bool HasPageStatistics() const { return fHasPageStatistics; }
 
    const RFieldDescriptor& GetFieldDescriptor(DescriptorId_t fieldId) const {
       return fFieldDescriptors.at(fieldId);
@@ -1046,6 +1054,8 @@ public:
    RResult<void> EnsureValidDescriptor() const;
    const RNTupleDescriptor& GetDescriptor() const { return fDescriptor; }
    RNTupleDescriptor MoveDescriptor();
+   /// Continues building from an existing descriptor, e.g. in order to add clusters to an existing ntuple
+   void SetDescriptor(RNTupleDescriptor &&descriptor) { fDescriptor = std::move(descriptor); }
 
    void SetNTuple(const std::string_view name, const std::string_view description);
    void SetHeaderCRC32(std::uint32_t crc32) { fHeaderCRC32 = crc32; }
@@ -1054,6 +1064,7 @@ public:
    void SetOnDiskHeaderSize(std::uint64_t size) { fDescriptor.fOnDiskHeaderSize = size; }
    /// The real footer size also include the page list envelopes
    void AddToOnDiskFooterSize(std::uint64_t size) { fDescriptor.fOnDiskFooterSize += size; }
+   void SetHasPageStatistics(bool val) { fDescriptor.fHasPageStatistics = val; }
 
    void AddField(const RFieldDescriptor& fieldDesc);
    RResult<void> AddFieldLink(DescriptorId_t fieldId, DescriptorId_t linkId);
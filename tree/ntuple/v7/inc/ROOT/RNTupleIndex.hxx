@@ -0,0 +1,217 @@
+/// \file ROOT/RNTupleIndex.hxx
+/// \ingroup NTuple ROOT7
+/// \date 2024-03-04
+/// \warning This is part of the ROOT 7 prototype! It will change without notice. It might trigger earthquakes. Feedback
+/// is welcome!
+
+/*************************************************************************
+ * Copyright (C) 1995-2024, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT7_RNTupleIndex
+#define ROOT7_RNTupleIndex
+
+#include <ROOT/RNTupleUtil.hxx>
+#include <ROOT/RStringView.hxx>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+class TFile;
+
+namespace ROOT {
+namespace Experimental {
+
+class RNTupleReader;
+
+namespace Internal {
+
+// clang-format off
+/**
+\class ROOT::Experimental::Internal::RNTupleKeyReader
+\ingroup NTuple
+\brief Reads the values of integral key fields of a reader as 64bit unsigned integers
+
+Key fields must not be part of a collection, so that their values are indexed by entry number.  The values of signed
+key fields are sign-extended, i.e. they are the two's complement representation of the 64bit signed value.
+*/
+// clang-format on
+class RNTupleKeyReader {
+private:
+   /// One function per key field that returns the value of the field for a given entry number
+   std::vector<std::function<std::uint64_t(NTupleSize_t)>> fReadFunctions;
+   /// Whether the key field of the same position has a signed integral type
+   std::vector<bool> fIsSigned;
+
+public:
+   /// Throws if a key field does not exist, is not of integral type, or is part of a collection
+   RNTupleKeyReader(const std::vector<std::string> &keyFieldNames, RNTupleReader &reader);
+
+   std::size_t GetNKeyFields() const { return fReadFunctions.size(); }
+   bool IsSignedKeyField(std::size_t keyFieldIdx) const { return fIsSigned[keyFieldIdx]; }
+   /// Appends the keys of the entries [firstEntry, firstEntry + nEntries) to `keys`, one value per key field each
+   void ReadKeys(NTupleSize_t firstEntry, NTupleSize_t nEntries, std::vector<std::uint64_t> &keys);
+};
+
+} // namespace Internal
+
+// clang-format off
+/**
+\class ROOT::Experimental::RNTupleIndex
+\ingroup NTuple
+\brief An index of the entries of an RNTuple by the values of one or more key fields
+
+The index is the RNTuple equivalent of a TTreeIndex.  It is built from integral key fields, e.g. the run and the event
+number, that are not part of a collection.  Keys are passed as 64bit unsigned integers, one value per key field; the
+value of a signed key field is passed as its two's complement, e.g. `static_cast<std::uint64_t>(-1)`.  Entries are
+ordered lexicographically by their keys and, for equal keys, by their entry number.  The values of signed key fields
+are ordered by their signed value, such that key ranges with negative values work as expected.  Looking up the entries
+of a given key takes constant time; the entries of a key range are found by binary search.
+
+The index can be stored next to the indexed RNTuple, as an auxiliary RNTuple named GetIndexNTupleName(), and later be
+read back without scanning the key fields again:
+~~~ {.cpp}
+auto reader = RNTupleReader::Open("Events", "data.root");
+auto index = RNTupleIndex::Create({"run", "event"}, *reader);
+auto file = std::unique_ptr<TFile>(TFile::Open("data.root", "UPDATE"));
+index->Write(*file);
+...
+reader->SetIndex(RNTupleIndex::Open("Events", "data.root"));
+reader->LoadEntry(reader->FindEntry({run, event}));
+~~~
+*/
+// clang-format on
+class RNTupleIndex {
+private:
+   std::string fNTupleName;
+   std::vector<std::string> fKeyFieldNames;
+   /// Whether the key field of the same position has a signed integral type
+   std::vector<bool> fIsSignedKey;
+   /// The encoded keys of all the entries in index order, i.e. the key of the i-th index row starts at
+   /// fKeys[i * nKeys].  See EncodeKeyValue().
+   std::vector<std::uint64_t> fKeys;
+   /// The entry numbers in index order
+   std::vector<NTupleSize_t> fEntryNumbers;
+   /// Open addressing hash table that maps every distinct key to its first index row; empty slots are zero and the
+   /// other slots store the row number plus one.  The number of slots is a power of two.
+   std::vector<std::uint64_t> fSlots;
+
+   RNTupleIndex(std::string_view ntupleName, const std::vector<std::string> &keyFieldNames);
+
+   /// Flips the sign bit of the values of signed key fields, which maps the signed order to the unsigned order of the
+   /// encoded values.  The encoding is its own inverse.
+   static std::uint64_t EncodeKeyValue(std::uint64_t value, bool isSigned)
+   {
+      return isSigned ? (value ^ (std::uint64_t(1) << 63)) : value;
+   }
+   /// Encodes a sequence of keys, one value per key field each
+   std::vector<std::uint64_t> EncodeKeys(const std::vector<std::uint64_t> &keys) const;
+   /// Reads and encodes the keys of all the entries of the reader
+   void ReadKeys(const std::vector<std::string> &keyFieldNames, RNTupleReader &reader);
+   std::size_t GetNKeyFields() const { return fKeyFieldNames.size(); }
+   const std::uint64_t *GetKeyOfRow(std::size_t row) const { return fKeys.data() + row * GetNKeyFields(); }
+   static std::uint64_t HashKey(const std::uint64_t *key, std::size_t nKeyFields);
+   /// Fills the hash table from the sorted keys
+   void BuildHashTable();
+   /// Returns the first row with the given encoded key or the number of rows if the key is not in the index
+   std::size_t FindFirstRow(const std::uint64_t *key) const;
+   /// Returns the first row whose key is not less than the given encoded key
+   std::size_t LowerBound(const std::vector<std::uint64_t> &key) const;
+   void EnsureValidKey(const std::vector<std::uint64_t> &key) const;
+
+public:
+   /// The name of the auxiliary RNTuple that stores the index of the given RNTuple
+   static std::string GetIndexNTupleName(std::string_view ntupleName) { return std::string(ntupleName) + ".index"; }
+
+   /// Reads the given key fields of all the entries of the reader.  Throws if a key field does not exist, is not of
+   /// integral type, or is part of a collection.
+   static std::unique_ptr<RNTupleIndex> Create(const std::vector<std::string> &keyFieldNames, RNTupleReader &reader);
+   /// Reads the index of the given RNTuple that has been stored by Write().  Throws if there is no such index.
+   static std::unique_ptr<RNTupleIndex> Open(std::string_view ntupleName, std::string_view storage);
+
+   RNTupleIndex(const RNTupleIndex &other) = delete;
+   RNTupleIndex &operator=(const RNTupleIndex &other) = delete;
+   ~RNTupleIndex() = default;
+
+   /// Stores the index as an auxiliary RNTuple in the given file, typically the file of the indexed RNTuple
+   void Write(TFile &file) const;
+
+   const std::string &GetNTupleName() const { return fNTupleName; }
+   const std::vector<std::string> &GetKeyFieldNames() const { return fKeyFieldNames; }
+   /// The number of indexed entries, which equals the number of entries of the indexed RNTuple
+   NTupleSize_t GetNEntries() const { return fEntryNumbers.size(); }
+
+   /// Returns the smallest entry number with the given key or kInvalidNTupleIndex if there is no such entry.  The key
+   /// has one value per key field.
+   NTupleSize_t GetFirstEntryNumber(const std::vector<std::uint64_t> &key) const;
+   /// Batched version of GetFirstEntryNumber(): `keys` is a sequence of keys, one value per key field each.  Returns
+   /// the smallest entry number or kInvalidNTupleIndex for every key.
+   std::vector<NTupleSize_t> GetFirstEntryNumbers(const std::vector<std::uint64_t> &keys) const;
+   /// Returns the entry numbers with the given key in ascending order
+   std::vector<NTupleSize_t> GetAllEntryNumbers(const std::vector<std::uint64_t> &key) const;
+   /// Returns the entry numbers of the keys in the half-open range [firstKey, lastKey), ordered by key
+   std::vector<NTupleSize_t>
+   GetEntryNumbersInRange(const std::vector<std::uint64_t> &firstKey, const std::vector<std::uint64_t> &lastKey) const;
+};
+
+namespace Internal {
+
+// clang-format off
+/**
+\class ROOT::Experimental::Internal::RNTupleJoinTable
+\ingroup NTuple
+\brief Maps the entries of an RNTuple to the entries of a friend RNTuple with the same key
+
+Used by RNTupleReader for friends that are joined on key fields.  The friend entries are looked up with the index of
+the friend RNTuple.  The lookup is batched: the keys of all the entries of a cluster are read and looked up at once.
+The entry mappings of the most recently used clusters are kept, such that reading entries in order or jumping between
+a few clusters does not repeat the lookup.
+*/
+// clang-format on
+class RNTupleJoinTable {
+public:
+   /// The number of clusters whose entry mappings are kept
+   static constexpr std::size_t kMaxJoinedClusters = 4;
+
+private:
+   struct RJoinedCluster {
+      NTupleSize_t fFirstEntry = 0;
+      /// The friend entry numbers of the entries [fFirstEntry, fFirstEntry + fEntryNumbers.size())
+      std::vector<NTupleSize_t> fEntryNumbers;
+   };
+
+   std::shared_ptr<const RNTupleIndex> fIndex;
+   std::vector<std::string> fKeyFieldNames;
+   RNTupleKeyReader fKeyReader;
+   /// The sorted first entry numbers of the clusters of the reader, followed by the number of entries
+   std::vector<NTupleSize_t> fClusterBoundaries;
+   /// Ordered from the most recently to the least recently used cluster
+   std::vector<RJoinedCluster> fJoinedClusters;
+   /// Read buffer for the keys of a cluster
+   std::vector<std::uint64_t> fKeys;
+
+public:
+   /// The key fields are the fields of `reader` whose values are looked up in the index of the friend
+   RNTupleJoinTable(std::shared_ptr<const RNTupleIndex> index, const std::vector<std::string> &keyFieldNames,
+                    RNTupleReader &reader);
+   /// Creates a join table with the same index and key fields for a clone of the reader
+   std::unique_ptr<RNTupleJoinTable> Clone(RNTupleReader &reader) const;
+
+   /// Returns the friend entry number with the same key as the given entry, or kInvalidNTupleIndex if the friend
+   /// has no such entry.  For several friend entries with the same key, the smallest entry number is returned.
+   NTupleSize_t GetEntryNumber(NTupleSize_t entry);
+};
+
+} // namespace Internal
+} // namespace Experimental
+} // namespace ROOT
+
+#endif
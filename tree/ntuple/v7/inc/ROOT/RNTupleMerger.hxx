@@ -19,10 +19,19 @@
 #include <ROOT/RError.hxx>
 #include <ROOT/RNTupleDescriptor.hxx>
 #include <ROOT/RNTupleUtil.hxx>
+#include <ROOT/RSpan.hxx>
+
+#include <string>
+#include <vector>
 
 namespace ROOT {
 namespace Experimental {
 
+namespace Detail {
+class RPageSink;
+class RPageSource;
+} // namespace Detail
+
 // clang-format off
 /**
 \class ROOT::Experimental::RFieldMerger
@@ -38,6 +47,31 @@ public:
    static RResult<RFieldMerger> Merge(const RFieldDescriptor &lhs, const RFieldDescriptor &rhs);
 };
 
+namespace Internal {
+
+// clang-format off
+/**
+\class ROOT::Experimental::Internal::RNTupleMerger
+\ingroup NTuple
+\brief Concatenates the entries of several ntuples with identical schema into a single ntuple
+
+The merger copies the sealed pages of the sources to the destination without unpacking them.  Pages are decompressed
+and recompressed only if the compression settings of the source column differ from the compression settings of the
+destination sink.  Every source becomes one cluster group in the destination; the source clusters are preserved.
+*/
+// clang-format on
+class RNTupleMerger {
+public:
+   /// Merges the given sources into the destination.  The destination must not be created yet; it is created with
+   /// the schema of the first source.  Throws an RException if the schemas of the sources are not identical.
+   /// If fieldNames is not empty, only the given top-level fields, including their subfields, are merged; the
+   /// schemas of the sources then only need to agree on these fields.
+   void Merge(std::span<Detail::RPageSource *> sources, Detail::RPageSink &destination,
+              const std::vector<std::string> &fieldNames = {});
+};
+
+} // namespace Internal
+
 } // namespace Experimental
 } // namespace ROOT
 
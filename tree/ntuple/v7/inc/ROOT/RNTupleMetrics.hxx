@@ -321,6 +321,10 @@ public:
 
    void ObserveMetrics(RNTupleMetrics &observee);
 
+   /// Calls `fnVisit` with the fully qualified name, e.g. "RNTupleReader.RPageSourceFile.nReadV", for every counter
+   /// of this object and of the observed sub metrics
+   void VisitCounters(const std::function<void(const std::string &, const RNTuplePerfCounter &)> &fnVisit,
+                      const std::string &prefix = "") const;
    void Print(std::ostream &output, const std::string &prefix = "") const;
    void Enable();
    bool IsEnabled() const { return fIsEnabled; }
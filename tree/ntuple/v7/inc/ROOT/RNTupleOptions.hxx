@@ -60,10 +60,31 @@ protected:
    /// fApproxUnzippedPageSize in size and tail pages (the last page in a cluster) is between
    /// fApproxUnzippedPageSize/2 and fApproxUnzippedPageSize * 1.5 in size.
    std::size_t fApproxUnzippedPageSize = 64 * 1024;
+   /// If non-zero, the page size is tuned per column such that compressed pages are approximately
+   /// fApproxZippedPageSize in size.  After every cluster, the number of elements per page of a column is adjusted
+   /// according to the compression ratio observed so far for that column; fApproxUnzippedPageSize is used as the
+   /// initial page size.  Adaptive page sizes require buffered writing.
+   std::size_t fApproxZippedPageSize = 0;
+   /// Upper limit for the uncompressed size of pages whose size is tuned according to fApproxZippedPageSize.  Limits
+   /// the size of the write buffers of well-compressible columns.
+   std::size_t fMaxUnzippedPageSize = 1024 * 1024;
+   /// If non-zero, buffered writing holds at most approximately fPageBufferBudget bytes of pages in memory.  Once the
+   /// buffered pages of the open cluster exceed the budget, their sealed versions are written to storage right away
+   /// instead of at the end of the cluster, so that the writer memory does not grow with the cluster size.
+   std::size_t fPageBufferBudget = 0;
+   /// If set, buffered writing seals (compresses) every page as soon as it is committed, also without implicit
+   /// multi-threading.  Compression then happens before the cluster is committed, at the cost of keeping both the
+   /// uncompressed and the compressed copy of the buffered pages in memory.  Otherwise, without a task scheduler, the
+   /// buffered pages are sealed one by one when the cluster is committed.
+   bool fSealPagesEagerly = false;
    bool fUseBufferedWrite = true;
    /// If set, 64bit index columns are replaced by 32bit index columns. This limits the cluster size to 512MB
    /// but it can result in smaller file sizes for data sets with many collections and lz4 or no compression.
    bool fHasSmallClusters = false;
+   /// If set, the page lists store the minimum, the maximum, and the number of NaN values of every page of numeric
+   /// columns.  Readers can use the statistics to skip clusters and pages.  When appending to an existing ntuple,
+   /// the setting of the existing ntuple is kept.
+   bool fHasPageStatistics = false;
 
 public:
    /// A maximum size of 512MB still allows for a vector of bool to be stored in a small cluster.  This is the
@@ -92,11 +113,28 @@ public:
    std::size_t GetApproxUnzippedPageSize() const { return fApproxUnzippedPageSize; }
    void SetApproxUnzippedPageSize(std::size_t val);
 
+   std::size_t GetApproxZippedPageSize() const { return fApproxZippedPageSize; }
+   /// Setting a value of zero turns off adaptive page sizes
+   void SetApproxZippedPageSize(std::size_t val) { fApproxZippedPageSize = val; }
+
+   std::size_t GetMaxUnzippedPageSize() const { return fMaxUnzippedPageSize; }
+   void SetMaxUnzippedPageSize(std::size_t val);
+
+   std::size_t GetPageBufferBudget() const { return fPageBufferBudget; }
+   /// Setting a value of zero buffers all the pages of a cluster until the cluster is committed
+   void SetPageBufferBudget(std::size_t val) { fPageBufferBudget = val; }
+
+   bool GetSealPagesEagerly() const { return fSealPagesEagerly; }
+   void SetSealPagesEagerly(bool val) { fSealPagesEagerly = val; }
+
    bool GetUseBufferedWrite() const { return fUseBufferedWrite; }
    void SetUseBufferedWrite(bool val) { fUseBufferedWrite = val; }
 
    bool GetHasSmallClusters() const { return fHasSmallClusters; }
    void SetHasSmallClusters(bool val) { fHasSmallClusters = val; }
+
+   bool GetHasPageStatistics() const { return fHasPageStatistics; }
+   void SetHasPageStatistics(bool val) { fHasPageStatistics = val; }
 };
 
 // clang-format off
@@ -151,12 +189,24 @@ public:
 private:
    EClusterCache fClusterCache = EClusterCache::kDefault;
    unsigned int fClusterBunchSize = 1;
+   bool fUseSharedPageCache = false;
+   bool fUseMmap = false;
 
 public:
    EClusterCache GetClusterCache() const { return fClusterCache; }
    void SetClusterCache(EClusterCache val) { fClusterCache = val; }
    unsigned int GetClusterBunchSize() const  { return fClusterBunchSize; }
    void SetClusterBunchSize(unsigned int val) { fClusterBunchSize = val; }
+   bool GetUseSharedPageCache() const { return fUseSharedPageCache; }
+   /// If set, decompressed pages are taken from and added to the process-wide RSharedPageCache, such that readers
+   /// of the same ntuple do not decompress the same pages twice.  The size of the cache is set through
+   /// RSharedPageCache::Get().SetMaxBytes().
+   void SetUseSharedPageCache(bool val) { fUseSharedPageCache = val; }
+   bool GetUseMmap() const { return fUseMmap; }
+   /// If set, local files are memory mapped instead of read.  Pages that are neither compressed nor packed, e.g.
+   /// pages of uncompressed float or double columns, are then used in place without copying.  Ignored for files
+   /// that do not support memory mapping, e.g. remote files.
+   void SetUseMmap(bool val) { fUseMmap = val; }
 };
 
 } // namespace Experimental
@@ -0,0 +1,115 @@
+/// \file ROOT/RNTupleParallelWriter.hxx
+/// \ingroup NTuple ROOT7
+/// \date 2023-04-18
+/// \warning This is part of the ROOT 7 prototype! It will change without notice. It might trigger earthquakes. Feedback
+/// is welcome!
+
+/*************************************************************************
+ * Copyright (C) 1995-2023, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT7_RNTupleParallelWriter
+#define ROOT7_RNTupleParallelWriter
+
+#include <ROOT/RNTupleMetrics.hxx>
+#include <ROOT/RNTupleOptions.hxx>
+#include <ROOT/RStringView.hxx>
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+class TFile;
+
+namespace ROOT {
+namespace Experimental {
+
+namespace Detail {
+class RPageSink;
+} // namespace Detail
+
+class RNTupleFillContext;
+class RNTupleModel;
+
+// clang-format off
+/**
+\class ROOT::Experimental::RNTupleParallelWriter
+\ingroup NTuple
+\brief A writer to fill an RNTuple from multiple threads.
+
+Instead of directly filling entries, the parallel writer hands out fill contexts (RNTupleFillContext).  Every thread
+should use its own fill context, which has its own clone of the model, its own entries, and its own page buffers.
+Each fill context serializes and compresses its clusters independently; only committing a finished cluster to the
+shared page sink is serialized across threads.  Thus, the order of the clusters on storage, and hence the order of
+the entries, depends on the order in which the fill contexts commit their clusters.
+
+All fill contexts must be destroyed before the parallel writer.  On destruction, the parallel writer commits the
+clusters of all the fill contexts in a single cluster group and writes the ntuple footer.
+
+~~~ {.cpp}
+#include <ROOT/RNTuple.hxx>
+#include <ROOT/RNTupleModel.hxx>
+#include <ROOT/RNTupleParallelWriter.hxx>
+using ROOT::Experimental::RNTupleModel;
+using ROOT::Experimental::RNTupleParallelWriter;
+
+auto model = RNTupleModel::Create();
+model->MakeField<float>("pt");
+auto writer = RNTupleParallelWriter::Recreate(std::move(model), "myNTuple", "some/file.root");
+// In every thread:
+{
+   auto fillContext = writer->CreateFillContext();
+   auto entry = fillContext->CreateEntry();
+   *entry->Get<float>("pt") = 42.0;
+   fillContext->Fill(*entry);
+}
+~~~
+*/
+// clang-format on
+class RNTupleParallelWriter {
+private:
+   /// A global mutex to protect the internal data structures of this object and the shared page sink
+   std::mutex fMutex;
+   /// The final sink that writes the data to storage
+   std::unique_ptr<Detail::RPageSink> fSink;
+   /// The original model, cloned for every fill context.  Needs to be destructed before fSink.
+   std::unique_ptr<RNTupleModel> fModel;
+   Detail::RNTupleMetrics fMetrics;
+   /// List of all created fill contexts; used to verify that they are destroyed before the writer
+   std::vector<std::weak_ptr<RNTupleFillContext>> fFillContexts;
+
+   RNTupleParallelWriter(std::unique_ptr<RNTupleModel> model, std::unique_ptr<Detail::RPageSink> sink);
+
+public:
+   /// Recreate a new file and return a writer to write an ntuple.  Throws an exception if the model is null or
+   /// if the write options disable buffered writing.
+   static std::unique_ptr<RNTupleParallelWriter> Recreate(std::unique_ptr<RNTupleModel> model,
+                                                          std::string_view ntupleName, std::string_view storage,
+                                                          const RNTupleWriteOptions &options = RNTupleWriteOptions());
+   /// Append an ntuple to the existing file, which must not be accessed while data is filled into any created
+   /// fill context.  Throws an exception if the model is null or if the write options disable buffered writing.
+   static std::unique_ptr<RNTupleParallelWriter> Append(std::unique_ptr<RNTupleModel> model,
+                                                        std::string_view ntupleName, TFile &file,
+                                                        const RNTupleWriteOptions &options = RNTupleWriteOptions());
+
+   RNTupleParallelWriter(const RNTupleParallelWriter &) = delete;
+   RNTupleParallelWriter &operator=(const RNTupleParallelWriter &) = delete;
+   ~RNTupleParallelWriter();
+
+   /// Create a new fill context that can be used to fill entries from a single thread.  This method is thread-safe.
+   std::shared_ptr<RNTupleFillContext> CreateFillContext();
+
+   void EnableMetrics() { fMetrics.Enable(); }
+   const Detail::RNTupleMetrics &GetMetrics() const { return fMetrics; }
+
+   const RNTupleModel *GetModel() const { return fModel.get(); }
+};
+
+} // namespace Experimental
+} // namespace ROOT
+
+#endif
@@ -0,0 +1,167 @@
+/// \file ROOT/RNTupleReadProfile.hxx
+/// \ingroup NTuple ROOT7
+/// \date 2024-02-12
+/// \warning This is part of the ROOT 7 prototype! It will change without notice. It might trigger earthquakes. Feedback
+/// is welcome!
+
+/*************************************************************************
+ * Copyright (C) 1995-2024, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT7_RNTupleReadProfile
+#define ROOT7_RNTupleReadProfile
+
+#include <ROOT/RNTupleUtil.hxx>
+
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace ROOT {
+namespace Experimental {
+namespace Detail {
+
+class RNTupleMetrics;
+
+// clang-format off
+/**
+\class ROOT::Experimental::Detail::RNTupleReadProfile
+\ingroup NTuple
+\brief Per-column and per-cluster read statistics of a page source
+
+The profile complements the aggregate counters of the page source metrics.  For every physical column, it records the
+number of unsealed pages, their size on storage and in memory, and the time spent in decompressing and in unpacking
+them, i.e. in deserializing the column elements into their in-memory representation.  For every cluster, it records
+the time span and the busy time of reading, decompressing, and unpacking its pages, which gives a timeline of I/O wait
+versus decompression versus deserialization.
+
+The page source only records into the profile if its metrics are enabled.  Recording is thread-safe.
+*/
+// clang-format on
+class RNTupleReadProfile {
+public:
+   using Clock_t = std::chrono::steady_clock;
+
+   enum class EPhase {
+      kRead,
+      kUnzip,
+      kUnpack
+   };
+
+   struct RColumnStats {
+      std::uint64_t fNPages = 0;
+      std::uint64_t fSzOnStorage = 0;
+      std::uint64_t fSzUnzip = 0;
+      /// In nanoseconds
+      std::uint64_t fTimeUnzip = 0;
+      /// In nanoseconds
+      std::uint64_t fTimeUnpack = 0;
+   };
+
+   /// The activity of a processing phase for a given cluster.  Times are in nanoseconds since the creation of the
+   /// profile.  Because pages can be decompressed in parallel, the busy time can exceed the time span.
+   struct RClusterPhase {
+      DescriptorId_t fClusterId = kInvalidDescriptorId;
+      EPhase fPhase = EPhase::kRead;
+      std::uint64_t fStart = 0;
+      std::uint64_t fEnd = 0;
+      std::uint64_t fBusy = 0;
+   };
+
+private:
+   Clock_t::time_point fStartTime;
+   mutable std::mutex fLock;
+   std::map<DescriptorId_t, RColumnStats> fColumnStats;
+   std::map<std::pair<DescriptorId_t, EPhase>, RClusterPhase> fClusterPhases;
+
+   std::uint64_t GetTimestamp(Clock_t::time_point timePoint) const;
+   /// Must be called with the lock held
+   void AddClusterActivityUnlocked(DescriptorId_t clusterId, EPhase phase, Clock_t::time_point start,
+                                   Clock_t::time_point end, std::uint64_t busy);
+
+public:
+   RNTupleReadProfile() : fStartTime(Clock_t::now()) {}
+   RNTupleReadProfile(const RNTupleReadProfile &other) = delete;
+   RNTupleReadProfile &operator=(const RNTupleReadProfile &other) = delete;
+   ~RNTupleReadProfile() = default;
+
+   static const char *GetPhaseName(EPhase phase);
+
+   /// Records a page that was decompressed between `start` and `unzipped` and unpacked between `unzipped` and `end`.
+   /// If the cluster id is valid, the activity is also added to the cluster timeline.
+   void AddUnsealedPage(DescriptorId_t physicalColumnId, DescriptorId_t clusterId, std::uint64_t szOnStorage,
+                        std::uint64_t szUnzip, Clock_t::time_point start, Clock_t::time_point unzipped,
+                        Clock_t::time_point end);
+   /// Adds an activity of the given phase to the cluster timeline
+   void AddClusterActivity(DescriptorId_t clusterId, EPhase phase, Clock_t::time_point start, Clock_t::time_point end);
+   /// Adds a single vector read of several clusters to their timelines.  The time span of the read is attributed to
+   /// all the clusters; the busy time is divided in proportion to the number of bytes read for each cluster.
+   void AddVectorRead(const std::vector<DescriptorId_t> &clusterIds, const std::vector<std::uint64_t> &nBytes,
+                      Clock_t::time_point start, Clock_t::time_point end);
+
+   std::map<DescriptorId_t, RColumnStats> GetColumnStats() const;
+   /// Returns the cluster timeline ordered by start time
+   std::vector<RClusterPhase> GetClusterPhases() const;
+};
+
+// clang-format off
+/**
+\class ROOT::Experimental::Detail::RNTupleReadReport
+\ingroup NTuple
+\brief A machine-readable snapshot of the performance counters and the read profile of a page source
+
+Reports are created by RPageSource::GetReadReport() and can be printed as JSON or as CSV.  The CSV output is in
+long format, with one value per line: counters, per-column statistics, and the start, end, and busy time of every
+cluster phase.
+*/
+// clang-format on
+struct RNTupleReadReport {
+   enum class EFormat {
+      kJSON,
+      kCSV
+   };
+
+   struct RCounter {
+      std::string fName;
+      std::string fUnit;
+      std::string fDescription;
+      /// NaN if the counter has no valid value
+      double fValue = 0.0;
+   };
+
+   struct RColumn {
+      DescriptorId_t fPhysicalColumnId = kInvalidDescriptorId;
+      std::string fFieldName;
+      std::string fColumnType;
+      RNTupleReadProfile::RColumnStats fStats;
+   };
+
+   std::string fNTupleName;
+   /// The file or the object store of the ntuple, if known
+   std::string fLocation;
+   std::vector<RCounter> fCounters;
+   std::vector<RColumn> fColumns;
+   std::vector<RNTupleReadProfile::RClusterPhase> fClusterPhases;
+
+   /// Replaces the counters by the current values of all the counters of the given metrics
+   void SetCounters(const RNTupleMetrics &metrics);
+   /// Prints a JSON object or the CSV lines of this report
+   void Print(std::ostream &output, EFormat format) const;
+   /// Prints a JSON array of the reports or the CSV lines of all the reports with a single header line
+   static void Print(const std::vector<RNTupleReadReport> &reports, std::ostream &output, EFormat format);
+};
+
+} // namespace Detail
+} // namespace Experimental
+} // namespace ROOT
+
+#endif
@@ -65,6 +65,10 @@ public:
    static constexpr std::uint32_t kFlagSortDesColumn     = 0x02;
    static constexpr std::uint32_t kFlagNonNegativeColumn = 0x04;
    static constexpr std::uint32_t kFlagDeferredColumn    = 0x08;
+   static constexpr std::uint32_t kFlagHasValueRange     = 0x10;
+
+   /// Footer feature flag (first 64bit word): the page lists contain a page statistics block for every column
+   static constexpr std::int64_t kFeatureFlagPageStatistics = 0x01;
 
    static constexpr DescriptorId_t kZeroFieldId = std::uint64_t(-2);
 
@@ -189,6 +193,9 @@ public:
    static std::uint32_t SerializeUInt64(std::uint64_t val, void *buffer);
    static std::uint32_t DeserializeUInt64(const void *buffer, std::uint64_t &val);
 
+   static std::uint32_t SerializeDouble(double val, void *buffer);
+   static std::uint32_t DeserializeDouble(const void *buffer, double &val);
+
    static std::uint32_t SerializeString(const std::string &val, void *buffer);
    static RResult<std::uint32_t> DeserializeString(const void *buffer, std::uint32_t bufSize, std::string &val);
 
@@ -254,10 +261,12 @@ public:
    static RResult<void> DeserializeFooterV1(const void *buffer,
                                             std::uint32_t bufSize,
                                             RNTupleDescriptorBuilder &descBuilder);
-   // The clusters vector must be initialized with the cluster summaries corresponding to the page list
+   // The clusters vector must be initialized with the cluster summaries corresponding to the page list.
+   // The hasPageStatistics argument is taken from the footer feature flags, see RNTupleDescriptor::HasPageStatistics()
    static RResult<void> DeserializePageListV1(const void *buffer,
                                               std::uint32_t bufSize,
-                                              std::vector<RClusterDescriptorBuilder> &clusters);
+                                              std::vector<RClusterDescriptorBuilder> &clusters,
+                                              bool hasPageStatistics);
 }; // class RNTupleSerializer
 
 } // namespace Internal
@@ -130,6 +130,38 @@ public:
    ClusterSize_t::ValueType GetIndex() const { return fIndex; }
 };
 
+/// Summary of the values of a numeric column in a page or in a cluster, used to skip data that cannot match a
+/// selection.  The range is given as the values are represented on storage, i.e. after a possibly lossy packing.
+/// NaN values do not contribute to the range; they are counted separately.  If all the values are NaN, the range
+/// is empty, i.e. fMin is larger than fMax.
+struct RValueStatistics {
+   double fMin = 0.0;
+   double fMax = 0.0;
+   std::uint64_t fNNaN = 0;
+
+   bool operator==(const RValueStatistics &other) const
+   {
+      return fMin == other.fMin && fMax == other.fMax && fNNaN == other.fNNaN;
+   }
+   bool operator!=(const RValueStatistics &other) const { return !(*this == other); }
+   /// Whether there are non-NaN values in the range
+   bool HasRange() const { return fMin <= fMax; }
+   /// Widens the range and the NaN count to cover the values summarized by `other`
+   void Merge(const RValueStatistics &other)
+   {
+      if (other.HasRange()) {
+         if (HasRange()) {
+            fMin = (other.fMin < fMin) ? other.fMin : fMin;
+            fMax = (other.fMax > fMax) ? other.fMax : fMax;
+         } else {
+            fMin = other.fMin;
+            fMax = other.fMax;
+         }
+      }
+      fNNaN += other.fNNaN;
+   }
+};
+
 /// RNTupleLocator payload that is common for object stores using 64bit location information.
 /// This might not contain the full location of the content. In particular, for page locators this information may be
 /// used in conjunction with the cluster and column ID.
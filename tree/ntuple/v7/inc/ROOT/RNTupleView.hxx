@@ -18,13 +18,16 @@
 
 #include <ROOT/RField.hxx>
 #include <ROOT/RNTupleUtil.hxx>
+#include <ROOT/RSpan.hxx>
 #include <ROOT/RStringView.hxx>
 
+#include <algorithm>
 #include <iterator>
 #include <memory>
 #include <type_traits>
 #include <utility>
 #include <unordered_map>
+#include <vector>
 
 namespace ROOT {
 namespace Experimental {
@@ -135,6 +138,9 @@ accessed by index. For top-level fields, the index refers to the entry number. F
 nested collections have global index numbers that are derived from their parent indexes.
 
 Fields of simple types with a Map() method will use that and thus expose zero-copy access.
+
+Consecutive values of the same cluster can be read at once with ReadBulk(), which avoids the per-value overhead
+of operator().
 */
 // clang-format on
 template <typename T>
@@ -148,6 +154,11 @@ private:
    FieldT fField;
    /// Used as a Read() destination for fields that are not mappable
    Detail::RFieldBase::RValue fValue;
+   /// Created on the first call to ReadBulk() that cannot map the values
+   std::unique_ptr<Detail::RFieldBase::RBulk> fBulk;
+   /// The request mask passed to fBulk; all values of a bulk are requested
+   std::unique_ptr<bool[]> fBulkMask;
+   std::size_t fBulkMaskSize = 0;
 
 public:
    using FieldTypeT = T;
@@ -209,6 +220,49 @@ public:
    {
       return fField.MapV(clusterIndex, nItems);
    }
+
+   /// Reads `size` consecutive values starting at `clusterIndex`; the range must not cross a cluster boundary.
+   /// For mappable types, the values are returned without copying if the range is within a single page.
+   /// Otherwise, the values are read into an array owned by the view using the bulk read of the field, which
+   /// copies simple types page-wise and reads the items of vectors of simple types in one go.
+   /// The returned span is valid until the next call to ReadBulk().
+   std::span<const T> ReadBulk(const RClusterIndex &clusterIndex, std::size_t size)
+   {
+      if (size == 0)
+         return std::span<const T>();
+
+      if constexpr (Internal::isMappable<FieldT>) {
+         NTupleSize_t nItems;
+         const T *values = fField.MapV(clusterIndex, nItems);
+         if (nItems >= size)
+            return std::span<const T>(values, size);
+      }
+
+      if (!fBulk)
+         fBulk = std::make_unique<Detail::RFieldBase::RBulk>(fField.GenerateBulk());
+      if (fBulkMaskSize < size) {
+         fBulkMask = std::make_unique<bool[]>(size);
+         std::fill(fBulkMask.get(), fBulkMask.get() + size, true);
+         fBulkMaskSize = size;
+      }
+      return std::span<const T>(static_cast<const T *>(fBulk->ReadBulk(clusterIndex, fBulkMask.get(), size)), size);
+   }
+};
+
+// clang-format off
+/**
+\class ROOT::Experimental::RNTupleCollectionBulk
+\ingroup NTuple
+\brief The result of a bulk read of collections with RNTupleViewCollection::ReadBulk()
+
+The items of the collection `i` are `fItems[fOffsets[i]], ..., fItems[fOffsets[i + 1] - 1]`, i.e. fOffsets has one
+more element than the number of collections read.
+*/
+// clang-format on
+template <typename T>
+struct RNTupleCollectionBulk {
+   std::span<const ClusterSize_t::ValueType> fOffsets;
+   std::span<const T> fItems;
 };
 
 
@@ -225,6 +279,8 @@ class RNTupleViewCollection : public RNTupleView<ClusterSize_t> {
 private:
    Detail::RPageSource* fSource;
    DescriptorId_t fCollectionFieldId;
+   /// Memory for the offsets returned by ReadBulk()
+   std::vector<ClusterSize_t::ValueType> fBulkOffsets;
 
    RNTupleViewCollection(DescriptorId_t fieldId, Detail::RPageSource* source)
       : RNTupleView<ClusterSize_t>(fieldId, source)
@@ -274,6 +330,33 @@ public:
       return RNTupleViewCollection(fieldId, fSource);
    }
 
+   /// Reads the offsets of the collection field
+   using RNTupleView<ClusterSize_t>::ReadBulk;
+
+   /// Reads `size` consecutive collections starting at `clusterIndex` together with their items, which are read
+   /// through `itemView`.  The item view must belong to a sub field of this collection, e.g. obtained by GetView().
+   /// The items are returned as a single contiguous array, without copying if they are mappable and on a single page.
+   /// The returned spans are valid until the next call to ReadBulk() of this view and of the item view.
+   template <typename T>
+   RNTupleCollectionBulk<T> ReadBulk(RNTupleView<T> &itemView, const RClusterIndex &clusterIndex, std::size_t size)
+   {
+      fBulkOffsets.assign(1, 0);
+      if (size == 0)
+         return RNTupleCollectionBulk<T>{std::span<const ClusterSize_t::ValueType>(fBulkOffsets), std::span<const T>()};
+
+      ClusterSize_t firstSize;
+      RClusterIndex collectionStart;
+      fField.GetCollectionInfo(clusterIndex, &collectionStart, &firstSize);
+      // The offset column stores the cluster-local end index of the items of every collection
+      const auto offsets = RNTupleView<ClusterSize_t>::ReadBulk(clusterIndex, size);
+      fBulkOffsets.resize(size + 1);
+      for (std::size_t i = 0; i < size; ++i)
+         fBulkOffsets[i + 1] = offsets[i] - collectionStart.GetIndex();
+
+      return RNTupleCollectionBulk<T>{std::span<const ClusterSize_t::ValueType>(fBulkOffsets),
+                                      itemView.ReadBulk(collectionStart, fBulkOffsets[size])};
+   }
+
    ClusterSize_t operator()(NTupleSize_t globalIndex) {
       ClusterSize_t size;
       RClusterIndex collectionStart;
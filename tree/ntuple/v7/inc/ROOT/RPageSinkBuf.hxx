@@ -36,6 +36,11 @@ namespace Detail {
 \ingroup NTuple
 \brief Wrapper sink that coalesces cluster column page writes
 *
+* By default, all the pages of a cluster are kept in memory until the cluster is committed.  If a page buffer budget
+* is set in the write options, the sealed pages are handed over to the inner sink whenever the buffered pages exceed
+* the budget.  The pages of a cluster are then written in several consecutive batches; as usual, their locations are
+* only serialized with the page list of the cluster group.
+*
 * TODO(jblomer): The interplay of derived class and RPageSink is not yet optimally designed for page storage wrapper
 * classes like this one. Header and footer serialization, e.g., are done twice.  To be revised.
 */
@@ -104,6 +109,35 @@ private:
          return fSealedPages.emplace_back();
       }
 
+      /// Adds the compressed and uncompressed sizes of the buffered sealed pages to the sizes of the open cluster.
+      /// Must be called before the sealed pages are handed over to the inner sink and dropped.
+      void AddSealedPagesToCluster()
+      {
+         if (fSealedPages.empty())
+            return;
+         const std::uint64_t elementSize = fCol.fColumn->GetElement()->GetSize();
+         for (const auto &sealedPage : fSealedPages) {
+            fNBytesZippedCluster += sealedPage.fSize;
+            fNBytesUnzippedCluster += sealedPage.fNElements * elementSize;
+         }
+      }
+      std::uint64_t GetNBytesZippedCluster() const { return fNBytesZippedCluster; }
+      std::uint64_t GetNBytesUnzippedCluster() const { return fNBytesUnzippedCluster; }
+      void ResetClusterSizes()
+      {
+         fNBytesZippedCluster = 0;
+         fNBytesUnzippedCluster = 0;
+      }
+
+      /// Adds the compressed and uncompressed sizes of the pages of a cluster to the column totals and returns the
+      /// compression ratio (compressed size / uncompressed size) observed so far
+      double UpdateCompressionRatio(std::uint64_t nBytesZipped, std::uint64_t nBytesUnzipped)
+      {
+         fNBytesZipped += nBytesZipped;
+         fNBytesUnzipped += nBytesUnzipped;
+         return static_cast<double>(fNBytesZipped) / static_cast<double>(fNBytesUnzipped);
+      }
+
    private:
       RPageStorage::ColumnHandle_t fCol;
       /// Using a deque guarantees that element iterators are never invalidated
@@ -114,12 +148,24 @@ private:
       /// Note that each RSealedPage refers to the same buffer as `fBufferedPages[i].fBuf` for some value of `i`, and
       /// thus owned by RPageZipItem
       RPageStorage::SealedPageSequence_t fSealedPages;
+      /// Sum of the compressed sizes of the pages of the open cluster that have been passed to the inner sink
+      std::uint64_t fNBytesZippedCluster = 0;
+      /// Sum of the uncompressed sizes of the pages of the open cluster that have been passed to the inner sink
+      std::uint64_t fNBytesUnzippedCluster = 0;
+      /// Sum of the compressed sizes of the pages committed so far; used for adaptive page sizes
+      std::uint64_t fNBytesZipped = 0;
+      /// Sum of the uncompressed (in-memory) sizes of the pages committed so far
+      std::uint64_t fNBytesUnzipped = 0;
    };
 
 private:
    /// I/O performance counters that get registered in fMetrics
    struct RCounters {
       RNTuplePlainCounter &fParallelZip;
+      RNTupleAtomicCounter &fTimeWallZip;
+      RNTupleTickCounter<RNTupleAtomicCounter> &fTimeCpuZip;
+      RNTuplePlainCounter &fNPartialCommit;
+      RNTuplePlainCounter &fSzBufferedPeak;
    };
    std::unique_ptr<RCounters> fCounters;
    RNTupleMetrics fMetrics;
@@ -130,6 +176,20 @@ private:
    std::unique_ptr<RNTupleModel> fInnerModel;
    /// Vector of buffered column pages. Indexed by column id.
    std::vector<RColumnBuf> fBufferedColumns;
+   /// Memory held by the buffered pages and their compression buffers
+   std::size_t fNBytesBuffered = 0;
+
+   /// Seals the page of the given zip item into its own buffer and registers the sealed page with the column
+   void SealZipItem(RColumnBuf::RPageZipItem &zipItem, RSealedPage &sealedPage, const RColumnElementBase &element);
+   /// Hands the buffered pages of all the columns over to the inner sink and drops them.  If all the buffered pages are
+   /// sealed, they are committed in a single `CommitSealedPageV()` call.  The caller must hold the guard of the inner
+   /// sink.
+   void CommitBufferedPages();
+   /// Commits the buffered pages of the open cluster if they exceed the page buffer budget of the write options
+   void CommitBufferedPagesIfOverBudget();
+   /// Called after committing a cluster if adaptive page sizes are turned on in the write options.  Adjusts the
+   /// number of elements per page of the buffered columns to approach the target compressed page size.
+   void AdaptPageSizes();
 
 protected:
    void CreateImpl(const RNTupleModel &model, unsigned char *serializedHeader, std::uint32_t length) final;
@@ -138,6 +198,7 @@ protected:
    std::uint64_t CommitClusterImpl(NTupleSize_t nEntries) final;
    RNTupleLocator CommitClusterGroupImpl(unsigned char *serializedPageList, std::uint32_t length) final;
    void CommitDatasetImpl(unsigned char *serializedFooter, std::uint32_t length) final;
+   void LoadExistingImpl(const RNTupleModel &model) final;
 
 public:
    explicit RPageSinkBuf(std::unique_ptr<RPageSink> inner);
@@ -147,6 +208,7 @@ public:
    RPageSinkBuf& operator=(RPageSinkBuf&&) = default;
    ~RPageSinkBuf() override;
 
+   bool IsUpdate() const final { return fInnerSink->IsUpdate(); }
    void UpdateSchema(const RNTupleModelChangeset &changeset, NTupleSize_t firstEntry) final;
    RPage ReservePage(ColumnHandle_t columnHandle, std::size_t nElements) final;
    void ReleasePage(RPage &page) final;
@@ -34,6 +34,11 @@ namespace Detail {
 \class ROOT::Experimental::Detail::RPageSourceFriends
 \ingroup NTuple
 \brief Virtual storage that combines several other sources horizontally
+
+Sources can be marked as joined.  The entries of a joined source do not correspond to the entries of the first source;
+instead, the reader maps every entry to the entry of the joined source with the same key (see RNTupleJoinTable).
+Joined sources can have any number of entries.  Their clusters are not part of the virtual descriptor, whose number of
+entries is the one of the first source, but their pages are served by the virtual source as usual.
 */
 // clang-format on
 class RPageSourceFriends final : public RPageSource {
@@ -75,6 +80,8 @@ private:
 
    RNTupleMetrics fMetrics;
    std::vector<std::unique_ptr<RPageSource>> fSources;
+   /// For every source, whether its entries are joined by key rather than by entry number
+   std::vector<bool> fIsJoined;
    RIdBiMap fIdBiMap;
 
    RNTupleDescriptorBuilder fBuilder;
@@ -88,6 +95,9 @@ protected:
 
 public:
    RPageSourceFriends(std::string_view ntupleName, std::span<std::unique_ptr<RPageSource>> sources);
+   /// The `isJoined` flags have one element per source; the first source cannot be joined
+   RPageSourceFriends(std::string_view ntupleName, std::span<std::unique_ptr<RPageSource>> sources,
+                      const std::vector<bool> &isJoined);
 
    std::unique_ptr<RPageSource> Clone() const final;
    ~RPageSourceFriends() final;
@@ -20,6 +20,7 @@
 #include <ROOT/RNTupleDescriptor.hxx>
 #include <ROOT/RNTupleMetrics.hxx>
 #include <ROOT/RNTupleOptions.hxx>
+#include <ROOT/RNTupleReadProfile.hxx>
 #include <ROOT/RNTupleUtil.hxx>
 #include <ROOT/RPage.hxx>
 #include <ROOT/RPageAllocator.hxx>
@@ -31,6 +32,8 @@
 #include <deque>
 #include <functional>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <shared_mutex>
 #include <unordered_set>
 #include <vector>
@@ -88,6 +91,8 @@ public:
       const void *fBuffer = nullptr;
       std::uint32_t fSize = 0;
       std::uint32_t fNElements = 0;
+      /// The value range of the elements of the page, set when sealing pages of numeric columns
+      std::optional<RValueStatistics> fStatistics;
 
       RSealedPage() = default;
       RSealedPage(const void *b, std::uint32_t s, std::uint32_t n) : fBuffer(b), fSize(s), fNElements(n) {}
@@ -175,10 +180,38 @@ up to the given entry number are committed.
 */
 // clang-format on
 class RPageSink : public RPageStorage {
+public:
+   /// An RAII wrapper used to synchronize a page sink. See GetSinkGuard().
+   class RSinkGuard {
+      std::mutex *fLock;
+
+   public:
+      explicit RSinkGuard(std::mutex *lock) : fLock(lock)
+      {
+         if (fLock != nullptr) {
+            fLock->lock();
+         }
+      }
+      RSinkGuard(const RSinkGuard &) = delete;
+      RSinkGuard &operator=(const RSinkGuard &) = delete;
+      RSinkGuard(RSinkGuard &&) = delete;
+      RSinkGuard &operator=(RSinkGuard &&) = delete;
+      ~RSinkGuard()
+      {
+         if (fLock != nullptr) {
+            fLock->unlock();
+         }
+      }
+   };
+
 private:
    /// Used to map the IDs of the descriptor to the physical IDs issued during header/footer serialization
    Internal::RNTupleSerializer::RContext fSerializationContext;
 
+   /// Used by Create() for sinks that update an existing ntuple: connects the fields of the model to the fields of the
+   /// existing ntuple and prepares the serialization context and the column ranges for the following clusters.
+   void CreateFromExisting(RNTupleModel &model);
+
 protected:
    /// Default I/O performance counters that get registered in fMetrics
    struct RCounters {
@@ -209,6 +242,9 @@ protected:
    /// Keeps track of the written pages in the currently open cluster. Indexed by column id.
    std::vector<RClusterDescriptor::RPageRange> fOpenPageRanges;
    RNTupleDescriptorBuilder fDescriptorBuilder;
+   /// Whether CommitPage() computes the value statistics of the committed pages.  Sinks that forward the pages to
+   /// another sink, which writes the page list, can skip the computation.
+   bool fComputePageStatistics = true;
 
    virtual void CreateImpl(const RNTupleModel &model, unsigned char *serializedHeader, std::uint32_t length) = 0;
    virtual RNTupleLocator CommitPageImpl(ColumnHandle_t columnHandle, const RPage &page) = 0;
@@ -227,6 +263,10 @@ protected:
    /// Typically, the implementation takes care of compressing and writing the provided buffer.
    virtual RNTupleLocator CommitClusterGroupImpl(unsigned char *serializedPageList, std::uint32_t length) = 0;
    virtual void CommitDatasetImpl(unsigned char *serializedFooter, std::uint32_t length) = 0;
+   /// Called by Create() instead of CreateImpl() if IsUpdate() is true.  Loads the descriptor of the existing ntuple
+   /// into fDescriptorBuilder, including the header checksum and the column ranges of the last cluster.  The default
+   /// implementation throws, page sinks that can update an existing ntuple must override it.
+   virtual void LoadExistingImpl(const RNTupleModel &model);
 
    /// Helper for streaming a page. This is commonly used in derived, concrete page sinks. Note that if
    /// compressionSetting is 0 (uncompressed) and the page is mappable, the returned sealed page will
@@ -269,6 +309,10 @@ public:
    ColumnHandle_t AddColumn(DescriptorId_t fieldId, const RColumn &column) final;
    void DropColumn(ColumnHandle_t /*columnHandle*/) final {}
 
+   /// Whether the sink continues an existing ntuple rather than creating a new one.  In this case, Create() connects
+   /// the fields of the model to the existing fields and columns and the written clusters follow the existing ones.
+   virtual bool IsUpdate() const { return false; }
+
    /// Physically creates the storage container to hold the ntuple (e.g., a keys a TFile or an S3 bucket)
    /// To do so, Create() calls CreateImpl() after updating the descriptor.
    /// Create() associates column handles to the columns referenced by the model
@@ -292,6 +336,15 @@ public:
    void CommitClusterGroup();
    /// Finalize the current cluster and the entrire data set.
    void CommitDataset();
+   /// Returns the number of entries in the so far committed clusters, i.e. the first entry number of the next cluster
+   NTupleSize_t GetNEntriesCommitted() const { return fPrevClusterNEntries; }
+   /// The descriptor of the data written so far; its physical column IDs are the ones expected by CommitSealedPage()
+   const RNTupleDescriptor &GetDescriptor() const { return fDescriptorBuilder.GetDescriptor(); }
+
+   /// Returns a guard that, for the lifetime of the guard, serializes the calls to the page sink across threads.
+   /// The default implementation returns a no-op guard.  Page sinks that are shared between several writers, such as
+   /// the sink of an RNTupleParallelWriter, return a guard that locks the shared sink.
+   virtual RSinkGuard GetSinkGuard() { return RSinkGuard(nullptr); }
 
    /// Get a new, empty page for the given column that can be filled with up to nElements.  If nElements is zero,
    /// the page sink picks an appropriate size.
@@ -359,6 +412,10 @@ public:
 private:
    RNTupleDescriptor fDescriptor;
    mutable std::shared_mutex fDescriptorLock;
+   /// Set once AttachImpl() succeeded; checked without a lock by concurrent calls to Attach()
+   std::atomic<bool> fIsAttached{false};
+   /// Serializes concurrent calls to Attach().  As before, AttachImpl() runs without holding the descriptor lock.
+   std::mutex fAttachLock;
 
 protected:
    /// Default I/O performance counters that get registered in fMetrics
@@ -398,10 +455,14 @@ protected:
    std::unique_ptr<RCounters> fCounters;
    /// Wraps the I/O counters and is observed by the RNTupleReader metrics
    RNTupleMetrics fMetrics;
+   /// Per-column and per-cluster statistics, only recorded if the metrics are enabled
+   RNTupleReadProfile fProfile;
 
    RNTupleReadOptions fOptions;
    /// The active columns are implicitly defined by the model fields or views
    RActivePhysicalColumns fActivePhysicalColumns;
+   /// Physical columns whose pages are not preloaded with the cluster, see SetLazyPhysicalColumns()
+   RCluster::ColumnSet_t fLazyPhysicalColumns;
 
    /// Helper to unzip pages and header/footer; comprises a 16MB (kMAXZIPBUF) unzip buffer.
    /// Not all page sources need a decompressor (e.g. virtual ones for chains and friends don't), thus we
@@ -418,7 +479,10 @@ protected:
    /// The optimization of directly mapping pages is left to the concrete page source implementations.
    /// Usage of this method requires construction of fDecompressor. Memory is allocated via
    /// `RPageAllocatorHeap`; use `RPageAllocatorHeap::DeletePage()` to deallocate returned pages.
-   RPage UnsealPage(const RSealedPage &sealedPage, const RColumnElementBase &element, DescriptorId_t physicalColumnId);
+   /// If the metrics are enabled, the page is recorded in the read profile; the cluster id is optional and adds the
+   /// decompression and unpacking of the page to the cluster timeline.
+   RPage UnsealPage(const RSealedPage &sealedPage, const RColumnElementBase &element, DescriptorId_t physicalColumnId,
+                    DescriptorId_t clusterId = kInvalidDescriptorId);
 
    /// Prepare a page range read for the column set in `clusterKey`.  Specifically, pages referencing the
    /// `kTypePageZero` locator are filled in `pageZeroMap`; otherwise, `perPageFunc` is called for each page. This is
@@ -435,6 +499,13 @@ protected:
    /// GetMetrics() member function.
    void EnableDefaultMetrics(const std::string &prefix);
 
+   /// The active physical columns whose pages are preloaded by the cluster pool, i.e. the ones that are not lazy
+   RCluster::ColumnSet_t GetPreloadColumnSet() const;
+   bool IsLazyPhysicalColumn(DescriptorId_t physicalColumnId) const
+   {
+      return fLazyPhysicalColumns.count(physicalColumnId) > 0;
+   }
+
    /// Note that the underlying lock is not recursive. See GetSharedDescriptorGuard() for further information.
    RExclDescriptorGuard GetExclDescriptorGuard() { return RExclDescriptorGuard(fDescriptor, fDescriptorLock); }
 
@@ -469,12 +540,29 @@ public:
    ColumnHandle_t AddColumn(DescriptorId_t fieldId, const RColumn &column) override;
    void DropColumn(ColumnHandle_t columnHandle) override;
 
-   /// Open the physical storage container for the tree
-   void Attach() { GetExclDescriptorGuard().MoveIn(AttachImpl()); }
+   /// Open the physical storage container for the tree.  Does nothing if the page source is already attached.  Can be
+   /// called concurrently; the storage container is opened only once.
+   void Attach()
+   {
+      if (fIsAttached.load(std::memory_order_acquire))
+         return;
+      std::lock_guard<std::mutex> attachGuard(fAttachLock);
+      if (fIsAttached.load(std::memory_order_relaxed))
+         return;
+      GetExclDescriptorGuard().MoveIn(AttachImpl());
+      fIsAttached.store(true, std::memory_order_release);
+   }
    NTupleSize_t GetNEntries();
    NTupleSize_t GetNElements(ColumnHandle_t columnHandle);
    ColumnId_t GetColumnId(ColumnHandle_t columnHandle);
 
+   /// Lazy columns are columns whose values are only needed for some entries, e.g. columns that are only read if an
+   /// entry passes a selection.  The cluster pool does not preload the pages of lazy columns; instead, their pages are
+   /// read one by one when they are populated, so that pages without any selected entry are not read at all.  The
+   /// other active columns are preloaded as usual.  Must not be called concurrently to populating pages.
+   void SetLazyPhysicalColumns(const RCluster::ColumnSet_t &physicalColumns) { fLazyPhysicalColumns = physicalColumns; }
+   const RCluster::ColumnSet_t &GetLazyPhysicalColumns() const { return fLazyPhysicalColumns; }
+
    /// Allocates and fills a page that contains the index-th element
    virtual RPage PopulatePage(ColumnHandle_t columnHandle, NTupleSize_t globalIndex) = 0;
    /// Another version of PopulatePage that allows to specify cluster-relative indexes
@@ -496,6 +584,12 @@ public:
    /// LoadClusters() is typically called from the I/O thread of a cluster pool, i.e. the method runs
    /// concurrently to other methods of the page source.
    virtual std::vector<std::unique_ptr<RCluster>> LoadClusters(std::span<RCluster::RKey> clusterKeys) = 0;
+   /// Like LoadClusters() but hands over every cluster to `fnLoaded` as soon as its pages are available, together
+   /// with the index of its key in `clusterKeys`.  Clusters may be handed over in any order.  Page sources that can
+   /// overlap the reads for several clusters override this method; the default implementation calls LoadClusters()
+   /// and hands over the clusters in order once the entire bunch is loaded.
+   virtual void LoadClustersAsync(std::span<RCluster::RKey> clusterKeys,
+                                  const std::function<void(std::size_t, std::unique_ptr<RCluster>)> &fnLoaded);
 
    /// Parallel decompression and unpacking of the pages in the given cluster. The unzipped pages are supposed
    /// to be preloaded in a page pool attached to the source. The method is triggered by the cluster pool's
@@ -506,6 +600,9 @@ public:
 
    /// Returns the default metrics object.  Subclasses might alternatively override the method and provide their own metrics object.
    RNTupleMetrics &GetMetrics() override { return fMetrics; };
+   /// Collects the counters of GetMetrics() and the read profile into a report that can be exported as JSON or CSV.
+   /// The profile is only filled while the metrics are enabled.
+   RNTupleReadReport GetReadReport();
 };
 
 } // namespace Detail
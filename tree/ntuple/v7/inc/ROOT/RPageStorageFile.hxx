@@ -25,6 +25,7 @@
 
 #include <array>
 #include <cstdio>
+#include <functional>
 #include <memory>
 #include <string>
 #include <utility>
@@ -76,8 +77,13 @@ protected:
    std::uint64_t CommitClusterImpl(NTupleSize_t nEntries) final;
    RNTupleLocator CommitClusterGroupImpl(unsigned char *serializedPageList, std::uint32_t length) final;
    void CommitDatasetImpl(unsigned char *serializedFooter, std::uint32_t length) final;
+   void LoadExistingImpl(const RNTupleModel &model) final;
 
 public:
+   /// Creates a sink that adds clusters to the existing ntuple in the given file.  The file must be writable.
+   static std::unique_ptr<RPageSinkFile>
+   CreateForUpdate(std::string_view ntupleName, TFile &file, const RNTupleWriteOptions &options);
+
    RPageSinkFile(std::string_view ntupleName, std::string_view path, const RNTupleWriteOptions &options);
    RPageSinkFile(std::string_view ntupleName, std::string_view path, const RNTupleWriteOptions &options,
                  std::unique_ptr<TFile> &file);
@@ -88,6 +94,8 @@ public:
    RPageSinkFile& operator=(RPageSinkFile&&) = default;
    ~RPageSinkFile() override;
 
+   bool IsUpdate() const final { return fWriter->IsUpdate(); }
+
    RPage ReservePage(ColumnHandle_t columnHandle, std::size_t nElements) final;
    void ReleasePage(RPage &page) final;
 };
@@ -121,10 +129,22 @@ private:
    std::unique_ptr<ROOT::Internal::RRawFile> fFile;
    /// Takes the fFile to read ntuple blobs from it
    Internal::RMiniFileReader fReader;
-   /// The descriptor is created from the header and footer either in AttachImpl or in CreateFromAnchor
+   /// The descriptor is created from the header and footer either in AttachImpl or in CreateFromAnchor, or it is
+   /// copied from the original page source by Clone
    RNTupleDescriptorBuilder fDescriptorBuilder;
+   struct RIoUringContext;
+   /// Created on the first call to LoadClustersAsync(); holds the io_uring instance if io_uring is available for fFile.
+   /// Must outlive fClusterPool, whose I/O thread uses it.
+   std::unique_ptr<RIoUringContext> fIoUring;
    /// The cluster pool asynchronously preloads the next few clusters
    std::unique_ptr<RClusterPool> fClusterPool;
+   /// Identifies the file and ntuple in the shared page cache; only used if the shared page cache is turned on
+   std::uint64_t fSharedPageCacheSourceId = 0;
+   /// If the file is memory mapped (see RNTupleReadOptions::SetUseMmap()), the start of the mapping of the entire
+   /// file.  The on-disk pages of the clusters point into the mapping.
+   unsigned char *fMmapBase = nullptr;
+   /// The size of the memory mapped region
+   std::uint64_t fMmapSize = 0;
 
    /// Deserialized header and footer into a minimal descriptor held by fDescriptorBuilder
    void InitDescriptor(const Internal::RFileNTupleAnchor &anchor);
@@ -143,6 +163,13 @@ private:
    std::unique_ptr<RCluster> PrepareSingleCluster(
       const RCluster::RKey &clusterKey,
       std::vector<ROOT::Internal::RRawFile::RIOVec> &readRequests);
+   /// Used instead of PrepareSingleCluster() if the file is memory mapped.  No data is read; the on-disk pages point
+   /// into the mapping and the kernel is advised to prefetch the byte range of the cluster.
+   std::unique_ptr<RCluster> PrepareSingleClusterMapped(const RCluster::RKey &clusterKey);
+   /// Returns a page that points directly into the memory mapped file, or a null page if the sealed page needs to be
+   /// decompressed or unpacked or if it is not suitably aligned in the file.
+   RPage MapSealedPage(const RSealedPage &sealedPage, const RColumnElementBase &element,
+                       DescriptorId_t physicalColumnId);
 
 protected:
    RNTupleDescriptor AttachImpl() final;
@@ -151,7 +178,8 @@ protected:
 public:
    RPageSourceFile(std::string_view ntupleName, std::string_view path, const RNTupleReadOptions &options);
    /// The cloned page source creates a new raw file and reader and opens its own file descriptor to the data.
-   /// The meta-data (header and footer) is reread and parsed by the clone.
+   /// If this page source is attached, the clone copies its descriptor; otherwise, the meta-data (header and footer)
+   /// is reread and parsed by the clone.
    std::unique_ptr<RPageSource> Clone() const final;
 
    RPageSourceFile(const RPageSourceFile&) = delete;
@@ -168,6 +196,11 @@ public:
    LoadSealedPage(DescriptorId_t physicalColumnId, const RClusterIndex &clusterIndex, RSealedPage &sealedPage) final;
 
    std::vector<std::unique_ptr<RCluster>> LoadClusters(std::span<RCluster::RKey> clusterKeys) final;
+   /// With io_uring support, the reads for all the clusters of the bunch are submitted at once and every cluster is
+   /// handed over as soon as its reads complete.  Otherwise, or if the io_uring setup fails, the clusters are loaded
+   /// with a single vector read.
+   void LoadClustersAsync(std::span<RCluster::RKey> clusterKeys,
+                          const std::function<void(std::size_t, std::unique_ptr<RCluster>)> &fnLoaded) final;
 };
 
 
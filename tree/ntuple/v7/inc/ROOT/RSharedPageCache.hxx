@@ -0,0 +1,163 @@
+/// \file ROOT/RSharedPageCache.hxx
+/// \ingroup NTuple ROOT7
+/// \date 2024-01-22
+/// \warning This is part of the ROOT 7 prototype! It will change without notice. It might trigger earthquakes. Feedback
+/// is welcome!
+
+/*************************************************************************
+ * Copyright (C) 1995-2024, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT7_RSharedPageCache
+#define ROOT7_RSharedPageCache
+
+#include <ROOT/RNTupleUtil.hxx>
+#include <ROOT/RPage.hxx>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+namespace ROOT {
+namespace Experimental {
+namespace Detail {
+
+// clang-format off
+/**
+\class ROOT::Experimental::Detail::RSharedPageCache
+\ingroup NTuple
+\brief A process-wide, memory-bounded cache of decompressed and unpacked pages
+
+Unlike the page pool, which belongs to a single page source, the shared page cache is used by all the page sources
+that enable it through RNTupleReadOptions::SetUseSharedPageCache().  Readers of the same ntuple, including the
+clones of a page source that are created for multi-threaded processing, can thus reuse the pages that another
+reader already decompressed.
+
+Pages are identified by the source (file and ntuple), the physical column, the position of the page on storage
+and the in-memory element type.  The cache is split in several shards, each with its own lock and its own
+least-recently-used list, such that concurrent readers rarely contend for the same lock.  Every shard gets an equal
+share of the maximum cache size.  Evicted pages that are still in use by a page source stay alive until they are
+released; thus, the memory used by pages can temporarily exceed the cache size.
+*/
+// clang-format on
+class RSharedPageCache {
+public:
+   /// A page owned by the cache.  Page sources keep a shared pointer to the entry for as long as they use the page.
+   class RCachedPage {
+   private:
+      RPage fPage;
+
+   public:
+      explicit RCachedPage(const RPage &page) : fPage(page) {}
+      RCachedPage(const RCachedPage &other) = delete;
+      RCachedPage &operator=(const RCachedPage &other) = delete;
+      ~RCachedPage();
+
+      const RPage &GetPage() const { return fPage; }
+   };
+
+   struct RKey {
+      std::uint64_t fSourceId = 0;
+      DescriptorId_t fPhysicalColumnId = kInvalidDescriptorId;
+      /// The on-storage position of the sealed page, unique within a source
+      std::uint64_t fPagePosition = 0;
+      /// Distinguishes the same column read into different in-memory types
+      std::size_t fElementTypeHash = 0;
+
+      RKey() = default;
+      RKey(std::uint64_t sourceId, DescriptorId_t physicalColumnId, std::uint64_t pagePosition,
+           std::size_t elementTypeHash)
+         : fSourceId(sourceId),
+           fPhysicalColumnId(physicalColumnId),
+           fPagePosition(pagePosition),
+           fElementTypeHash(elementTypeHash)
+      {
+      }
+
+      bool operator==(const RKey &other) const
+      {
+         return fSourceId == other.fSourceId && fPhysicalColumnId == other.fPhysicalColumnId &&
+                fPagePosition == other.fPagePosition && fElementTypeHash == other.fElementTypeHash;
+      }
+   };
+
+   static constexpr std::size_t kNShards = 16;
+   static constexpr std::uint64_t kDefaultMaxBytes = 256 * 1024 * 1024;
+
+private:
+   struct RKeyHash {
+      std::size_t operator()(const RKey &key) const;
+   };
+
+   using LruList_t = std::list<std::pair<RKey, std::shared_ptr<RCachedPage>>>;
+
+   struct RShard {
+      std::mutex fLock;
+      /// Most recently used entries at the front
+      LruList_t fLru;
+      std::unordered_map<RKey, LruList_t::iterator, RKeyHash> fIndex;
+      std::uint64_t fNBytes = 0;
+   };
+
+   std::array<RShard, kNShards> fShards;
+   std::atomic<std::uint64_t> fMaxBytes{kDefaultMaxBytes};
+   std::atomic<std::uint64_t> fNHits{0};
+   std::atomic<std::uint64_t> fNMisses{0};
+
+   std::mutex fSourceIdsLock;
+   std::unordered_map<std::string, std::uint64_t> fSourceIds;
+
+   RShard &GetShard(const RKey &key) { return fShards[RKeyHash()(key) % kNShards]; }
+   /// Drops least recently used entries until the shard fits into its share of the maximum cache size.
+   /// Must be called with the shard lock held.
+   void EvictUnlocked(RShard &shard, std::uint64_t maxShardBytes);
+
+public:
+   RSharedPageCache() = default;
+   RSharedPageCache(const RSharedPageCache &other) = delete;
+   RSharedPageCache &operator=(const RSharedPageCache &other) = delete;
+   ~RSharedPageCache() = default;
+
+   /// The cache instance shared by all page sources of the process
+   static RSharedPageCache &Get();
+
+   /// Returns a stable, process-wide unique identifier for the given description of a source, e.g. the URL of the
+   /// file together with the ntuple name and properties of the ntuple anchor.  Page sources with equal descriptions
+   /// share the cached pages.
+   std::uint64_t GetSourceId(const std::string &sourceDescription);
+
+   /// Returns the cached page or nullptr if the page is not in the cache
+   std::shared_ptr<RCachedPage> Find(const RKey &key);
+   /// Takes ownership of the page, which must be allocated by RPageAllocatorHeap.  If another thread inserted the
+   /// same page in the meantime, the given page is freed and the existing entry is returned.  Pages larger than
+   /// the share of a single shard are not retained by the cache but the returned entry still owns the page.
+   std::shared_ptr<RCachedPage> Insert(const RKey &key, const RPage &page);
+
+   /// Drops all the entries; pages still in use stay alive until they are released
+   void Clear();
+
+   std::uint64_t GetMaxBytes() const { return fMaxBytes; }
+   /// Changing the maximum size immediately evicts pages if necessary
+   void SetMaxBytes(std::uint64_t maxBytes);
+   /// The number of bytes held by the cache
+   std::uint64_t GetNBytes();
+   std::uint64_t GetNHits() const { return fNHits; }
+   std::uint64_t GetNMisses() const { return fNMisses; }
+};
+
+} // namespace Detail
+} // namespace Experimental
+} // namespace ROOT
+
+#endif
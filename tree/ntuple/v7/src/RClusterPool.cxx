@@ -131,32 +131,32 @@ void ROOT::Experimental::Detail::RClusterPool::ExecReadClusters()
             clusterKeys.emplace_back(item.fClusterKey);
          }
 
-         auto clusters = fPageSource.LoadClusters(clusterKeys);
-         bool unzipQueueDirty = false;
-         for (std::size_t i = 0; i < clusters.size(); ++i) {
+         // Every cluster is handed over to the unzip thread as soon as it is loaded, so that unzipping can start
+         // while the remaining clusters of the bunch are still being read
+         fPageSource.LoadClustersAsync(clusterKeys, [&](std::size_t i, std::unique_ptr<RCluster> cluster) {
             // Meanwhile, the user might have requested clusters outside the look-ahead window, so that we don't
             // need the cluster anymore, in which case we simply discard it right away, before moving it to the pool
             bool discard;
             {
                std::unique_lock<std::mutex> lock(fLockWorkQueue);
                discard = std::any_of(fInFlightClusters.begin(), fInFlightClusters.end(),
-                                     [thisClusterId = clusters[i]->GetId()](auto &inFlight) {
+                                     [thisClusterId = cluster->GetId()](auto &inFlight) {
                                         return inFlight.fClusterKey.fClusterId == thisClusterId && inFlight.fIsExpired;
                                      });
             }
             if (discard) {
-               clusters[i].reset();
-               readItems[i].fPromise.set_value(std::move(clusters[i]));
+               cluster.reset();
+               readItems[i].fPromise.set_value(std::move(cluster));
             } else {
                // Hand-over the loaded cluster pages to the unzip thread
-               std::unique_lock<std::mutex> lock(fLockUnzipQueue);
-               fUnzipQueue.emplace_back(RUnzipItem{std::move(clusters[i]), std::move(readItems[i].fPromise)});
-               unzipQueueDirty = true;
+               {
+                  std::unique_lock<std::mutex> lock(fLockUnzipQueue);
+                  fUnzipQueue.emplace_back(RUnzipItem{std::move(cluster), std::move(readItems[i].fPromise)});
+               }
+               fCvHasUnzipWork.notify_one();
             }
-         }
-         readItems.erase(readItems.begin(), readItems.begin() + clusters.size());
-         if (unzipQueueDirty)
-            fCvHasUnzipWork.notify_one();
+         });
+         readItems.erase(readItems.begin(), readItems.begin() + clusterKeys.size());
       }
    } // while (true)
 }
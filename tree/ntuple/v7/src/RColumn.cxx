@@ -89,6 +89,22 @@ void ROOT::Experimental::Detail::RColumn::Flush()
    fWritePage[fWritePageIdx].Reset(fNElements);
 }
 
+void ROOT::Experimental::Detail::RColumn::SetApproxNElementsPerPage(std::uint32_t nElements)
+{
+   if (nElements < 2)
+      throw RException(R__FAIL("page size too small for writing"));
+   if (nElements == fApproxNElementsPerPage)
+      return;
+   R__ASSERT(fWritePage[0].IsEmpty() && fWritePage[1].IsEmpty());
+
+   fApproxNElementsPerPage = nElements;
+   for (auto &page : fWritePage) {
+      fPageSink->ReleasePage(page);
+      page = fPageSink->ReservePage(fHandleSink, fApproxNElementsPerPage + fApproxNElementsPerPage / 2);
+   }
+   fWritePage[fWritePageIdx].Reset(fNElements);
+}
+
 void ROOT::Experimental::Detail::RColumn::MapPage(const NTupleSize_t index)
 {
    fPageSource->ReleasePage(fReadPage);
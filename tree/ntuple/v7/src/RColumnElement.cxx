@@ -18,11 +18,736 @@
 #include <TError.h>
 
 #include <algorithm>
-#include <bitset>
+#include <atomic>
 #include <cstdint>
+#include <cstring>
 #include <memory>
 #include <utility>
 
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define R__NTUPLE_X86_KERNELS
+#include <immintrin.h>
+#define R__TARGET_SSE41 __attribute__((target("sse4.1")))
+#define R__TARGET_AVX2 __attribute__((target("avx2")))
+#define R__TARGET_AVX512 __attribute__((target("avx512f,avx512bw")))
+#endif
+
+namespace {
+
+using ROOT::Experimental::Internal::EColumnElementSIMDLevel;
+
+EColumnElementSIMDLevel DetectSIMDLevel()
+{
+#ifdef R__NTUPLE_X86_KERNELS
+   __builtin_cpu_init();
+   if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw"))
+      return EColumnElementSIMDLevel::kAVX512;
+   if (__builtin_cpu_supports("avx2"))
+      return EColumnElementSIMDLevel::kAVX2;
+   if (__builtin_cpu_supports("sse4.1"))
+      return EColumnElementSIMDLevel::kSSE41;
+#endif
+   return EColumnElementSIMDLevel::kScalar;
+}
+
+EColumnElementSIMDLevel GetMaxSIMDLevel()
+{
+   static const EColumnElementSIMDLevel gMaxLevel = DetectSIMDLevel();
+   return gMaxLevel;
+}
+
+std::atomic<EColumnElementSIMDLevel> &GetSIMDLevelRef()
+{
+   static std::atomic<EColumnElementSIMDLevel> gLevel{GetMaxSIMDLevel()};
+   return gLevel;
+}
+
+// The scalar kernels process the elements from index `first` on, such that they also handle the remainder of the
+// vectorized kernels.  The vectorized kernels return the number of elements they processed.
+
+void SplitBytesScalar(unsigned char *dst, const unsigned char *src, std::size_t count, std::size_t N, std::size_t first)
+{
+   for (std::size_t i = first; i < count; ++i) {
+      for (std::size_t b = 0; b < N; ++b)
+         dst[b * count + i] = src[i * N + b];
+   }
+}
+
+void UnsplitBytesScalar(unsigned char *dst, const unsigned char *src, std::size_t count, std::size_t N,
+                        std::size_t first)
+{
+   for (std::size_t i = first; i < count; ++i) {
+      for (std::size_t b = 0; b < N; ++b)
+         dst[i * N + b] = src[b * count + i];
+   }
+}
+
+/// `first` must be a multiple of 8
+void PackBitsScalar(unsigned char *dst, const bool *src, std::size_t count, std::size_t first)
+{
+   for (std::size_t i = first; i < count; i += 8) {
+      unsigned char packed = 0;
+      for (std::size_t j = i; j < std::min(count, i + 8); ++j)
+         packed |= static_cast<unsigned char>(src[j] << (j - i));
+      dst[i / 8] = packed;
+   }
+}
+
+void UnpackBitsScalar(bool *dst, const unsigned char *src, std::size_t count, std::size_t first)
+{
+   for (std::size_t i = first; i < count; ++i)
+      dst[i] = (src[i / 8] >> (i % 8)) & 1;
+}
+
+void TruncateFloatsTo16BitsScalar(std::uint16_t *dst, const float *src, std::size_t count, std::size_t first)
+{
+   for (std::size_t i = first; i < count; ++i) {
+      std::uint32_t bits;
+      std::memcpy(&bits, &src[i], sizeof(bits));
+      dst[i] = static_cast<std::uint16_t>(bits >> 16);
+   }
+}
+
+void ExpandFloatsFrom16BitsScalar(float *dst, const std::uint16_t *src, std::size_t count, std::size_t first)
+{
+   for (std::size_t i = first; i < count; ++i) {
+      const std::uint32_t bits = static_cast<std::uint32_t>(src[i]) << 16;
+      std::memcpy(&dst[i], &bits, sizeof(bits));
+   }
+}
+
+// The vectorized bit stream kernels process multiples of 8 elements, such that the scalar kernels continue at a byte
+// boundary of the stream
+
+void PackBitStreamScalar(unsigned char *dst, const std::uint64_t *src, std::size_t count, std::size_t width,
+                         std::size_t first)
+{
+   WriteBitStream(dst + first * width / 8, count - first, width,
+                  [src = src + first](std::size_t i) -> std::uint64_t { return src[i]; });
+}
+
+void UnpackBitStreamScalar(std::uint64_t *dst, const unsigned char *src, std::size_t count, std::size_t width,
+                           std::size_t first)
+{
+   ReadBitStream(src + first * width / 8, count - first, width,
+                 [dst = dst + first](std::size_t i, std::uint64_t val) { dst[i] = val; });
+}
+
+#ifdef R__NTUPLE_X86_KERNELS
+
+// Byte splitting of blocks of 16 elements (SSE) or 32 elements (AVX2).  In a first step, the bytes within every
+// 16 byte vector are grouped by their position in the element.  In a second step, the vectors are transposed as a
+// matrix of 8 (for 2 byte elements), 4 (4 byte elements), or 2 byte (8 byte elements) words such that every vector
+// holds the same byte of 16 consecutive elements.  Unsplitting runs the same steps in reverse order.  Both steps
+// are their own inverse.  The AVX2 kernels operate on two such blocks at once, one in each 128bit lane.
+
+inline __m128i Load128(const unsigned char *src)
+{
+   return _mm_loadu_si128(reinterpret_cast<const __m128i *>(src));
+}
+
+inline void Store128(unsigned char *dst, __m128i v)
+{
+   _mm_storeu_si128(reinterpret_cast<__m128i *>(dst), v);
+}
+
+R__TARGET_SSE41 inline void Transpose4x4Epi32(__m128i *v)
+{
+   const __m128i t0 = _mm_unpacklo_epi32(v[0], v[1]);
+   const __m128i t1 = _mm_unpackhi_epi32(v[0], v[1]);
+   const __m128i t2 = _mm_unpacklo_epi32(v[2], v[3]);
+   const __m128i t3 = _mm_unpackhi_epi32(v[2], v[3]);
+   v[0] = _mm_unpacklo_epi64(t0, t2);
+   v[1] = _mm_unpackhi_epi64(t0, t2);
+   v[2] = _mm_unpacklo_epi64(t1, t3);
+   v[3] = _mm_unpackhi_epi64(t1, t3);
+}
+
+R__TARGET_SSE41 inline void Transpose8x8Epi16(__m128i *v)
+{
+   __m128i a[8];
+   __m128i b[8];
+   for (int j = 0; j < 4; ++j) {
+      a[2 * j] = _mm_unpacklo_epi16(v[2 * j], v[2 * j + 1]);
+      a[2 * j + 1] = _mm_unpackhi_epi16(v[2 * j], v[2 * j + 1]);
+   }
+   for (int j = 0; j < 2; ++j) {
+      b[4 * j] = _mm_unpacklo_epi32(a[4 * j], a[4 * j + 2]);
+      b[4 * j + 1] = _mm_unpackhi_epi32(a[4 * j], a[4 * j + 2]);
+      b[4 * j + 2] = _mm_unpacklo_epi32(a[4 * j + 1], a[4 * j + 3]);
+      b[4 * j + 3] = _mm_unpackhi_epi32(a[4 * j + 1], a[4 * j + 3]);
+   }
+   for (int j = 0; j < 4; ++j) {
+      v[2 * j] = _mm_unpacklo_epi64(b[j], b[j + 4]);
+      v[2 * j + 1] = _mm_unpackhi_epi64(b[j], b[j + 4]);
+   }
+}
+
+R__TARGET_SSE41 std::size_t SplitBytesSSE41(unsigned char *dst, const unsigned char *src, std::size_t count,
+                                            std::size_t N)
+{
+   std::size_t i = 0;
+   if (N == 2) {
+      const __m128i shuffle = _mm_setr_epi8(0, 2, 4, 6, 8, 10, 12, 14, 1, 3, 5, 7, 9, 11, 13, 15);
+      for (; i + 16 <= count; i += 16) {
+         const __m128i v0 = _mm_shuffle_epi8(Load128(src + 2 * i), shuffle);
+         const __m128i v1 = _mm_shuffle_epi8(Load128(src + 2 * i + 16), shuffle);
+         Store128(dst + i, _mm_unpacklo_epi64(v0, v1));
+         Store128(dst + count + i, _mm_unpackhi_epi64(v0, v1));
+      }
+   } else if (N == 4) {
+      const __m128i shuffle = _mm_setr_epi8(0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15);
+      for (; i + 16 <= count; i += 16) {
+         __m128i v[4];
+         for (int j = 0; j < 4; ++j)
+            v[j] = _mm_shuffle_epi8(Load128(src + 4 * i + 16 * j), shuffle);
+         Transpose4x4Epi32(v);
+         for (int b = 0; b < 4; ++b)
+            Store128(dst + b * count + i, v[b]);
+      }
+   } else if (N == 8) {
+      const __m128i shuffle = _mm_setr_epi8(0, 8, 1, 9, 2, 10, 3, 11, 4, 12, 5, 13, 6, 14, 7, 15);
+      for (; i + 16 <= count; i += 16) {
+         __m128i v[8];
+         for (int j = 0; j < 8; ++j)
+            v[j] = _mm_shuffle_epi8(Load128(src + 8 * i + 16 * j), shuffle);
+         Transpose8x8Epi16(v);
+         for (int b = 0; b < 8; ++b)
+            Store128(dst + b * count + i, v[b]);
+      }
+   }
+   return i;
+}
+
+R__TARGET_SSE41 std::size_t UnsplitBytesSSE41(unsigned char *dst, const unsigned char *src, std::size_t count,
+                                              std::size_t N)
+{
+   std::size_t i = 0;
+   if (N == 2) {
+      for (; i + 16 <= count; i += 16) {
+         const __m128i p0 = Load128(src + i);
+         const __m128i p1 = Load128(src + count + i);
+         Store128(dst + 2 * i, _mm_unpacklo_epi8(p0, p1));
+         Store128(dst + 2 * i + 16, _mm_unpackhi_epi8(p0, p1));
+      }
+   } else if (N == 4) {
+      const __m128i shuffle = _mm_setr_epi8(0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15);
+      for (; i + 16 <= count; i += 16) {
+         __m128i v[4];
+         for (int b = 0; b < 4; ++b)
+            v[b] = Load128(src + b * count + i);
+         Transpose4x4Epi32(v);
+         for (int j = 0; j < 4; ++j)
+            Store128(dst + 4 * i + 16 * j, _mm_shuffle_epi8(v[j], shuffle));
+      }
+   } else if (N == 8) {
+      const __m128i shuffle = _mm_setr_epi8(0, 2, 4, 6, 8, 10, 12, 14, 1, 3, 5, 7, 9, 11, 13, 15);
+      for (; i + 16 <= count; i += 16) {
+         __m128i v[8];
+         for (int b = 0; b < 8; ++b)
+            v[b] = Load128(src + b * count + i);
+         Transpose8x8Epi16(v);
+         for (int j = 0; j < 8; ++j)
+            Store128(dst + 8 * i + 16 * j, _mm_shuffle_epi8(v[j], shuffle));
+      }
+   }
+   return i;
+}
+
+R__TARGET_SSE41 std::size_t PackBitsSSE41(unsigned char *dst, const bool *src, std::size_t count)
+{
+   const __m128i zero = _mm_setzero_si128();
+   std::size_t i = 0;
+   for (; i + 16 <= count; i += 16) {
+      const __m128i v = Load128(reinterpret_cast<const unsigned char *>(src + i));
+      const auto packed = static_cast<std::uint16_t>(~_mm_movemask_epi8(_mm_cmpeq_epi8(v, zero)));
+      std::memcpy(dst + i / 8, &packed, sizeof(packed));
+   }
+   return i;
+}
+
+R__TARGET_SSE41 std::size_t UnpackBitsSSE41(bool *dst, const unsigned char *src, std::size_t count)
+{
+   const __m128i shuffle = _mm_setr_epi8(0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1);
+   const __m128i bitMask = _mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128);
+   const __m128i one = _mm_set1_epi8(1);
+   std::size_t i = 0;
+   for (; i + 16 <= count; i += 16) {
+      std::uint16_t packed;
+      std::memcpy(&packed, src + i / 8, sizeof(packed));
+      const __m128i bytes = _mm_shuffle_epi8(_mm_set1_epi16(static_cast<short>(packed)), shuffle);
+      const __m128i bits = _mm_cmpeq_epi8(_mm_and_si128(bytes, bitMask), bitMask);
+      Store128(reinterpret_cast<unsigned char *>(dst + i), _mm_and_si128(bits, one));
+   }
+   return i;
+}
+
+R__TARGET_SSE41 std::size_t TruncateFloatsTo16BitsSSE41(std::uint16_t *dst, const float *src, std::size_t count)
+{
+   std::size_t i = 0;
+   for (; i + 8 <= count; i += 8) {
+      const __m128i lo = _mm_srli_epi32(Load128(reinterpret_cast<const unsigned char *>(src + i)), 16);
+      const __m128i hi = _mm_srli_epi32(Load128(reinterpret_cast<const unsigned char *>(src + i + 4)), 16);
+      Store128(reinterpret_cast<unsigned char *>(dst + i), _mm_packus_epi32(lo, hi));
+   }
+   return i;
+}
+
+R__TARGET_SSE41 std::size_t ExpandFloatsFrom16BitsSSE41(float *dst, const std::uint16_t *src, std::size_t count)
+{
+   std::size_t i = 0;
+   for (; i + 8 <= count; i += 8) {
+      const __m128i halves = Load128(reinterpret_cast<const unsigned char *>(src + i));
+      const __m128i lo = _mm_slli_epi32(_mm_cvtepu16_epi32(halves), 16);
+      const __m128i hi = _mm_slli_epi32(_mm_cvtepu16_epi32(_mm_srli_si128(halves, 8)), 16);
+      Store128(reinterpret_cast<unsigned char *>(dst + i), lo);
+      Store128(reinterpret_cast<unsigned char *>(dst + i + 4), hi);
+   }
+   return i;
+}
+
+R__TARGET_AVX2 inline __m256i LoadTwo128(const unsigned char *lo, const unsigned char *hi)
+{
+   return _mm256_inserti128_si256(_mm256_castsi128_si256(Load128(lo)), Load128(hi), 1);
+}
+
+R__TARGET_AVX2 inline void StoreTwo128(unsigned char *lo, unsigned char *hi, __m256i v)
+{
+   Store128(lo, _mm256_castsi256_si128(v));
+   Store128(hi, _mm256_extracti128_si256(v, 1));
+}
+
+R__TARGET_AVX2 inline __m256i Load256(const unsigned char *src)
+{
+   return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src));
+}
+
+R__TARGET_AVX2 inline void Store256(unsigned char *dst, __m256i v)
+{
+   _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst), v);
+}
+
+R__TARGET_AVX2 inline void Transpose4x4Epi32(__m256i *v)
+{
+   const __m256i t0 = _mm256_unpacklo_epi32(v[0], v[1]);
+   const __m256i t1 = _mm256_unpackhi_epi32(v[0], v[1]);
+   const __m256i t2 = _mm256_unpacklo_epi32(v[2], v[3]);
+   const __m256i t3 = _mm256_unpackhi_epi32(v[2], v[3]);
+   v[0] = _mm256_unpacklo_epi64(t0, t2);
+   v[1] = _mm256_unpackhi_epi64(t0, t2);
+   v[2] = _mm256_unpacklo_epi64(t1, t3);
+   v[3] = _mm256_unpackhi_epi64(t1, t3);
+}
+
+R__TARGET_AVX2 inline void Transpose8x8Epi16(__m256i *v)
+{
+   __m256i a[8];
+   __m256i b[8];
+   for (int j = 0; j < 4; ++j) {
+      a[2 * j] = _mm256_unpacklo_epi16(v[2 * j], v[2 * j + 1]);
+      a[2 * j + 1] = _mm256_unpackhi_epi16(v[2 * j], v[2 * j + 1]);
+   }
+   for (int j = 0; j < 2; ++j) {
+      b[4 * j] = _mm256_unpacklo_epi32(a[4 * j], a[4 * j + 2]);
+      b[4 * j + 1] = _mm256_unpackhi_epi32(a[4 * j], a[4 * j + 2]);
+      b[4 * j + 2] = _mm256_unpacklo_epi32(a[4 * j + 1], a[4 * j + 3]);
+      b[4 * j + 3] = _mm256_unpackhi_epi32(a[4 * j + 1], a[4 * j + 3]);
+   }
+   for (int j = 0; j < 4; ++j) {
+      v[2 * j] = _mm256_unpacklo_epi64(b[j], b[j + 4]);
+      v[2 * j + 1] = _mm256_unpackhi_epi64(b[j], b[j + 4]);
+   }
+}
+
+/// Elements i to i + 15 are processed in the low lanes, elements i + 16 to i + 31 in the high lanes
+R__TARGET_AVX2 std::size_t SplitBytesAVX2(unsigned char *dst, const unsigned char *src, std::size_t count,
+                                          std::size_t N)
+{
+   std::size_t i = 0;
+   if (N == 2) {
+      const __m256i shuffle =
+         _mm256_broadcastsi128_si256(_mm_setr_epi8(0, 2, 4, 6, 8, 10, 12, 14, 1, 3, 5, 7, 9, 11, 13, 15));
+      for (; i + 32 <= count; i += 32) {
+         const __m256i v0 = _mm256_shuffle_epi8(LoadTwo128(src + 2 * i, src + 2 * i + 32), shuffle);
+         const __m256i v1 = _mm256_shuffle_epi8(LoadTwo128(src + 2 * i + 16, src + 2 * i + 48), shuffle);
+         Store256(dst + i, _mm256_unpacklo_epi64(v0, v1));
+         Store256(dst + count + i, _mm256_unpackhi_epi64(v0, v1));
+      }
+   } else if (N == 4) {
+      const __m256i shuffle =
+         _mm256_broadcastsi128_si256(_mm_setr_epi8(0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15));
+      for (; i + 32 <= count; i += 32) {
+         __m256i v[4];
+         for (int j = 0; j < 4; ++j)
+            v[j] = _mm256_shuffle_epi8(LoadTwo128(src + 4 * i + 16 * j, src + 4 * i + 64 + 16 * j), shuffle);
+         Transpose4x4Epi32(v);
+         for (int b = 0; b < 4; ++b)
+            Store256(dst + b * count + i, v[b]);
+      }
+   } else if (N == 8) {
+      const __m256i shuffle =
+         _mm256_broadcastsi128_si256(_mm_setr_epi8(0, 8, 1, 9, 2, 10, 3, 11, 4, 12, 5, 13, 6, 14, 7, 15));
+      for (; i + 32 <= count; i += 32) {
+         __m256i v[8];
+         for (int j = 0; j < 8; ++j)
+            v[j] = _mm256_shuffle_epi8(LoadTwo128(src + 8 * i + 16 * j, src + 8 * i + 128 + 16 * j), shuffle);
+         Transpose8x8Epi16(v);
+         for (int b = 0; b < 8; ++b)
+            Store256(dst + b * count + i, v[b]);
+      }
+   }
+   return i;
+}
+
+R__TARGET_AVX2 std::size_t UnsplitBytesAVX2(unsigned char *dst, const unsigned char *src, std::size_t count,
+                                            std::size_t N)
+{
+   std::size_t i = 0;
+   if (N == 2) {
+      for (; i + 32 <= count; i += 32) {
+         const __m256i p0 = Load256(src + i);
+         const __m256i p1 = Load256(src + count + i);
+         StoreTwo128(dst + 2 * i, dst + 2 * i + 32, _mm256_unpacklo_epi8(p0, p1));
+         StoreTwo128(dst + 2 * i + 16, dst + 2 * i + 48, _mm256_unpackhi_epi8(p0, p1));
+      }
+   } else if (N == 4) {
+      const __m256i shuffle =
+         _mm256_broadcastsi128_si256(_mm_setr_epi8(0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15));
+      for (; i + 32 <= count; i += 32) {
+         __m256i v[4];
+         for (int b = 0; b < 4; ++b)
+            v[b] = Load256(src + b * count + i);
+         Transpose4x4Epi32(v);
+         for (int j = 0; j < 4; ++j)
+            StoreTwo128(dst + 4 * i + 16 * j, dst + 4 * i + 64 + 16 * j, _mm256_shuffle_epi8(v[j], shuffle));
+      }
+   } else if (N == 8) {
+      const __m256i shuffle =
+         _mm256_broadcastsi128_si256(_mm_setr_epi8(0, 2, 4, 6, 8, 10, 12, 14, 1, 3, 5, 7, 9, 11, 13, 15));
+      for (; i + 32 <= count; i += 32) {
+         __m256i v[8];
+         for (int b = 0; b < 8; ++b)
+            v[b] = Load256(src + b * count + i);
+         Transpose8x8Epi16(v);
+         for (int j = 0; j < 8; ++j)
+            StoreTwo128(dst + 8 * i + 16 * j, dst + 8 * i + 128 + 16 * j, _mm256_shuffle_epi8(v[j], shuffle));
+      }
+   }
+   return i;
+}
+
+R__TARGET_AVX2 std::size_t PackBitsAVX2(unsigned char *dst, const bool *src, std::size_t count)
+{
+   const __m256i zero = _mm256_setzero_si256();
+   std::size_t i = 0;
+   for (; i + 32 <= count; i += 32) {
+      const __m256i v = Load256(reinterpret_cast<const unsigned char *>(src + i));
+      const auto packed = ~static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, zero)));
+      std::memcpy(dst + i / 8, &packed, sizeof(packed));
+   }
+   return i;
+}
+
+R__TARGET_AVX2 std::size_t UnpackBitsAVX2(bool *dst, const unsigned char *src, std::size_t count)
+{
+   // Both lanes hold all four bytes; the low lane expands bytes 0 and 1, the high lane bytes 2 and 3
+   const __m256i shuffle = _mm256_setr_epi8(0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 3,
+                                            3, 3, 3, 3, 3, 3, 3);
+   const __m256i bitMask =
+      _mm256_broadcastsi128_si256(_mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128));
+   const __m256i one = _mm256_set1_epi8(1);
+   std::size_t i = 0;
+   for (; i + 32 <= count; i += 32) {
+      std::uint32_t packed;
+      std::memcpy(&packed, src + i / 8, sizeof(packed));
+      const __m256i bytes = _mm256_shuffle_epi8(_mm256_set1_epi32(static_cast<int>(packed)), shuffle);
+      const __m256i bits = _mm256_cmpeq_epi8(_mm256_and_si256(bytes, bitMask), bitMask);
+      Store256(reinterpret_cast<unsigned char *>(dst + i), _mm256_and_si256(bits, one));
+   }
+   return i;
+}
+
+R__TARGET_AVX2 std::size_t TruncateFloatsTo16BitsAVX2(std::uint16_t *dst, const float *src, std::size_t count)
+{
+   std::size_t i = 0;
+   for (; i + 16 <= count; i += 16) {
+      const __m256i lo = _mm256_srli_epi32(Load256(reinterpret_cast<const unsigned char *>(src + i)), 16);
+      const __m256i hi = _mm256_srli_epi32(Load256(reinterpret_cast<const unsigned char *>(src + i + 8)), 16);
+      // The pack instruction interleaves the lanes of its arguments
+      const __m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi32(lo, hi), 0xD8);
+      Store256(reinterpret_cast<unsigned char *>(dst + i), packed);
+   }
+   return i;
+}
+
+R__TARGET_AVX2 std::size_t ExpandFloatsFrom16BitsAVX2(float *dst, const std::uint16_t *src, std::size_t count)
+{
+   std::size_t i = 0;
+   for (; i + 8 <= count; i += 8) {
+      const __m256i halves = _mm256_cvtepu16_epi32(Load128(reinterpret_cast<const unsigned char *>(src + i)));
+      Store256(reinterpret_cast<unsigned char *>(dst + i), _mm256_slli_epi32(halves, 16));
+   }
+   return i;
+}
+
+/// Merges pairs of neighboring elements into one value of twice the width, such that the stream is assembled from
+/// half as many values and written in 64bit words.  Requires width <= 32.
+R__TARGET_AVX2 std::size_t PackBitStreamAVX2(unsigned char *dst, const std::uint64_t *src, std::size_t count,
+                                             std::size_t width)
+{
+   if (width > 32)
+      return 0;
+   const __m128i shift = _mm_cvtsi64_si128(static_cast<long long>(width));
+   const std::size_t pairWidth = 2 * width;
+   // Fewer than 64 bits are pending in `acc` at the beginning of every pair
+   unsigned __int128 acc = 0;
+   std::size_t nAcc = 0;
+   std::size_t i = 0;
+   for (; i + 8 <= count; i += 8) {
+      const __m256i a = Load256(reinterpret_cast<const unsigned char *>(src + i));
+      const __m256i b = Load256(reinterpret_cast<const unsigned char *>(src + i + 4));
+      // The lanes hold the pairs of elements (0, 1), (4, 5), (2, 3), and (6, 7)
+      const __m256i pairs =
+         _mm256_or_si256(_mm256_unpacklo_epi64(a, b), _mm256_sll_epi64(_mm256_unpackhi_epi64(a, b), shift));
+      alignas(32) std::uint64_t p[4];
+      _mm256_store_si256(reinterpret_cast<__m256i *>(p), pairs);
+      for (int j : {0, 2, 1, 3}) {
+         acc |= static_cast<unsigned __int128>(p[j]) << nAcc;
+         nAcc += pairWidth;
+         if (nAcc >= 64) {
+            const auto word = static_cast<std::uint64_t>(acc);
+            std::memcpy(dst, &word, sizeof(word));
+            dst += 8;
+            acc >>= 64;
+            nAcc -= 64;
+         }
+      }
+   }
+   // 8 * width bits per iteration leave full bytes pending
+   for (; nAcc > 0; nAcc -= 8, acc >>= 8)
+      *dst++ = static_cast<unsigned char>(acc & 0xff);
+   return i;
+}
+
+/// Gathers for every element the 64bit word starting at the byte that holds the element's first bit.  Requires
+/// width <= 56, such that the element is fully contained in that word.  The loop stops before a gathered word
+/// would extend beyond the end of the stream.
+R__TARGET_AVX2 std::size_t UnpackBitStreamAVX2(std::uint64_t *dst, const unsigned char *src, std::size_t count,
+                                               std::size_t width)
+{
+   if (width > 56)
+      return 0;
+   const std::size_t nBytes = (count * width + 7) / 8;
+   const __m256i mask = _mm256_set1_epi64x(static_cast<long long>((std::uint64_t(1) << width) - 1));
+   const __m256i seven = _mm256_set1_epi64x(7);
+   const __m256i step = _mm256_set1_epi64x(static_cast<long long>(4 * width));
+   const auto w = static_cast<long long>(width);
+   // The bit offsets of the next four elements
+   __m256i offsets = _mm256_setr_epi64x(0, w, 2 * w, 3 * w);
+   std::size_t i = 0;
+   for (; (i + 8 <= count) && ((i + 7) * width / 8 + 8 <= nBytes); i += 8) {
+      for (std::size_t j = 0; j < 8; j += 4) {
+         const __m256i words = _mm256_i64gather_epi64(reinterpret_cast<const long long *>(src),
+                                                      _mm256_srli_epi64(offsets, 3), 1);
+         const __m256i values = _mm256_and_si256(_mm256_srlv_epi64(words, _mm256_and_si256(offsets, seven)), mask);
+         Store256(reinterpret_cast<unsigned char *>(dst + i + j), values);
+         offsets = _mm256_add_epi64(offsets, step);
+      }
+   }
+   return i;
+}
+
+R__TARGET_AVX512 std::size_t PackBitsAVX512(unsigned char *dst, const bool *src, std::size_t count)
+{
+   std::size_t i = 0;
+   for (; i + 64 <= count; i += 64) {
+      const __m512i v = _mm512_loadu_si512(src + i);
+      const std::uint64_t packed = _mm512_test_epi8_mask(v, v);
+      std::memcpy(dst + i / 8, &packed, sizeof(packed));
+   }
+   return i;
+}
+
+R__TARGET_AVX512 std::size_t UnpackBitsAVX512(bool *dst, const unsigned char *src, std::size_t count)
+{
+   const __m512i one = _mm512_set1_epi8(1);
+   std::size_t i = 0;
+   for (; i + 64 <= count; i += 64) {
+      std::uint64_t packed;
+      std::memcpy(&packed, src + i / 8, sizeof(packed));
+      _mm512_storeu_si512(dst + i, _mm512_maskz_mov_epi8(packed, one));
+   }
+   return i;
+}
+
+R__TARGET_AVX512 std::size_t TruncateFloatsTo16BitsAVX512(std::uint16_t *dst, const float *src, std::size_t count)
+{
+   std::size_t i = 0;
+   for (; i + 16 <= count; i += 16) {
+      const __m512i bits = _mm512_srli_epi32(_mm512_loadu_si512(src + i), 16);
+      _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i), _mm512_cvtepi32_epi16(bits));
+   }
+   return i;
+}
+
+R__TARGET_AVX512 std::size_t ExpandFloatsFrom16BitsAVX512(float *dst, const std::uint16_t *src, std::size_t count)
+{
+   std::size_t i = 0;
+   for (; i + 16 <= count; i += 16) {
+      const __m512i halves =
+         _mm512_cvtepu16_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + i)));
+      _mm512_storeu_si512(dst + i, _mm512_slli_epi32(halves, 16));
+   }
+   return i;
+}
+
+#endif // R__NTUPLE_X86_KERNELS
+
+} // anonymous namespace
+
+ROOT::Experimental::Internal::EColumnElementSIMDLevel ROOT::Experimental::Internal::GetColumnElementSIMDLevel()
+{
+   return GetSIMDLevelRef().load();
+}
+
+ROOT::Experimental::Internal::EColumnElementSIMDLevel ROOT::Experimental::Internal::GetMaxColumnElementSIMDLevel()
+{
+   return GetMaxSIMDLevel();
+}
+
+void ROOT::Experimental::Internal::SetColumnElementSIMDLevel(EColumnElementSIMDLevel level)
+{
+   GetSIMDLevelRef().store(std::min(level, GetMaxSIMDLevel()));
+}
+
+// The AVX-512 level uses the AVX2 kernels for byte splitting
+
+void ROOT::Experimental::Internal::SplitBytes(void *destination, const void *source, std::size_t count,
+                                              std::size_t elementSize)
+{
+   auto dst = reinterpret_cast<unsigned char *>(destination);
+   auto src = reinterpret_cast<const unsigned char *>(source);
+   std::size_t first = 0;
+#ifdef R__NTUPLE_X86_KERNELS
+   switch (GetSIMDLevelRef().load(std::memory_order_relaxed)) {
+   case EColumnElementSIMDLevel::kAVX512:
+   case EColumnElementSIMDLevel::kAVX2: first = SplitBytesAVX2(dst, src, count, elementSize); break;
+   case EColumnElementSIMDLevel::kSSE41: first = SplitBytesSSE41(dst, src, count, elementSize); break;
+   default: break;
+   }
+#endif
+   SplitBytesScalar(dst, src, count, elementSize, first);
+}
+
+void ROOT::Experimental::Internal::UnsplitBytes(void *destination, const void *source, std::size_t count,
+                                                std::size_t elementSize)
+{
+   auto dst = reinterpret_cast<unsigned char *>(destination);
+   auto src = reinterpret_cast<const unsigned char *>(source);
+   std::size_t first = 0;
+#ifdef R__NTUPLE_X86_KERNELS
+   switch (GetSIMDLevelRef().load(std::memory_order_relaxed)) {
+   case EColumnElementSIMDLevel::kAVX512:
+   case EColumnElementSIMDLevel::kAVX2: first = UnsplitBytesAVX2(dst, src, count, elementSize); break;
+   case EColumnElementSIMDLevel::kSSE41: first = UnsplitBytesSSE41(dst, src, count, elementSize); break;
+   default: break;
+   }
+#endif
+   UnsplitBytesScalar(dst, src, count, elementSize, first);
+}
+
+void ROOT::Experimental::Internal::PackBits(void *destination, const bool *source, std::size_t count)
+{
+   auto dst = reinterpret_cast<unsigned char *>(destination);
+   std::size_t first = 0;
+#ifdef R__NTUPLE_X86_KERNELS
+   switch (GetSIMDLevelRef().load(std::memory_order_relaxed)) {
+   case EColumnElementSIMDLevel::kAVX512: first = PackBitsAVX512(dst, source, count); break;
+   case EColumnElementSIMDLevel::kAVX2: first = PackBitsAVX2(dst, source, count); break;
+   case EColumnElementSIMDLevel::kSSE41: first = PackBitsSSE41(dst, source, count); break;
+   default: break;
+   }
+#endif
+   PackBitsScalar(dst, source, count, first);
+}
+
+void ROOT::Experimental::Internal::UnpackBits(bool *destination, const void *source, std::size_t count)
+{
+   auto src = reinterpret_cast<const unsigned char *>(source);
+   std::size_t first = 0;
+#ifdef R__NTUPLE_X86_KERNELS
+   switch (GetSIMDLevelRef().load(std::memory_order_relaxed)) {
+   case EColumnElementSIMDLevel::kAVX512: first = UnpackBitsAVX512(destination, src, count); break;
+   case EColumnElementSIMDLevel::kAVX2: first = UnpackBitsAVX2(destination, src, count); break;
+   case EColumnElementSIMDLevel::kSSE41: first = UnpackBitsSSE41(destination, src, count); break;
+   default: break;
+   }
+#endif
+   UnpackBitsScalar(destination, src, count, first);
+}
+
+void ROOT::Experimental::Internal::TruncateFloatsTo16Bits(std::uint16_t *destination, const float *source,
+                                                          std::size_t count)
+{
+   std::size_t first = 0;
+#ifdef R__NTUPLE_X86_KERNELS
+   switch (GetSIMDLevelRef().load(std::memory_order_relaxed)) {
+   case EColumnElementSIMDLevel::kAVX512: first = TruncateFloatsTo16BitsAVX512(destination, source, count); break;
+   case EColumnElementSIMDLevel::kAVX2: first = TruncateFloatsTo16BitsAVX2(destination, source, count); break;
+   case EColumnElementSIMDLevel::kSSE41: first = TruncateFloatsTo16BitsSSE41(destination, source, count); break;
+   default: break;
+   }
+#endif
+   TruncateFloatsTo16BitsScalar(destination, source, count, first);
+}
+
+void ROOT::Experimental::Internal::ExpandFloatsFrom16Bits(float *destination, const std::uint16_t *source,
+                                                          std::size_t count)
+{
+   std::size_t first = 0;
+#ifdef R__NTUPLE_X86_KERNELS
+   switch (GetSIMDLevelRef().load(std::memory_order_relaxed)) {
+   case EColumnElementSIMDLevel::kAVX512: first = ExpandFloatsFrom16BitsAVX512(destination, source, count); break;
+   case EColumnElementSIMDLevel::kAVX2: first = ExpandFloatsFrom16BitsAVX2(destination, source, count); break;
+   case EColumnElementSIMDLevel::kSSE41: first = ExpandFloatsFrom16BitsSSE41(destination, source, count); break;
+   default: break;
+   }
+#endif
+   ExpandFloatsFrom16BitsScalar(destination, source, count, first);
+}
+
+// The AVX-512 level uses the AVX2 kernels for bit streams; SSE4.1 lacks the gathers and the per-element shifts
+
+void ROOT::Experimental::Internal::PackBitStream(void *destination, const std::uint64_t *source, std::size_t count,
+                                                 std::size_t width)
+{
+   auto dst = reinterpret_cast<unsigned char *>(destination);
+   std::size_t first = 0;
+#ifdef R__NTUPLE_X86_KERNELS
+   switch (GetSIMDLevelRef().load(std::memory_order_relaxed)) {
+   case EColumnElementSIMDLevel::kAVX512:
+   case EColumnElementSIMDLevel::kAVX2: first = PackBitStreamAVX2(dst, source, count, width); break;
+   default: break;
+   }
+#endif
+   PackBitStreamScalar(dst, source, count, width, first);
+}
+
+void ROOT::Experimental::Internal::UnpackBitStream(std::uint64_t *destination, const void *source, std::size_t count,
+                                                   std::size_t width)
+{
+   auto src = reinterpret_cast<const unsigned char *>(source);
+   std::size_t first = 0;
+#ifdef R__NTUPLE_X86_KERNELS
+   switch (GetSIMDLevelRef().load(std::memory_order_relaxed)) {
+   case EColumnElementSIMDLevel::kAVX512:
+   case EColumnElementSIMDLevel::kAVX2: first = UnpackBitStreamAVX2(destination, src, count, width); break;
+   default: break;
+   }
+#endif
+   UnpackBitStreamScalar(destination, src, count, width, first);
+}
+
 template <>
 std::unique_ptr<ROOT::Experimental::Detail::RColumnElementBase>
 ROOT::Experimental::Detail::RColumnElementBase::Generate<void>(EColumnType type)
@@ -56,6 +781,15 @@ ROOT::Experimental::Detail::RColumnElementBase::Generate<void>(EColumnType type)
    case EColumnType::kSplitUInt32: return std::make_unique<RColumnElement<std::uint32_t, EColumnType::kSplitUInt32>>();
    case EColumnType::kSplitInt16: return std::make_unique<RColumnElement<std::int16_t, EColumnType::kSplitInt16>>();
    case EColumnType::kSplitUInt16: return std::make_unique<RColumnElement<std::uint16_t, EColumnType::kSplitUInt16>>();
+   case EColumnType::kPackedIndex64:
+      return std::make_unique<RColumnElement<ClusterSize_t, EColumnType::kPackedIndex64>>();
+   case EColumnType::kPackedIndex32:
+      return std::make_unique<RColumnElement<ClusterSize_t, EColumnType::kPackedIndex32>>();
+   case EColumnType::kPackedInt64: return std::make_unique<RColumnElement<std::int64_t, EColumnType::kPackedInt64>>();
+   case EColumnType::kPackedInt32: return std::make_unique<RColumnElement<std::int32_t, EColumnType::kPackedInt32>>();
+   case EColumnType::kPackedInt16: return std::make_unique<RColumnElement<std::int16_t, EColumnType::kPackedInt16>>();
+   case EColumnType::kReal32Trunc: return std::make_unique<RColumnElement<float, EColumnType::kReal32Trunc>>();
+   case EColumnType::kReal32Quant: return std::make_unique<RColumnElement<float, EColumnType::kReal32Quant>>();
    default: R__ASSERT(false);
    }
    // never here
@@ -90,12 +824,34 @@ std::size_t ROOT::Experimental::Detail::RColumnElementBase::GetBitsOnStorage(ECo
    case EColumnType::kSplitUInt32: return 32;
    case EColumnType::kSplitInt16: return 16;
    case EColumnType::kSplitUInt16: return 16;
+   case EColumnType::kPackedIndex64: return 65;
+   case EColumnType::kPackedIndex32: return 33;
+   case EColumnType::kPackedInt64: return 65;
+   case EColumnType::kPackedInt32: return 33;
+   case EColumnType::kPackedInt16: return 17;
+   case EColumnType::kReal32Trunc: return 32;
+   case EColumnType::kReal32Quant: return 32;
    default: R__ASSERT(false);
    }
    // never here
    return 0;
 }
 
+std::size_t ROOT::Experimental::Detail::RColumnElementBase::GetBitsOnStorage(const RColumnModel &model)
+{
+   if (model.GetBitsOnStorage() > 0)
+      return model.GetBitsOnStorage();
+   return GetBitsOnStorage(model.GetType());
+}
+
+void ROOT::Experimental::Detail::RColumnElementBase::ApplyColumnModel(const RColumnModel &model)
+{
+   if (model.GetBitsOnStorage() > 0)
+      SetBitsOnStorage(model.GetBitsOnStorage());
+   if (const auto &range = model.GetValueRange())
+      SetValueRange(range->first, range->second);
+}
+
 std::string ROOT::Experimental::Detail::RColumnElementBase::GetTypeName(EColumnType type) {
    switch (type) {
    case EColumnType::kIndex64: return "Index64";
@@ -124,6 +880,13 @@ std::string ROOT::Experimental::Detail::RColumnElementBase::GetTypeName(EColumnT
    case EColumnType::kSplitUInt32: return "SplitUInt32";
    case EColumnType::kSplitInt16: return "SplitInt16";
    case EColumnType::kSplitUInt16: return "SplitUInt16";
+   case EColumnType::kPackedIndex64: return "PackedIndex64";
+   case EColumnType::kPackedIndex32: return "PackedIndex32";
+   case EColumnType::kPackedInt64: return "PackedInt64";
+   case EColumnType::kPackedInt32: return "PackedInt32";
+   case EColumnType::kPackedInt16: return "PackedInt16";
+   case EColumnType::kReal32Trunc: return "Real32Trunc";
+   case EColumnType::kReal32Quant: return "Real32Quant";
    default: return "UNKNOWN";
    }
 }
@@ -131,33 +894,11 @@ std::string ROOT::Experimental::Detail::RColumnElementBase::GetTypeName(EColumnT
 void ROOT::Experimental::Detail::RColumnElement<bool, ROOT::Experimental::EColumnType::kBit>::Pack(
   void *dst, void *src, std::size_t count) const
 {
-   bool *boolArray = reinterpret_cast<bool *>(src);
-   char *charArray = reinterpret_cast<char *>(dst);
-   std::bitset<8> bitSet;
-   std::size_t i = 0;
-   for (; i < count; ++i) {
-      bitSet.set(i % 8, boolArray[i]);
-      if (i % 8 == 7) {
-         char packed = bitSet.to_ulong();
-         charArray[i / 8] = packed;
-      }
-   }
-   if (i % 8 != 0) {
-      char packed = bitSet.to_ulong();
-      charArray[i / 8] = packed;
-   }
+   Internal::PackBits(dst, reinterpret_cast<const bool *>(src), count);
 }
 
 void ROOT::Experimental::Detail::RColumnElement<bool, ROOT::Experimental::EColumnType::kBit>::Unpack(
   void *dst, void *src, std::size_t count) const
 {
-   bool *boolArray = reinterpret_cast<bool *>(dst);
-   char *charArray = reinterpret_cast<char *>(src);
-   std::bitset<8> bitSet;
-   for (std::size_t i = 0; i < count; i += 8) {
-      bitSet = charArray[i / 8];
-      for (std::size_t j = i; j < std::min(count, i + 8); ++j) {
-         boolArray[j] = bitSet[j % 8];
-      }
-   }
+   Internal::UnpackBits(reinterpret_cast<bool *>(dst), src, count);
 }
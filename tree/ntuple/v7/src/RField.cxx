@@ -47,6 +47,7 @@
 #include <exception>
 #include <iostream>
 #include <new> // hardware_destructive_interference_size
+#include <optional>
 #include <type_traits>
 #include <unordered_map>
 
@@ -220,6 +221,49 @@ void SyncFieldIDs(const ROOT::Experimental::Detail::RFieldBase &from, ROOT::Expe
    }
 }
 
+/// Creates the column model of a float or double field, which, for the lossy column types, includes the bit width
+/// and the value range
+ROOT::Experimental::RColumnModel
+MakeRealColumnModel(ROOT::Experimental::EColumnType type, std::uint16_t bitsOnStorage,
+                    const std::optional<ROOT::Experimental::RColumnModel::ValueRange_t> &valueRange,
+                    const std::string &fieldName)
+{
+   using ROOT::Experimental::EColumnType;
+   ROOT::Experimental::RColumnModel model(type);
+   if (type == EColumnType::kReal32Trunc || type == EColumnType::kReal32Quant)
+      model.SetBitsOnStorage(bitsOnStorage);
+   if (type == EColumnType::kReal32Quant) {
+      if (!valueRange) {
+         throw ROOT::Experimental::RException(
+            R__FAIL("quantized field `" + fieldName + "` requires a value range, use SetQuantized()"));
+      }
+      model.SetValueRange(valueRange->first, valueRange->second);
+   }
+   return model;
+}
+
+/// Quantized columns can only represent the values of their value range.  The fields check the values when they are
+/// appended, so that the error reaches the caller of Fill() instead of being raised when the page is sealed, possibly
+/// by a concurrent task.
+template <typename T>
+void EnsureInQuantizedRange(T value, const ROOT::Experimental::RColumnModel::ValueRange_t &valueRange,
+                            const std::string &fieldName)
+{
+   if (!(value >= valueRange.first && value <= valueRange.second)) {
+      throw ROOT::Experimental::RException(R__FAIL("value " + std::to_string(value) + " of quantized field `" +
+                                                   fieldName + "` outside of the range [" +
+                                                   std::to_string(valueRange.first) + ", " +
+                                                   std::to_string(valueRange.second) + "]"));
+   }
+}
+
+/// Returns the column model of the first column of the given on-disk field
+ROOT::Experimental::RColumnModel
+GetOnDiskColumnModel(const ROOT::Experimental::RNTupleDescriptor &desc, ROOT::Experimental::DescriptorId_t fieldId)
+{
+   return (*desc.GetColumnIterable(fieldId).begin()).GetModel();
+}
+
 } // anonymous namespace
 
 //------------------------------------------------------------------------------
@@ -247,7 +291,8 @@ ROOT::Experimental::Detail::RFieldBase::RBulk::RBulk(RBulk &&other)
      fCapacity(other.fCapacity),
      fSize(other.fSize),
      fNValidValues(other.fNValidValues),
-     fFirstIndex(other.fFirstIndex)
+     fFirstIndex(other.fFirstIndex),
+     fAuxData(std::move(other.fAuxData))
 {
    std::swap(fValues, other.fValues);
    std::swap(fMaskAvail, other.fMaskAvail);
@@ -263,6 +308,7 @@ ROOT::Experimental::Detail::RFieldBase::RBulk &ROOT::Experimental::Detail::RFiel
    std::swap(fMaskAvail, other.fMaskAvail);
    std::swap(fNValidValues, other.fNValidValues);
    std::swap(fFirstIndex, other.fFirstIndex);
+   std::swap(fAuxData, other.fAuxData);
    return *this;
 }
 
@@ -449,6 +495,17 @@ ROOT::Experimental::Detail::RFieldBase::Create(const std::string &fieldName, con
       auto normalizedInnerTypeName = itemField->GetType();
       result =
          std::make_unique<RSetField>(fieldName, "std::set<" + normalizedInnerTypeName + ">", std::move(itemField));
+   } else if (canonicalType.substr(0, 9) == "std::map<" || canonicalType.substr(0, 19) == "std::unordered_map<") {
+      const std::string mapTypePrefix = canonicalType.substr(0, canonicalType.find('<') + 1);
+      auto innerTypes = TokenizeTypeList(
+         canonicalType.substr(mapTypePrefix.length(), canonicalType.length() - mapTypePrefix.length() - 1));
+      if (innerTypes.size() != 2)
+         return R__FAIL("the type list for " + mapTypePrefix + "> must have exactly two elements");
+      std::array<std::unique_ptr<RFieldBase>, 2> items{Create("_0", innerTypes[0]).Unwrap(),
+                                                       Create("_1", innerTypes[1]).Unwrap()};
+      const auto normalizedTypeName = mapTypePrefix + items[0]->GetType() + "," + items[1]->GetType() + ">";
+      auto itemField = std::make_unique<RPairField>("_0", items);
+      result = std::make_unique<RMapField>(fieldName, normalizedTypeName, std::move(itemField));
    } else if (canonicalType == ":Collection:") {
       // TODO: create an RCollectionField?
       result = std::make_unique<RField<ClusterSize_t>>(fieldName);
@@ -690,6 +747,7 @@ void ROOT::Experimental::Detail::RFieldBase::AutoAdjustColumnTypes(const RNTuple
          switch (colType) {
          case EColumnType::kSplitIndex64: colType = EColumnType::kSplitIndex32; break;
          case EColumnType::kIndex64: colType = EColumnType::kIndex32; break;
+         case EColumnType::kPackedIndex64: colType = EColumnType::kPackedIndex32; break;
          default: break;
          }
       }
@@ -774,9 +832,13 @@ void ROOT::Experimental::RFieldZero::AcceptVisitor(Detail::RFieldVisitor &visito
 const ROOT::Experimental::Detail::RFieldBase::RColumnRepresentations &
 ROOT::Experimental::RField<ROOT::Experimental::ClusterSize_t>::GetColumnRepresentations() const
 {
-   static RColumnRepresentations representations(
-      {{EColumnType::kSplitIndex64}, {EColumnType::kIndex64}, {EColumnType::kSplitIndex32}, {EColumnType::kIndex32}},
-      {});
+   static RColumnRepresentations representations({{EColumnType::kSplitIndex64},
+                                                  {EColumnType::kIndex64},
+                                                  {EColumnType::kSplitIndex32},
+                                                  {EColumnType::kIndex32},
+                                                  {EColumnType::kPackedIndex64},
+                                                  {EColumnType::kPackedIndex32}},
+                                                 {});
    return representations;
 }
 
@@ -801,9 +863,13 @@ void ROOT::Experimental::RField<ROOT::Experimental::ClusterSize_t>::AcceptVisito
 const ROOT::Experimental::Detail::RFieldBase::RColumnRepresentations &
 ROOT::Experimental::RCardinalityField::GetColumnRepresentations() const
 {
-   static RColumnRepresentations representations(
-      {{EColumnType::kSplitIndex64}, {EColumnType::kIndex64}, {EColumnType::kSplitIndex32}, {EColumnType::kIndex32}},
-      {});
+   static RColumnRepresentations representations({{EColumnType::kSplitIndex64},
+                                                  {EColumnType::kIndex64},
+                                                  {EColumnType::kSplitIndex32},
+                                                  {EColumnType::kIndex32},
+                                                  {EColumnType::kPackedIndex64},
+                                                  {EColumnType::kPackedIndex32}},
+                                                 {});
    return representations;
 }
 
@@ -935,19 +1001,55 @@ void ROOT::Experimental::RField<bool>::AcceptVisitor(Detail::RFieldVisitor &visi
 const ROOT::Experimental::Detail::RFieldBase::RColumnRepresentations &
 ROOT::Experimental::RField<float>::GetColumnRepresentations() const
 {
-   static RColumnRepresentations representations({{EColumnType::kSplitReal32}, {EColumnType::kReal32}}, {});
+   static RColumnRepresentations representations({{EColumnType::kSplitReal32},
+                                                  {EColumnType::kReal32},
+                                                  {EColumnType::kReal32Trunc},
+                                                  {EColumnType::kReal32Quant}},
+                                                 {});
    return representations;
 }
 
 void ROOT::Experimental::RField<float>::GenerateColumnsImpl()
 {
-   fColumns.emplace_back(Detail::RColumn::Create<float>(RColumnModel(GetColumnRepresentative()[0]), 0));
+   const auto type = GetColumnRepresentative()[0];
+   auto model = MakeRealColumnModel(type, fBitsOnStorage, fValueRange, GetQualifiedFieldName());
+   fColumns.emplace_back(Detail::RColumn::Create<float>(model, 0));
+   // Quantized values take the AppendImpl() path, which checks the value range
+   if (type == EColumnType::kReal32Quant)
+      fTraits &= ~kTraitMappable;
+   else
+      fTraits |= kTraitMappable;
+}
+
+std::size_t ROOT::Experimental::RField<float>::AppendImpl(const void *from)
+{
+   EnsureInQuantizedRange(*static_cast<const float *>(from), *fValueRange, GetQualifiedFieldName());
+   fPrincipalColumn->Append(from);
+   return fPrincipalColumn->GetElement()->GetPackedSize();
 }
 
 void ROOT::Experimental::RField<float>::GenerateColumnsImpl(const RNTupleDescriptor &desc)
 {
-   auto onDiskTypes = EnsureCompatibleColumnTypes(desc);
-   fColumns.emplace_back(Detail::RColumn::Create<float>(RColumnModel(onDiskTypes[0]), 0));
+   EnsureCompatibleColumnTypes(desc);
+   fColumns.emplace_back(Detail::RColumn::Create<float>(GetOnDiskColumnModel(desc, GetOnDiskId()), 0));
+}
+
+void ROOT::Experimental::RField<float>::SetTruncated(std::size_t nBits)
+{
+   Detail::RColumnElement<float, EColumnType::kReal32Trunc>().SetBitsOnStorage(nBits);
+   SetColumnRepresentative({EColumnType::kReal32Trunc});
+   fBitsOnStorage = nBits;
+   fValueRange.reset();
+}
+
+void ROOT::Experimental::RField<float>::SetQuantized(double min, double max, std::size_t nBits)
+{
+   Detail::RColumnElement<float, EColumnType::kReal32Quant> element;
+   element.SetBitsOnStorage(nBits);
+   element.SetValueRange(min, max);
+   SetColumnRepresentative({EColumnType::kReal32Quant});
+   fBitsOnStorage = nBits;
+   fValueRange = RColumnModel::ValueRange_t(min, max);
 }
 
 void ROOT::Experimental::RField<float>::AcceptVisitor(Detail::RFieldVisitor &visitor) const
@@ -961,20 +1063,39 @@ void ROOT::Experimental::RField<float>::AcceptVisitor(Detail::RFieldVisitor &vis
 const ROOT::Experimental::Detail::RFieldBase::RColumnRepresentations &
 ROOT::Experimental::RField<double>::GetColumnRepresentations() const
 {
-   static RColumnRepresentations representations(
-      {{EColumnType::kSplitReal64}, {EColumnType::kReal64}, {EColumnType::kSplitReal32}, {EColumnType::kReal32}}, {});
+   static RColumnRepresentations representations({{EColumnType::kSplitReal64},
+                                                  {EColumnType::kReal64},
+                                                  {EColumnType::kSplitReal32},
+                                                  {EColumnType::kReal32},
+                                                  {EColumnType::kReal32Trunc},
+                                                  {EColumnType::kReal32Quant}},
+                                                 {});
    return representations;
 }
 
 void ROOT::Experimental::RField<double>::GenerateColumnsImpl()
 {
-   fColumns.emplace_back(Detail::RColumn::Create<double>(RColumnModel(GetColumnRepresentative()[0]), 0));
+   const auto type = GetColumnRepresentative()[0];
+   auto model = MakeRealColumnModel(type, fBitsOnStorage, fValueRange, GetQualifiedFieldName());
+   fColumns.emplace_back(Detail::RColumn::Create<double>(model, 0));
+   // Quantized values take the AppendImpl() path, which checks the value range
+   if (type == EColumnType::kReal32Quant)
+      fTraits &= ~kTraitMappable;
+   else
+      fTraits |= kTraitMappable;
+}
+
+std::size_t ROOT::Experimental::RField<double>::AppendImpl(const void *from)
+{
+   EnsureInQuantizedRange(*static_cast<const double *>(from), *fValueRange, GetQualifiedFieldName());
+   fPrincipalColumn->Append(from);
+   return fPrincipalColumn->GetElement()->GetPackedSize();
 }
 
 void ROOT::Experimental::RField<double>::GenerateColumnsImpl(const RNTupleDescriptor &desc)
 {
-   auto onDiskTypes = EnsureCompatibleColumnTypes(desc);
-   fColumns.emplace_back(Detail::RColumn::Create<double>(RColumnModel(onDiskTypes[0]), 0));
+   EnsureCompatibleColumnTypes(desc);
+   fColumns.emplace_back(Detail::RColumn::Create<double>(GetOnDiskColumnModel(desc, GetOnDiskId()), 0));
 }
 
 void ROOT::Experimental::RField<double>::AcceptVisitor(Detail::RFieldVisitor &visitor) const
@@ -987,12 +1108,32 @@ void ROOT::Experimental::RField<double>::SetDouble32()
    fTypeAlias = "Double32_t";
 }
 
+void ROOT::Experimental::RField<double>::SetTruncated(std::size_t nBits)
+{
+   Detail::RColumnElement<double, EColumnType::kReal32Trunc>().SetBitsOnStorage(nBits);
+   SetColumnRepresentative({EColumnType::kReal32Trunc});
+   fBitsOnStorage = nBits;
+   fValueRange.reset();
+}
+
+void ROOT::Experimental::RField<double>::SetQuantized(double min, double max, std::size_t nBits)
+{
+   Detail::RColumnElement<double, EColumnType::kReal32Quant> element;
+   element.SetBitsOnStorage(nBits);
+   element.SetValueRange(min, max);
+   SetColumnRepresentative({EColumnType::kReal32Quant});
+   fBitsOnStorage = nBits;
+   fValueRange = RColumnModel::ValueRange_t(min, max);
+}
+
 //------------------------------------------------------------------------------
 
 const ROOT::Experimental::Detail::RFieldBase::RColumnRepresentations &
 ROOT::Experimental::RField<std::int16_t>::GetColumnRepresentations() const
 {
-   static RColumnRepresentations representations({{EColumnType::kSplitInt16}, {EColumnType::kInt16}},
+   static RColumnRepresentations representations({{EColumnType::kSplitInt16},
+                                                  {EColumnType::kInt16},
+                                                  {EColumnType::kPackedInt16}},
                                                  {{EColumnType::kSplitUInt16}, {EColumnType::kUInt16}});
    return representations;
 }
@@ -1018,7 +1159,9 @@ void ROOT::Experimental::RField<std::int16_t>::AcceptVisitor(Detail::RFieldVisit
 const ROOT::Experimental::Detail::RFieldBase::RColumnRepresentations &
 ROOT::Experimental::RField<std::uint16_t>::GetColumnRepresentations() const
 {
-   static RColumnRepresentations representations({{EColumnType::kSplitUInt16}, {EColumnType::kUInt16}},
+   static RColumnRepresentations representations({{EColumnType::kSplitUInt16},
+                                                  {EColumnType::kUInt16},
+                                                  {EColumnType::kPackedInt16}},
                                                  {{EColumnType::kSplitInt16}, {EColumnType::kInt16}});
    return representations;
 }
@@ -1044,7 +1187,9 @@ void ROOT::Experimental::RField<std::uint16_t>::AcceptVisitor(Detail::RFieldVisi
 const ROOT::Experimental::Detail::RFieldBase::RColumnRepresentations &
 ROOT::Experimental::RField<std::int32_t>::GetColumnRepresentations() const
 {
-   static RColumnRepresentations representations({{EColumnType::kSplitInt32}, {EColumnType::kInt32}},
+   static RColumnRepresentations representations({{EColumnType::kSplitInt32},
+                                                  {EColumnType::kInt32},
+                                                  {EColumnType::kPackedInt32}},
                                                  {{EColumnType::kSplitUInt32}, {EColumnType::kUInt32}});
    return representations;
 }
@@ -1070,7 +1215,9 @@ void ROOT::Experimental::RField<std::int32_t>::AcceptVisitor(Detail::RFieldVisit
 const ROOT::Experimental::Detail::RFieldBase::RColumnRepresentations &
 ROOT::Experimental::RField<std::uint32_t>::GetColumnRepresentations() const
 {
-   static RColumnRepresentations representations({{EColumnType::kSplitUInt32}, {EColumnType::kUInt32}},
+   static RColumnRepresentations representations({{EColumnType::kSplitUInt32},
+                                                  {EColumnType::kUInt32},
+                                                  {EColumnType::kPackedInt32}},
                                                  {{EColumnType::kSplitInt32}, {EColumnType::kInt32}});
    return representations;
 }
@@ -1096,7 +1243,9 @@ void ROOT::Experimental::RField<std::uint32_t>::AcceptVisitor(Detail::RFieldVisi
 const ROOT::Experimental::Detail::RFieldBase::RColumnRepresentations &
 ROOT::Experimental::RField<std::uint64_t>::GetColumnRepresentations() const
 {
-   static RColumnRepresentations representations({{EColumnType::kSplitUInt64}, {EColumnType::kUInt64}},
+   static RColumnRepresentations representations({{EColumnType::kSplitUInt64},
+                                                  {EColumnType::kUInt64},
+                                                  {EColumnType::kPackedInt64}},
                                                  {{EColumnType::kSplitInt64}, {EColumnType::kInt64}});
    return representations;
 }
@@ -1122,7 +1271,9 @@ void ROOT::Experimental::RField<std::uint64_t>::AcceptVisitor(Detail::RFieldVisi
 const ROOT::Experimental::Detail::RFieldBase::RColumnRepresentations &
 ROOT::Experimental::RField<std::int64_t>::GetColumnRepresentations() const
 {
-   static RColumnRepresentations representations({{EColumnType::kSplitInt64}, {EColumnType::kInt64}},
+   static RColumnRepresentations representations({{EColumnType::kSplitInt64},
+                                                  {EColumnType::kInt64},
+                                                  {EColumnType::kPackedInt64}},
                                                  {{EColumnType::kSplitUInt64},
                                                   {EColumnType::kUInt64},
                                                   {EColumnType::kInt32},
@@ -1156,7 +1307,9 @@ ROOT::Experimental::RField<std::string>::GetColumnRepresentations() const
    static RColumnRepresentations representations({{EColumnType::kSplitIndex64, EColumnType::kChar},
                                                   {EColumnType::kIndex64, EColumnType::kChar},
                                                   {EColumnType::kSplitIndex32, EColumnType::kChar},
-                                                  {EColumnType::kIndex32, EColumnType::kChar}},
+                                                  {EColumnType::kIndex32, EColumnType::kChar},
+                                                  {EColumnType::kPackedIndex64, EColumnType::kChar},
+                                                  {EColumnType::kPackedIndex32, EColumnType::kChar}},
                                                  {});
    return representations;
 }
@@ -1597,9 +1750,13 @@ void ROOT::Experimental::RProxiedCollectionField::ReadGlobalImpl(NTupleSize_t gl
 const ROOT::Experimental::Detail::RFieldBase::RColumnRepresentations &
 ROOT::Experimental::RProxiedCollectionField::GetColumnRepresentations() const
 {
-   static RColumnRepresentations representations(
-      {{EColumnType::kSplitIndex64}, {EColumnType::kIndex64}, {EColumnType::kSplitIndex32}, {EColumnType::kIndex32}},
-      {});
+   static RColumnRepresentations representations({{EColumnType::kSplitIndex64},
+                                                  {EColumnType::kIndex64},
+                                                  {EColumnType::kSplitIndex32},
+                                                  {EColumnType::kIndex32},
+                                                  {EColumnType::kPackedIndex64},
+                                                  {EColumnType::kPackedIndex32}},
+                                                 {});
    return representations;
 }
 
@@ -1835,12 +1992,55 @@ void ROOT::Experimental::RVectorField::ReadGlobalImpl(NTupleSize_t globalIndex,
    }
 }
 
+std::size_t ROOT::Experimental::RVectorField::ReadBulkImpl(const RBulkSpec &bulkSpec)
+{
+   if (!fSubFields[0]->IsSimple())
+      return RFieldBase::ReadBulkImpl(bulkSpec);
+
+   auto typedValues = static_cast<std::vector<char> *>(bulkSpec.fValues);
+   auto itemColumn = GetPrincipalColumnOf(*fSubFields[0]);
+
+   RClusterIndex collectionStart;
+   ClusterSize_t collectionSize;
+   fPrincipalColumn->GetCollectionInfo(bulkSpec.fFirstIndex, &collectionStart, &collectionSize);
+   typedValues[0].resize(collectionSize * fItemSize);
+   if (collectionSize > 0)
+      itemColumn->ReadV(collectionStart, collectionSize, typedValues[0].data());
+
+   // Go page by page through the offset column, which saves the page lookup for every offset.  The items of each
+   // vector are read by a separate ReadV() call directly into the vector's storage, i.e. with one memcpy per item
+   // page that the vector spans; they are not coalesced across vectors because every vector has its own buffer.
+   auto lastOffset = collectionStart.GetIndex() + collectionSize;
+   ClusterSize_t::ValueType nRemainingValues = bulkSpec.fCount - 1;
+   std::size_t nValues = 1;
+   while (nRemainingValues > 0) {
+      NTupleSize_t nElementsUntilPageEnd;
+      const auto offsets = fPrincipalColumn->MapV<ClusterSize_t>(bulkSpec.fFirstIndex + nValues, nElementsUntilPageEnd);
+      const std::size_t nBatch = std::min(nRemainingValues, nElementsUntilPageEnd);
+      for (std::size_t i = 0; i < nBatch; ++i) {
+         const auto size = offsets[i] - lastOffset;
+         auto &vec = typedValues[nValues + i];
+         vec.resize(size * fItemSize);
+         if (size > 0)
+            itemColumn->ReadV(RClusterIndex(collectionStart.GetClusterId(), lastOffset), size, vec.data());
+         lastOffset = offsets[i];
+      }
+      nRemainingValues -= nBatch;
+      nValues += nBatch;
+   }
+   return RBulkSpec::kAllSet;
+}
+
 const ROOT::Experimental::Detail::RFieldBase::RColumnRepresentations &
 ROOT::Experimental::RVectorField::GetColumnRepresentations() const
 {
-   static RColumnRepresentations representations(
-      {{EColumnType::kSplitIndex64}, {EColumnType::kIndex64}, {EColumnType::kSplitIndex32}, {EColumnType::kIndex32}},
-      {});
+   static RColumnRepresentations representations({{EColumnType::kSplitIndex64},
+                                                  {EColumnType::kIndex64},
+                                                  {EColumnType::kSplitIndex32},
+                                                  {EColumnType::kIndex32},
+                                                  {EColumnType::kPackedIndex64},
+                                                  {EColumnType::kPackedIndex32}},
+                                                 {});
    return representations;
 }
 
@@ -2055,16 +2255,21 @@ std::size_t ROOT::Experimental::RRVecField::ReadBulkImpl(const RBulkSpec &bulkSp
       }
    }
 
-   GetPrincipalColumnOf(*fSubFields[0])->ReadV(firstItemIndex, nItems, itemValueArray - delta);
+   if (nItems > 0)
+      GetPrincipalColumnOf(*fSubFields[0])->ReadV(firstItemIndex, nItems, itemValueArray - delta);
    return RBulkSpec::kAllSet;
 }
 
 const ROOT::Experimental::Detail::RFieldBase::RColumnRepresentations &
 ROOT::Experimental::RRVecField::GetColumnRepresentations() const
 {
-   static RColumnRepresentations representations(
-      {{EColumnType::kSplitIndex64}, {EColumnType::kIndex64}, {EColumnType::kSplitIndex32}, {EColumnType::kIndex32}},
-      {});
+   static RColumnRepresentations representations({{EColumnType::kSplitIndex64},
+                                                  {EColumnType::kIndex64},
+                                                  {EColumnType::kSplitIndex32},
+                                                  {EColumnType::kIndex32},
+                                                  {EColumnType::kPackedIndex64},
+                                                  {EColumnType::kPackedIndex32}},
+                                                 {});
    return representations;
 }
 
@@ -2240,9 +2445,13 @@ void ROOT::Experimental::RField<std::vector<bool>>::ReadGlobalImpl(NTupleSize_t
 const ROOT::Experimental::Detail::RFieldBase::RColumnRepresentations &
 ROOT::Experimental::RField<std::vector<bool>>::GetColumnRepresentations() const
 {
-   static RColumnRepresentations representations(
-      {{EColumnType::kSplitIndex64}, {EColumnType::kIndex64}, {EColumnType::kSplitIndex32}, {EColumnType::kIndex32}},
-      {});
+   static RColumnRepresentations representations({{EColumnType::kSplitIndex64},
+                                                  {EColumnType::kIndex64},
+                                                  {EColumnType::kSplitIndex32},
+                                                  {EColumnType::kIndex32},
+                                                  {EColumnType::kPackedIndex64},
+                                                  {EColumnType::kPackedIndex32}},
+                                                 {});
    return representations;
 }
 
@@ -2580,6 +2789,72 @@ ROOT::Experimental::RSetField::CloneImpl(std::string_view newName) const
 
 //------------------------------------------------------------------------------
 
+ROOT::Experimental::RMapField::RMapField(std::string_view fieldName, std::string_view typeName,
+                                         std::unique_ptr<Detail::RFieldBase> itemField)
+   : ROOT::Experimental::RProxiedCollectionField(fieldName, typeName, std::move(itemField))
+{
+   if (!(fProperties & TVirtualCollectionProxy::kIsAssociative))
+      throw RException(R__FAIL(std::string(typeName) + " is not an associative collection"));
+}
+
+std::unique_ptr<ROOT::Experimental::Detail::RFieldBase>
+ROOT::Experimental::RMapField::CloneImpl(std::string_view newName) const
+{
+   auto newItemField = fSubFields[0]->Clone(fSubFields[0]->GetName());
+   return std::unique_ptr<RMapField>(new RMapField(newName, GetType(), std::move(newItemField)));
+}
+
+//------------------------------------------------------------------------------
+
+ROOT::Experimental::RMapFieldBase::RMapFieldBase(std::string_view fieldName, std::string_view typeName,
+                                                 std::unique_ptr<Detail::RFieldBase> itemField)
+   : ROOT::Experimental::Detail::RFieldBase(fieldName, typeName, ENTupleStructure::kCollection, false /* isSimple */),
+     fNWritten(0)
+{
+   auto itemSubFields = itemField->GetSubFields();
+   if (itemSubFields.size() != 2)
+      throw RException(R__FAIL("the item field of map " + std::string(typeName) + " must be a key-value pair"));
+   fKeyField = itemSubFields[0];
+   fValueField = itemSubFields[1];
+   Attach(std::move(itemField));
+}
+
+const ROOT::Experimental::Detail::RFieldBase::RColumnRepresentations &
+ROOT::Experimental::RMapFieldBase::GetColumnRepresentations() const
+{
+   static RColumnRepresentations representations({{EColumnType::kSplitIndex64},
+                                                  {EColumnType::kIndex64},
+                                                  {EColumnType::kSplitIndex32},
+                                                  {EColumnType::kIndex32},
+                                                  {EColumnType::kPackedIndex64},
+                                                  {EColumnType::kPackedIndex32}},
+                                                 {});
+   return representations;
+}
+
+void ROOT::Experimental::RMapFieldBase::GenerateColumnsImpl()
+{
+   fColumns.emplace_back(Detail::RColumn::Create<ClusterSize_t>(RColumnModel(GetColumnRepresentative()[0]), 0));
+}
+
+void ROOT::Experimental::RMapFieldBase::GenerateColumnsImpl(const RNTupleDescriptor &desc)
+{
+   auto onDiskTypes = EnsureCompatibleColumnTypes(desc);
+   fColumns.emplace_back(Detail::RColumn::Create<ClusterSize_t>(RColumnModel(onDiskTypes[0]), 0));
+}
+
+void ROOT::Experimental::RMapFieldBase::CommitCluster()
+{
+   fNWritten = 0;
+}
+
+void ROOT::Experimental::RMapFieldBase::AcceptVisitor(Detail::RFieldVisitor &visitor) const
+{
+   visitor.VisitMapField(*this);
+}
+
+//------------------------------------------------------------------------------
+
 ROOT::Experimental::RNullableField::RNullableField(std::string_view fieldName, std::string_view typeName,
                                                    std::unique_ptr<Detail::RFieldBase> itemField)
    : ROOT::Experimental::Detail::RFieldBase(fieldName, typeName, ENTupleStructure::kCollection, false /* isSimple */)
@@ -2590,9 +2865,14 @@ ROOT::Experimental::RNullableField::RNullableField(std::string_view fieldName, s
 const ROOT::Experimental::Detail::RFieldBase::RColumnRepresentations &
 ROOT::Experimental::RNullableField::GetColumnRepresentations() const
 {
-   static RColumnRepresentations representations(
-      {{EColumnType::kSplitIndex64}, {EColumnType::kIndex64}, {EColumnType::kSplitIndex32}, {EColumnType::kIndex32},
-       {EColumnType::kBit}}, {});
+   static RColumnRepresentations representations({{EColumnType::kSplitIndex64},
+                                                  {EColumnType::kIndex64},
+                                                  {EColumnType::kSplitIndex32},
+                                                  {EColumnType::kIndex32},
+                                                  {EColumnType::kPackedIndex64},
+                                                  {EColumnType::kPackedIndex32},
+                                                  {EColumnType::kBit}},
+                                                 {});
    return representations;
 }
 
@@ -2883,9 +3163,13 @@ ROOT::Experimental::RCollectionField::RCollectionField(
 const ROOT::Experimental::Detail::RFieldBase::RColumnRepresentations &
 ROOT::Experimental::RCollectionField::GetColumnRepresentations() const
 {
-   static RColumnRepresentations representations(
-      {{EColumnType::kSplitIndex64}, {EColumnType::kIndex64}, {EColumnType::kSplitIndex32}, {EColumnType::kIndex32}},
-      {});
+   static RColumnRepresentations representations({{EColumnType::kSplitIndex64},
+                                                  {EColumnType::kIndex64},
+                                                  {EColumnType::kSplitIndex32},
+                                                  {EColumnType::kIndex32},
+                                                  {EColumnType::kPackedIndex64},
+                                                  {EColumnType::kPackedIndex32}},
+                                                 {});
    return representations;
 }
 
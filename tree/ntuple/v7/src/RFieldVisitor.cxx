@@ -385,6 +385,11 @@ void ROOT::Experimental::RPrintValueVisitor::VisitProxiedCollectionField(const R
    PrintCollection(field);
 }
 
+void ROOT::Experimental::RPrintValueVisitor::VisitMapField(const RMapFieldBase &field)
+{
+   PrintCollection(field);
+}
+
 void ROOT::Experimental::RPrintValueVisitor::VisitVectorField(const RVectorField &field)
 {
    PrintCollection(field);
@@ -1153,6 +1153,16 @@ void ROOT::Experimental::Internal::RNTupleFileWriter::RFileProper::Write(
 }
 
 
+void ROOT::Experimental::Internal::RNTupleFileWriter::RFileProper::Read(void *buffer, size_t nbytes,
+                                                                        std::int64_t offset)
+{
+   R__ASSERT(fFile);
+   if (fFile->ReadBuffer(static_cast<char *>(buffer), offset, nbytes))
+      throw RException(R__FAIL("failed to read " + std::to_string(nbytes) + " bytes at offset " +
+                               std::to_string(offset) + " from '" + fFile->GetName() + "'"));
+}
+
+
 std::uint64_t ROOT::Experimental::Internal::RNTupleFileWriter::RFileProper::WriteKey(
    const void *buffer, size_t nbytes, size_t len)
 {
@@ -1256,12 +1266,41 @@ ROOT::Experimental::Internal::RNTupleFileWriter *ROOT::Experimental::Internal::R
 }
 
 
+ROOT::Experimental::Internal::RNTupleFileWriter *
+ROOT::Experimental::Internal::RNTupleFileWriter::Update(std::string_view ntupleName, TFile &file)
+{
+   if (!file.IsWritable())
+      throw RException(R__FAIL("file '" + std::string(file.GetName()) + "' is not writable"));
+   auto ntuple = std::unique_ptr<ROOT::Experimental::RNTuple>(
+      file.Get<ROOT::Experimental::RNTuple>(std::string(ntupleName).c_str()));
+   if (!ntuple) {
+      throw RException(R__FAIL("no RNTuple named '" + std::string(ntupleName) + "' in file '" + file.GetName() +
+                               "'"));
+   }
+
+   auto writer = new RNTupleFileWriter(ntupleName);
+   writer->fFileProper.fFile = &file;
+   writer->fNTupleAnchor = ntuple->GetAnchor();
+   writer->fIsUpdate = true;
+   return writer;
+}
+
+
+void ROOT::Experimental::Internal::RNTupleFileWriter::ReadBuffer(void *buffer, size_t nbytes, std::uint64_t offset)
+{
+   R__ASSERT(fIsUpdate);
+   fFileProper.Read(buffer, nbytes, offset);
+}
+
+
 void ROOT::Experimental::Internal::RNTupleFileWriter::Commit()
 {
    if (fFileProper) {
-      // Easy case, the ROOT file header and the RNTuple streaming is taken care of by TFile
+      // Easy case, the ROOT file header and the RNTuple streaming is taken care of by TFile.  When updating, the new
+      // anchor is written as a new key cycle before the key of the previous anchor is deleted, so that the space of
+      // the previous anchor cannot be reused for the new one.
       ROOT::Experimental::RNTuple ntuple(fNTupleAnchor);
-      fFileProper.fFile->WriteObject(&ntuple, fNTupleName.c_str());
+      fFileProper.fFile->WriteObject(&ntuple, fNTupleName.c_str(), fIsUpdate ? "WriteDelete" : "");
       fFileProper.fFile->Write();
       return;
    }
@@ -16,6 +16,7 @@
 #include <ROOT/RNTuple.hxx>
 
 #include <ROOT/RFieldVisitor.hxx>
+#include <ROOT/RNTupleIndex.hxx>
 #include <ROOT/RNTupleModel.hxx>
 #include <ROOT/RPageSourceFriends.hxx>
 #include <ROOT/RPageStorage.hxx>
@@ -144,10 +145,49 @@ std::unique_ptr<ROOT::Experimental::RNTupleReader>
 ROOT::Experimental::RNTupleReader::OpenFriends(std::span<ROpenSpec> ntuples)
 {
    std::vector<std::unique_ptr<Detail::RPageSource>> sources;
+   std::vector<bool> isJoined;
    for (const auto &n : ntuples) {
       sources.emplace_back(Detail::RPageSource::Create(n.fNTupleName, n.fStorage, n.fOptions));
+      isJoined.emplace_back(!n.fJoinFields.empty());
    }
-   return std::make_unique<RNTupleReader>(std::make_unique<Detail::RPageSourceFriends>("_friends", sources));
+   auto reader =
+      std::make_unique<RNTupleReader>(std::make_unique<Detail::RPageSourceFriends>("_friends", sources, isJoined));
+
+   for (std::size_t i = 0; i < ntuples.size(); ++i) {
+      if (!isJoined[i])
+         continue;
+      const auto &spec = ntuples[i];
+
+      // Prefer the stored index over scanning the key fields of the joined ntuple
+      auto joinedReader = RNTupleReader::Open(spec.fNTupleName, spec.fStorage, spec.fOptions);
+      std::shared_ptr<const RNTupleIndex> index;
+      try {
+         index = RNTupleIndex::Open(spec.fNTupleName, spec.fStorage);
+      } catch (const RException &) {
+      }
+      if (!index || index->GetKeyFieldNames() != spec.fJoinFields ||
+          index->GetNEntries() != joinedReader->GetNEntries()) {
+         index = RNTupleIndex::Create(spec.fJoinFields, *joinedReader);
+      }
+
+      const auto &primaryName = ntuples[0].fNTupleName;
+      std::vector<std::string> keyFieldNames;
+      for (const auto &fieldName : spec.fJoinFields)
+         keyFieldNames.emplace_back(primaryName + "." + fieldName);
+      const auto fieldId =
+         reader->fSource->GetSharedDescriptorGuard()->FindFieldId(joinedReader->GetDescriptor()->GetName());
+      reader->fJoinTables[fieldId] = std::make_unique<Internal::RNTupleJoinTable>(index, keyFieldNames, *reader);
+   }
+   return reader;
+}
+
+std::unique_ptr<ROOT::Experimental::RNTupleReader> ROOT::Experimental::RNTupleReader::Clone()
+{
+   auto clone = std::make_unique<RNTupleReader>(fSource->Clone());
+   // The virtual field IDs of the cloned friends source are the same
+   for (const auto &[fieldId, joinTable] : fJoinTables)
+      clone->fJoinTables[fieldId] = joinTable->Clone(*clone);
+   return clone;
 }
 
 ROOT::Experimental::RNTupleModel *ROOT::Experimental::RNTupleReader::GetModel()
@@ -217,6 +257,15 @@ void ROOT::Experimental::RNTupleReader::PrintInfo(const ENTupleInfo what, std::o
    }
    case ENTupleInfo::kStorageDetails: fSource->GetSharedDescriptorGuard()->PrintInfo(output); break;
    case ENTupleInfo::kMetrics: fMetrics.Print(output); break;
+   case ENTupleInfo::kMetricsJSON:
+   case ENTupleInfo::kMetricsCSV: {
+      auto report = fSource->GetReadReport();
+      // Use the reader's view on the counters, which includes the counters of the page source
+      report.SetCounters(fMetrics);
+      report.Print(output, (what == ENTupleInfo::kMetricsJSON) ? Detail::RNTupleReadReport::EFormat::kJSON
+                                                                : Detail::RNTupleReadReport::EFormat::kCSV);
+      break;
+   }
    default:
       // Unhandled case, internal error
       R__ASSERT(false);
@@ -260,11 +309,59 @@ const ROOT::Experimental::RNTupleDescriptor *ROOT::Experimental::RNTupleReader::
    return fCachedDescriptor.get();
 }
 
+void ROOT::Experimental::RNTupleReader::SetIndex(std::unique_ptr<RNTupleIndex> index)
+{
+   if (index && index->GetNEntries() != GetNEntries()) {
+      throw RException(R__FAIL("index of " + std::to_string(index->GetNEntries()) + " entries does not match RNTuple '" +
+                               fSource->GetSharedDescriptorGuard()->GetName() + "' of " +
+                               std::to_string(GetNEntries()) + " entries"));
+   }
+   fIndex = std::move(index);
+}
+
+void ROOT::Experimental::RNTupleReader::LoadJoinedEntry(NTupleSize_t index, REntry &entry)
+{
+   for (auto &value : entry) {
+      auto itr = fJoinTables.find(value.GetField()->GetOnDiskId());
+      if (itr == fJoinTables.end()) {
+         value.Read(index);
+         continue;
+      }
+
+      const auto joinedIndex = itr->second->GetEntryNumber(index);
+      if (joinedIndex == kInvalidNTupleIndex) {
+         throw RException(R__FAIL("no entry of joined RNTuple '" + value.GetField()->GetName() +
+                                  "' matches the key of entry " + std::to_string(index)));
+      }
+      value.Read(joinedIndex);
+   }
+}
+
+void ROOT::Experimental::RNTupleReader::EnsureNotJoined(DescriptorId_t fieldId)
+{
+   auto descriptorGuard = fSource->GetSharedDescriptorGuard();
+   for (auto id = fieldId; id != descriptorGuard->GetFieldZeroId();
+        id = descriptorGuard->GetFieldDescriptor(id).GetParentId()) {
+      if (fJoinTables.count(id) > 0) {
+         throw RException(R__FAIL("views of fields of joined RNTuples are not supported: '" +
+                                  descriptorGuard->GetQualifiedFieldName(fieldId) + "'"));
+      }
+   }
+}
+
+ROOT::Experimental::NTupleSize_t
+ROOT::Experimental::RNTupleReader::FindEntry(const std::vector<std::uint64_t> &key) const
+{
+   if (!fIndex)
+      throw RException(R__FAIL("no index set"));
+   return fIndex->GetFirstEntryNumber(key);
+}
+
 //------------------------------------------------------------------------------
 
-ROOT::Experimental::RNTupleWriter::RNTupleWriter(std::unique_ptr<ROOT::Experimental::RNTupleModel> model,
-                                                 std::unique_ptr<ROOT::Experimental::Detail::RPageSink> sink)
-   : fSink(std::move(sink)), fModel(std::move(model)), fMetrics("RNTupleWriter")
+ROOT::Experimental::RNTupleFillContext::RNTupleFillContext(std::unique_ptr<ROOT::Experimental::RNTupleModel> model,
+                                                           std::unique_ptr<ROOT::Experimental::Detail::RPageSink> sink)
+   : fSink(std::move(sink)), fModel(std::move(model)), fMetrics("RNTupleFillContext")
 {
    if (!fModel) {
       throw RException(R__FAIL("null model"));
@@ -281,6 +378,8 @@ ROOT::Experimental::RNTupleWriter::RNTupleWriter(std::unique_ptr<ROOT::Experimen
 #endif
    fSink->Create(*fModel.get());
    fMetrics.ObserveMetrics(fSink->GetMetrics());
+   // Non-zero if the sink updates an existing ntuple; the entry numbers continue after the existing entries
+   fNEntries = fLastCommitted = fSink->GetNEntriesCommitted();
 
    const auto &writeOpts = fSink->GetWriteOptions();
    fMaxUnzippedClusterSize = writeOpts.GetMaxUnzippedClusterSize();
@@ -289,11 +388,58 @@ ROOT::Experimental::RNTupleWriter::RNTupleWriter(std::unique_ptr<ROOT::Experimen
    fUnzippedClusterSizeEst = scale * writeOpts.GetApproxZippedClusterSize();
 }
 
+ROOT::Experimental::RNTupleFillContext::~RNTupleFillContext()
+{
+   try {
+      CommitCluster();
+   } catch (const RException &err) {
+      R__LOG_ERROR(NTupleLog()) << "failure committing cluster: " << err.GetError().GetReport();
+   }
+}
+
+void ROOT::Experimental::RNTupleFillContext::CommitCluster()
+{
+   if (fNEntries == fLastCommitted) {
+      return;
+   }
+   if (fSink->GetWriteOptions().GetHasSmallClusters() &&
+      (fUnzippedClusterSize > RNTupleWriteOptions::kMaxSmallClusterSize))
+   {
+      throw RException(R__FAIL("invalid attempt to write a cluster > 512MiB with 'small clusters' option enabled"));
+   }
+   for (auto &field : *fModel->GetFieldZero()) {
+      field.Flush();
+      field.CommitCluster();
+   }
+   fNBytesCommitted += fSink->CommitCluster(fNEntries);
+   fNBytesFilled += fUnzippedClusterSize;
+
+   // Cap the compression factor at 1000 to prevent overflow of fUnzippedClusterSizeEst
+   const float compressionFactor =
+      std::min(1000.f, static_cast<float>(fNBytesFilled) / static_cast<float>(fNBytesCommitted));
+   fUnzippedClusterSizeEst =
+      compressionFactor * static_cast<float>(fSink->GetWriteOptions().GetApproxZippedClusterSize());
+
+   fLastCommitted = fNEntries;
+   fUnzippedClusterSize = 0;
+}
+
+//------------------------------------------------------------------------------
+
+ROOT::Experimental::RNTupleWriter::RNTupleWriter(std::unique_ptr<ROOT::Experimental::RNTupleModel> model,
+                                                 std::unique_ptr<ROOT::Experimental::Detail::RPageSink> sink)
+   : fFillContext(std::move(model), std::move(sink)), fMetrics("RNTupleWriter")
+{
+   // Observe directly the sink's metrics to keep the counter names independent of the fill context
+   fMetrics.ObserveMetrics(fFillContext.fSink->GetMetrics());
+   fLastCommittedClusterGroup = fFillContext.GetNEntries();
+}
+
 ROOT::Experimental::RNTupleWriter::~RNTupleWriter()
 {
    try {
       CommitCluster(true /* commitClusterGroup */);
-      fSink->CommitDataset();
+      fFillContext.fSink->CommitDataset();
    } catch (const RException &err) {
       R__LOG_ERROR(NTupleLog()) << "failure committing ntuple: " << err.GetError().GetReport();
    }
@@ -318,44 +464,24 @@ ROOT::Experimental::RNTupleWriter::Append(std::unique_ptr<RNTupleModel> model, s
    return std::make_unique<RNTupleWriter>(std::move(model), std::move(sink));
 }
 
-void ROOT::Experimental::RNTupleWriter::CommitClusterGroup()
+std::unique_ptr<ROOT::Experimental::RNTupleWriter>
+ROOT::Experimental::RNTupleWriter::Update(std::unique_ptr<RNTupleModel> model, std::string_view ntupleName, TFile &file,
+                                          const RNTupleWriteOptions &options)
 {
-   if (fNEntries == fLastCommittedClusterGroup)
-      return;
-   fSink->CommitClusterGroup();
-   fLastCommittedClusterGroup = fNEntries;
+   if (!model)
+      throw RException(R__FAIL("null model"));
+   std::unique_ptr<Detail::RPageSink> sink = Detail::RPageSinkFile::CreateForUpdate(ntupleName, file, options);
+   if (options.GetUseBufferedWrite())
+      sink = std::make_unique<Detail::RPageSinkBuf>(std::move(sink));
+   return std::make_unique<RNTupleWriter>(std::move(model), std::move(sink));
 }
 
-void ROOT::Experimental::RNTupleWriter::CommitCluster(bool commitClusterGroup)
+void ROOT::Experimental::RNTupleWriter::CommitClusterGroup()
 {
-   if (fNEntries == fLastCommitted) {
-      if (commitClusterGroup)
-         CommitClusterGroup();
+   if (fFillContext.GetNEntries() == fLastCommittedClusterGroup)
       return;
-   }
-   if (fSink->GetWriteOptions().GetHasSmallClusters() &&
-      (fUnzippedClusterSize > RNTupleWriteOptions::kMaxSmallClusterSize))
-   {
-      throw RException(R__FAIL("invalid attempt to write a cluster > 512MiB with 'small clusters' option enabled"));
-   }
-   for (auto &field : *fModel->GetFieldZero()) {
-      field.Flush();
-      field.CommitCluster();
-   }
-   fNBytesCommitted += fSink->CommitCluster(fNEntries);
-   fNBytesFilled += fUnzippedClusterSize;
-
-   // Cap the compression factor at 1000 to prevent overflow of fUnzippedClusterSizeEst
-   const float compressionFactor =
-      std::min(1000.f, static_cast<float>(fNBytesFilled) / static_cast<float>(fNBytesCommitted));
-   fUnzippedClusterSizeEst =
-      compressionFactor * static_cast<float>(fSink->GetWriteOptions().GetApproxZippedClusterSize());
-
-   fLastCommitted = fNEntries;
-   fUnzippedClusterSize = 0;
-
-   if (commitClusterGroup)
-      CommitClusterGroup();
+   fFillContext.fSink->CommitClusterGroup();
+   fLastCommittedClusterGroup = fFillContext.GetNEntries();
 }
 
 //------------------------------------------------------------------------------
@@ -29,6 +29,7 @@
 #include <cstdint>
 #include <deque>
 #include <iostream>
+#include <limits>
 #include <set>
 #include <utility>
 
@@ -230,6 +231,7 @@ bool ROOT::Experimental::RNTupleDescriptor::operator==(const RNTupleDescriptor &
    return fName == other.fName &&
           fDescription == other.fDescription &&
           fNEntries == other.fNEntries &&
+          fHasPageStatistics == other.fHasPageStatistics &&
           fGeneration == other.fGeneration &&
           fFieldDescriptors == other.fFieldDescriptors &&
           fColumnDescriptors == other.fColumnDescriptors &&
@@ -450,6 +452,7 @@ std::unique_ptr<ROOT::Experimental::RNTupleDescriptor> ROOT::Experimental::RNTup
    clone->fOnDiskFooterSize = fOnDiskFooterSize;
    clone->fNEntries = fNEntries;
    clone->fNPhysicalColumns = fNPhysicalColumns;
+   clone->fHasPageStatistics = fHasPageStatistics;
    clone->fGeneration = fGeneration;
    for (const auto &d : fFieldDescriptors)
       clone->fFieldDescriptors.emplace(d.first, d.second.Clone());
@@ -502,9 +505,17 @@ ROOT::Experimental::RClusterDescriptorBuilder::CommitColumnRange(DescriptorId_t
       return R__FAIL("column ID conflict");
    RClusterDescriptor::RColumnRange columnRange{physicalId, firstElementIndex, RClusterSize(0)};
    columnRange.fCompressionSettings = compressionSettings;
+   bool hasStatistics = !pageRange.fPageInfos.empty();
+   RValueStatistics statistics{std::numeric_limits<double>::infinity(), -std::numeric_limits<double>::infinity(), 0};
    for (const auto &pi : pageRange.fPageInfos) {
       columnRange.fNElements += pi.fNElements;
+      if (pi.fStatistics)
+         statistics.Merge(*pi.fStatistics);
+      else
+         hasStatistics = false;
    }
+   if (hasStatistics)
+      columnRange.fStatistics = statistics;
    fCluster.fPageRanges[physicalId] = pageRange.Clone();
    fCluster.fColumnRanges[physicalId] = columnRange;
    return RResult<void>::Success();
@@ -554,6 +565,7 @@ ROOT::Experimental::RClusterDescriptorBuilder::AddDeferredColumnRanges(const RNT
                   columnRange.fFirstElementIndex = fCluster.GetFirstEntryIndex() * nRepetitions;
                   columnRange.fNElements = fCluster.GetNEntries() * nRepetitions;
                   const auto element = Detail::RColumnElementBase::Generate<void>(c.GetModel().GetType());
+                  element->ApplyColumnModel(c.GetModel());
                   pageRange.ExtendToFitColumnRange(columnRange, *element, Detail::RPage::kPageZeroSize);
                }
             }
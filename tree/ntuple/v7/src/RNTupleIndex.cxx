@@ -0,0 +1,407 @@
+/// \file RNTupleIndex.cxx
+/// \ingroup NTuple ROOT7
+/// \date 2024-03-04
+/// \warning This is part of the ROOT 7 prototype! It will change without notice. It might trigger earthquakes. Feedback
+/// is welcome!
+
+/*************************************************************************
+ * Copyright (C) 1995-2024, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include <ROOT/RError.hxx>
+#include <ROOT/RNTuple.hxx>
+#include <ROOT/RNTupleDescriptor.hxx>
+#include <ROOT/RNTupleIndex.hxx>
+#include <ROOT/RNTupleModel.hxx>
+
+#include <algorithm>
+#include <numeric>
+#include <type_traits>
+#include <utility>
+
+namespace {
+
+/// Returns a function that reads the value of an integral key field for a given entry number; signed values are
+/// sign-extended
+template <typename T>
+std::function<std::uint64_t(ROOT::Experimental::NTupleSize_t)>
+MakeReadFunction(ROOT::Experimental::RNTupleReader &reader, const std::string &fieldName)
+{
+   // The function object must be copyable but views are move-only
+   auto view = std::make_shared<ROOT::Experimental::RNTupleView<T>>(reader.GetView<T>(fieldName));
+   return [view](ROOT::Experimental::NTupleSize_t entry) { return static_cast<std::uint64_t>((*view)(entry)); };
+}
+
+/// The splitmix64 finalizer
+std::uint64_t MixBits(std::uint64_t x)
+{
+   x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+   x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+   return x ^ (x >> 31);
+}
+
+std::string GetKeyFieldName(std::size_t keyFieldIdx)
+{
+   return "key" + std::to_string(keyFieldIdx);
+}
+
+} // anonymous namespace
+
+ROOT::Experimental::Internal::RNTupleKeyReader::RNTupleKeyReader(const std::vector<std::string> &keyFieldNames,
+                                                                 RNTupleReader &reader)
+{
+   const auto &desc = *reader.GetDescriptor();
+   for (const auto &fieldName : keyFieldNames) {
+      const auto fieldId = desc.FindFieldId(fieldName);
+      if (fieldId == kInvalidDescriptorId)
+         throw RException(R__FAIL("no key field named '" + fieldName + "' in RNTuple '" + desc.GetName() + "'"));
+      // The view of a field inside a collection is indexed by the collection elements, not by the entries
+      for (auto parentId = desc.GetFieldDescriptor(fieldId).GetParentId(); parentId != desc.GetFieldZeroId();
+           parentId = desc.GetFieldDescriptor(parentId).GetParentId()) {
+         const auto structure = desc.GetFieldDescriptor(parentId).GetStructure();
+         if (structure == ENTupleStructure::kCollection || structure == ENTupleStructure::kVariant)
+            throw RException(R__FAIL("key field '" + fieldName + "' is part of a collection"));
+      }
+
+      const auto typeName = desc.GetFieldDescriptor(fieldId).GetTypeName();
+      if (typeName == "bool") {
+         fReadFunctions.emplace_back(MakeReadFunction<bool>(reader, fieldName));
+      } else if (typeName == "char") {
+         fReadFunctions.emplace_back(MakeReadFunction<char>(reader, fieldName));
+      } else if (typeName == "std::int8_t") {
+         fReadFunctions.emplace_back(MakeReadFunction<std::int8_t>(reader, fieldName));
+      } else if (typeName == "std::uint8_t") {
+         fReadFunctions.emplace_back(MakeReadFunction<std::uint8_t>(reader, fieldName));
+      } else if (typeName == "std::int16_t") {
+         fReadFunctions.emplace_back(MakeReadFunction<std::int16_t>(reader, fieldName));
+      } else if (typeName == "std::uint16_t") {
+         fReadFunctions.emplace_back(MakeReadFunction<std::uint16_t>(reader, fieldName));
+      } else if (typeName == "std::int32_t") {
+         fReadFunctions.emplace_back(MakeReadFunction<std::int32_t>(reader, fieldName));
+      } else if (typeName == "std::uint32_t") {
+         fReadFunctions.emplace_back(MakeReadFunction<std::uint32_t>(reader, fieldName));
+      } else if (typeName == "std::int64_t") {
+         fReadFunctions.emplace_back(MakeReadFunction<std::int64_t>(reader, fieldName));
+      } else if (typeName == "std::uint64_t") {
+         fReadFunctions.emplace_back(MakeReadFunction<std::uint64_t>(reader, fieldName));
+      } else {
+         throw RException(R__FAIL("key field '" + fieldName + "' has non-integral type '" + typeName + "'"));
+      }
+      // Whether char is signed depends on the platform, just like the values read for it
+      fIsSigned.emplace_back((typeName == "char") ? std::is_signed_v<char> : (typeName.rfind("std::int", 0) == 0));
+   }
+}
+
+void ROOT::Experimental::Internal::RNTupleKeyReader::ReadKeys(NTupleSize_t firstEntry, NTupleSize_t nEntries,
+                                                              std::vector<std::uint64_t> &keys)
+{
+   const auto nKeyFields = GetNKeyFields();
+   const auto offset = keys.size();
+   keys.resize(offset + nEntries * nKeyFields);
+   // Field by field, so that every view reads its pages sequentially
+   for (std::size_t k = 0; k < nKeyFields; ++k) {
+      const auto &readFunction = fReadFunctions[k];
+      for (NTupleSize_t i = 0; i < nEntries; ++i)
+         keys[offset + i * nKeyFields + k] = readFunction(firstEntry + i);
+   }
+}
+
+//------------------------------------------------------------------------------
+
+ROOT::Experimental::RNTupleIndex::RNTupleIndex(std::string_view ntupleName,
+                                               const std::vector<std::string> &keyFieldNames)
+   : fNTupleName(ntupleName), fKeyFieldNames(keyFieldNames)
+{
+   if (fKeyFieldNames.empty())
+      throw RException(R__FAIL("an RNTuple index needs at least one key field"));
+}
+
+std::vector<std::uint64_t> ROOT::Experimental::RNTupleIndex::EncodeKeys(const std::vector<std::uint64_t> &keys) const
+{
+   const auto nKeyFields = GetNKeyFields();
+   std::vector<std::uint64_t> result(keys.size());
+   for (std::size_t i = 0; i < keys.size(); ++i)
+      result[i] = EncodeKeyValue(keys[i], fIsSignedKey[i % nKeyFields]);
+   return result;
+}
+
+void ROOT::Experimental::RNTupleIndex::ReadKeys(const std::vector<std::string> &keyFieldNames, RNTupleReader &reader)
+{
+   const auto nKeyFields = GetNKeyFields();
+   Internal::RNTupleKeyReader keyReader(keyFieldNames, reader);
+   fIsSignedKey.clear();
+   for (std::size_t k = 0; k < nKeyFields; ++k)
+      fIsSignedKey.emplace_back(keyReader.IsSignedKeyField(k));
+   fKeys.clear();
+   keyReader.ReadKeys(0, reader.GetNEntries(), fKeys);
+   for (std::size_t i = 0; i < fKeys.size(); ++i)
+      fKeys[i] = EncodeKeyValue(fKeys[i], fIsSignedKey[i % nKeyFields]);
+}
+
+std::unique_ptr<ROOT::Experimental::RNTupleIndex>
+ROOT::Experimental::RNTupleIndex::Create(const std::vector<std::string> &keyFieldNames, RNTupleReader &reader)
+{
+   auto index = std::unique_ptr<RNTupleIndex>(new RNTupleIndex(reader.GetDescriptor()->GetName(), keyFieldNames));
+   const auto nKeyFields = index->GetNKeyFields();
+   const auto nEntries = reader.GetNEntries();
+
+   index->ReadKeys(keyFieldNames, reader);
+   const auto keys = std::move(index->fKeys);
+
+   // Order the entries by key; the stable sort keeps the entries of equal keys in ascending order
+   const auto keysOfEntries = keys.data();
+   std::vector<NTupleSize_t> order(nEntries);
+   std::iota(order.begin(), order.end(), 0);
+   std::stable_sort(order.begin(), order.end(), [&](NTupleSize_t a, NTupleSize_t b) {
+      const auto keyA = keysOfEntries + a * nKeyFields;
+      const auto keyB = keysOfEntries + b * nKeyFields;
+      return std::lexicographical_compare(keyA, keyA + nKeyFields, keyB, keyB + nKeyFields);
+   });
+
+   index->fKeys.resize(keys.size());
+   for (std::size_t row = 0; row < nEntries; ++row) {
+      const auto key = keysOfEntries + order[row] * nKeyFields;
+      std::copy(key, key + nKeyFields, index->fKeys.data() + row * nKeyFields);
+   }
+   index->fEntryNumbers = std::move(order);
+   index->BuildHashTable();
+   return index;
+}
+
+std::unique_ptr<ROOT::Experimental::RNTupleIndex>
+ROOT::Experimental::RNTupleIndex::Open(std::string_view ntupleName, std::string_view storage)
+{
+   auto reader = RNTupleReader::Open(GetIndexNTupleName(ntupleName), storage);
+   const auto &desc = *reader->GetDescriptor();
+
+   std::vector<std::string> keyFieldNames;
+   for (auto fieldId = desc.FindFieldId(GetKeyFieldName(0)); fieldId != kInvalidDescriptorId;
+        fieldId = desc.FindFieldId(GetKeyFieldName(keyFieldNames.size()))) {
+      keyFieldNames.emplace_back(desc.GetFieldDescriptor(fieldId).GetFieldDescription());
+   }
+   if (keyFieldNames.empty() || desc.FindFieldId("entry") == kInvalidDescriptorId)
+      throw RException(R__FAIL("'" + desc.GetName() + "' is not an RNTuple index"));
+
+   auto index = std::unique_ptr<RNTupleIndex>(new RNTupleIndex(ntupleName, keyFieldNames));
+   const auto nKeyFields = index->GetNKeyFields();
+   const auto nEntries = reader->GetNEntries();
+   // The index rows have been written in index order; signed key fields are stored with a signed type
+   std::vector<std::string> storedKeyFieldNames;
+   for (std::size_t k = 0; k < nKeyFields; ++k)
+      storedKeyFieldNames.emplace_back(GetKeyFieldName(k));
+   index->ReadKeys(storedKeyFieldNames, *reader);
+   index->fEntryNumbers.resize(nEntries);
+   auto viewEntry = reader->GetView<std::uint64_t>("entry");
+   for (auto i : reader->GetEntryRange())
+      index->fEntryNumbers[i] = viewEntry(i);
+
+   index->BuildHashTable();
+   return index;
+}
+
+void ROOT::Experimental::RNTupleIndex::Write(TFile &file) const
+{
+   const auto nKeyFields = GetNKeyFields();
+   auto model = RNTupleModel::Create();
+   // Signed key fields are stored as signed integers, so that Open() restores their order.  Only one of the two
+   // values of a key field is used.
+   std::vector<std::shared_ptr<std::uint64_t>> keyValues(nKeyFields);
+   std::vector<std::shared_ptr<std::int64_t>> signedKeyValues(nKeyFields);
+   for (std::size_t k = 0; k < nKeyFields; ++k) {
+      if (fIsSignedKey[k])
+         signedKeyValues[k] = model->MakeField<std::int64_t>({GetKeyFieldName(k), fKeyFieldNames[k]});
+      else
+         keyValues[k] = model->MakeField<std::uint64_t>({GetKeyFieldName(k), fKeyFieldNames[k]});
+   }
+   auto entryNumber = model->MakeField<std::uint64_t>("entry");
+
+   auto writer = RNTupleWriter::Append(std::move(model), GetIndexNTupleName(fNTupleName), file);
+   for (std::size_t row = 0; row < fEntryNumbers.size(); ++row) {
+      const auto key = GetKeyOfRow(row);
+      for (std::size_t k = 0; k < nKeyFields; ++k) {
+         if (fIsSignedKey[k])
+            *signedKeyValues[k] = static_cast<std::int64_t>(EncodeKeyValue(key[k], true));
+         else
+            *keyValues[k] = key[k];
+      }
+      *entryNumber = fEntryNumbers[row];
+      writer->Fill();
+   }
+}
+
+std::uint64_t ROOT::Experimental::RNTupleIndex::HashKey(const std::uint64_t *key, std::size_t nKeyFields)
+{
+   std::uint64_t hash = 0;
+   for (std::size_t k = 0; k < nKeyFields; ++k)
+      hash = MixBits(hash ^ key[k]) + k;
+   return hash;
+}
+
+void ROOT::Experimental::RNTupleIndex::BuildHashTable()
+{
+   const auto nKeyFields = GetNKeyFields();
+   const auto nRows = fEntryNumbers.size();
+   auto fnIsFirstOfKey = [&](std::size_t row) {
+      return (row == 0) || !std::equal(GetKeyOfRow(row - 1), GetKeyOfRow(row - 1) + nKeyFields, GetKeyOfRow(row));
+   };
+
+   std::size_t nDistinct = 0;
+   for (std::size_t row = 0; row < nRows; ++row)
+      nDistinct += fnIsFirstOfKey(row);
+   // With a load factor of at most 1/2, probing sequences are short and there is always an empty slot
+   std::size_t nSlots = 1;
+   while (nSlots < 2 * nDistinct)
+      nSlots *= 2;
+   fSlots.assign(nSlots, 0);
+
+   const auto mask = nSlots - 1;
+   for (std::size_t row = 0; row < nRows; ++row) {
+      if (!fnIsFirstOfKey(row))
+         continue;
+      auto slot = HashKey(GetKeyOfRow(row), nKeyFields) & mask;
+      while (fSlots[slot] != 0)
+         slot = (slot + 1) & mask;
+      fSlots[slot] = row + 1;
+   }
+}
+
+void ROOT::Experimental::RNTupleIndex::EnsureValidKey(const std::vector<std::uint64_t> &key) const
+{
+   if (key.size() != GetNKeyFields()) {
+      throw RException(R__FAIL("invalid key: expected " + std::to_string(GetNKeyFields()) + " values, got " +
+                               std::to_string(key.size())));
+   }
+}
+
+std::size_t ROOT::Experimental::RNTupleIndex::FindFirstRow(const std::uint64_t *key) const
+{
+   const auto nKeyFields = GetNKeyFields();
+   const auto mask = fSlots.size() - 1;
+   for (auto slot = HashKey(key, nKeyFields) & mask; fSlots[slot] != 0; slot = (slot + 1) & mask) {
+      const auto row = fSlots[slot] - 1;
+      if (std::equal(key, key + nKeyFields, GetKeyOfRow(row)))
+         return row;
+   }
+   return fEntryNumbers.size();
+}
+
+std::size_t ROOT::Experimental::RNTupleIndex::LowerBound(const std::vector<std::uint64_t> &key) const
+{
+   std::size_t first = 0;
+   std::size_t count = fEntryNumbers.size();
+   while (count > 0) {
+      const auto step = count / 2;
+      const auto row = GetKeyOfRow(first + step);
+      if (std::lexicographical_compare(row, row + key.size(), key.begin(), key.end())) {
+         first += step + 1;
+         count -= step + 1;
+      } else {
+         count = step;
+      }
+   }
+   return first;
+}
+
+ROOT::Experimental::NTupleSize_t
+ROOT::Experimental::RNTupleIndex::GetFirstEntryNumber(const std::vector<std::uint64_t> &key) const
+{
+   EnsureValidKey(key);
+   const auto row = FindFirstRow(EncodeKeys(key).data());
+   return (row < fEntryNumbers.size()) ? fEntryNumbers[row] : kInvalidNTupleIndex;
+}
+
+std::vector<ROOT::Experimental::NTupleSize_t>
+ROOT::Experimental::RNTupleIndex::GetFirstEntryNumbers(const std::vector<std::uint64_t> &keys) const
+{
+   const auto nKeyFields = GetNKeyFields();
+   if (keys.size() % nKeyFields != 0) {
+      throw RException(R__FAIL("invalid keys: expected a multiple of " + std::to_string(nKeyFields) + " values, got " +
+                               std::to_string(keys.size())));
+   }
+
+   const auto nKeys = keys.size() / nKeyFields;
+   const auto encodedKeys = EncodeKeys(keys);
+   std::vector<NTupleSize_t> result(nKeys);
+   for (std::size_t i = 0; i < nKeys; ++i) {
+      const auto row = FindFirstRow(encodedKeys.data() + i * nKeyFields);
+      result[i] = (row < fEntryNumbers.size()) ? fEntryNumbers[row] : kInvalidNTupleIndex;
+   }
+   return result;
+}
+
+std::vector<ROOT::Experimental::NTupleSize_t>
+ROOT::Experimental::RNTupleIndex::GetAllEntryNumbers(const std::vector<std::uint64_t> &key) const
+{
+   EnsureValidKey(key);
+   const auto encodedKey = EncodeKeys(key);
+   std::vector<NTupleSize_t> result;
+   for (auto row = FindFirstRow(encodedKey.data());
+        row < fEntryNumbers.size() && std::equal(encodedKey.begin(), encodedKey.end(), GetKeyOfRow(row)); ++row) {
+      result.emplace_back(fEntryNumbers[row]);
+   }
+   return result;
+}
+
+std::vector<ROOT::Experimental::NTupleSize_t>
+ROOT::Experimental::RNTupleIndex::GetEntryNumbersInRange(const std::vector<std::uint64_t> &firstKey,
+                                                         const std::vector<std::uint64_t> &lastKey) const
+{
+   EnsureValidKey(firstKey);
+   EnsureValidKey(lastKey);
+   const auto firstRow = LowerBound(EncodeKeys(firstKey));
+   const auto lastRow = std::max(firstRow, LowerBound(EncodeKeys(lastKey)));
+   return std::vector<NTupleSize_t>(fEntryNumbers.begin() + firstRow, fEntryNumbers.begin() + lastRow);
+}
+
+//------------------------------------------------------------------------------
+
+ROOT::Experimental::Internal::RNTupleJoinTable::RNTupleJoinTable(std::shared_ptr<const RNTupleIndex> index,
+                                                                 const std::vector<std::string> &keyFieldNames,
+                                                                 RNTupleReader &reader)
+   : fIndex(std::move(index)), fKeyFieldNames(keyFieldNames), fKeyReader(keyFieldNames, reader)
+{
+   if (fKeyReader.GetNKeyFields() != fIndex->GetKeyFieldNames().size()) {
+      throw RException(R__FAIL("number of key fields does not match the index of RNTuple '" +
+                               fIndex->GetNTupleName() + "'"));
+   }
+
+   for (const auto &clusterDesc : reader.GetDescriptor()->GetClusterIterable())
+      fClusterBoundaries.emplace_back(clusterDesc.GetFirstEntryIndex());
+   fClusterBoundaries.emplace_back(reader.GetNEntries());
+   std::sort(fClusterBoundaries.begin(), fClusterBoundaries.end());
+   fClusterBoundaries.erase(std::unique(fClusterBoundaries.begin(), fClusterBoundaries.end()),
+                            fClusterBoundaries.end());
+}
+
+std::unique_ptr<ROOT::Experimental::Internal::RNTupleJoinTable>
+ROOT::Experimental::Internal::RNTupleJoinTable::Clone(RNTupleReader &reader) const
+{
+   return std::make_unique<RNTupleJoinTable>(fIndex, fKeyFieldNames, reader);
+}
+
+ROOT::Experimental::NTupleSize_t ROOT::Experimental::Internal::RNTupleJoinTable::GetEntryNumber(NTupleSize_t entry)
+{
+   for (auto itr = fJoinedClusters.begin(); itr != fJoinedClusters.end(); ++itr) {
+      if (entry < itr->fFirstEntry || entry >= itr->fFirstEntry + itr->fEntryNumbers.size())
+         continue;
+      std::rotate(fJoinedClusters.begin(), itr, itr + 1);
+      return fJoinedClusters.front().fEntryNumbers[entry - fJoinedClusters.front().fFirstEntry];
+   }
+
+   // The cluster boundaries end with the number of entries
+   auto itrNext = std::upper_bound(fClusterBoundaries.begin(), fClusterBoundaries.end(), entry);
+   if (itrNext == fClusterBoundaries.begin() || itrNext == fClusterBoundaries.end())
+      throw RException(R__FAIL("entry number " + std::to_string(entry) + " out of bounds"));
+   const auto firstEntry = *(itrNext - 1);
+
+   fKeys.clear();
+   fKeyReader.ReadKeys(firstEntry, *itrNext - firstEntry, fKeys);
+   if (fJoinedClusters.size() == kMaxJoinedClusters)
+      fJoinedClusters.pop_back();
+   fJoinedClusters.insert(fJoinedClusters.begin(), RJoinedCluster{firstEntry, fIndex->GetFirstEntryNumbers(fKeys)});
+   return fJoinedClusters.front().fEntryNumbers[entry - firstEntry];
+}
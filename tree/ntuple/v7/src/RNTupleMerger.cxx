@@ -13,17 +13,200 @@
  * For the list of contributors see $ROOTSYS/README/CREDITS.             *
  *************************************************************************/
 
+#include <ROOT/RColumnElement.hxx>
+#include <ROOT/RColumnModel.hxx>
 #include <ROOT/RError.hxx>
+#include <ROOT/RField.hxx>
+#include <ROOT/RLogger.hxx>
 #include <ROOT/RNTuple.hxx>
 #include <ROOT/RNTupleDescriptor.hxx>
 #include <ROOT/RNTupleMerger.hxx>
+#include <ROOT/RNTupleModel.hxx>
+#include <ROOT/RNTupleOptions.hxx>
 #include <ROOT/RNTupleUtil.hxx>
+#include <ROOT/RNTupleZip.hxx>
+#include <ROOT/RPageStorage.hxx>
+#include <ROOT/RPageStorageFile.hxx>
 
-Long64_t ROOT::Experimental::RNTuple::Merge(TCollection* inputs, TFileMergeInfo* mergeInfo) {
-   if (inputs == nullptr || mergeInfo == nullptr) {
+#include <TFile.h>
+#include <TFileMergeInfo.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <deque>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace {
+
+using ROOT::Experimental::DescriptorId_t;
+using ROOT::Experimental::EColumnType;
+using ROOT::Experimental::RColumnModel;
+using ROOT::Experimental::RException;
+using ROOT::Experimental::RField;
+using ROOT::Experimental::RNTupleDescriptor;
+using ROOT::Experimental::RNTupleModel;
+
+/// The on-disk identity of a physical column, used to match the columns of the sources with the ones of the
+/// destination
+struct RColumnInfo {
+   std::string fFieldTypeName;
+   RColumnModel fColumnModel;
+   DescriptorId_t fPhysicalId = ROOT::Experimental::kInvalidDescriptorId;
+   bool fIsDeferred = false;
+};
+
+/// Maps "qualified field name#column index" to the column information of all the physical columns of an ntuple
+std::unordered_map<std::string, RColumnInfo> CollectColumns(const RNTupleDescriptor &desc)
+{
+   std::unordered_map<std::string, RColumnInfo> columns;
+   for (const auto &columnDesc : desc.GetColumnIterable()) {
+      if (columnDesc.IsAliasColumn())
+         continue;
+      const auto fieldId = columnDesc.GetFieldId();
+      RColumnInfo info;
+      info.fFieldTypeName = desc.GetFieldDescriptor(fieldId).GetTypeName();
+      info.fColumnModel = columnDesc.GetModel();
+      info.fPhysicalId = columnDesc.GetPhysicalId();
+      info.fIsDeferred = columnDesc.IsDeferredColumn();
+      columns[desc.GetQualifiedFieldName(fieldId) + "#" + std::to_string(columnDesc.GetIndex())] = info;
+   }
+   return columns;
+}
+
+/// Returns the name of the top-level field of a key of the map returned by CollectColumns()
+std::string GetTopLevelFieldName(const std::string &columnKey)
+{
+   return columnKey.substr(0, columnKey.find_first_of(".#"));
+}
+
+/// Creates a model with the given top-level fields of the ntuple described by `desc`
+std::unique_ptr<RNTupleModel>
+GenerateModelOfFields(const RNTupleDescriptor &desc, const std::vector<std::string> &fieldNames)
+{
+   auto model = RNTupleModel::Create();
+   model->GetFieldZero()->SetOnDiskId(desc.GetFieldZeroId());
+   for (const auto &name : fieldNames) {
+      const auto fieldId = desc.FindFieldId(name, desc.GetFieldZeroId());
+      if (fieldId == ROOT::Experimental::kInvalidDescriptorId)
+         throw RException(R__FAIL("ntuple '" + desc.GetName() + "' has no top-level field " + name));
+      model->AddField(desc.GetFieldDescriptor(fieldId).CreateField(desc));
+   }
+   model->Freeze();
+   return model;
+}
+
+/// Sets the column representatives of the fields of a model generated from `desc` to the on-disk column types, such
+/// that the sealed pages can be copied verbatim.  For truncated and quantized floating point fields, this includes
+/// the bit width and the value range.  Fields that cannot write their on-disk representation keep their default one;
+/// they are later on reported as incompatible.
+void UseOnDiskColumnRepresentation(RNTupleModel &model, const RNTupleDescriptor &desc)
+{
+   for (auto &field : *model.GetFieldZero()) {
+      if (field.GetOnDiskId() == ROOT::Experimental::kInvalidDescriptorId)
+         continue;
+
+      ROOT::Experimental::Detail::RFieldBase::ColumnRepresentation_t onDiskTypes;
+      std::vector<RColumnModel> onDiskModels;
+      for (const auto &c : desc.GetColumnIterable(field.GetOnDiskId())) {
+         onDiskTypes.emplace_back(c.GetModel().GetType());
+         onDiskModels.emplace_back(c.GetModel());
+      }
+      if (onDiskTypes.empty() || onDiskTypes == field.GetColumnRepresentative())
+         continue;
+
+      const auto &columnModel = onDiskModels[0];
+      const auto bitsOnStorage = ROOT::Experimental::Detail::RColumnElementBase::GetBitsOnStorage(columnModel);
+      const bool isTruncated = columnModel.GetType() == EColumnType::kReal32Trunc;
+      const bool isQuantized = columnModel.GetType() == EColumnType::kReal32Quant;
+      try {
+         if (auto floatField = dynamic_cast<RField<float> *>(&field); floatField && isTruncated) {
+            floatField->SetTruncated(bitsOnStorage);
+         } else if (floatField && isQuantized) {
+            floatField->SetQuantized(columnModel.GetValueRange()->first, columnModel.GetValueRange()->second,
+                                     bitsOnStorage);
+         } else if (auto doubleField = dynamic_cast<RField<double> *>(&field); doubleField && isTruncated) {
+            doubleField->SetTruncated(bitsOnStorage);
+         } else if (doubleField && isQuantized) {
+            doubleField->SetQuantized(columnModel.GetValueRange()->first, columnModel.GetValueRange()->second,
+                                      bitsOnStorage);
+         } else {
+            field.SetColumnRepresentative(onDiskTypes);
+         }
+      } catch (const RException &) {
+         // Keep the default representation
+      }
+   }
+}
+
+} // anonymous namespace
+
+Long64_t ROOT::Experimental::RNTuple::Merge(TCollection *inputs, TFileMergeInfo *mergeInfo)
+{
+   // The first entry of the input list is the name of the ntuple, the remaining entries are the source files
+   if (inputs == nullptr || mergeInfo == nullptr || inputs->GetEntries() < 2) {
+      return -1;
+   }
+
+   auto outFile = dynamic_cast<TFile *>(mergeInfo->fOutputDirectory);
+   if (!outFile) {
+      R__LOG_ERROR(NTupleLog()) << "merging RNTuples is only supported in the top-level directory of a file";
+      return -1;
+   }
+
+   TIter itr(inputs);
+   const std::string ntupleName = itr()->GetName();
+
+   std::vector<std::unique_ptr<Detail::RPageSource>> sources;
+   std::vector<Detail::RPageSource *> sourcePtrs;
+   while (auto obj = itr()) {
+      auto inFile = dynamic_cast<TFile *>(obj);
+      std::unique_ptr<RNTuple> anchor(inFile ? inFile->Get<RNTuple>(ntupleName.c_str()) : nullptr);
+      if (!anchor) {
+         R__LOG_ERROR(NTupleLog()) << "cannot find RNTuple '" << ntupleName << "' in " << obj->GetName();
+         return -1;
+      }
+      sources.emplace_back(anchor->MakePageSource());
+      sourcePtrs.emplace_back(sources.back().get());
+   }
+
+   RNTupleWriteOptions options;
+   options.SetCompression(outFile->GetCompressionSettings());
+   // Without an explicit request for a different compression, the output keeps the compression of the inputs such
+   // that the pages can be copied verbatim, provided that all the columns of all the inputs use the same compression.
+   // Attaching is a no-op for sources that are already attached, so RNTupleMerger::Merge() does not attach them again.
+   if (mergeInfo->fOptions.Contains("fast")) {
+      std::set<std::int64_t> inputCompressions;
+      for (auto &source : sources) {
+         source->Attach();
+         auto descriptorGuard = source->GetSharedDescriptorGuard();
+         for (const auto &clusterDesc : descriptorGuard->GetClusterIterable()) {
+            for (auto columnId : clusterDesc.GetColumnIds())
+               inputCompressions.insert(clusterDesc.GetColumnRange(columnId).fCompressionSettings);
+         }
+      }
+      if (inputCompressions.size() == 1) {
+         options.SetCompression(*inputCompressions.begin());
+      } else if (inputCompressions.size() > 1) {
+         R__LOG_WARNING(NTupleLog()) << "the inputs of ntuple '" << ntupleName
+                                     << "' use different compression settings; pages are recompressed with the "
+                                     << "compression settings of the output file";
+      }
+   }
+
+   Detail::RPageSinkFile destination(ntupleName, *outFile, options);
+   try {
+      Internal::RNTupleMerger merger;
+      merger.Merge(sourcePtrs, destination);
+   } catch (const RException &err) {
+      R__LOG_ERROR(NTupleLog()) << "failure merging ntuple '" << ntupleName << "': " << err.GetError().GetReport();
       return -1;
    }
-   return -1;
+
+   return 0;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -36,3 +219,141 @@ ROOT::Experimental::RFieldMerger::Merge(const ROOT::Experimental::RFieldDescript
    return R__FAIL("couldn't merge field " + lhs.GetFieldName() + " with field "
       + rhs.GetFieldName() + " (unimplemented!)");
 }
+
+////////////////////////////////////////////////////////////////////////////////
+
+void ROOT::Experimental::Internal::RNTupleMerger::Merge(std::span<Detail::RPageSource *> sources,
+                                                        Detail::RPageSink &destination,
+                                                        const std::vector<std::string> &fieldNames)
+{
+   if (sources.empty())
+      throw RException(R__FAIL("no sources to merge"));
+
+   const auto destCompression = destination.GetWriteOptions().GetCompression();
+   // Only needed if sealed pages have to be recompressed
+   std::unique_ptr<Detail::RNTupleDecompressor> decompressor;
+
+   // The model of the first source is used to create the destination; it needs to stay alive for as long as the
+   // destination is in use because its columns are connected to the destination.
+   std::unique_ptr<RNTupleModel> model;
+   std::unordered_map<std::string, RColumnInfo> destColumns;
+
+   for (auto source : sources) {
+      source->Attach();
+      auto descriptor = source->GetSharedDescriptorGuard()->Clone();
+
+      if (!model) {
+         model = fieldNames.empty() ? descriptor->GenerateModel() : GenerateModelOfFields(*descriptor, fieldNames);
+         UseOnDiskColumnRepresentation(*model, *descriptor);
+         destination.Create(*model);
+         destColumns = CollectColumns(destination.GetDescriptor());
+      }
+
+      // Map the physical columns of the source onto the physical columns of the destination
+      auto srcColumns = CollectColumns(*descriptor);
+      if (!fieldNames.empty()) {
+         for (auto itr = srcColumns.begin(); itr != srcColumns.end();) {
+            const auto topLevelName = GetTopLevelFieldName(itr->first);
+            if (std::find(fieldNames.begin(), fieldNames.end(), topLevelName) == fieldNames.end())
+               itr = srcColumns.erase(itr);
+            else
+               ++itr;
+         }
+      }
+      if (srcColumns.size() != destColumns.size()) {
+         throw RException(R__FAIL("ntuple '" + descriptor->GetName() + "' has an incompatible schema: " +
+                                  std::to_string(srcColumns.size()) + " columns instead of " +
+                                  std::to_string(destColumns.size())));
+      }
+      // Pairs of (source column ID, destination column info)
+      std::vector<std::pair<DescriptorId_t, RColumnInfo>> columnMap;
+      for (const auto &[name, srcInfo] : srcColumns) {
+         auto itr = destColumns.find(name);
+         if (itr == destColumns.end() || itr->second.fFieldTypeName != srcInfo.fFieldTypeName ||
+             itr->second.fColumnModel != srcInfo.fColumnModel) {
+            throw RException(R__FAIL("ntuple '" + descriptor->GetName() + "' has an incompatible column " + name));
+         }
+         if (srcInfo.fIsDeferred)
+            throw RException(R__FAIL("merging ntuples with late model extensions is unsupported: " + name));
+         columnMap.emplace_back(srcInfo.fPhysicalId, itr->second);
+      }
+      std::sort(columnMap.begin(), columnMap.end(),
+                [](const auto &a, const auto &b) { return a.second.fPhysicalId < b.second.fPhysicalId; });
+
+      std::vector<const RClusterDescriptor *> clusters;
+      for (const auto &clusterDesc : descriptor->GetClusterIterable())
+         clusters.emplace_back(&clusterDesc);
+      std::sort(clusters.begin(), clusters.end(),
+                [](auto a, auto b) { return a->GetFirstEntryIndex() < b->GetFirstEntryIndex(); });
+
+      for (const auto clusterDesc : clusters) {
+         const auto clusterId = clusterDesc->GetId();
+
+         Detail::RPageStorage::SealedPageSequence_t sealedPages;
+         std::vector<std::unique_ptr<unsigned char[]>> buffers;
+         // Number of sealed pages per column, in the order of columnMap
+         std::vector<std::size_t> nPagesPerColumn;
+
+         for (const auto &[srcColumnId, destInfo] : columnMap) {
+            if (!clusterDesc->ContainsColumn(srcColumnId)) {
+               throw RException(R__FAIL("cluster " + std::to_string(clusterId) + " of ntuple '" +
+                                        descriptor->GetName() + "' is missing column " +
+                                        std::to_string(srcColumnId)));
+            }
+
+            const auto &columnRange = clusterDesc->GetColumnRange(srcColumnId);
+            const bool needsRecompression = columnRange.fCompressionSettings != destCompression;
+            std::unique_ptr<Detail::RColumnElementBase> element;
+            if (needsRecompression) {
+               element = Detail::RColumnElementBase::Generate(destInfo.fColumnModel.GetType());
+               element->ApplyColumnModel(destInfo.fColumnModel);
+               if (!decompressor)
+                  decompressor = std::make_unique<Detail::RNTupleDecompressor>();
+            }
+
+            const auto &pageRange = clusterDesc->GetPageRange(srcColumnId);
+            ClusterSize_t::ValueType idxInCluster = 0;
+            for (const auto &pageInfo : pageRange.fPageInfos) {
+               auto buffer = std::make_unique<unsigned char[]>(pageInfo.fLocator.fBytesOnStorage);
+               Detail::RPageStorage::RSealedPage sealedPage;
+               sealedPage.fBuffer = buffer.get();
+               source->LoadSealedPage(srcColumnId, RClusterIndex(clusterId, idxInCluster), sealedPage);
+               sealedPage.fStatistics = pageInfo.fStatistics;
+               idxInCluster += pageInfo.fNElements;
+
+               if (needsRecompression) {
+                  const auto packedSize = element->GetPackedSize(sealedPage.fNElements);
+                  auto unzipBuffer = std::make_unique<unsigned char[]>(packedSize);
+                  decompressor->Unzip(sealedPage.fBuffer, sealedPage.fSize, packedSize, unzipBuffer.get());
+                  auto zipBuffer = std::make_unique<unsigned char[]>(packedSize);
+                  const auto zipSize =
+                     Detail::RNTupleCompressor::Zip(unzipBuffer.get(), packedSize, destCompression, zipBuffer.get());
+                  sealedPage.fBuffer = zipBuffer.get();
+                  sealedPage.fSize = zipSize;
+                  buffer = std::move(zipBuffer);
+               }
+
+               sealedPages.emplace_back(std::move(sealedPage));
+               buffers.emplace_back(std::move(buffer));
+            }
+            nPagesPerColumn.emplace_back(pageRange.fPageInfos.size());
+         }
+
+         // The iterators into the deque are only stable once all sealed pages of the cluster have been added
+         std::vector<Detail::RPageStorage::RSealedPageGroup> toCommit;
+         auto itrPage = sealedPages.cbegin();
+         for (std::size_t i = 0; i < columnMap.size(); ++i) {
+            auto itrLast = std::next(itrPage, nPagesPerColumn[i]);
+            toCommit.emplace_back(columnMap[i].second.fPhysicalId, itrPage, itrLast);
+            itrPage = itrLast;
+         }
+         destination.CommitSealedPageV(toCommit);
+         destination.CommitCluster(destination.GetNEntriesCommitted() + clusterDesc->GetNEntries());
+      }
+
+      if (!clusters.empty())
+         destination.CommitClusterGroup();
+   }
+
+   destination.CommitDataset();
+}
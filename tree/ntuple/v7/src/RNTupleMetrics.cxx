@@ -63,6 +63,18 @@ ROOT::Experimental::Detail::RNTupleMetrics::GetCounter(std::string_view name) co
    return nullptr;
 }
 
+void ROOT::Experimental::Detail::RNTupleMetrics::VisitCounters(
+   const std::function<void(const std::string &, const RNTuplePerfCounter &)> &fnVisit,
+   const std::string &prefix) const
+{
+   for (const auto &c : fCounters) {
+      fnVisit(prefix + fName + kNamespaceSeperator + c->GetName(), *c);
+   }
+   for (const auto m : fObservedMetrics) {
+      m->VisitCounters(fnVisit, prefix + fName + kNamespaceSeperator);
+   }
+}
+
 void ROOT::Experimental::Detail::RNTupleMetrics::Print(std::ostream &output, const std::string &prefix) const
 {
    if (!fIsEnabled) {
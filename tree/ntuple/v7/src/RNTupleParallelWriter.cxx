@@ -0,0 +1,205 @@
+/// \file RNTupleParallelWriter.cxx
+/// \ingroup NTuple ROOT7
+/// \date 2023-04-18
+/// \warning This is part of the ROOT 7 prototype! It will change without notice. It might trigger earthquakes. Feedback
+/// is welcome!
+
+/*************************************************************************
+ * Copyright (C) 1995-2023, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include <ROOT/RNTupleParallelWriter.hxx>
+
+#include <ROOT/RColumn.hxx>
+#include <ROOT/RLogger.hxx>
+#include <ROOT/RNTuple.hxx>
+#include <ROOT/RNTupleModel.hxx>
+#include <ROOT/RNTupleZip.hxx>
+#include <ROOT/RPageAllocator.hxx>
+#include <ROOT/RPageSinkBuf.hxx>
+#include <ROOT/RPageStorage.hxx>
+#include <ROOT/RPageStorageFile.hxx>
+
+#include <TError.h>
+
+#include <iterator>
+#include <utility>
+
+namespace {
+
+using ROOT::Experimental::DescriptorId_t;
+using ROOT::Experimental::NTupleSize_t;
+using ROOT::Experimental::RException;
+using ROOT::Experimental::RNTupleLocator;
+using ROOT::Experimental::RNTupleModel;
+using ROOT::Experimental::RValueStatistics;
+using ROOT::Experimental::Detail::RPage;
+using ROOT::Experimental::Detail::RPageSink;
+using ROOT::Experimental::Detail::RPageStorage;
+
+/// A page sink that forwards the sealed pages and the cluster commits of one fill context to the page sink shared by
+/// all the fill contexts.  It is meant to be wrapped by an RPageSinkBuf, which seals the pages before taking the
+/// guard of this sink.  The header, the page lists, and the footer are written by the RNTupleParallelWriter.
+class RPageSynchronizingSink : public RPageSink {
+private:
+   /// The shared page sink that actually writes the data
+   RPageSink &fInnerSink;
+   /// The mutex of the RNTupleParallelWriter that protects fInnerSink
+   std::mutex &fMutex;
+
+protected:
+   void CreateImpl(const RNTupleModel &, unsigned char *, std::uint32_t) final {}
+   RNTupleLocator CommitPageImpl(ColumnHandle_t columnHandle, const RPage &page) final
+   {
+      const auto &element = *columnHandle.fColumn->GetElement();
+      auto sealedPage = SealPage(page, element, GetWriteOptions().GetCompression());
+      RValueStatistics statistics;
+      if (GetWriteOptions().GetHasPageStatistics() &&
+          element.GetValueStatistics(page.GetBuffer(), page.GetNElements(), statistics))
+         sealedPage.fStatistics = statistics;
+      fInnerSink.CommitSealedPage(columnHandle.fPhysicalId, sealedPage);
+      return RNTupleLocator{};
+   }
+   RNTupleLocator CommitSealedPageImpl(DescriptorId_t physicalColumnId, const RSealedPage &sealedPage) final
+   {
+      fInnerSink.CommitSealedPage(physicalColumnId, sealedPage);
+      return RNTupleLocator{};
+   }
+   std::vector<RNTupleLocator> CommitSealedPageVImpl(std::span<RPageStorage::RSealedPageGroup> ranges) final
+   {
+      fInnerSink.CommitSealedPageV(ranges);
+      std::size_t nPages = 0;
+      for (const auto &range : ranges)
+         nPages += std::distance(range.fFirst, range.fLast);
+      // The locators are only used for the bookkeeping of this sink, which is never written out
+      return std::vector<RNTupleLocator>(nPages);
+   }
+   std::uint64_t CommitClusterImpl(NTupleSize_t nEntries) final
+   {
+      // nEntries counts the entries of this fill context; the inner sink expects the total number of entries
+      const auto nNewEntries = nEntries - fPrevClusterNEntries;
+      return fInnerSink.CommitCluster(fInnerSink.GetNEntriesCommitted() + nNewEntries);
+   }
+   RNTupleLocator CommitClusterGroupImpl(unsigned char *, std::uint32_t) final
+   {
+      throw RException(R__FAIL("cluster groups of a fill context are committed by the parallel writer"));
+   }
+   void CommitDatasetImpl(unsigned char *, std::uint32_t) final
+   {
+      throw RException(R__FAIL("the dataset of a fill context is committed by the parallel writer"));
+   }
+
+public:
+   RPageSynchronizingSink(RPageSink &inner, std::mutex &mutex)
+      : RPageSink(inner.GetNTupleName(), inner.GetWriteOptions()), fInnerSink(inner), fMutex(mutex)
+   {
+      fCompressor = std::make_unique<ROOT::Experimental::Detail::RNTupleCompressor>();
+      fComputePageStatistics = false;
+      // The shared sink keeps a single set of open page ranges.  Pages committed before the end of a cluster would
+      // end up in the cluster of whichever fill context commits a cluster first; thus, no early commits.
+      fOptions->SetPageBufferBudget(0);
+      // The pages must be compressed by the fill context before it takes the guard of the shared sink, even without
+      // implicit multi-threading
+      fOptions->SetSealPagesEagerly(true);
+   }
+   RPageSynchronizingSink(const RPageSynchronizingSink &) = delete;
+   RPageSynchronizingSink &operator=(const RPageSynchronizingSink &) = delete;
+   ~RPageSynchronizingSink() override = default;
+
+   RPage ReservePage(ColumnHandle_t columnHandle, std::size_t nElements) final
+   {
+      if (nElements == 0)
+         throw RException(R__FAIL("invalid call: request empty page"));
+      auto elementSize = columnHandle.fColumn->GetElement()->GetSize();
+      return ROOT::Experimental::Detail::RPageAllocatorHeap::NewPage(columnHandle.fPhysicalId, elementSize,
+                                                                     nElements);
+   }
+   void ReleasePage(RPage &page) final { ROOT::Experimental::Detail::RPageAllocatorHeap::DeletePage(page); }
+
+   RSinkGuard GetSinkGuard() final { return RSinkGuard(&fMutex); }
+};
+
+} // anonymous namespace
+
+ROOT::Experimental::RNTupleParallelWriter::RNTupleParallelWriter(std::unique_ptr<RNTupleModel> model,
+                                                                 std::unique_ptr<Detail::RPageSink> sink)
+   : fSink(std::move(sink)), fModel(std::move(model)), fMetrics("RNTupleParallelWriter")
+{
+   if (!fModel) {
+      throw RException(R__FAIL("null model"));
+   }
+   if (!fSink) {
+      throw RException(R__FAIL("null sink"));
+   }
+   fModel->Freeze();
+   fSink->Create(*fModel);
+   fMetrics.ObserveMetrics(fSink->GetMetrics());
+}
+
+ROOT::Experimental::RNTupleParallelWriter::~RNTupleParallelWriter()
+{
+   for (const auto &context : fFillContexts) {
+      if (!context.expired()) {
+         R__LOG_ERROR(NTupleLog()) << "RNTupleFillContext has not been destructed";
+         return;
+      }
+   }
+
+   // All fill contexts have flushed their data; commit all their clusters in a single cluster group
+   try {
+      if (fSink->GetNEntriesCommitted() > 0)
+         fSink->CommitClusterGroup();
+      fSink->CommitDataset();
+   } catch (const RException &err) {
+      R__LOG_ERROR(NTupleLog()) << "failure committing ntuple: " << err.GetError().GetReport();
+   }
+}
+
+std::unique_ptr<ROOT::Experimental::RNTupleParallelWriter>
+ROOT::Experimental::RNTupleParallelWriter::Recreate(std::unique_ptr<RNTupleModel> model, std::string_view ntupleName,
+                                                    std::string_view storage, const RNTupleWriteOptions &options)
+{
+   if (!options.GetUseBufferedWrite()) {
+      throw RException(R__FAIL("parallel writing requires buffering"));
+   }
+
+   // The shared sink must not be buffered itself: the fill contexts take care of buffering and compressing the pages
+   auto innerOptions = options.Clone();
+   innerOptions->SetUseBufferedWrite(false);
+   auto sink = Detail::RPageSink::Create(ntupleName, storage, *innerOptions);
+   // Cannot use std::make_unique because the constructor of RNTupleParallelWriter is private.
+   return std::unique_ptr<RNTupleParallelWriter>(new RNTupleParallelWriter(std::move(model), std::move(sink)));
+}
+
+std::unique_ptr<ROOT::Experimental::RNTupleParallelWriter>
+ROOT::Experimental::RNTupleParallelWriter::Append(std::unique_ptr<RNTupleModel> model, std::string_view ntupleName,
+                                                  TFile &file, const RNTupleWriteOptions &options)
+{
+   if (!options.GetUseBufferedWrite()) {
+      throw RException(R__FAIL("parallel writing requires buffering"));
+   }
+
+   auto sink = std::make_unique<Detail::RPageSinkFile>(ntupleName, file, options);
+   // Cannot use std::make_unique because the constructor of RNTupleParallelWriter is private.
+   return std::unique_ptr<RNTupleParallelWriter>(new RNTupleParallelWriter(std::move(model), std::move(sink)));
+}
+
+std::shared_ptr<ROOT::Experimental::RNTupleFillContext> ROOT::Experimental::RNTupleParallelWriter::CreateFillContext()
+{
+   auto model = fModel->Clone();
+
+   // Every fill context buffers and seals its pages on its own; the synchronizing sink only serializes the commit
+   // of complete clusters to the shared sink.
+   auto sink = std::make_unique<Detail::RPageSinkBuf>(std::make_unique<RPageSynchronizingSink>(*fSink, fMutex));
+
+   // Cannot use std::make_shared because the constructor of RNTupleFillContext is private.
+   std::shared_ptr<RNTupleFillContext> context(new RNTupleFillContext(std::move(model), std::move(sink)));
+
+   std::lock_guard g(fMutex);
+   fFillContexts.push_back(context);
+   return context;
+}
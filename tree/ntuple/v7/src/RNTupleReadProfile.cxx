@@ -0,0 +1,304 @@
+/// \file RNTupleReadProfile.cxx
+/// \ingroup NTuple ROOT7
+/// \date 2024-02-12
+/// \warning This is part of the ROOT 7 prototype! It will change without notice. It might trigger earthquakes. Feedback
+/// is welcome!
+
+/*************************************************************************
+ * Copyright (C) 1995-2024, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include <ROOT/RNTupleMetrics.hxx>
+#include <ROOT/RNTupleReadProfile.hxx>
+
+#include <TError.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <numeric>
+
+namespace {
+
+using ROOT::Experimental::Detail::RNTupleReadProfile;
+using ROOT::Experimental::Detail::RNTupleReadReport;
+
+std::string EscapeJSON(const std::string &str)
+{
+   std::string result;
+   result.reserve(str.length());
+   for (auto c : str) {
+      switch (c) {
+      case '"': result += "\\\""; break;
+      case '\\': result += "\\\\"; break;
+      case '\n': result += "\\n"; break;
+      case '\t': result += "\\t"; break;
+      default:
+         if (static_cast<unsigned char>(c) < 0x20) {
+            char buf[8];
+            snprintf(buf, sizeof(buf), "\\u%04x", c);
+            result += buf;
+         } else {
+            result += c;
+         }
+      }
+   }
+   return result;
+}
+
+std::string EscapeCSV(const std::string &str)
+{
+   if (str.find_first_of(",\"\n") == std::string::npos)
+      return str;
+   std::string result = "\"";
+   for (auto c : str) {
+      if (c == '"')
+         result += '"';
+      result += c;
+   }
+   return result + "\"";
+}
+
+/// Integral counter values, such as byte counts, are printed without loss of precision; returns an empty string
+/// for NaN and infinity
+std::string FormatValue(double value)
+{
+   if (!std::isfinite(value))
+      return "";
+   if ((std::floor(value) == value) && (std::abs(value) < 9007199254740992.)) // 2^53
+      return std::to_string(static_cast<std::int64_t>(value));
+   char buf[32];
+   snprintf(buf, sizeof(buf), "%.17g", value);
+   return buf;
+}
+
+void PrintJSON(const RNTupleReadReport &report, std::ostream &output)
+{
+   output << "{\"ntuple\": \"" << EscapeJSON(report.fNTupleName) << "\", \"location\": \""
+          << EscapeJSON(report.fLocation) << "\",\n";
+
+   output << " \"counters\": [";
+   for (std::size_t i = 0; i < report.fCounters.size(); ++i) {
+      const auto &counter = report.fCounters[i];
+      output << (i == 0 ? "\n" : ",\n") << "  {\"name\": \"" << EscapeJSON(counter.fName) << "\", \"unit\": \""
+             << EscapeJSON(counter.fUnit) << "\", \"description\": \"" << EscapeJSON(counter.fDescription)
+             << "\", \"value\": ";
+      // NaN and infinity are not valid JSON numbers
+      const auto value = FormatValue(counter.fValue);
+      output << (value.empty() ? "null" : value) << "}";
+   }
+   output << "],\n";
+
+   output << " \"columns\": [";
+   for (std::size_t i = 0; i < report.fColumns.size(); ++i) {
+      const auto &column = report.fColumns[i];
+      output << (i == 0 ? "\n" : ",\n") << "  {\"id\": " << column.fPhysicalColumnId << ", \"field\": \""
+             << EscapeJSON(column.fFieldName) << "\", \"type\": \"" << EscapeJSON(column.fColumnType)
+             << "\", \"nPages\": " << column.fStats.fNPages << ", \"szOnStorage\": " << column.fStats.fSzOnStorage
+             << ", \"szUnzip\": " << column.fStats.fSzUnzip << ", \"timeUnzip\": " << column.fStats.fTimeUnzip
+             << ", \"timeUnpack\": " << column.fStats.fTimeUnpack << "}";
+   }
+   output << "],\n";
+
+   output << " \"clusters\": [";
+   for (std::size_t i = 0; i < report.fClusterPhases.size(); ++i) {
+      const auto &phase = report.fClusterPhases[i];
+      output << (i == 0 ? "\n" : ",\n") << "  {\"id\": " << phase.fClusterId << ", \"phase\": \""
+             << RNTupleReadProfile::GetPhaseName(phase.fPhase) << "\", \"start\": " << phase.fStart
+             << ", \"end\": " << phase.fEnd << ", \"busy\": " << phase.fBusy << "}";
+   }
+   output << "]}";
+}
+
+void PrintCSVHeader(std::ostream &output)
+{
+   output << "ntuple,location,kind,id,field,name,unit,value\n";
+}
+
+void PrintCSV(const RNTupleReadReport &report, std::ostream &output)
+{
+   const std::string prefix = EscapeCSV(report.fNTupleName) + "," + EscapeCSV(report.fLocation) + ",";
+   for (const auto &counter : report.fCounters) {
+      output << prefix << "counter,,," << EscapeCSV(counter.fName) << "," << EscapeCSV(counter.fUnit) << ","
+             << FormatValue(counter.fValue) << "\n";
+   }
+   for (const auto &column : report.fColumns) {
+      const std::string columnPrefix =
+         prefix + "column," + std::to_string(column.fPhysicalColumnId) + "," + EscapeCSV(column.fFieldName) + ",";
+      output << columnPrefix << "nPages,," << column.fStats.fNPages << "\n";
+      output << columnPrefix << "szOnStorage,B," << column.fStats.fSzOnStorage << "\n";
+      output << columnPrefix << "szUnzip,B," << column.fStats.fSzUnzip << "\n";
+      output << columnPrefix << "timeUnzip,ns," << column.fStats.fTimeUnzip << "\n";
+      output << columnPrefix << "timeUnpack,ns," << column.fStats.fTimeUnpack << "\n";
+   }
+   for (const auto &phase : report.fClusterPhases) {
+      const std::string phasePrefix = prefix + "cluster," + std::to_string(phase.fClusterId) + ",," +
+                                      RNTupleReadProfile::GetPhaseName(phase.fPhase);
+      output << phasePrefix << ".start,ns," << phase.fStart << "\n";
+      output << phasePrefix << ".end,ns," << phase.fEnd << "\n";
+      output << phasePrefix << ".busy,ns," << phase.fBusy << "\n";
+   }
+}
+
+} // anonymous namespace
+
+const char *ROOT::Experimental::Detail::RNTupleReadProfile::GetPhaseName(EPhase phase)
+{
+   switch (phase) {
+   case EPhase::kRead: return "read";
+   case EPhase::kUnzip: return "unzip";
+   case EPhase::kUnpack: return "unpack";
+   }
+   return "";
+}
+
+std::uint64_t ROOT::Experimental::Detail::RNTupleReadProfile::GetTimestamp(Clock_t::time_point timePoint) const
+{
+   return std::chrono::duration_cast<std::chrono::nanoseconds>(timePoint - fStartTime).count();
+}
+
+void ROOT::Experimental::Detail::RNTupleReadProfile::AddClusterActivityUnlocked(DescriptorId_t clusterId,
+                                                                                EPhase phase,
+                                                                                Clock_t::time_point start,
+                                                                                Clock_t::time_point end,
+                                                                                std::uint64_t busy)
+{
+   const auto tsStart = GetTimestamp(start);
+   const auto tsEnd = GetTimestamp(end);
+   auto itr = fClusterPhases.find({clusterId, phase});
+   if (itr == fClusterPhases.end()) {
+      fClusterPhases[{clusterId, phase}] = RClusterPhase{clusterId, phase, tsStart, tsEnd, busy};
+      return;
+   }
+   auto &clusterPhase = itr->second;
+   clusterPhase.fStart = std::min(clusterPhase.fStart, tsStart);
+   clusterPhase.fEnd = std::max(clusterPhase.fEnd, tsEnd);
+   clusterPhase.fBusy += busy;
+}
+
+void ROOT::Experimental::Detail::RNTupleReadProfile::AddUnsealedPage(DescriptorId_t physicalColumnId,
+                                                                     DescriptorId_t clusterId,
+                                                                     std::uint64_t szOnStorage, std::uint64_t szUnzip,
+                                                                     Clock_t::time_point start,
+                                                                     Clock_t::time_point unzipped,
+                                                                     Clock_t::time_point end)
+{
+   const std::uint64_t timeUnzip = std::chrono::duration_cast<std::chrono::nanoseconds>(unzipped - start).count();
+   const std::uint64_t timeUnpack = std::chrono::duration_cast<std::chrono::nanoseconds>(end - unzipped).count();
+
+   std::lock_guard<std::mutex> lockGuard(fLock);
+   auto &stats = fColumnStats[physicalColumnId];
+   stats.fNPages++;
+   stats.fSzOnStorage += szOnStorage;
+   stats.fSzUnzip += szUnzip;
+   stats.fTimeUnzip += timeUnzip;
+   stats.fTimeUnpack += timeUnpack;
+
+   if (clusterId == kInvalidDescriptorId)
+      return;
+   AddClusterActivityUnlocked(clusterId, EPhase::kUnzip, start, unzipped, timeUnzip);
+   if (end > unzipped)
+      AddClusterActivityUnlocked(clusterId, EPhase::kUnpack, unzipped, end, timeUnpack);
+}
+
+void ROOT::Experimental::Detail::RNTupleReadProfile::AddClusterActivity(DescriptorId_t clusterId, EPhase phase,
+                                                                        Clock_t::time_point start,
+                                                                        Clock_t::time_point end)
+{
+   const std::uint64_t busy = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+   std::lock_guard<std::mutex> lockGuard(fLock);
+   AddClusterActivityUnlocked(clusterId, phase, start, end, busy);
+}
+
+void ROOT::Experimental::Detail::RNTupleReadProfile::AddVectorRead(const std::vector<DescriptorId_t> &clusterIds,
+                                                                   const std::vector<std::uint64_t> &nBytes,
+                                                                   Clock_t::time_point start, Clock_t::time_point end)
+{
+   R__ASSERT(clusterIds.size() == nBytes.size());
+   const double duration = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+   const auto nBytesTotal = std::accumulate(nBytes.begin(), nBytes.end(), std::uint64_t(0));
+
+   std::lock_guard<std::mutex> lockGuard(fLock);
+   for (std::size_t i = 0; i < clusterIds.size(); ++i) {
+      const double fraction =
+         (nBytesTotal > 0) ? double(nBytes[i]) / double(nBytesTotal) : 1. / double(clusterIds.size());
+      AddClusterActivityUnlocked(clusterIds[i], EPhase::kRead, start, end,
+                                 static_cast<std::uint64_t>(duration * fraction));
+   }
+}
+
+std::map<ROOT::Experimental::DescriptorId_t, ROOT::Experimental::Detail::RNTupleReadProfile::RColumnStats>
+ROOT::Experimental::Detail::RNTupleReadProfile::GetColumnStats() const
+{
+   std::lock_guard<std::mutex> lockGuard(fLock);
+   return fColumnStats;
+}
+
+std::vector<ROOT::Experimental::Detail::RNTupleReadProfile::RClusterPhase>
+ROOT::Experimental::Detail::RNTupleReadProfile::GetClusterPhases() const
+{
+   std::vector<RClusterPhase> result;
+   {
+      std::lock_guard<std::mutex> lockGuard(fLock);
+      for (const auto &p : fClusterPhases)
+         result.emplace_back(p.second);
+   }
+   std::stable_sort(result.begin(), result.end(),
+                    [](const RClusterPhase &a, const RClusterPhase &b) { return a.fStart < b.fStart; });
+   return result;
+}
+
+void ROOT::Experimental::Detail::RNTupleReadReport::SetCounters(const RNTupleMetrics &metrics)
+{
+   fCounters.clear();
+   metrics.VisitCounters([this](const std::string &name, const RNTuplePerfCounter &counter) {
+      RCounter c;
+      c.fName = name;
+      c.fUnit = counter.GetUnit();
+      c.fDescription = counter.GetDescription();
+      // Calculated counters are floating point values, NaN if they are not available
+      if (auto calcPerf = dynamic_cast<const RNTupleCalcPerf *>(&counter))
+         c.fValue = calcPerf->GetValue();
+      else
+         c.fValue = counter.GetValueAsInt();
+      fCounters.emplace_back(std::move(c));
+   });
+}
+
+void ROOT::Experimental::Detail::RNTupleReadReport::Print(std::ostream &output, EFormat format) const
+{
+   switch (format) {
+   case EFormat::kJSON:
+      PrintJSON(*this, output);
+      output << std::endl;
+      break;
+   case EFormat::kCSV:
+      PrintCSVHeader(output);
+      PrintCSV(*this, output);
+      break;
+   }
+}
+
+void ROOT::Experimental::Detail::RNTupleReadReport::Print(const std::vector<RNTupleReadReport> &reports,
+                                                          std::ostream &output, EFormat format)
+{
+   switch (format) {
+   case EFormat::kJSON:
+      output << "[";
+      for (std::size_t i = 0; i < reports.size(); ++i) {
+         output << (i == 0 ? "\n" : ",\n");
+         PrintJSON(reports[i], output);
+      }
+      output << "]" << std::endl;
+      break;
+   case EFormat::kCSV:
+      PrintCSVHeader(output);
+      for (const auto &r : reports)
+         PrintCSV(r, output);
+      break;
+   }
+}
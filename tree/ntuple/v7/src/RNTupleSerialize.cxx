@@ -187,7 +187,7 @@ std::uint32_t SerializeColumnListV1(const ROOT::Experimental::RNTupleDescriptor
 
          auto type = c.GetModel().GetType();
          pos += RNTupleSerializer::SerializeColumnType(type, *where);
-         pos += RNTupleSerializer::SerializeUInt16(RColumnElementBase::GetBitsOnStorage(type), *where);
+         pos += RNTupleSerializer::SerializeUInt16(RColumnElementBase::GetBitsOnStorage(c.GetModel()), *where);
          pos += RNTupleSerializer::SerializeUInt32(context.GetOnDiskFieldId(c.GetFieldId()), *where);
          std::uint32_t flags = 0;
          // TODO(jblomer): add support for descending columns in the column model
@@ -199,9 +199,16 @@ std::uint32_t SerializeColumnListV1(const ROOT::Experimental::RNTupleDescriptor
          const std::uint64_t firstElementIdx = c.GetFirstElementIndex();
          if (firstElementIdx > 0)
             flags |= RNTupleSerializer::kFlagDeferredColumn;
+         const auto &valueRange = c.GetModel().GetValueRange();
+         if (valueRange)
+            flags |= RNTupleSerializer::kFlagHasValueRange;
          pos += RNTupleSerializer::SerializeUInt32(flags, *where);
          if (flags & RNTupleSerializer::kFlagDeferredColumn)
             pos += RNTupleSerializer::SerializeUInt64(firstElementIdx, *where);
+         if (valueRange) {
+            pos += RNTupleSerializer::SerializeDouble(valueRange->first, *where);
+            pos += RNTupleSerializer::SerializeDouble(valueRange->second, *where);
+         }
 
          pos += RNTupleSerializer::SerializeFramePostscript(buffer ? frame : nullptr, pos - frame);
       }
@@ -232,6 +239,8 @@ RResult<std::uint32_t> DeserializeColumnV1(
    std::uint32_t fieldId;
    std::uint32_t flags;
    std::uint64_t firstElementIdx = 0;
+   double valueMin = 0.0;
+   double valueMax = 0.0;
    if (fnFrameSizeLeft() < RNTupleSerializer::SerializeColumnType(type, nullptr) +
                            sizeof(std::uint16_t) + 2 * sizeof(std::uint32_t))
    {
@@ -249,12 +258,36 @@ RResult<std::uint32_t> DeserializeColumnV1(
          return R__FAIL("column record frame too short");
       bytes += RNTupleSerializer::DeserializeUInt64(bytes, firstElementIdx);
    }
+   if (flags & RNTupleSerializer::kFlagHasValueRange) {
+      if (fnFrameSizeLeft() < 2 * sizeof(double))
+         return R__FAIL("column record frame too short");
+      bytes += RNTupleSerializer::DeserializeDouble(bytes, valueMin);
+      bytes += RNTupleSerializer::DeserializeDouble(bytes, valueMax);
+   }
 
-   if (ROOT::Experimental::Detail::RColumnElementBase::GetBitsOnStorage(type) != bitsOnStorage)
+   const bool isSorted = (flags & (RNTupleSerializer::kFlagSortAscColumn | RNTupleSerializer::kFlagSortDesColumn));
+   ROOT::Experimental::RColumnModel model(type, isSorted);
+
+   // For the lossy float columns, the bit width and the value range are part of the column model; they are verified
+   // by configuring a column element accordingly
+   if (type == EColumnType::kReal32Trunc || type == EColumnType::kReal32Quant) {
+      model.SetBitsOnStorage(bitsOnStorage);
+      if (flags & RNTupleSerializer::kFlagHasValueRange)
+         model.SetValueRange(valueMin, valueMax);
+      else if (type == EColumnType::kReal32Quant)
+         return R__FAIL("missing value range of quantized column");
+      try {
+         ROOT::Experimental::Detail::RColumnElementBase::Generate<void>(type)->ApplyColumnModel(model);
+      } catch (const ROOT::Experimental::RException &err) {
+         return R__FAIL("invalid column model: " + err.GetError().GetReport());
+      }
+   } else if (ROOT::Experimental::Detail::RColumnElementBase::GetBitsOnStorage(type) != bitsOnStorage) {
       return R__FAIL("column element size mismatch");
+   } else if (flags & RNTupleSerializer::kFlagHasValueRange) {
+      return R__FAIL("value range given for a column type that does not support it");
+   }
 
-   const bool isSorted = (flags & (RNTupleSerializer::kFlagSortAscColumn | RNTupleSerializer::kFlagSortDesColumn));
-   columnDesc.FieldId(fieldId).Model({type, isSorted}).FirstElementIndex(firstElementIdx);
+   columnDesc.FieldId(fieldId).Model(model).FirstElementIndex(firstElementIdx);
 
    return frameSize;
 }
@@ -471,6 +504,22 @@ std::uint32_t ROOT::Experimental::Internal::RNTupleSerializer::DeserializeUInt64
    return DeserializeInt64(buffer, *reinterpret_cast<std::int64_t *>(&val));
 }
 
+std::uint32_t ROOT::Experimental::Internal::RNTupleSerializer::SerializeDouble(double val, void *buffer)
+{
+   // IEEE 754 binary64, stored with the byte order of a 64bit integer
+   std::uint64_t bits;
+   memcpy(&bits, &val, sizeof(bits));
+   return SerializeUInt64(bits, buffer);
+}
+
+std::uint32_t ROOT::Experimental::Internal::RNTupleSerializer::DeserializeDouble(const void *buffer, double &val)
+{
+   std::uint64_t bits;
+   auto result = DeserializeUInt64(buffer, bits);
+   memcpy(&val, &bits, sizeof(val));
+   return result;
+}
+
 std::uint32_t ROOT::Experimental::Internal::RNTupleSerializer::SerializeString(const std::string &val, void *buffer)
 {
    if (buffer) {
@@ -533,6 +582,13 @@ std::uint16_t ROOT::Experimental::Internal::RNTupleSerializer::SerializeColumnTy
    case EColumnType::kSplitUInt32: return SerializeUInt16(0x14, buffer);
    case EColumnType::kSplitInt16: return SerializeUInt16(0x1C, buffer);
    case EColumnType::kSplitUInt16: return SerializeUInt16(0x15, buffer);
+   case EColumnType::kPackedIndex64: return SerializeUInt16(0x1D, buffer);
+   case EColumnType::kPackedIndex32: return SerializeUInt16(0x1E, buffer);
+   case EColumnType::kPackedInt64: return SerializeUInt16(0x1F, buffer);
+   case EColumnType::kPackedInt32: return SerializeUInt16(0x20, buffer);
+   case EColumnType::kPackedInt16: return SerializeUInt16(0x21, buffer);
+   case EColumnType::kReal32Trunc: return SerializeUInt16(0x22, buffer);
+   case EColumnType::kReal32Quant: return SerializeUInt16(0x23, buffer);
    default: throw RException(R__FAIL("ROOT bug: unexpected column type"));
    }
 }
@@ -572,6 +628,13 @@ RResult<std::uint16_t> ROOT::Experimental::Internal::RNTupleSerializer::Deserial
    case 0x14: type = EColumnType::kSplitUInt32; break;
    case 0x1C: type = EColumnType::kSplitInt16; break;
    case 0x15: type = EColumnType::kSplitUInt16; break;
+   case 0x1D: type = EColumnType::kPackedIndex64; break;
+   case 0x1E: type = EColumnType::kPackedIndex32; break;
+   case 0x1F: type = EColumnType::kPackedInt64; break;
+   case 0x20: type = EColumnType::kPackedInt32; break;
+   case 0x21: type = EColumnType::kPackedInt16; break;
+   case 0x22: type = EColumnType::kReal32Trunc; break;
+   case 0x23: type = EColumnType::kReal32Quant; break;
    default: return R__FAIL("unexpected on-disk column type");
    }
    return result;
@@ -1285,6 +1348,19 @@ std::uint32_t ROOT::Experimental::Internal::RNTupleSerializer::SerializePageList
          }
          pos += SerializeUInt64(columnRange.fFirstElementIndex, *where);
          pos += SerializeUInt32(columnRange.fCompressionSettings, *where);
+         // The page statistics block is announced by a footer feature flag; older readers skip it as part of the
+         // frame.  It is empty unless all the pages have statistics.  The cluster statistics are merged from the page
+         // statistics on reading.
+         if (desc.HasPageStatistics()) {
+            const std::uint32_t nStatistics = columnRange.fStatistics ? pageRange.fPageInfos.size() : 0;
+            pos += SerializeUInt32(nStatistics, *where);
+            for (std::uint32_t k = 0; k < nStatistics; ++k) {
+               const auto &pi = pageRange.fPageInfos[k];
+               pos += SerializeDouble(pi.fStatistics->fMin, *where);
+               pos += SerializeDouble(pi.fStatistics->fMax, *where);
+               pos += SerializeUInt64(pi.fStatistics->fNNaN, *where);
+            }
+         }
 
          pos += SerializeFramePostscript(buffer ? innerFrame : nullptr, pos - innerFrame);
       }
@@ -1308,8 +1384,10 @@ ROOT::Experimental::Internal::RNTupleSerializer::SerializeFooterV1(void *buffer,
 
    pos += SerializeEnvelopePreamble(*where);
 
-   // So far we don't make use of feature flags
-   pos += SerializeFeatureFlags(std::vector<std::int64_t>(), *where);
+   std::vector<std::int64_t> featureFlags;
+   if (desc.HasPageStatistics())
+      featureFlags.emplace_back(kFeatureFlagPageStatistics);
+   pos += SerializeFeatureFlags(featureFlags, *where);
    pos += SerializeUInt32(context.GetHeaderCRC32(), *where);
 
    // Schema extension, i.e. incremental changes with respect to the header
@@ -1444,6 +1522,10 @@ ROOT::Experimental::RResult<void> ROOT::Experimental::Internal::RNTupleSerialize
    if (!result)
       return R__FORWARD_ERROR(result);
    bytes += result.Unwrap();
+   if (!featureFlags.empty()) {
+      descBuilder.SetHasPageStatistics(featureFlags[0] & kFeatureFlagPageStatistics);
+      featureFlags[0] &= ~kFeatureFlagPageStatistics;
+   }
    for (auto f: featureFlags) {
       if (f)
          R__LOG_WARNING(NTupleLog()) << "Unsupported feature flag! " << f;
@@ -1539,7 +1621,8 @@ ROOT::Experimental::RResult<void> ROOT::Experimental::Internal::RNTupleSerialize
 
 
 ROOT::Experimental::RResult<void> ROOT::Experimental::Internal::RNTupleSerializer::DeserializePageListV1(
-   const void *buffer, std::uint32_t bufSize, std::vector<RClusterDescriptorBuilder> &clusters)
+   const void *buffer, std::uint32_t bufSize, std::vector<RClusterDescriptorBuilder> &clusters,
+   bool hasPageStatistics)
 {
    auto base = reinterpret_cast<const unsigned char *>(buffer);
    auto bytes = base;
@@ -1608,6 +1691,26 @@ ROOT::Experimental::RResult<void> ROOT::Experimental::Internal::RNTupleSerialize
          std::uint32_t compressionSettings;
          bytes += DeserializeUInt32(bytes, compressionSettings);
 
+         if (hasPageStatistics) {
+            if (fnInnerFrameSizeLeft() < static_cast<int>(sizeof(std::uint32_t)))
+               return R__FAIL("page statistics block missing");
+            std::uint32_t nStatistics;
+            bytes += DeserializeUInt32(bytes, nStatistics);
+            if (nStatistics != 0 && nStatistics != nPages)
+               return R__FAIL("mismatch of page statistics and pages");
+            constexpr int kStatisticsSize = 2 * sizeof(double) + sizeof(std::uint64_t);
+            if (fnInnerFrameSizeLeft() < static_cast<int>(nStatistics * kStatisticsSize))
+               return R__FAIL("page statistics block too short");
+            for (std::uint32_t k = 0; k < nStatistics; ++k) {
+               auto &pi = pageRange.fPageInfos[k];
+               RValueStatistics statistics;
+               bytes += DeserializeDouble(bytes, statistics.fMin);
+               bytes += DeserializeDouble(bytes, statistics.fMax);
+               bytes += DeserializeUInt64(bytes, statistics.fNNaN);
+               pi.fStatistics = statistics;
+            }
+         }
+
          clusters[i].CommitColumnRange(j, columnOffset, compressionSettings, pageRange);
          bytes = innerFrame + innerFrameSize;
       }
@@ -40,9 +40,18 @@ ROOT::Experimental::Detail::RPageSinkBuf::RPageSinkBuf(std::unique_ptr<RPageSink
 {
    fCounters = std::unique_ptr<RCounters>(new RCounters{
       *fMetrics.MakeCounter<RNTuplePlainCounter*>("ParallelZip", "",
-         "compressing pages in parallel")
+         "compressing pages in parallel"),
+      *fMetrics.MakeCounter<RNTupleAtomicCounter*>("timeWallZip", "ns", "wall clock time spent compressing"),
+      *fMetrics.MakeCounter<RNTupleTickCounter<RNTupleAtomicCounter>*>("timeCpuZip", "ns",
+                                                                       "CPU time spent compressing"),
+      *fMetrics.MakeCounter<RNTuplePlainCounter *>("nPartialCommit", "",
+                                                   "number of buffered page commits before the end of a cluster"),
+      *fMetrics.MakeCounter<RNTuplePlainCounter *>("szBufferedPeak", "B",
+                                                   "peak memory of the buffered pages and their compression buffers")
    });
    fMetrics.ObserveMetrics(fInnerSink->GetMetrics());
+   // The inner sink receives the statistics with the sealed pages
+   fComputePageStatistics = false;
 }
 
 ROOT::Experimental::Detail::RPageSinkBuf::~RPageSinkBuf()
@@ -61,6 +70,16 @@ void ROOT::Experimental::Detail::RPageSinkBuf::CreateImpl(const RNTupleModel &mo
    fInnerSink->Create(*fInnerModel);
 }
 
+void ROOT::Experimental::Detail::RPageSinkBuf::LoadExistingImpl(const RNTupleModel &model)
+{
+   fInnerModel = model.Clone();
+   fInnerSink->Create(*fInnerModel);
+   // The buffered sink mirrors the descriptor of the inner sink, so that both sinks use the same physical column IDs.
+   // The inner sink writes the footer, which is why the header checksum is not needed here.
+   fDescriptorBuilder.SetDescriptor(std::move(*fInnerSink->GetDescriptor().Clone()));
+   fBufferedColumns.resize(fDescriptorBuilder.GetDescriptor().GetNPhysicalColumns());
+}
+
 void ROOT::Experimental::Detail::RPageSinkBuf::UpdateSchema(const RNTupleModelChangeset &changeset,
                                                             NTupleSize_t firstEntry)
 {
@@ -100,6 +119,20 @@ void ROOT::Experimental::Detail::RPageSinkBuf::UpdateSchema(const RNTupleModelCh
    fInnerSink->UpdateSchema(innerChangeset, firstEntry);
 }
 
+void ROOT::Experimental::Detail::RPageSinkBuf::SealZipItem(RColumnBuf::RPageZipItem &zipItem,
+                                                           RSealedPage &sealedPage,
+                                                           const RColumnElementBase &element)
+{
+   RNTupleAtomicTimer timer(fCounters->fTimeWallZip, fCounters->fTimeCpuZip);
+   sealedPage = SealPage(zipItem.fPage, element, GetWriteOptions().GetCompression(), zipItem.fBuf.get());
+   // The statistics are computed along with sealing so that they are computed in parallel, too
+   RValueStatistics statistics;
+   if (fDescriptorBuilder.GetDescriptor().HasPageStatistics() &&
+       element.GetValueStatistics(zipItem.fPage.GetBuffer(), zipItem.fPage.GetNElements(), statistics))
+      sealedPage.fStatistics = statistics;
+   zipItem.fSealedPage = &sealedPage;
+}
+
 ROOT::Experimental::RNTupleLocator
 ROOT::Experimental::Detail::RPageSinkBuf::CommitPageImpl(ColumnHandle_t columnHandle, const RPage &page)
 {
@@ -113,26 +146,63 @@ ROOT::Experimental::Detail::RPageSinkBuf::CommitPageImpl(ColumnHandle_t columnHa
    // valid until the return value of DrainBufferedPages() goes out of scope in
    // CommitCluster().
    auto &zipItem = fBufferedColumns.at(columnHandle.fPhysicalId).BufferPage(columnHandle, bufPage);
-   if (!fTaskScheduler) {
+
+   // Adaptive page sizes need the compressed size of the pages, which is only known if this sink seals them
+   const auto &options = GetWriteOptions();
+   if (!fTaskScheduler && !options.GetSealPagesEagerly() && options.GetApproxZippedPageSize() == 0) {
+      // Lazy sealing: the inner sink seals the pages one by one when they are committed, so that only the unsealed
+      // copy of the buffered pages is kept in memory
+      fNBytesBuffered += page.GetNBytes();
+      if (fNBytesBuffered > static_cast<std::size_t>(fCounters->fSzBufferedPeak.GetValue()))
+         fCounters->fSzBufferedPeak.SetValue(fNBytesBuffered);
+      CommitBufferedPagesIfOverBudget();
       return RNTupleLocator{};
    }
-   fCounters->fParallelZip.SetValue(1);
+
    // Thread safety: Each thread works on a distinct zipItem which owns its
    // compression buffer.
    zipItem.AllocateSealedPageBuf();
    R__ASSERT(zipItem.fBuf);
    auto &sealedPage = fBufferedColumns.at(columnHandle.fPhysicalId).RegisterSealedPage();
-   fTaskScheduler->AddTask([this, &zipItem, &sealedPage, colId = columnHandle.fPhysicalId] {
-      sealedPage = SealPage(zipItem.fPage, *fBufferedColumns.at(colId).GetHandle().fColumn->GetElement(),
-                            GetWriteOptions().GetCompression(), zipItem.fBuf.get());
-      zipItem.fSealedPage = &sealedPage;
-   });
+   // The buffered copy of the page and its compression buffer
+   fNBytesBuffered += 2 * page.GetNBytes();
+   if (fNBytesBuffered > static_cast<std::size_t>(fCounters->fSzBufferedPeak.GetValue()))
+      fCounters->fSzBufferedPeak.SetValue(fNBytesBuffered);
+
+   // Without a task scheduler, eagerly sealed pages are sealed right away by the calling thread.  Thus, by the time the
+   // cluster is committed, all the buffered pages are sealed and the inner sink only needs to write them.
+   if (!fTaskScheduler) {
+      SealZipItem(zipItem, sealedPage, *columnHandle.fColumn->GetElement());
+   } else {
+      fCounters->fParallelZip.SetValue(1);
+      fTaskScheduler->AddTask([this, &zipItem, &sealedPage, colId = columnHandle.fPhysicalId] {
+         SealZipItem(zipItem, sealedPage, *fBufferedColumns.at(colId).GetHandle().fColumn->GetElement());
+      });
+   }
+
+   CommitBufferedPagesIfOverBudget();
 
    // we're feeding bad locators to fOpenPageRanges but it should not matter
    // because they never get written out
    return RNTupleLocator{};
 }
 
+void ROOT::Experimental::Detail::RPageSinkBuf::CommitBufferedPagesIfOverBudget()
+{
+   // Streaming mode: write out the pages of the open cluster once the memory budget is exhausted.  The page ranges of
+   // the open cluster are kept by the inner sink until the cluster is committed.
+   const auto pageBufferBudget = GetWriteOptions().GetPageBufferBudget();
+   if (pageBufferBudget == 0 || fNBytesBuffered <= pageBufferBudget)
+      return;
+
+   WaitForAllTasks();
+   {
+      auto guard = fInnerSink->GetSinkGuard();
+      CommitBufferedPages();
+   }
+   fCounters->fNPartialCommit.Inc();
+}
+
 ROOT::Experimental::RNTupleLocator
 ROOT::Experimental::Detail::RPageSinkBuf::CommitSealedPageImpl(DescriptorId_t physicalColumnId,
                                                                const RSealedPage &sealedPage)
@@ -148,6 +218,27 @@ ROOT::Experimental::Detail::RPageSinkBuf::CommitClusterImpl(ROOT::Experimental::
 {
    WaitForAllTasks();
 
+   // If the inner sink is shared with other writers, the guard is held only for writing the buffered pages and for
+   // committing the cluster.
+   std::uint64_t nbytes;
+   {
+      auto guard = fInnerSink->GetSinkGuard();
+      CommitBufferedPages();
+      nbytes = fInnerSink->CommitCluster(nEntries);
+   }
+
+   if (GetWriteOptions().GetApproxZippedPageSize() > 0)
+      AdaptPageSizes();
+
+   for (auto &bufColumn : fBufferedColumns)
+      bufColumn.ResetClusterSizes();
+   return nbytes;
+}
+
+void ROOT::Experimental::Detail::RPageSinkBuf::CommitBufferedPages()
+{
+   fNBytesBuffered = 0;
+
    // If we have only sealed pages in all buffered columns, commit them in a single `CommitSealedPageV()` call
    bool singleCommitCall = std::all_of(fBufferedColumns.begin(), fBufferedColumns.end(),
                                        [](auto &bufColumn) { return bufColumn.HasSealedPagesOnly(); });
@@ -160,21 +251,19 @@ ROOT::Experimental::Detail::RPageSinkBuf::CommitClusterImpl(ROOT::Experimental::
       }
       fInnerSink->CommitSealedPageV(toCommit);
 
-      for (auto &bufColumn : fBufferedColumns)
+      for (auto &bufColumn : fBufferedColumns) {
+         bufColumn.AddSealedPagesToCluster();
          bufColumn.DropBufferedPages();
-      return fInnerSink->CommitCluster(nEntries);
+      }
+      return;
    }
 
-   // Otherwise, try to do it per column
+   // Otherwise, the pages have been buffered unsealed and the inner sink seals them one by one
    for (auto &bufColumn : fBufferedColumns) {
-      // In practice, either all (see above) or none of the buffered pages have been sealed, depending on whether
-      // a task scheduler is available. The rare condition of a few columns consisting only of sealed pages should
-      // not happen unless the API is misused.
-      if (!bufColumn.IsEmpty() && bufColumn.HasSealedPagesOnly())
-         throw RException(R__FAIL("only a few columns have all pages sealed"));
-
-      // Slow path: if the buffered column contains both sealed and unsealed pages, commit them one by one.
-      // TODO(jalopezg): coalesce contiguous sealed pages and commit via `CommitSealedPageV()`.
+      // In practice, either all or none of the buffered pages have been sealed, depending on whether a task scheduler
+      // is available or eager sealing is requested.  If the task scheduler was added or removed in the middle of a
+      // cluster, the sealed pages of a column are committed one by one, too.
+      bufColumn.AddSealedPagesToCluster();
       auto drained = bufColumn.DrainBufferedPages();
       for (auto &bufPage : std::get<std::deque<RColumnBuf::RPageZipItem>>(drained)) {
          if (bufPage.IsSealed()) {
@@ -185,7 +274,33 @@ ROOT::Experimental::Detail::RPageSinkBuf::CommitClusterImpl(ROOT::Experimental::
          ReleasePage(bufPage.fPage);
       }
    }
-   return fInnerSink->CommitCluster(nEntries);
+}
+
+void ROOT::Experimental::Detail::RPageSinkBuf::AdaptPageSizes()
+{
+   const auto &options = GetWriteOptions();
+   const double targetZippedPageSize = options.GetApproxZippedPageSize();
+   const auto maxUnzippedPageSize = std::max(options.GetMaxUnzippedPageSize(), options.GetApproxUnzippedPageSize());
+
+   for (auto &bufColumn : fBufferedColumns) {
+      // The pages of the cluster may have been committed in several batches; the column keeps track of their sizes
+      const auto nBytesZipped = bufColumn.GetNBytesZippedCluster();
+      const auto nBytesUnzipped = bufColumn.GetNBytesUnzippedCluster();
+      if (nBytesZipped == 0 || nBytesUnzipped == 0)
+         continue;
+      // The write pages of the column are reserved from this sink, so the sink may resize them
+      auto column = const_cast<RColumn *>(bufColumn.GetHandle().fColumn);
+      const std::uint64_t elementSize = column->GetElement()->GetSize();
+      const auto compressionRatio = bufColumn.UpdateCompressionRatio(nBytesZipped, nBytesUnzipped);
+
+      // Pages larger than the column's data in a cluster would not further reduce the number of pages but they would
+      // inflate the write buffers
+      const double upperLimit = std::min<std::uint64_t>(
+         maxUnzippedPageSize, std::max<std::uint64_t>(nBytesUnzipped, options.GetApproxUnzippedPageSize()));
+      const double lowerLimit = 2 * elementSize;
+      const auto unzippedPageSize = std::clamp(targetZippedPageSize / compressionRatio, lowerLimit, upperLimit);
+      column->SetApproxNElementsPerPage(static_cast<std::uint32_t>(unzippedPageSize / elementSize));
+   }
 }
 
 ROOT::Experimental::RNTupleLocator
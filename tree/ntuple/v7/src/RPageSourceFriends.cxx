@@ -23,9 +23,19 @@
 
 ROOT::Experimental::Detail::RPageSourceFriends::RPageSourceFriends(
    std::string_view ntupleName, std::span<std::unique_ptr<RPageSource>> sources)
-   : RPageSource(ntupleName, RNTupleReadOptions())
-   , fMetrics(std::string(ntupleName))
+   : RPageSourceFriends(ntupleName, sources, std::vector<bool>(sources.size(), false))
 {
+}
+
+ROOT::Experimental::Detail::RPageSourceFriends::RPageSourceFriends(std::string_view ntupleName,
+                                                                   std::span<std::unique_ptr<RPageSource>> sources,
+                                                                   const std::vector<bool> &isJoined)
+   : RPageSource(ntupleName, RNTupleReadOptions()), fMetrics(std::string(ntupleName)), fIsJoined(isJoined)
+{
+   if (fIsJoined.size() != sources.size())
+      throw RException(R__FAIL("number of join flags does not match the number of friend RNTuples"));
+   if (!fIsJoined.empty() && fIsJoined[0])
+      throw RException(R__FAIL("the first friend RNTuple cannot be joined"));
    for (auto &s : sources) {
       fSources.emplace_back(std::move(s));
       fMetrics.ObserveMetrics(fSources.back()->GetMetrics());
@@ -73,7 +83,7 @@ ROOT::Experimental::RNTupleDescriptor ROOT::Experimental::Detail::RPageSourceFri
    for (std::size_t i = 0; i < fSources.size(); ++i) {
       fSources[i]->Attach();
 
-      if (fSources[i]->GetNEntries() != fSources[0]->GetNEntries()) {
+      if (!fIsJoined[i] && fSources[i]->GetNEntries() != fSources[0]->GetNEntries()) {
          fNextId = 1;
          fIdBiMap.Clear();
          fBuilder.Reset();
@@ -104,7 +114,9 @@ ROOT::Experimental::RNTupleDescriptor ROOT::Experimental::Detail::RPageSourceFri
 
             clusterBuilder.CommitColumnRange(virtualColumnId, firstElementIndex, compressionSettings, pageRange);
          }
-         fBuilder.AddClusterWithDetails(clusterBuilder.MoveDescriptor().Unwrap());
+         // The entry range of a joined cluster is not an entry range of the virtual ntuple
+         if (!fIsJoined[i])
+            fBuilder.AddClusterWithDetails(clusterBuilder.MoveDescriptor().Unwrap());
          fIdBiMap.Insert({i, c.GetId()}, fNextId);
          fNextId++;
       }
@@ -121,7 +133,7 @@ ROOT::Experimental::Detail::RPageSourceFriends::Clone() const
    std::vector<std::unique_ptr<RPageSource>> cloneSources;
    for (const auto &f : fSources)
       cloneSources.emplace_back(f->Clone());
-   return std::make_unique<RPageSourceFriends>(fNTupleName, cloneSources);
+   return std::make_unique<RPageSourceFriends>(fNTupleName, cloneSources, fIsJoined);
 }
 
 
@@ -16,6 +16,7 @@
 #include <ROOT/RPageStorage.hxx>
 #include <ROOT/RPageStorageFile.hxx>
 #include <ROOT/RColumn.hxx>
+#include <ROOT/RColumnElement.hxx>
 #include <ROOT/RField.hxx>
 #include <ROOT/RNTupleDescriptor.hxx>
 #include <ROOT/RNTupleMetrics.hxx>
@@ -31,6 +32,8 @@
 #include <Compression.h>
 #include <TError.h>
 
+#include <algorithm>
+#include <functional>
 #include <utility>
 
 
@@ -76,6 +79,15 @@ ROOT::Experimental::Detail::RPageSource::RActivePhysicalColumns::ToColumnSet() c
    return result;
 }
 
+ROOT::Experimental::Detail::RCluster::ColumnSet_t
+ROOT::Experimental::Detail::RPageSource::GetPreloadColumnSet() const
+{
+   auto result = fActivePhysicalColumns.ToColumnSet();
+   for (auto id : fLazyPhysicalColumns)
+      result.erase(id);
+   return result;
+}
+
 ROOT::Experimental::Detail::RPageSource::RPageSource(std::string_view name, const RNTupleReadOptions &options)
    : RPageStorage(name), fMetrics(""), fOptions(options)
 {
@@ -143,7 +155,8 @@ void ROOT::Experimental::Detail::RPageSource::UnzipCluster(RCluster *cluster)
 
 ROOT::Experimental::Detail::RPage ROOT::Experimental::Detail::RPageSource::UnsealPage(const RSealedPage &sealedPage,
                                                                                       const RColumnElementBase &element,
-                                                                                      DescriptorId_t physicalColumnId)
+                                                                                      DescriptorId_t physicalColumnId,
+                                                                                      DescriptorId_t clusterId)
 {
    // Unsealing a page zero is a no-op.  `RPageRange::ExtendToFitColumnRange()` guarantees that the page zero buffer is
    // large enough to hold `sealedPage.fNElements`
@@ -153,6 +166,12 @@ ROOT::Experimental::Detail::RPage ROOT::Experimental::Detail::RPageSource::Unsea
       return page;
    }
 
+   const bool isProfiling = fMetrics.IsEnabled();
+   RNTupleReadProfile::Clock_t::time_point tStart;
+   RNTupleReadProfile::Clock_t::time_point tUnzipped;
+   if (isProfiling)
+      tStart = RNTupleReadProfile::Clock_t::now();
+
    const auto bytesPacked = element.GetPackedSize(sealedPage.fNElements);
    using Allocator_t = RPageAllocatorHeap;
    auto page = Allocator_t::NewPage(physicalColumnId, element.GetSize(), sealedPage.fNElements);
@@ -164,6 +183,8 @@ ROOT::Experimental::Detail::RPage ROOT::Experimental::Detail::RPageSource::Unsea
       // Note that usually pages are compressed.
       memcpy(page.GetBuffer(), sealedPage.fBuffer, bytesPacked);
    }
+   if (isProfiling)
+      tUnzipped = RNTupleReadProfile::Clock_t::now();
 
    if (!element.IsMappable()) {
       auto tmp = Allocator_t::NewPage(physicalColumnId, element.GetSize(), sealedPage.fNElements);
@@ -172,6 +193,12 @@ ROOT::Experimental::Detail::RPage ROOT::Experimental::Detail::RPageSource::Unsea
       page = tmp;
    }
 
+   if (isProfiling) {
+      fProfile.AddUnsealedPage(physicalColumnId, clusterId, sealedPage.fSize,
+                               element.GetSize() * sealedPage.fNElements, tStart, tUnzipped,
+                               element.IsMappable() ? tUnzipped : RNTupleReadProfile::Clock_t::now());
+   }
+
    page.GrowUnchecked(sealedPage.fNElements);
    return page;
 }
@@ -199,6 +226,14 @@ void ROOT::Experimental::Detail::RPageSource::PrepareLoadCluster(
    }
 }
 
+void ROOT::Experimental::Detail::RPageSource::LoadClustersAsync(
+   std::span<RCluster::RKey> clusterKeys, const std::function<void(std::size_t, std::unique_ptr<RCluster>)> &fnLoaded)
+{
+   auto clusters = LoadClusters(clusterKeys);
+   for (std::size_t i = 0; i < clusters.size(); ++i)
+      fnLoaded(i, std::move(clusters[i]));
+}
+
 void ROOT::Experimental::Detail::RPageSource::EnableDefaultMetrics(const std::string &prefix)
 {
    fMetrics = RNTupleMetrics(prefix);
@@ -290,6 +325,27 @@ void ROOT::Experimental::Detail::RPageSource::EnableDefaultMetrics(const std::st
    });
 }
 
+ROOT::Experimental::Detail::RNTupleReadReport ROOT::Experimental::Detail::RPageSource::GetReadReport()
+{
+   RNTupleReadReport report;
+   report.fNTupleName = fNTupleName;
+   report.SetCounters(GetMetrics());
+
+   const auto columnStats = fProfile.GetColumnStats();
+   auto descriptorGuard = GetSharedDescriptorGuard();
+   for (const auto &[physicalColumnId, stats] : columnStats) {
+      const auto &columnDesc = descriptorGuard->GetColumnDescriptor(physicalColumnId);
+      RNTupleReadReport::RColumn column;
+      column.fPhysicalColumnId = physicalColumnId;
+      column.fFieldName = descriptorGuard->GetQualifiedFieldName(columnDesc.GetFieldId());
+      column.fColumnType = RColumnElementBase::GetTypeName(columnDesc.GetModel().GetType());
+      column.fStats = stats;
+      report.fColumns.emplace_back(std::move(column));
+   }
+   report.fClusterPhases = fProfile.GetClusterPhases();
+   return report;
+}
+
 
 //------------------------------------------------------------------------------
 
@@ -331,7 +387,20 @@ std::unique_ptr<ROOT::Experimental::Detail::RPageSink> ROOT::Experimental::Detai
 ROOT::Experimental::Detail::RPageStorage::ColumnHandle_t
 ROOT::Experimental::Detail::RPageSink::AddColumn(DescriptorId_t fieldId, const RColumn &column)
 {
-   auto columnId = fDescriptorBuilder.GetDescriptor().GetNPhysicalColumns();
+   const auto &descriptor = fDescriptorBuilder.GetDescriptor();
+   if (IsUpdate()) {
+      // Fields of the existing ntuple write into their existing columns; only fields added by a late model extension
+      // get new columns
+      const auto existingId = descriptor.FindPhysicalColumnId(fieldId, column.GetIndex());
+      if (existingId != kInvalidDescriptorId) {
+         if (descriptor.GetColumnDescriptor(existingId).GetModel() != column.GetModel()) {
+            throw RException(R__FAIL("column representation mismatch for field '" +
+                                     descriptor.GetQualifiedFieldName(fieldId) + "' of ntuple '" + fNTupleName + "'"));
+         }
+         return ColumnHandle_t{existingId, &column};
+      }
+   }
+   auto columnId = descriptor.GetNPhysicalColumns();
    fDescriptorBuilder.AddColumn(columnId, columnId, fieldId, column.GetModel(), column.GetIndex(),
                                 column.GetFirstElementIndex());
    return ColumnHandle_t{columnId, &column};
@@ -395,9 +464,134 @@ void ROOT::Experimental::Detail::RPageSink::UpdateSchema(const RNTupleModelChang
       fSerializationContext.MapSchema(descriptor, /*forHeaderExtension=*/true);
 }
 
+void ROOT::Experimental::Detail::RPageSink::LoadExistingImpl(const RNTupleModel & /* model */)
+{
+   throw RException(R__FAIL("this page sink cannot update an existing ntuple"));
+}
+
+void ROOT::Experimental::Detail::RPageSink::CreateFromExisting(RNTupleModel &model)
+{
+   LoadExistingImpl(model);
+   const auto &descriptor = fDescriptorBuilder.GetDescriptor();
+
+   const auto nPhysicalColumns = descriptor.GetNPhysicalColumns();
+   for (DescriptorId_t i = 0; i < descriptor.GetNLogicalColumns(); ++i) {
+      const auto &columnDesc = descriptor.GetColumnDescriptor(i);
+      // The open column and page ranges are indexed by the physical column ID.  The physical columns of a late model
+      // extension that follows projected fields are not numbered consecutively.
+      if (!columnDesc.IsAliasColumn() && columnDesc.GetPhysicalId() >= nPhysicalColumns)
+         throw RException(R__FAIL("cannot update ntuple '" + fNTupleName + "': unsupported column layout"));
+   }
+
+   // The IDs of a deserialized descriptor are the on-disk IDs, so the existing fields, columns, clusters, and cluster
+   // groups are mapped onto themselves.  The fields of the schema extension follow the fields of the header.
+   const auto nFields = descriptor.GetNFields() - 1;
+   const auto nExtensionFields = descriptor.GetHeaderExtension() ? descriptor.GetHeaderExtension()->GetNFields() : 0;
+   for (DescriptorId_t i = 0; i < nFields - nExtensionFields; ++i)
+      fSerializationContext.MapFieldId(i);
+   fSerializationContext.BeginHeaderExtension();
+   for (DescriptorId_t i = nFields - nExtensionFields; i < nFields; ++i)
+      fSerializationContext.MapFieldId(i);
+   for (DescriptorId_t i = 0; i < descriptor.GetNLogicalColumns(); ++i)
+      fSerializationContext.MapColumnId(i);
+   for (DescriptorId_t i = 0; i < descriptor.GetNClusters(); ++i)
+      fSerializationContext.MapClusterId(i);
+   for (DescriptorId_t i = 0; i < descriptor.GetNClusterGroups(); ++i)
+      fSerializationContext.MapClusterGroupId(i);
+   fSerializationContext.SetHeaderSize(descriptor.GetOnDiskHeaderSize());
+   fSerializationContext.SetHeaderCRC32(fDescriptorBuilder.GetHeaderCRC32());
+
+   // The elements of the following clusters continue after the elements of the last existing cluster
+   const auto nClusters = descriptor.GetNClusters();
+   for (DescriptorId_t i = 0; i < nPhysicalColumns; ++i) {
+      RClusterDescriptor::RColumnRange columnRange;
+      columnRange.fPhysicalColumnId = i;
+      columnRange.fFirstElementIndex = descriptor.GetColumnDescriptor(i).GetFirstElementIndex();
+      if (nClusters > 0) {
+         const auto &lastCluster = descriptor.GetClusterDescriptor(nClusters - 1);
+         if (lastCluster.ContainsColumn(i)) {
+            const auto &lastRange = lastCluster.GetColumnRange(i);
+            columnRange.fFirstElementIndex = lastRange.fFirstElementIndex + lastRange.fNElements;
+         }
+      }
+      columnRange.fNElements = 0;
+      columnRange.fCompressionSettings = GetWriteOptions().GetCompression();
+      fOpenColumnRanges.emplace_back(columnRange);
+      RClusterDescriptor::RPageRange pageRange;
+      pageRange.fPhysicalColumnId = i;
+      fOpenPageRanges.emplace_back(std::move(pageRange));
+   }
+   fNextClusterInGroup = nClusters;
+   fPrevClusterNEntries = descriptor.GetNEntries();
+
+   auto fnSetOnDiskId = [&](RFieldBase &f) {
+      const auto fieldId = descriptor.FindFieldId(f.GetName(), f.GetParent()->GetOnDiskId());
+      if (fieldId == kInvalidDescriptorId) {
+         throw RException(
+            R__FAIL("field '" + f.GetQualifiedFieldName() + "' is not part of ntuple '" + fNTupleName + "'"));
+      }
+      const auto &fieldDesc = descriptor.GetFieldDescriptor(fieldId);
+      if (fieldDesc.GetTypeName() != f.GetType()) {
+         throw RException(R__FAIL("type mismatch for field '" + f.GetQualifiedFieldName() + "': '" + f.GetType() +
+                                  "' vs. '" + fieldDesc.GetTypeName() + "' in ntuple '" + fNTupleName + "'"));
+      }
+      f.SetOnDiskId(fieldId);
+   };
+   auto fnConnectField = [&](RFieldBase &f) {
+      fnSetOnDiskId(f);
+      f.ConnectPageSink(*this); // issues in turn one or several calls to `AddColumn()`
+   };
+
+   auto &fieldZero = *model.GetFieldZero();
+   fieldZero.SetOnDiskId(descriptor.GetFieldZeroId());
+   model.GetProjectedFields().GetFieldZero()->SetOnDiskId(descriptor.GetFieldZeroId());
+   for (auto f : fieldZero.GetSubFields()) {
+      fnConnectField(*f);
+      for (auto &descendant : *f)
+         fnConnectField(descendant);
+   }
+   for (auto f : model.GetProjectedFields().GetFieldZero()->GetSubFields()) {
+      fnSetOnDiskId(*f);
+      for (auto &descendant : *f)
+         fnSetOnDiskId(descendant);
+   }
+
+   // Every field of the existing ntuple that stores data needs to be filled, too; projected fields only have alias
+   // columns and need not be part of the model
+   std::function<bool(DescriptorId_t)> fnHasPhysicalColumns = [&](DescriptorId_t fieldId) {
+      for (const auto &c : descriptor.GetColumnIterable(fieldId)) {
+         if (!c.IsAliasColumn())
+            return true;
+      }
+      for (const auto &f : descriptor.GetFieldIterable(fieldId)) {
+         if (fnHasPhysicalColumns(f.GetId()))
+            return true;
+      }
+      return false;
+   };
+   const auto subFields = fieldZero.GetSubFields();
+   for (const auto &fieldDesc : descriptor.GetTopLevelFields()) {
+      const auto isInModel = std::any_of(subFields.begin(), subFields.end(), [&](const RFieldBase *f) {
+         return f->GetOnDiskId() == fieldDesc.GetId();
+      });
+      if (!isInModel && fnHasPhysicalColumns(fieldDesc.GetId())) {
+         throw RException(R__FAIL("field '" + fieldDesc.GetFieldName() + "' of ntuple '" + fNTupleName +
+                                  "' is missing in the model"));
+      }
+   }
+
+   fDescriptorBuilder.BeginHeaderExtension();
+}
+
 void ROOT::Experimental::Detail::RPageSink::Create(RNTupleModel &model)
 {
+   if (IsUpdate()) {
+      CreateFromExisting(model);
+      return;
+   }
+
    fDescriptorBuilder.SetNTuple(fNTupleName, model.GetDescription());
+   fDescriptorBuilder.SetHasPageStatistics(fOptions->GetHasPageStatistics());
    const auto &descriptor = fDescriptorBuilder.GetDescriptor();
 
    auto &fieldZero = *model.GetFieldZero();
@@ -427,6 +621,11 @@ void ROOT::Experimental::Detail::RPageSink::CommitPage(ColumnHandle_t columnHand
    RClusterDescriptor::RPageRange::RPageInfo pageInfo;
    pageInfo.fNElements = page.GetNElements();
    pageInfo.fLocator = CommitPageImpl(columnHandle, page);
+   RValueStatistics statistics;
+   if (fComputePageStatistics && fDescriptorBuilder.GetDescriptor().HasPageStatistics() &&
+       columnHandle.fColumn->GetElement()->GetValueStatistics(page.GetBuffer(), page.GetNElements(), statistics)) {
+      pageInfo.fStatistics = statistics;
+   }
    fOpenPageRanges.at(columnHandle.fPhysicalId).fPageInfos.emplace_back(pageInfo);
 }
 
@@ -439,6 +638,7 @@ void ROOT::Experimental::Detail::RPageSink::CommitSealedPage(
    RClusterDescriptor::RPageRange::RPageInfo pageInfo;
    pageInfo.fNElements = sealedPage.fNElements;
    pageInfo.fLocator = CommitSealedPageImpl(physicalColumnId, sealedPage);
+   pageInfo.fStatistics = sealedPage.fStatistics;
    fOpenPageRanges.at(physicalColumnId).fPageInfos.emplace_back(pageInfo);
 }
 
@@ -465,6 +665,7 @@ void ROOT::Experimental::Detail::RPageSink::CommitSealedPageV(std::span<RPageSto
          RClusterDescriptor::RPageRange::RPageInfo pageInfo;
          pageInfo.fNElements = sealedPageIt->fNElements;
          pageInfo.fLocator = locators[i++];
+         pageInfo.fStatistics = sealedPageIt->fStatistics;
          fOpenPageRanges.at(range.fPhysicalColumnId).fPageInfos.emplace_back(pageInfo);
       }
    }
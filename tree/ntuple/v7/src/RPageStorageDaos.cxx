@@ -502,7 +502,8 @@ ROOT::Experimental::RNTupleDescriptor ROOT::Experimental::Detail::RPageSourceDao
                            buffer.get());
 
       auto clusters = RClusterGroupDescriptorBuilder::GetClusterSummaries(ntplDesc, cgDesc.GetId());
-      Internal::RNTupleSerializer::DeserializePageListV1(buffer.get(), cgDesc.GetPageListLength(), clusters);
+      Internal::RNTupleSerializer::DeserializePageListV1(buffer.get(), cgDesc.GetPageListLength(), clusters,
+                                                         ntplDesc.HasPageStatistics());
       for (std::size_t i = 0; i < clusters.size(); ++i) {
          ntplDesc.AddClusterDetails(clusters[i].MoveDescriptor().Unwrap());
       }
@@ -574,8 +575,12 @@ ROOT::Experimental::Detail::RPageSourceDaos::PopulatePageFromCluster(ColumnHandl
       return pageZero;
    }
 
-   if (fOptions.GetClusterCache() == RNTupleReadOptions::EClusterCache::kOff) {
-      if (pageInfo.fLocator.fReserved & Internal::EDaosLocatorFlags::kCagedPage) {
+   // Pages of lazy columns are read on demand, bypassing the cluster pool, unless they are caged
+   const bool isCagedPage = pageInfo.fLocator.fReserved & Internal::EDaosLocatorFlags::kCagedPage;
+   const bool useClusterCache = (fOptions.GetClusterCache() != RNTupleReadOptions::EClusterCache::kOff) &&
+                                (!IsLazyPhysicalColumn(columnId) || isCagedPage);
+   if (!useClusterCache) {
+      if (isCagedPage) {
          throw ROOT::Experimental::RException(
             R__FAIL("accessing caged pages is only supported in conjunction with cluster cache"));
       }
@@ -590,8 +595,11 @@ ROOT::Experimental::Detail::RPageSourceDaos::PopulatePageFromCluster(ColumnHandl
       fCounters->fSzReadPayload.Add(bytesOnStorage);
       sealedPageBuffer = directReadBuffer.get();
    } else {
-      if (!fCurrentCluster || (fCurrentCluster->GetId() != clusterId) || !fCurrentCluster->ContainsColumn(columnId))
-         fCurrentCluster = fClusterPool->GetCluster(clusterId, fActivePhysicalColumns.ToColumnSet());
+      if (!fCurrentCluster || (fCurrentCluster->GetId() != clusterId) || !fCurrentCluster->ContainsColumn(columnId)) {
+         auto physicalColumns = GetPreloadColumnSet();
+         physicalColumns.insert(columnId);
+         fCurrentCluster = fClusterPool->GetCluster(clusterId, physicalColumns);
+      }
       R__ASSERT(fCurrentCluster->ContainsColumn(columnId));
 
       auto cachedPage = fPagePool->GetPage(columnId, RClusterIndex(clusterId, idxInCluster));
@@ -607,7 +615,7 @@ ROOT::Experimental::Detail::RPageSourceDaos::PopulatePageFromCluster(ColumnHandl
    RPage newPage;
    {
       RNTupleAtomicTimer timer(fCounters->fTimeWallUnzip, fCounters->fTimeCpuUnzip);
-      newPage = UnsealPage({sealedPageBuffer, bytesOnStorage, pageInfo.fNElements}, *element, columnId);
+      newPage = UnsealPage({sealedPageBuffer, bytesOnStorage, pageInfo.fNElements}, *element, columnId, clusterId);
       fCounters->fSzUnzip.Add(elementSize * pageInfo.fNElements);
    }
 
@@ -794,6 +802,7 @@ void ROOT::Experimental::Detail::RPageSourceDaos::UnzipClusterImpl(RCluster *clu
       const auto &columnDesc = descriptorGuard->GetColumnDescriptor(columnId);
 
       allElements.emplace_back(RColumnElementBase::Generate(columnDesc.GetModel().GetType()));
+      allElements.back()->ApplyColumnModel(columnDesc.GetModel());
 
       const auto &pageRange = clusterDescriptor.GetPageRange(columnId);
       std::uint64_t pageNo = 0;
@@ -806,7 +815,8 @@ void ROOT::Experimental::Detail::RPageSourceDaos::UnzipClusterImpl(RCluster *clu
          auto taskFunc = [this, columnId, clusterId, firstInPage, onDiskPage, element = allElements.back().get(),
                           nElements = pi.fNElements,
                           indexOffset = clusterDescriptor.GetColumnRange(columnId).fFirstElementIndex]() {
-            auto newPage = UnsealPage({onDiskPage->GetAddress(), onDiskPage->GetSize(), nElements}, *element, columnId);
+            auto newPage = UnsealPage({onDiskPage->GetAddress(), onDiskPage->GetSize(), nElements}, *element,
+                                      columnId, clusterId);
             fCounters->fSzUnzip.Add(element->GetSize() * nElements);
 
             newPage.SetWindow(indexOffset + firstInPage, RPage::RClusterInfo(clusterId, indexOffset));
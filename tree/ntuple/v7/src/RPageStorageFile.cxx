@@ -26,15 +26,29 @@
 #include <ROOT/RPagePool.hxx>
 #include <ROOT/RPageStorageFile.hxx>
 #include <ROOT/RRawFile.hxx>
+#include <ROOT/RSharedPageCache.hxx>
 
+#include <RConfigure.h>
 #include <RVersion.h>
 #include <TError.h>
 
+#ifdef R__HAS_URING
+#include <ROOT/RIoUring.hxx>
+#include <ROOT/RRawFileUnix.hxx>
+#endif
+
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
 #include <algorithm>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
 #include <iostream>
+#include <string>
+#include <typeinfo>
 #include <utility>
 
 #include <atomic>
@@ -44,6 +58,29 @@
 #include <thread>
 #include <queue>
 
+namespace {
+
+/// Pages taken from the shared page cache are not freed by the page pool; the deleter keeps the cache entry alive
+/// until the page pool releases the page
+ROOT::Experimental::Detail::RPageDeleter
+MakeSharedPageDeleter(std::shared_ptr<ROOT::Experimental::Detail::RSharedPageCache::RCachedPage> sharedPage)
+{
+   return ROOT::Experimental::Detail::RPageDeleter(
+      [sharedPage](const ROOT::Experimental::Detail::RPage &, void * /*userData*/) {}, nullptr);
+}
+
+} // anonymous namespace
+
+/// The io_uring state of a page source.  Only accessed by LoadClustersAsync(), i.e. by the I/O thread of the cluster
+/// pool.  The ring is reused for all the cluster bunches.
+struct ROOT::Experimental::Detail::RPageSourceFile::RIoUringContext {
+#ifdef R__HAS_URING
+   /// Null if io_uring is not available, e.g. for remote files or if the ring setup failed
+   std::unique_ptr<ROOT::Internal::RIoUring> fRing;
+   int fFileDes = -1;
+#endif
+};
+
 ROOT::Experimental::Detail::RPageSinkFile::RPageSinkFile(std::string_view ntupleName,
    const RNTupleWriteOptions &options)
    : RPageSink(ntupleName, options)
@@ -82,10 +119,62 @@ ROOT::Experimental::Detail::RPageSinkFile::RPageSinkFile(std::string_view ntuple
 }
 
 
+std::unique_ptr<ROOT::Experimental::Detail::RPageSinkFile>
+ROOT::Experimental::Detail::RPageSinkFile::CreateForUpdate(std::string_view ntupleName, TFile &file,
+                                                           const RNTupleWriteOptions &options)
+{
+   auto sink = std::unique_ptr<RPageSinkFile>(new RPageSinkFile(ntupleName, options));
+   sink->fWriter = std::unique_ptr<Internal::RNTupleFileWriter>(Internal::RNTupleFileWriter::Update(ntupleName, file));
+   return sink;
+}
+
+
 ROOT::Experimental::Detail::RPageSinkFile::~RPageSinkFile()
 {
 }
 
+void ROOT::Experimental::Detail::RPageSinkFile::LoadExistingImpl(const RNTupleModel & /* model */)
+{
+   RNTupleDecompressor decompressor;
+   auto fnReadEnvelope = [&](std::uint64_t offset, std::uint32_t nbytes, std::uint32_t length) {
+      auto buffer = std::make_unique<unsigned char[]>(length);
+      auto zipBuffer = std::make_unique<unsigned char[]>(nbytes);
+      fWriter->ReadBuffer(zipBuffer.get(), nbytes, offset);
+      decompressor.Unzip(zipBuffer.get(), nbytes, length, buffer.get());
+      return buffer;
+   };
+
+   const auto &anchor = fWriter->GetNTupleAnchor();
+   RNTupleDescriptorBuilder descBuilder;
+   descBuilder.SetOnDiskHeaderSize(anchor.fNBytesHeader);
+   auto header = fnReadEnvelope(anchor.fSeekHeader, anchor.fNBytesHeader, anchor.fLenHeader);
+   Internal::RNTupleSerializer::DeserializeHeaderV1(header.get(), anchor.fLenHeader, descBuilder).ThrowOnError();
+   descBuilder.AddToOnDiskFooterSize(anchor.fNBytesFooter);
+   auto footer = fnReadEnvelope(anchor.fSeekFooter, anchor.fNBytesFooter, anchor.fLenFooter);
+   Internal::RNTupleSerializer::DeserializeFooterV1(footer.get(), anchor.fLenFooter, descBuilder).ThrowOnError();
+   auto ntplDesc = descBuilder.MoveDescriptor();
+
+   // The column ranges of the last cluster determine the first element index of the columns in the new clusters.
+   // Only the page list of the last cluster group needs to be read for that.
+   if (ntplDesc.GetNClusterGroups() > 0) {
+      const auto &cgDesc = ntplDesc.GetClusterGroupDescriptor(ntplDesc.GetNClusterGroups() - 1);
+      const auto &locator = cgDesc.GetPageListLocator();
+      auto pageList =
+         fnReadEnvelope(locator.GetPosition<std::uint64_t>(), locator.fBytesOnStorage, cgDesc.GetPageListLength());
+      auto clusters = RClusterGroupDescriptorBuilder::GetClusterSummaries(ntplDesc, cgDesc.GetId());
+      Internal::RNTupleSerializer::DeserializePageListV1(pageList.get(), cgDesc.GetPageListLength(), clusters,
+                                                         ntplDesc.HasPageStatistics())
+         .ThrowOnError();
+      for (std::size_t i = 0; i < clusters.size(); ++i) {
+         ntplDesc.AddClusterDetails(clusters[i].AddDeferredColumnRanges(ntplDesc).MoveDescriptor().Unwrap())
+            .ThrowOnError();
+      }
+   }
+
+   fDescriptorBuilder.SetDescriptor(std::move(ntplDesc));
+   fDescriptorBuilder.SetHeaderCRC32(descBuilder.GetHeaderCRC32());
+}
+
 void ROOT::Experimental::Detail::RPageSinkFile::CreateImpl(const RNTupleModel & /* model */,
                                                            unsigned char *serializedHeader, std::uint32_t length)
 {
@@ -135,7 +224,7 @@ ROOT::Experimental::Detail::RPageSinkFile::CommitSealedPageImpl(DescriptorId_t p
                                                                 const RPageStorage::RSealedPage &sealedPage)
 {
    const auto bitsOnStorage = RColumnElementBase::GetBitsOnStorage(
-      fDescriptorBuilder.GetDescriptor().GetColumnDescriptor(physicalColumnId).GetModel().GetType());
+      fDescriptorBuilder.GetDescriptor().GetColumnDescriptor(physicalColumnId).GetModel());
    const auto bytesPacked = (bitsOnStorage * sealedPage.fNElements + 7) / 8;
 
    return WriteSealedPage(sealedPage, bytesPacked);
@@ -237,7 +326,14 @@ ROOT::Experimental::Detail::RPageSourceFile::CreateFromAnchor(const Internal::RF
    return pageSource;
 }
 
-ROOT::Experimental::Detail::RPageSourceFile::~RPageSourceFile() = default;
+ROOT::Experimental::Detail::RPageSourceFile::~RPageSourceFile()
+{
+   if (fMmapBase) {
+      // The I/O and unzip threads of the cluster pool access the mapping
+      fClusterPool.reset();
+      fFile->Unmap(fMmapBase, fMmapSize);
+   }
+}
 
 
 ROOT::Experimental::RNTupleDescriptor ROOT::Experimental::Detail::RPageSourceFile::AttachImpl()
@@ -251,7 +347,32 @@ ROOT::Experimental::RNTupleDescriptor ROOT::Experimental::Detail::RPageSourceFil
 
    auto ntplDesc = fDescriptorBuilder.MoveDescriptor();
 
+   if (fOptions.GetUseMmap() && (fFile->GetFeatures() & ROOT::Internal::RRawFile::kFeatureHasMmap)) {
+      try {
+         fMmapSize = fFile->GetSize();
+         std::uint64_t mapdOffset;
+         fMmapBase = static_cast<unsigned char *>(fFile->Map(fMmapSize, 0, mapdOffset));
+      } catch (const std::runtime_error &e) {
+         R__LOG_WARNING(NTupleLog()) << "memory mapping failed, falling back to reads: " << e.what();
+         fMmapBase = nullptr;
+         fMmapSize = 0;
+      }
+   }
+
+   if (fOptions.GetUseSharedPageCache()) {
+      // Clones of this page source and other readers of the same ntuple map to the same source id.  The anchor
+      // properties distinguish an ntuple from a rewritten ntuple in a file of the same name.
+      const auto sourceDescription = fFile->GetUrl() + '\n' + fNTupleName + '\n' + std::to_string(fFile->GetSize()) +
+                                     '\n' + std::to_string(ntplDesc.GetOnDiskHeaderSize()) + '\n' +
+                                     std::to_string(ntplDesc.GetOnDiskFooterSize());
+      fSharedPageCacheSourceId = RSharedPageCache::Get().GetSourceId(sourceDescription);
+   }
+
    for (const auto &cgDesc : ntplDesc.GetClusterGroupIterable()) {
+      // The descriptor of a clone already contains the page locations
+      const auto &clusterIds = cgDesc.GetClusterIds();
+      if (!clusterIds.empty() && ntplDesc.GetClusterDescriptor(clusterIds[0]).HasPageLocations())
+         continue;
       auto buffer = std::make_unique<unsigned char[]>(cgDesc.GetPageListLength());
       auto zipBuffer = std::make_unique<unsigned char[]>(cgDesc.GetPageListLocator().fBytesOnStorage);
       fReader.ReadBuffer(zipBuffer.get(), cgDesc.GetPageListLocator().fBytesOnStorage,
@@ -260,7 +381,8 @@ ROOT::Experimental::RNTupleDescriptor ROOT::Experimental::Detail::RPageSourceFil
                            buffer.get());
 
       auto clusters = RClusterGroupDescriptorBuilder::GetClusterSummaries(ntplDesc, cgDesc.GetId());
-      Internal::RNTupleSerializer::DeserializePageListV1(buffer.get(), cgDesc.GetPageListLength(), clusters);
+      Internal::RNTupleSerializer::DeserializePageListV1(buffer.get(), cgDesc.GetPageListLength(), clusters,
+                                                         ntplDesc.HasPageStatistics());
       for (std::size_t i = 0; i < clusters.size(); ++i) {
          ntplDesc.AddClusterDetails(clusters[i].AddDeferredColumnRanges(ntplDesc).MoveDescriptor().Unwrap());
       }
@@ -288,8 +410,13 @@ void ROOT::Experimental::Detail::RPageSourceFile::LoadSealedPage(DescriptorId_t
    if (!sealedPage.fBuffer)
       return;
    if (pageInfo.fLocator.fType != RNTupleLocator::kTypePageZero) {
-      fReader.ReadBuffer(const_cast<void *>(sealedPage.fBuffer), bytesOnStorage,
-                         pageInfo.fLocator.GetPosition<std::uint64_t>());
+      if (fMmapBase) {
+         memcpy(const_cast<void *>(sealedPage.fBuffer), fMmapBase + pageInfo.fLocator.GetPosition<std::uint64_t>(),
+                bytesOnStorage);
+      } else {
+         fReader.ReadBuffer(const_cast<void *>(sealedPage.fBuffer), bytesOnStorage,
+                            pageInfo.fLocator.GetPosition<std::uint64_t>());
+      }
    } else {
       memcpy(const_cast<void *>(sealedPage.fBuffer), RPage::GetPageZeroBuffer(), bytesOnStorage);
    }
@@ -320,16 +447,45 @@ ROOT::Experimental::Detail::RPageSourceFile::PopulatePageFromCluster(ColumnHandl
       return pageZero;
    }
 
-   if (fOptions.GetClusterCache() == RNTupleReadOptions::EClusterCache::kOff) {
-      directReadBuffer = std::unique_ptr<unsigned char[]>(new unsigned char[bytesOnStorage]);
-      fReader.ReadBuffer(directReadBuffer.get(), bytesOnStorage, pageInfo.fLocator.GetPosition<std::uint64_t>());
+   const bool useSharedPageCache = fOptions.GetUseSharedPageCache();
+   const RSharedPageCache::RKey sharedCacheKey(fSharedPageCacheSourceId, columnId,
+                                               pageInfo.fLocator.GetPosition<std::uint64_t>(),
+                                               typeid(*element).hash_code());
+   auto fnRegisterSharedPage = [this](const std::shared_ptr<RSharedPageCache::RCachedPage> &sharedPage) {
+      auto page = sharedPage->GetPage();
+      fPagePool->RegisterPage(page, MakeSharedPageDeleter(sharedPage));
+      return page;
+   };
+
+   // Pages of lazy columns are read on demand, bypassing the cluster pool
+   const bool useClusterCache =
+      (fOptions.GetClusterCache() != RNTupleReadOptions::EClusterCache::kOff) && !IsLazyPhysicalColumn(columnId);
+   if (!useClusterCache) {
+      if (fMmapBase) {
+         sealedPageBuffer = fMmapBase + pageInfo.fLocator.GetPosition<std::uint64_t>();
+      } else {
+         // Look up the shared page cache before reading such that a cache hit saves the read, too
+         if (useSharedPageCache) {
+            if (auto sharedPage = RSharedPageCache::Get().Find(sharedCacheKey))
+               return fnRegisterSharedPage(sharedPage);
+         }
+         directReadBuffer = std::unique_ptr<unsigned char[]>(new unsigned char[bytesOnStorage]);
+         const bool isProfiling = fMetrics.IsEnabled();
+         RNTupleReadProfile::Clock_t::time_point tStart;
+         if (isProfiling)
+            tStart = RNTupleReadProfile::Clock_t::now();
+         fReader.ReadBuffer(directReadBuffer.get(), bytesOnStorage, pageInfo.fLocator.GetPosition<std::uint64_t>());
+         if (isProfiling)
+            fProfile.AddClusterActivity(clusterId, RNTupleReadProfile::EPhase::kRead, tStart,
+                                        RNTupleReadProfile::Clock_t::now());
+         fCounters->fNRead.Inc();
+         sealedPageBuffer = directReadBuffer.get();
+      }
       fCounters->fNPageLoaded.Inc();
-      fCounters->fNRead.Inc();
       fCounters->fSzReadPayload.Add(bytesOnStorage);
-      sealedPageBuffer = directReadBuffer.get();
    } else {
       if (!fCurrentCluster || (fCurrentCluster->GetId() != clusterId) || !fCurrentCluster->ContainsColumn(columnId))
-         fCurrentCluster = fClusterPool->GetCluster(clusterId, fActivePhysicalColumns.ToColumnSet());
+         fCurrentCluster = fClusterPool->GetCluster(clusterId, GetPreloadColumnSet());
       R__ASSERT(fCurrentCluster->ContainsColumn(columnId));
 
       auto cachedPage = fPagePool->GetPage(columnId, RClusterIndex(clusterId, idxInCluster));
@@ -342,15 +498,37 @@ ROOT::Experimental::Detail::RPageSourceFile::PopulatePageFromCluster(ColumnHandl
       sealedPageBuffer = onDiskPage->GetAddress();
    }
 
+   if (fMmapBase) {
+      auto mappedPage = MapSealedPage({sealedPageBuffer, bytesOnStorage, pageInfo.fNElements}, *element, columnId);
+      if (!mappedPage.IsNull()) {
+         mappedPage.SetWindow(clusterInfo.fColumnOffset + pageInfo.fFirstInPage,
+                              RPage::RClusterInfo(clusterId, clusterInfo.fColumnOffset));
+         fPagePool->RegisterPage(mappedPage, RPageDeleter([](const RPage &, void *) {}, nullptr));
+         fCounters->fNPagePopulated.Inc();
+         return mappedPage;
+      }
+   }
+
+   // With the cluster cache, the shared page cache is only looked up after the page pool such that the same page
+   // buffer is never registered twice in the page pool
+   if (useSharedPageCache && (useClusterCache || fMmapBase)) {
+      if (auto sharedPage = RSharedPageCache::Get().Find(sharedCacheKey))
+         return fnRegisterSharedPage(sharedPage);
+   }
+
    RPage newPage;
    {
       RNTupleAtomicTimer timer(fCounters->fTimeWallUnzip, fCounters->fTimeCpuUnzip);
-      newPage = UnsealPage({sealedPageBuffer, bytesOnStorage, pageInfo.fNElements}, *element, columnId);
+      newPage = UnsealPage({sealedPageBuffer, bytesOnStorage, pageInfo.fNElements}, *element, columnId, clusterId);
       fCounters->fSzUnzip.Add(elementSize * pageInfo.fNElements);
    }
 
    newPage.SetWindow(clusterInfo.fColumnOffset + pageInfo.fFirstInPage,
                      RPage::RClusterInfo(clusterId, clusterInfo.fColumnOffset));
+   if (useSharedPageCache) {
+      fCounters->fNPagePopulated.Inc();
+      return fnRegisterSharedPage(RSharedPageCache::Get().Insert(sharedCacheKey, newPage));
+   }
    fPagePool->RegisterPage(
       newPage,
       RPageDeleter([](const RPage &page, void * /*userData*/) { RPageAllocatorHeap::DeletePage(page); }, nullptr));
@@ -418,6 +596,13 @@ std::unique_ptr<ROOT::Experimental::Detail::RPageSource> ROOT::Experimental::Det
    auto clone = new RPageSourceFile(fNTupleName, fOptions);
    clone->fFile = fFile->Clone();
    clone->fReader = Internal::RMiniFileReader(clone->fFile.get());
+   {
+      // An attached page source has a non-empty descriptor; the clone starts from a copy of it, so that it does not
+      // need to read and parse the header, the footer, and the page lists again
+      auto descriptorGuard = GetSharedDescriptorGuard();
+      if (descriptorGuard->GetOnDiskHeaderSize() > 0)
+         clone->fDescriptorBuilder.SetDescriptor(std::move(*descriptorGuard->Clone()));
+   }
    return std::unique_ptr<RPageSourceFile>(clone);
 }
 
@@ -532,29 +717,261 @@ ROOT::Experimental::Detail::RPageSourceFile::PrepareSingleCluster(
    return cluster;
 }
 
+std::unique_ptr<ROOT::Experimental::Detail::RCluster>
+ROOT::Experimental::Detail::RPageSourceFile::PrepareSingleClusterMapped(const RCluster::RKey &clusterKey)
+{
+   std::uint64_t firstByte = std::uint64_t(-1);
+   std::uint64_t lastByte = 0;
+   std::size_t szPayload = 0;
+   std::size_t nPages = 0;
+   auto pageZeroMap = std::make_unique<ROnDiskPageMap>();
+   // The mapping is owned by the page source, so the page map only references it
+   auto pageMap = std::make_unique<ROnDiskPageMap>();
+   PrepareLoadCluster(clusterKey, *pageZeroMap,
+                      [&](DescriptorId_t physicalColumnId, NTupleSize_t pageNo,
+                          const RClusterDescriptor::RPageRange::RPageInfo &pageInfo) {
+                         const auto offset = pageInfo.fLocator.GetPosition<std::uint64_t>();
+                         const auto size = pageInfo.fLocator.fBytesOnStorage;
+                         pageMap->Register(ROnDiskPage::Key(physicalColumnId, pageNo),
+                                           ROnDiskPage(fMmapBase + offset, size));
+                         firstByte = std::min<std::uint64_t>(firstByte, offset);
+                         lastByte = std::max<std::uint64_t>(lastByte, offset + size);
+                         szPayload += size;
+                         nPages++;
+                      });
+   fCounters->fSzReadPayload.Add(szPayload);
+   fCounters->fNPageLoaded.Add(nPages);
+
+#ifndef _WIN32
+   // Clusters are loaded by the cluster pool ahead of their use.  Let the kernel read ahead the byte range of the
+   // cluster asynchronously such that the pages are likely in the page cache once they are accessed.
+   if (nPages > 0) {
+      static const std::uint64_t szPageMask = sysconf(_SC_PAGESIZE) - 1;
+      const auto alignedFirstByte = firstByte & ~szPageMask;
+      madvise(fMmapBase + alignedFirstByte, lastByte - alignedFirstByte, MADV_WILLNEED);
+   }
+#endif
+
+   auto cluster = std::make_unique<RCluster>(clusterKey.fClusterId);
+   cluster->Adopt(std::move(pageMap));
+   cluster->Adopt(std::move(pageZeroMap));
+   for (auto colId : clusterKey.fPhysicalColumnSet)
+      cluster->SetColumnAvailable(colId);
+   return cluster;
+}
+
+ROOT::Experimental::Detail::RPage
+ROOT::Experimental::Detail::RPageSourceFile::MapSealedPage(const RSealedPage &sealedPage,
+                                                           const RColumnElementBase &element,
+                                                           DescriptorId_t physicalColumnId)
+{
+   const auto elementSize = element.GetSize();
+   if (!element.IsMappable() || (sealedPage.fSize != element.GetPackedSize(sealedPage.fNElements)))
+      return RPage();
+   // The writer does not align pages in the file; misaligned pages are copied by UnsealPage()
+   if (reinterpret_cast<std::uintptr_t>(sealedPage.fBuffer) % elementSize != 0)
+      return RPage();
+
+   RPage page(physicalColumnId, const_cast<void *>(sealedPage.fBuffer), elementSize, sealedPage.fNElements);
+   page.GrowUnchecked(sealedPage.fNElements);
+   return page;
+}
+
 std::vector<std::unique_ptr<ROOT::Experimental::Detail::RCluster>>
 ROOT::Experimental::Detail::RPageSourceFile::LoadClusters(std::span<RCluster::RKey> clusterKeys)
 {
    fCounters->fNClusterLoaded.Add(clusterKeys.size());
 
    std::vector<std::unique_ptr<ROOT::Experimental::Detail::RCluster>> clusters;
+   if (fMmapBase) {
+      for (auto key : clusterKeys) {
+         clusters.emplace_back(PrepareSingleClusterMapped(key));
+      }
+      return clusters;
+   }
+
    std::vector<ROOT::Internal::RRawFile::RIOVec> readRequests;
+   // For the read profile, the number of bytes requested for every cluster
+   std::vector<DescriptorId_t> clusterIds;
+   std::vector<std::uint64_t> nBytesPerCluster;
 
    for (auto key: clusterKeys) {
+      const auto nReqsBefore = readRequests.size();
       clusters.emplace_back(PrepareSingleCluster(key, readRequests));
+      clusterIds.emplace_back(key.fClusterId);
+      nBytesPerCluster.emplace_back(0);
+      for (auto i = nReqsBefore; i < readRequests.size(); ++i)
+         nBytesPerCluster.back() += readRequests[i].fSize;
    }
 
    auto nReqs = readRequests.size();
+   // Clusters that consist of page zero only come with an empty read request; if there is nothing else, no read is
+   // issued at all
+   const auto nNonEmptyReqs = std::count_if(readRequests.begin(), readRequests.end(),
+                                            [](const ROOT::Internal::RRawFile::RIOVec &req) { return req.fSize > 0; });
+   if (nNonEmptyReqs == 0)
+      return clusters;
+   const bool isProfiling = fMetrics.IsEnabled();
+   RNTupleReadProfile::Clock_t::time_point tStart;
+   if (isProfiling)
+      tStart = RNTupleReadProfile::Clock_t::now();
    {
       RNTupleAtomicTimer timer(fCounters->fTimeWallRead, fCounters->fTimeCpuRead);
       fFile->ReadV(&readRequests[0], nReqs);
    }
+   if (isProfiling)
+      fProfile.AddVectorRead(clusterIds, nBytesPerCluster, tStart, RNTupleReadProfile::Clock_t::now());
    fCounters->fNReadV.Inc();
-   fCounters->fNRead.Add(nReqs);
+   fCounters->fNRead.Add(nNonEmptyReqs);
 
    return clusters;
 }
 
+void ROOT::Experimental::Detail::RPageSourceFile::LoadClustersAsync(
+   std::span<RCluster::RKey> clusterKeys, const std::function<void(std::size_t, std::unique_ptr<RCluster>)> &fnLoaded)
+{
+#ifdef R__HAS_URING
+   using ROOT::Internal::RIoUring;
+
+   if (!fIoUring) {
+      fIoUring = std::make_unique<RIoUringContext>();
+      // Memory mapped files are not read; LoadClusters() then only assembles the page maps
+      auto fileUnix = fMmapBase ? nullptr : dynamic_cast<ROOT::Internal::RRawFileUnix *>(fFile.get());
+      if (fileUnix) {
+         try {
+            // The file is opened lazily; GetSize() ensures that it is open and we have a valid file descriptor
+            fileUnix->GetSize();
+            fIoUring->fFileDes = fileUnix->GetFd();
+            fIoUring->fRing = std::make_unique<RIoUring>();
+         } catch (const std::runtime_error &e) {
+            R__LOG_WARNING(NTupleLog()) << "io_uring setup failed, falling back to vector reads: " << e.what();
+         }
+      }
+   }
+
+   if (fIoUring->fRing) {
+      fCounters->fNClusterLoaded.Add(clusterKeys.size());
+
+      std::vector<std::unique_ptr<RCluster>> clusters;
+      std::vector<ROOT::Internal::RRawFile::RIOVec> readRequests;
+      // The index of the cluster that a read request belongs to
+      std::vector<std::size_t> clusterIdxOfRequest;
+      for (auto key : clusterKeys) {
+         clusters.emplace_back(PrepareSingleCluster(key, readRequests));
+         clusterIdxOfRequest.resize(readRequests.size(), clusters.size() - 1);
+      }
+
+      const auto nReqs = readRequests.size();
+      std::vector<RIoUring::RReadEvent> readEvents(nReqs);
+      // The number of outstanding reads per cluster; a cluster is handed over once its counter drops to zero
+      std::vector<std::size_t> nPendingReads(clusters.size(), 0);
+      std::size_t nNonEmptyReqs = 0;
+      for (std::size_t i = 0; i < nReqs; ++i) {
+         readEvents[i].fBuffer = readRequests[i].fBuffer;
+         readEvents[i].fOffset = readRequests[i].fOffset;
+         readEvents[i].fSize = readRequests[i].fSize;
+         readEvents[i].fFileDes = fIoUring->fFileDes;
+         if (readEvents[i].fSize > 0) {
+            nPendingReads[clusterIdxOfRequest[i]]++;
+            nNonEmptyReqs++;
+         }
+      }
+      // Clusters that consist of page zero only don't need to wait for any read
+      for (std::size_t i = 0; i < clusters.size(); ++i) {
+         if (nPendingReads[i] == 0)
+            fnLoaded(i, std::move(clusters[i]));
+      }
+
+      auto &ring = *fIoUring->fRing;
+      const auto queueDepth = ring.GetQueueDepth();
+      std::size_t nextReq = 0;
+      std::size_t nInFlight = 0;
+      // Remainders of short reads that need to be resubmitted
+      std::vector<RIoUring::RReadEvent *> resubmit;
+      const bool isProfiling = fMetrics.IsEnabled();
+      RNTupleReadProfile::Clock_t::time_point tStart;
+      if (isProfiling)
+         tStart = RNTupleReadProfile::Clock_t::now();
+      try {
+         RNTupleAtomicTimer timer(fCounters->fTimeWallRead, fCounters->fTimeCpuRead);
+         while ((nextReq < nReqs) || !resubmit.empty() || (nInFlight > 0)) {
+            // Keep as many reads in flight as the ring can hold
+            unsigned int nPrepared = 0;
+            while (nInFlight + nPrepared < queueDepth) {
+               RIoUring::RReadEvent *readEvent = nullptr;
+               if (!resubmit.empty()) {
+                  readEvent = resubmit.back();
+                  resubmit.pop_back();
+               } else {
+                  while ((nextReq < nReqs) && (readEvents[nextReq].fSize == 0))
+                     nextReq++;
+                  if (nextReq == nReqs)
+                     break;
+                  readEvent = &readEvents[nextReq++];
+               }
+               if (!ring.PrepareRead(readEvent)) {
+                  resubmit.emplace_back(readEvent);
+                  break;
+               }
+               nPrepared++;
+            }
+            if (nPrepared > 0) {
+               // The accepted reads are in flight even if the ring did not accept all of them
+               const auto nSubmitted = ring.Submit();
+               nInFlight += nSubmitted;
+               if (nSubmitted != nPrepared)
+                  throw std::runtime_error("io_uring did not accept all the prepared read requests");
+            }
+            if (nInFlight == 0) {
+               // With no reads in flight, the submission queue will not drain and the read can never be queued
+               if (!resubmit.empty())
+                  throw std::runtime_error("io_uring did not accept a read request with an empty submission queue");
+               continue;
+            }
+
+            auto readEvent = ring.WaitForRead();
+            nInFlight--;
+            if (readEvent->fOutBytes < readEvent->fSize) {
+               if (readEvent->fOutBytes == 0)
+                  throw RException(R__FAIL("short read: unexpected end of file at offset " +
+                                           std::to_string(readEvent->fOffset)));
+               readEvent->fBuffer = static_cast<unsigned char *>(readEvent->fBuffer) + readEvent->fOutBytes;
+               readEvent->fOffset += readEvent->fOutBytes;
+               readEvent->fSize -= readEvent->fOutBytes;
+               resubmit.emplace_back(readEvent);
+               continue;
+            }
+            const auto clusterIdx = clusterIdxOfRequest[readEvent - readEvents.data()];
+            if (--nPendingReads[clusterIdx] == 0) {
+               if (isProfiling) {
+                  fProfile.AddClusterActivity(clusterKeys[clusterIdx].fClusterId, RNTupleReadProfile::EPhase::kRead,
+                                              tStart, RNTupleReadProfile::Clock_t::now());
+               }
+               fnLoaded(clusterIdx, std::move(clusters[clusterIdx]));
+            }
+         }
+      } catch (...) {
+         // The kernel may still write into the cluster buffers; wait for the outstanding reads before releasing them.
+         // The ring is discarded because it may still hold prepared but unsubmitted requests.
+         for (; nInFlight > 0; --nInFlight) {
+            try {
+               ring.WaitForRead();
+            } catch (const std::runtime_error &) {
+            }
+         }
+         fIoUring.reset();
+         throw;
+      }
+      // No vector read is issued; nRead counts the byte ranges read through the ring, not counting resubmitted remainders
+      // of short reads
+      fCounters->fNRead.Add(nNonEmptyReqs);
+      return;
+   }
+#endif
+
+   RPageSource::LoadClustersAsync(clusterKeys, fnLoaded);
+}
+
 
 void ROOT::Experimental::Detail::RPageSourceFile::UnzipClusterImpl(RCluster *cluster)
 {
@@ -572,6 +989,7 @@ void ROOT::Experimental::Detail::RPageSourceFile::UnzipClusterImpl(RCluster *clu
       const auto &columnDesc = descriptorGuard->GetColumnDescriptor(columnId);
 
       allElements.emplace_back(RColumnElementBase::Generate(columnDesc.GetModel().GetType()));
+      allElements.back()->ApplyColumnModel(columnDesc.GetModel());
 
       const auto &pageRange = clusterDescriptor.GetPageRange(columnId);
       std::uint64_t pageNo = 0;
@@ -581,13 +999,42 @@ void ROOT::Experimental::Detail::RPageSourceFile::UnzipClusterImpl(RCluster *clu
          auto onDiskPage = cluster->GetOnDiskPage(key);
          R__ASSERT(onDiskPage && (onDiskPage->GetSize() == pi.fLocator.fBytesOnStorage));
 
+         const bool useSharedPageCache =
+            fOptions.GetUseSharedPageCache() && (pi.fLocator.fType != RNTupleLocator::kTypePageZero);
          auto taskFunc = [this, columnId, clusterId, firstInPage, onDiskPage, element = allElements.back().get(),
                           nElements = pi.fNElements,
-                          indexOffset = clusterDescriptor.GetColumnRange(columnId).fFirstElementIndex]() {
-            auto newPage = UnsealPage({onDiskPage->GetAddress(), onDiskPage->GetSize(), nElements}, *element, columnId);
+                          indexOffset = clusterDescriptor.GetColumnRange(columnId).fFirstElementIndex,
+                          useSharedPageCache,
+                          pagePosition = useSharedPageCache ? pi.fLocator.GetPosition<std::uint64_t>() : 0]() {
+            if (fMmapBase) {
+               auto mappedPage =
+                  MapSealedPage({onDiskPage->GetAddress(), onDiskPage->GetSize(), nElements}, *element, columnId);
+               if (!mappedPage.IsNull()) {
+                  mappedPage.SetWindow(indexOffset + firstInPage, RPage::RClusterInfo(clusterId, indexOffset));
+                  fPagePool->PreloadPage(mappedPage, RPageDeleter([](const RPage &, void *) {}, nullptr));
+                  return;
+               }
+            }
+
+            const RSharedPageCache::RKey sharedCacheKey(fSharedPageCacheSourceId, columnId, pagePosition,
+                                                        typeid(*element).hash_code());
+            if (useSharedPageCache) {
+               if (auto sharedPage = RSharedPageCache::Get().Find(sharedCacheKey)) {
+                  fPagePool->PreloadPage(sharedPage->GetPage(), MakeSharedPageDeleter(sharedPage));
+                  return;
+               }
+            }
+
+            auto newPage = UnsealPage({onDiskPage->GetAddress(), onDiskPage->GetSize(), nElements}, *element,
+                                      columnId, clusterId);
             fCounters->fSzUnzip.Add(element->GetSize() * nElements);
 
             newPage.SetWindow(indexOffset + firstInPage, RPage::RClusterInfo(clusterId, indexOffset));
+            if (useSharedPageCache) {
+               auto sharedPage = RSharedPageCache::Get().Insert(sharedCacheKey, newPage);
+               fPagePool->PreloadPage(sharedPage->GetPage(), MakeSharedPageDeleter(sharedPage));
+               return;
+            }
             fPagePool->PreloadPage(
                newPage,
                RPageDeleter([](const RPage &page, void * /*userData*/) { RPageAllocatorHeap::DeletePage(page); },
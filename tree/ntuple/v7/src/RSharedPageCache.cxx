@@ -0,0 +1,139 @@
+/// \file RSharedPageCache.cxx
+/// \ingroup NTuple ROOT7
+/// \date 2024-01-22
+/// \warning This is part of the ROOT 7 prototype! It will change without notice. It might trigger earthquakes. Feedback
+/// is welcome!
+
+/*************************************************************************
+ * Copyright (C) 1995-2024, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include <ROOT/RSharedPageCache.hxx>
+#include <ROOT/RPageAllocator.hxx>
+
+#include <functional>
+
+namespace {
+
+std::uint64_t GetPageBytes(const ROOT::Experimental::Detail::RPage &page)
+{
+   return static_cast<std::uint64_t>(page.GetElementSize()) * page.GetMaxElements();
+}
+
+} // anonymous namespace
+
+ROOT::Experimental::Detail::RSharedPageCache::RCachedPage::~RCachedPage()
+{
+   RPageAllocatorHeap::DeletePage(fPage);
+}
+
+std::size_t ROOT::Experimental::Detail::RSharedPageCache::RKeyHash::operator()(const RKey &key) const
+{
+   // Boost-style hash combination of the key members
+   std::size_t seed = 0;
+   auto fnCombine = [&seed](std::size_t h) { seed ^= h + 0x9e3779b9 + (seed << 6) + (seed >> 2); };
+   fnCombine(std::hash<std::uint64_t>()(key.fSourceId));
+   fnCombine(std::hash<std::uint64_t>()(key.fPhysicalColumnId));
+   fnCombine(std::hash<std::uint64_t>()(key.fPagePosition));
+   fnCombine(key.fElementTypeHash);
+   return seed;
+}
+
+ROOT::Experimental::Detail::RSharedPageCache &ROOT::Experimental::Detail::RSharedPageCache::Get()
+{
+   static RSharedPageCache gCache;
+   return gCache;
+}
+
+std::uint64_t ROOT::Experimental::Detail::RSharedPageCache::GetSourceId(const std::string &sourceDescription)
+{
+   std::lock_guard<std::mutex> lockGuard(fSourceIdsLock);
+   auto itr = fSourceIds.find(sourceDescription);
+   if (itr != fSourceIds.end())
+      return itr->second;
+   const std::uint64_t sourceId = fSourceIds.size();
+   fSourceIds.emplace(sourceDescription, sourceId);
+   return sourceId;
+}
+
+void ROOT::Experimental::Detail::RSharedPageCache::EvictUnlocked(RShard &shard, std::uint64_t maxShardBytes)
+{
+   while ((shard.fNBytes > maxShardBytes) && !shard.fLru.empty()) {
+      const auto &victim = shard.fLru.back();
+      shard.fNBytes -= GetPageBytes(victim.second->GetPage());
+      shard.fIndex.erase(victim.first);
+      shard.fLru.pop_back();
+   }
+}
+
+std::shared_ptr<ROOT::Experimental::Detail::RSharedPageCache::RCachedPage>
+ROOT::Experimental::Detail::RSharedPageCache::Find(const RKey &key)
+{
+   auto &shard = GetShard(key);
+   std::lock_guard<std::mutex> lockGuard(shard.fLock);
+   auto itr = shard.fIndex.find(key);
+   if (itr == shard.fIndex.end()) {
+      fNMisses++;
+      return nullptr;
+   }
+   shard.fLru.splice(shard.fLru.begin(), shard.fLru, itr->second);
+   fNHits++;
+   return itr->second->second;
+}
+
+std::shared_ptr<ROOT::Experimental::Detail::RSharedPageCache::RCachedPage>
+ROOT::Experimental::Detail::RSharedPageCache::Insert(const RKey &key, const RPage &page)
+{
+   auto cachedPage = std::make_shared<RCachedPage>(page);
+   const auto nBytes = GetPageBytes(page);
+   const auto maxShardBytes = fMaxBytes / kNShards;
+   if (nBytes > maxShardBytes)
+      return cachedPage;
+
+   auto &shard = GetShard(key);
+   std::lock_guard<std::mutex> lockGuard(shard.fLock);
+   auto itr = shard.fIndex.find(key);
+   if (itr != shard.fIndex.end()) {
+      // Another page source populated the same page concurrently; `cachedPage` goes out of scope and frees `page`
+      shard.fLru.splice(shard.fLru.begin(), shard.fLru, itr->second);
+      return itr->second->second;
+   }
+   shard.fLru.emplace_front(key, cachedPage);
+   shard.fIndex[key] = shard.fLru.begin();
+   shard.fNBytes += nBytes;
+   EvictUnlocked(shard, maxShardBytes);
+   return cachedPage;
+}
+
+void ROOT::Experimental::Detail::RSharedPageCache::Clear()
+{
+   for (auto &shard : fShards) {
+      std::lock_guard<std::mutex> lockGuard(shard.fLock);
+      shard.fIndex.clear();
+      shard.fLru.clear();
+      shard.fNBytes = 0;
+   }
+}
+
+void ROOT::Experimental::Detail::RSharedPageCache::SetMaxBytes(std::uint64_t maxBytes)
+{
+   fMaxBytes = maxBytes;
+   for (auto &shard : fShards) {
+      std::lock_guard<std::mutex> lockGuard(shard.fLock);
+      EvictUnlocked(shard, maxBytes / kNShards);
+   }
+}
+
+std::uint64_t ROOT::Experimental::Detail::RSharedPageCache::GetNBytes()
+{
+   std::uint64_t nBytes = 0;
+   for (auto &shard : fShards) {
+      std::lock_guard<std::mutex> lockGuard(shard.fLock);
+      nBytes += shard.fNBytes;
+   }
+   return nBytes;
+}
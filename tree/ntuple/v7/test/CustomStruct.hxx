@@ -5,8 +5,10 @@
 #include <TRootIOCtor.h>
 
 #include <cstdint>
+#include <map>
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <variant>
 #include <vector>
 
@@ -58,6 +58,11 @@
 #pragma link C++ class std::set<std::set<char>> +;
 #pragma link C++ class std::set<std::pair<int, CustomStruct>> +;
 
+#pragma link C++ class std::map<int, float> +;
+#pragma link C++ class std::map<std::string, std::vector<float>> +;
+#pragma link C++ class std::map<char, std::string> +;
+#pragma link C++ class std::unordered_map<std::int64_t, double> +;
+
 #pragma link C++ options = version(3) class StructWithIORulesBase + ;
 #pragma link C++ options = version(3) class StructWithTransientString + ;
 #pragma link C++ options = version(3) class StructWithIORules + ;
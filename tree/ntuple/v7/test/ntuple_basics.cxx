@@ -177,6 +177,89 @@ TEST(RNTuple, FileAnchor)
    EXPECT_EQ(137, *b);
 }
 
+TEST(RNTuple, Update)
+{
+   FileRaii fileGuard("test_ntuple_update.root");
+
+   {
+      auto model = RNTupleModel::Create();
+      auto fldPt = model->MakeField<float>("pt");
+      auto fldVec = model->MakeField<std::vector<int>>("vec");
+      auto writer = RNTupleWriter::Recreate(std::move(model), "ntpl", fileGuard.GetPath());
+      for (int i = 0; i < 10; ++i) {
+         *fldPt = i;
+         *fldVec = std::vector<int>(i % 3, i);
+         writer->Fill();
+         if (i == 4)
+            writer->CommitCluster();
+      }
+   }
+
+   // Two updates, the second one with a different field order in the model
+   for (int update = 0; update < 2; ++update) {
+      auto model = RNTupleModel::Create();
+      std::shared_ptr<float> fldPt;
+      std::shared_ptr<std::vector<int>> fldVec;
+      if (update == 0) {
+         fldPt = model->MakeField<float>("pt");
+         fldVec = model->MakeField<std::vector<int>>("vec");
+      } else {
+         fldVec = model->MakeField<std::vector<int>>("vec");
+         fldPt = model->MakeField<float>("pt");
+      }
+      auto file = std::unique_ptr<TFile>(TFile::Open(fileGuard.GetPath().c_str(), "UPDATE"));
+      {
+         auto writer = RNTupleWriter::Update(std::move(model), "ntpl", *file);
+         EXPECT_EQ(10U + 10 * update, writer->GetNEntries());
+         for (int i = 10 + 10 * update; i < 20 + 10 * update; ++i) {
+            *fldPt = i;
+            *fldVec = std::vector<int>(i % 3, i);
+            writer->Fill();
+            if (i % 10 == 4)
+               writer->CommitCluster(true /* commitClusterGroup */);
+         }
+      }
+      file->Close();
+   }
+
+   auto reader = RNTupleReader::Open("ntpl", fileGuard.GetPath());
+   ASSERT_EQ(30U, reader->GetNEntries());
+   EXPECT_EQ(6U, reader->GetDescriptor()->GetNClusters());
+   EXPECT_EQ(5U, reader->GetDescriptor()->GetNClusterGroups());
+   auto pt = reader->GetModel()->Get<float>("pt");
+   auto vec = reader->GetModel()->Get<std::vector<int>>("vec");
+   for (int i = 0; i < 30; ++i) {
+      reader->LoadEntry(i);
+      EXPECT_FLOAT_EQ(i, *pt);
+      EXPECT_EQ(std::vector<int>(i % 3, i), *vec);
+   }
+   // Every third entry has zero, one, and two items, so the 30 entries have 30 items
+   auto viewVecItems = reader->GetView<int>("vec._0");
+   EXPECT_EQ(10, viewVecItems(9));
+   EXPECT_EQ(29, viewVecItems(29));
+
+   auto file = std::unique_ptr<TFile>(TFile::Open(fileGuard.GetPath().c_str(), "UPDATE"));
+   {
+      auto model = RNTupleModel::Create();
+      model->MakeField<float>("pt");
+      EXPECT_THROW(RNTupleWriter::Update(std::move(model), "ntpl", *file), RException);
+   }
+   {
+      auto model = RNTupleModel::Create();
+      model->MakeField<double>("pt");
+      model->MakeField<std::vector<int>>("vec");
+      EXPECT_THROW(RNTupleWriter::Update(std::move(model), "ntpl", *file), RException);
+   }
+   {
+      auto model = RNTupleModel::Create();
+      model->MakeField<float>("pt");
+      model->MakeField<std::vector<int>>("vec");
+      model->MakeField<int>("extra");
+      EXPECT_THROW(RNTupleWriter::Update(std::move(model), "ntpl", *file), RException);
+   }
+   EXPECT_THROW(RNTupleWriter::Update(RNTupleModel::Create(), "nonexistent", *file), RException);
+}
+
 TEST(RNTuple, Clusters)
 {
    FileRaii fileGuard("test_ntuple_clusters.root");
@@ -199,3 +199,126 @@ TEST(RNTupleBulk, RVec)
       }
    }
 }
+
+TEST(RNTupleBulk, StdVector)
+{
+   FileRaii fileGuard("test_ntuple_bulk_stdvector.root");
+   {
+      auto model = RNTupleModel::Create();
+      auto fldVecI = model->MakeField<std::vector<int>>("vint");
+      auto fldVecS = model->MakeField<std::vector<CustomStruct>>("vs");
+      auto writer = RNTupleWriter::Recreate(std::move(model), "ntpl", fileGuard.GetPath());
+      for (int i = 0; i < 10; ++i) {
+         fldVecI->resize(i);
+         fldVecS->resize(i);
+         for (int j = 0; j < i; ++j) {
+            fldVecI->at(j) = j;
+            fldVecS->at(j).a = j;
+         }
+         writer->Fill();
+      }
+   }
+
+   auto reader = RNTupleReader::Open("ntpl", fileGuard.GetPath());
+
+   auto fieldZero = reader->GetModel()->GetFieldZero();
+   std::unique_ptr<RFieldBase::RBulk> bulkI;
+   std::unique_ptr<RFieldBase::RBulk> bulkS;
+   for (auto &f : *fieldZero) {
+      if (f.GetName() == "vint")
+         bulkI = std::make_unique<RFieldBase::RBulk>(f.GenerateBulk());
+      if (f.GetName() == "vs")
+         bulkS = std::make_unique<RFieldBase::RBulk>(f.GenerateBulk());
+   }
+
+   auto mask = std::make_unique<bool[]>(10);
+   std::fill(mask.get(), mask.get() + 10, true);
+   mask[1] = false; // the std::vector<simple type> field optimization should ignore the mask
+
+   auto iArr = static_cast<std::vector<int> *>(bulkI->ReadBulk(RClusterIndex(0, 0), mask.get(), 10));
+   auto sArr = static_cast<std::vector<CustomStruct> *>(bulkS->ReadBulk(RClusterIndex(0, 0), mask.get(), 10));
+   for (int i = 0; i < 10; ++i) {
+      EXPECT_EQ(i, iArr[i].size());
+      EXPECT_EQ(i == 1 ? 0 : i, sArr[i].size());
+      for (std::size_t j = 0; j < iArr[i].size(); ++j) {
+         EXPECT_EQ(j, iArr[i].at(j));
+      }
+      for (std::size_t j = 0; j < sArr[i].size(); ++j) {
+         EXPECT_FLOAT_EQ(j, sArr[i].at(j).a);
+      }
+   }
+
+   // Read a sub range into the same bulk
+   iArr = static_cast<std::vector<int> *>(bulkI->ReadBulk(RClusterIndex(0, 3), mask.get(), 4));
+   for (int i = 0; i < 4; ++i) {
+      EXPECT_EQ(i + 3, iArr[i].size());
+   }
+}
+
+TEST(RNTupleBulk, View)
+{
+   FileRaii fileGuard("test_ntuple_bulk_view.root");
+   {
+      auto model = RNTupleModel::Create();
+      auto fldPt = model->MakeField<float>("pt");
+      auto fldVec = model->MakeField<ROOT::RVec<float>>("vec");
+      auto fldStr = model->MakeField<std::string>("str");
+      RNTupleWriteOptions options;
+      options.SetCompression(0);
+      // Small pages such that the bulks cross page boundaries
+      options.SetApproxUnzippedPageSize(64);
+      auto writer = RNTupleWriter::Recreate(std::move(model), "ntpl", fileGuard.GetPath(), options);
+      for (int i = 0; i < 100; ++i) {
+         *fldPt = i;
+         fldVec->resize(i % 5);
+         for (int j = 0; j < i % 5; ++j)
+            fldVec->at(j) = i + j;
+         *fldStr = std::to_string(i);
+         writer->Fill();
+      }
+   }
+
+   auto reader = RNTupleReader::Open("ntpl", fileGuard.GetPath());
+   auto viewPt = reader->GetView<float>("pt");
+
+   // Within a single page, the values are mapped
+   NTupleSize_t nItems;
+   auto mapped = viewPt.MapV(RClusterIndex(0, 0), nItems);
+   ASSERT_GT(nItems, 2u);
+   auto ptSpan = viewPt.ReadBulk(RClusterIndex(0, 0), 2);
+   EXPECT_EQ(mapped, ptSpan.data());
+   EXPECT_EQ(2u, ptSpan.size());
+
+   // Across page boundaries, the values are copied
+   auto ptSpanCopied = viewPt.ReadBulk(RClusterIndex(0, 10), 90);
+   ASSERT_EQ(90u, ptSpanCopied.size());
+   for (int i = 0; i < 90; ++i) {
+      EXPECT_FLOAT_EQ(i + 10, ptSpanCopied[i]);
+   }
+
+   auto viewStr = reader->GetView<std::string>("str");
+   auto strSpan = viewStr.ReadBulk(RClusterIndex(0, 5), 10);
+   ASSERT_EQ(10u, strSpan.size());
+   for (int i = 0; i < 10; ++i) {
+      EXPECT_EQ(std::to_string(i + 5), strSpan[i]);
+   }
+
+   auto viewVec = reader->GetViewCollection("vec");
+   auto viewVecItems = viewVec.GetView<float>("_0");
+   auto vecBulk = viewVec.ReadBulk(viewVecItems, RClusterIndex(0, 1), 99);
+   ASSERT_EQ(100u, vecBulk.fOffsets.size());
+   EXPECT_EQ(0u, vecBulk.fOffsets[0]);
+   EXPECT_EQ(vecBulk.fOffsets.back(), vecBulk.fItems.size());
+   for (int i = 0; i < 99; ++i) {
+      const auto entry = i + 1;
+      ASSERT_EQ(entry % 5, vecBulk.fOffsets[i + 1] - vecBulk.fOffsets[i]);
+      for (int j = 0; j < entry % 5; ++j) {
+         EXPECT_FLOAT_EQ(entry + j, vecBulk.fItems[vecBulk.fOffsets[i] + j]);
+      }
+   }
+
+   auto emptyBulk = viewVec.ReadBulk(viewVecItems, RClusterIndex(0, 0), 1);
+   ASSERT_EQ(2u, emptyBulk.fOffsets.size());
+   EXPECT_EQ(0u, emptyBulk.fOffsets[1]);
+   EXPECT_TRUE(emptyBulk.fItems.empty());
+}
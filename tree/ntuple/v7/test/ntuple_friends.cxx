@@ -131,3 +131,69 @@ TEST(RPageStorageFriends, FailOnEntryCountMismatch)
    RPageSourceFriends friendSource("myNTuple", realSources);
    EXPECT_THROW(friendSource.Attach(), ROOT::Experimental::RException);
 }
+
+TEST(RPageStorageFriends, Join)
+{
+   FileRaii fileGuard1("test_ntuple_friends_join1.root");
+   FileRaii fileGuard2("test_ntuple_friends_join2.root");
+
+   // 11 events of the runs 0 to 3 in turn, and a last event of run 7, which has no run entry
+   {
+      auto model = RNTupleModel::Create();
+      auto fieldRun = model->MakeField<std::uint32_t>("run");
+      auto fieldPt = model->MakeField<float>("pt");
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "events", fileGuard1.GetPath());
+      for (int i = 0; i < 11; ++i) {
+         *fieldRun = (i < 10) ? i % 4 : 7;
+         *fieldPt = i;
+         ntuple->Fill();
+         if (i % 3 == 2)
+            ntuple->CommitCluster();
+      }
+   }
+   // The runs in reverse order, each with a calibration constant and as many values as the run number
+   {
+      auto model = RNTupleModel::Create();
+      auto fieldRun = model->MakeField<std::uint32_t>("run");
+      auto fieldCalib = model->MakeField<float>("calib");
+      auto fieldVec = model->MakeField<std::vector<float>>("vec");
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "runs", fileGuard2.GetPath());
+      for (int i = 3; i >= 0; --i) {
+         *fieldRun = i;
+         *fieldCalib = 10 * i;
+         *fieldVec = std::vector<float>(i, i);
+         ntuple->Fill();
+      }
+   }
+
+   std::vector<RNTupleReader::ROpenSpec> friends{{"events", fileGuard1.GetPath()},
+                                                 {"runs", fileGuard2.GetPath(), {"run"}}};
+   auto ntuple = RNTupleReader::OpenFriends(friends);
+   EXPECT_EQ(11u, ntuple->GetNEntries());
+   EXPECT_THROW(ntuple->GetView<float>("runs.calib"), RException);
+   auto viewPt = ntuple->GetView<float>("events.pt");
+
+   auto entry = ntuple->GetModel()->GetDefaultEntry();
+   auto itrRuns =
+      std::find_if(entry->begin(), entry->end(), [](const auto &v) { return v.GetField()->GetName() == "runs"; });
+   ASSERT_NE(entry->end(), itrRuns);
+   auto runsValues = itrRuns->GetField()->SplitValue(*itrRuns);
+   ASSERT_EQ(3u, runsValues.size());
+   // Access the events in a different order than the clusters
+   for (auto i : {9, 0, 5, 1, 8, 2, 3, 7, 4, 6}) {
+      ntuple->LoadEntry(i);
+      EXPECT_FLOAT_EQ(i, viewPt(i));
+      EXPECT_EQ(static_cast<std::uint32_t>(i % 4), *runsValues[0].Get<std::uint32_t>());
+      EXPECT_FLOAT_EQ(10 * (i % 4), *runsValues[1].Get<float>());
+      EXPECT_EQ(std::vector<float>(i % 4, i % 4), *runsValues[2].Get<std::vector<float>>());
+   }
+   EXPECT_THROW(ntuple->LoadEntry(10), RException);
+
+   std::ostringstream os;
+   ntuple->Show(6, os);
+   EXPECT_NE(std::string::npos, os.str().find("\"calib\": 20"));
+
+   // The first RNTuple cannot be joined
+   friends[0].fJoinFields = {"run"};
+   EXPECT_THROW(RNTupleReader::OpenFriends(friends), RException);
+}
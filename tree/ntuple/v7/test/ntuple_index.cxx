@@ -0,0 +1,144 @@
+#include "ntuple_test.hxx"
+
+namespace {
+/// Writes 100 entries with run numbers 1 to 4 and event numbers 24 to 0 in reverse order; the pair (run, event) is
+/// unique except for the last two entries, which share the key (4, 1)
+void CreateEventNTuple(const std::string &path)
+{
+   auto model = RNTupleModel::Create();
+   auto fldRun = model->MakeField<std::uint32_t>("run");
+   auto fldEvent = model->MakeField<std::uint64_t>("event");
+   auto fldPt = model->MakeField<float>("pt");
+   auto fldVec = model->MakeField<std::vector<std::int32_t>>("vec");
+   auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntpl", path);
+   for (int i = 0; i < 100; ++i) {
+      *fldRun = 1 + i / 25;
+      *fldEvent = (i < 99) ? (99 - i) % 25 : 1;
+      *fldPt = i;
+      *fldVec = std::vector<std::int32_t>(i % 3, i);
+      ntuple->Fill();
+      if (i == 49)
+         ntuple->CommitCluster();
+   }
+}
+} // anonymous namespace
+
+TEST(RNTupleIndex, Basics)
+{
+   FileRaii fileGuard("test_ntuple_index_basics.root");
+   CreateEventNTuple(fileGuard.GetPath());
+
+   auto ntuple = RNTupleReader::Open("ntpl", fileGuard.GetPath());
+   auto index = RNTupleIndex::Create({"run", "event"}, *ntuple);
+   EXPECT_EQ("ntpl", index->GetNTupleName());
+   EXPECT_EQ(100U, index->GetNEntries());
+   ASSERT_EQ(2U, index->GetKeyFieldNames().size());
+
+   auto viewPt = ntuple->GetView<float>("pt");
+   for (int i = 0; i < 99; ++i) {
+      const std::uint64_t run = 1 + i / 25;
+      const std::uint64_t event = (99 - i) % 25;
+      const auto entryNumber = index->GetFirstEntryNumber({run, event});
+      ASSERT_NE(ROOT::Experimental::kInvalidNTupleIndex, entryNumber);
+      EXPECT_FLOAT_EQ(i, viewPt(entryNumber));
+   }
+   EXPECT_EQ(ROOT::Experimental::kInvalidNTupleIndex, index->GetFirstEntryNumber({5, 0}));
+   EXPECT_EQ(ROOT::Experimental::kInvalidNTupleIndex, index->GetFirstEntryNumber({1, 25}));
+
+   EXPECT_EQ(std::vector<NTupleSize_t>({98, 99}), index->GetAllEntryNumbers({4, 1}));
+   EXPECT_TRUE(index->GetAllEntryNumbers({0, 0}).empty());
+   // Run 2, events 3 to 5 inclusive, ordered by event number
+   EXPECT_EQ(std::vector<NTupleSize_t>({46, 45, 44}), index->GetEntryNumbersInRange({2, 3}, {2, 6}));
+   EXPECT_EQ(25U, index->GetEntryNumbersInRange({3, 0}, {4, 0}).size());
+   EXPECT_TRUE(index->GetEntryNumbersInRange({4, 0}, {3, 0}).empty());
+
+   EXPECT_THROW(index->GetFirstEntryNumber({1}), RException);
+   EXPECT_THROW(RNTupleIndex::Create({}, *ntuple), RException);
+   EXPECT_THROW(RNTupleIndex::Create({"pt"}, *ntuple), RException);
+   EXPECT_THROW(RNTupleIndex::Create({"vec._0"}, *ntuple), RException);
+   EXPECT_THROW(RNTupleIndex::Create({"nonexistent"}, *ntuple), RException);
+
+   EXPECT_THROW(ntuple->FindEntry({1, 24}), RException);
+   ntuple->SetIndex(std::move(index));
+   ASSERT_NE(nullptr, ntuple->GetIndex());
+   EXPECT_EQ(0U, ntuple->FindEntry({1, 24}));
+}
+
+TEST(RNTupleIndex, WriteAndOpen)
+{
+   FileRaii fileGuard("test_ntuple_index_write.root");
+   CreateEventNTuple(fileGuard.GetPath());
+
+   EXPECT_THROW(RNTupleIndex::Open("ntpl", fileGuard.GetPath()), RException);
+   {
+      auto ntuple = RNTupleReader::Open("ntpl", fileGuard.GetPath());
+      auto index = RNTupleIndex::Create({"event"}, *ntuple);
+      auto file = std::unique_ptr<TFile>(TFile::Open(fileGuard.GetPath().c_str(), "UPDATE"));
+      index->Write(*file);
+   }
+
+   auto ntuple = RNTupleReader::Open("ntpl", fileGuard.GetPath());
+   EXPECT_EQ(100U, ntuple->GetNEntries());
+   auto index = RNTupleIndex::Open("ntpl", fileGuard.GetPath());
+   EXPECT_EQ(std::vector<std::string>({"event"}), index->GetKeyFieldNames());
+   EXPECT_EQ(std::vector<NTupleSize_t>({24, 49, 74}), index->GetAllEntryNumbers({0}));
+   EXPECT_EQ(std::vector<NTupleSize_t>({23, 48, 73, 98, 99}), index->GetAllEntryNumbers({1}));
+   EXPECT_EQ(8U, index->GetEntryNumbersInRange({0}, {2}).size());
+
+   ntuple->SetIndex(std::move(index));
+   auto viewPt = ntuple->GetView<float>("pt");
+   EXPECT_FLOAT_EQ(0.0, viewPt(ntuple->FindEntry({24})));
+
+   // The index must cover all the entries
+   FileRaii fileGuardOther("test_ntuple_index_write_other.root");
+   {
+      auto model = RNTupleModel::Create();
+      auto fldEvent = model->MakeField<std::uint64_t>("event");
+      auto writer = RNTupleWriter::Recreate(std::move(model), "ntpl", fileGuardOther.GetPath());
+      writer->Fill();
+   }
+   auto other = RNTupleReader::Open("ntpl", fileGuardOther.GetPath());
+   EXPECT_THROW(other->SetIndex(RNTupleIndex::Open("ntpl", fileGuard.GetPath())), RException);
+}
+
+TEST(RNTupleIndex, SignedKeys)
+{
+   FileRaii fileGuard("test_ntuple_index_signed.root");
+   {
+      auto model = RNTupleModel::Create();
+      auto fldRun = model->MakeField<std::uint16_t>("run");
+      auto fldShift = model->MakeField<std::int32_t>("shift");
+      auto writer = RNTupleWriter::Recreate(std::move(model), "ntpl", fileGuard.GetPath());
+      // Shifts 2, 1, 0, -1, -2, -3 for run 1 and shifts -3, -2, -1, 0, 1, 2 for run 2
+      for (int i = 0; i < 12; ++i) {
+         *fldRun = 1 + i / 6;
+         *fldShift = (i < 6) ? (2 - i) : (i - 9);
+         writer->Fill();
+      }
+   }
+
+   auto fnKey = [](std::uint64_t run, std::int64_t shift) {
+      return std::vector<std::uint64_t>{run, static_cast<std::uint64_t>(shift)};
+   };
+   auto ntuple = RNTupleReader::Open("ntpl", fileGuard.GetPath());
+   auto index = RNTupleIndex::Create({"run", "shift"}, *ntuple);
+   EXPECT_EQ(4U, index->GetFirstEntryNumber(fnKey(1, -2)));
+   EXPECT_EQ(std::vector<NTupleSize_t>({6}), index->GetAllEntryNumbers(fnKey(2, -3)));
+   auto keys = fnKey(1, -3);
+   for (const auto &key : {fnKey(1, 0), fnKey(2, 0)})
+      keys.insert(keys.end(), key.begin(), key.end());
+   EXPECT_EQ(std::vector<NTupleSize_t>({5, 2, 9}), index->GetFirstEntryNumbers(keys));
+   // Negative shifts come before the non-negative ones
+   EXPECT_EQ(std::vector<NTupleSize_t>({5, 4, 3, 2, 1}), index->GetEntryNumbersInRange(fnKey(1, -3), fnKey(1, 2)));
+   EXPECT_EQ(std::vector<NTupleSize_t>({7, 8, 9}), index->GetEntryNumbersInRange(fnKey(2, -2), fnKey(2, 1)));
+   EXPECT_EQ(std::vector<NTupleSize_t>({0, 6, 7}), index->GetEntryNumbersInRange(fnKey(1, 2), fnKey(2, -1)));
+   EXPECT_TRUE(index->GetEntryNumbersInRange(fnKey(1, 0), fnKey(1, -1)).empty());
+
+   {
+      auto file = std::unique_ptr<TFile>(TFile::Open(fileGuard.GetPath().c_str(), "UPDATE"));
+      index->Write(*file);
+   }
+   auto stored = RNTupleIndex::Open("ntpl", fileGuard.GetPath());
+   EXPECT_EQ(std::vector<NTupleSize_t>({5, 4, 3, 2, 1}), stored->GetEntryNumbersInRange(fnKey(1, -3), fnKey(1, 2)));
+   EXPECT_EQ(11U, stored->GetFirstEntryNumber(fnKey(2, 2)));
+}
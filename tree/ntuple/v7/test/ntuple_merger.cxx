@@ -1,5 +1,7 @@
 #include "ntuple_test.hxx"
 
+#include <TFileMerger.h>
+
 namespace {
 
 // Reads an integer from a little-endian 4 byte buffer
@@ -79,3 +81,188 @@ TEST(RFieldMerger, Merge)
    auto mergeResult = RFieldMerger::Merge(RFieldDescriptor(), RFieldDescriptor());
    EXPECT_FALSE(mergeResult);
 }
+
+namespace {
+
+void WriteTestNTuple(const std::string &path, int compression, int firstValue, int nEntries)
+{
+   auto model = RNTupleModel::Create();
+   auto fldFoo = model->MakeField<int>("foo");
+   auto fldBar = model->MakeField<std::vector<float>>("bar");
+   RNTupleWriteOptions options;
+   options.SetCompression(compression);
+   auto writer = RNTupleWriter::Recreate(std::move(model), "ntuple", path, options);
+   for (int i = 0; i < nEntries; ++i) {
+      *fldFoo = firstValue + i;
+      *fldBar = std::vector<float>(i % 3, static_cast<float>(firstValue + i));
+      writer->Fill();
+      if (i % 50 == 49)
+         writer->CommitCluster();
+   }
+}
+
+} // anonymous namespace
+
+TEST(RNTupleMerger, Merge)
+{
+   FileRaii fileGuard1("test_ntuple_merge_in_1.root");
+   FileRaii fileGuard2("test_ntuple_merge_in_2.root");
+   FileRaii fileGuard3("test_ntuple_merge_out.root");
+
+   WriteTestNTuple(fileGuard1.GetPath(), 0, 0, 120);
+   WriteTestNTuple(fileGuard2.GetPath(), 0, 1000, 80);
+
+   {
+      auto source1 = RPageSource::Create("ntuple", fileGuard1.GetPath());
+      auto source2 = RPageSource::Create("ntuple", fileGuard2.GetPath());
+      std::vector<RPageSource *> sources{source1.get(), source2.get()};
+      RNTupleWriteOptions options;
+      options.SetCompression(0);
+      auto destination = std::make_unique<RPageSinkFile>("ntuple", fileGuard3.GetPath(), options);
+      RNTupleMerger merger;
+      merger.Merge(sources, *destination);
+   }
+
+   auto reader = RNTupleReader::Open("ntuple", fileGuard3.GetPath());
+   ASSERT_EQ(200U, reader->GetNEntries());
+   // 3 + 2 clusters in 2 cluster groups
+   EXPECT_EQ(5U, reader->GetDescriptor()->GetNClusters());
+   EXPECT_EQ(2U, reader->GetDescriptor()->GetNClusterGroups());
+   auto viewFoo = reader->GetView<int>("foo");
+   auto viewBar = reader->GetView<std::vector<float>>("bar");
+   for (unsigned i = 0; i < 200; ++i) {
+      const int j = (i < 120) ? i : i - 120;
+      const int expected = (i < 120) ? j : 1000 + j;
+      EXPECT_EQ(expected, viewFoo(i));
+      EXPECT_EQ(std::vector<float>(j % 3, static_cast<float>(expected)), viewBar(i));
+   }
+}
+
+TEST(RNTupleMerger, Recompress)
+{
+   FileRaii fileGuard1("test_ntuple_merge_recompress_in_1.root");
+   FileRaii fileGuard2("test_ntuple_merge_recompress_in_2.root");
+   FileRaii fileGuard3("test_ntuple_merge_recompress_out.root");
+
+   // The first source matches the destination compression, the second one needs to be recompressed
+   WriteTestNTuple(fileGuard1.GetPath(), 505, 0, 100);
+   WriteTestNTuple(fileGuard2.GetPath(), 0, 100, 100);
+
+   {
+      auto source1 = RPageSource::Create("ntuple", fileGuard1.GetPath());
+      auto source2 = RPageSource::Create("ntuple", fileGuard2.GetPath());
+      std::vector<RPageSource *> sources{source1.get(), source2.get()};
+      RNTupleWriteOptions options;
+      options.SetCompression(505);
+      auto destination = std::make_unique<RPageSinkFile>("ntuple", fileGuard3.GetPath(), options);
+      RNTupleMerger merger;
+      merger.Merge(sources, *destination);
+   }
+
+   auto reader = RNTupleReader::Open("ntuple", fileGuard3.GetPath());
+   ASSERT_EQ(200U, reader->GetNEntries());
+   for (const auto &clusterDesc : reader->GetDescriptor()->GetClusterIterable()) {
+      for (auto columnId : clusterDesc.GetColumnIds())
+         EXPECT_EQ(505, clusterDesc.GetColumnRange(columnId).fCompressionSettings);
+   }
+   auto viewFoo = reader->GetView<int>("foo");
+   for (unsigned i = 0; i < 200; ++i)
+      EXPECT_EQ(static_cast<int>(i), viewFoo(i));
+}
+
+TEST(RNTupleMerger, LossyColumns)
+{
+   FileRaii fileGuard1("test_ntuple_merge_lossy_in_1.root");
+   FileRaii fileGuard2("test_ntuple_merge_lossy_in_2.root");
+   FileRaii fileGuard3("test_ntuple_merge_lossy_out.root");
+
+   for (const auto &path : {fileGuard1.GetPath(), fileGuard2.GetPath()}) {
+      auto model = RNTupleModel::Create();
+      auto fldX = std::make_unique<RField<float>>("x");
+      fldX->SetQuantized(0.0, 100.0, 12);
+      model->AddField(std::move(fldX));
+      RNTupleWriteOptions options;
+      options.SetCompression(0);
+      auto writer = RNTupleWriter::Recreate(std::move(model), "ntuple", path, options);
+      for (int i = 0; i < 100; ++i) {
+         *writer->GetModel()->GetDefaultEntry()->Get<float>("x") = i;
+         writer->Fill();
+      }
+   }
+
+   {
+      auto source1 = RPageSource::Create("ntuple", fileGuard1.GetPath());
+      auto source2 = RPageSource::Create("ntuple", fileGuard2.GetPath());
+      std::vector<RPageSource *> sources{source1.get(), source2.get()};
+      RNTupleWriteOptions options;
+      options.SetCompression(505);
+      auto destination = std::make_unique<RPageSinkFile>("ntuple", fileGuard3.GetPath(), options);
+      RNTupleMerger merger;
+      merger.Merge(sources, *destination);
+   }
+
+   auto reader = RNTupleReader::Open("ntuple", fileGuard3.GetPath());
+   ASSERT_EQ(200U, reader->GetNEntries());
+   const auto desc = reader->GetDescriptor();
+   const auto columnModel = desc->GetColumnDescriptor(desc->FindLogicalColumnId(desc->FindFieldId("x"), 0)).GetModel();
+   EXPECT_EQ(EColumnType::kReal32Quant, columnModel.GetType());
+   EXPECT_EQ(12U, columnModel.GetBitsOnStorage());
+   auto viewX = reader->GetView<float>("x");
+   for (unsigned i = 0; i < 200; ++i)
+      EXPECT_NEAR(static_cast<float>(i % 100), viewX(i), 100.0 / 4095);
+}
+
+TEST(RNTupleMerger, IncompatibleSchema)
+{
+   FileRaii fileGuard1("test_ntuple_merge_incompatible_in_1.root");
+   FileRaii fileGuard2("test_ntuple_merge_incompatible_in_2.root");
+   FileRaii fileGuard3("test_ntuple_merge_incompatible_out.root");
+
+   WriteTestNTuple(fileGuard1.GetPath(), 0, 0, 10);
+   {
+      auto model = RNTupleModel::Create();
+      auto fldFoo = model->MakeField<float>("foo");
+      auto fldBar = model->MakeField<std::vector<float>>("bar");
+      auto writer = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuard2.GetPath());
+      writer->Fill();
+   }
+
+   auto source1 = RPageSource::Create("ntuple", fileGuard1.GetPath());
+   auto source2 = RPageSource::Create("ntuple", fileGuard2.GetPath());
+   std::vector<RPageSource *> sources{source1.get(), source2.get()};
+   auto destination = std::make_unique<RPageSinkFile>("ntuple", fileGuard3.GetPath(), RNTupleWriteOptions());
+   RNTupleMerger merger;
+   try {
+      merger.Merge(sources, *destination);
+      FAIL() << "merging ntuples with different schemas should throw";
+   } catch (const RException &err) {
+      EXPECT_THAT(err.what(), testing::HasSubstr("incompatible"));
+   }
+}
+
+TEST(RNTupleMerger, TFileMerger)
+{
+   FileRaii fileGuard1("test_ntuple_merge_tfilemerger_in_1.root");
+   FileRaii fileGuard2("test_ntuple_merge_tfilemerger_in_2.root");
+   FileRaii fileGuard3("test_ntuple_merge_tfilemerger_out.root");
+
+   WriteTestNTuple(fileGuard1.GetPath(), 505, 0, 60);
+   WriteTestNTuple(fileGuard2.GetPath(), 505, 60, 40);
+
+   {
+      ROOT::TestSupport::CheckDiagsRAII diags;
+      diags.requiredDiag(kWarning, "TFileMerger::MergeRecursive", "merging RNTuples is experimental");
+
+      TFileMerger merger(kFALSE, kFALSE);
+      merger.OutputFile(fileGuard3.GetPath().c_str(), "RECREATE", 505);
+      merger.AddFile(fileGuard1.GetPath().c_str());
+      merger.AddFile(fileGuard2.GetPath().c_str());
+      EXPECT_TRUE(merger.Merge());
+   }
+
+   auto reader = RNTupleReader::Open("ntuple", fileGuard3.GetPath());
+   ASSERT_EQ(100U, reader->GetNEntries());
+   auto viewFoo = reader->GetView<int>("foo");
+   for (unsigned i = 0; i < 100; ++i)
+      EXPECT_EQ(static_cast<int>(i), viewFoo(i));
+}
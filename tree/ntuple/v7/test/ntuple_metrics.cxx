@@ -112,3 +112,72 @@ TEST(Metrics, RNTupleWriter)
    // one page for the int field, one for the float field
    EXPECT_EQ(2, page_counter->GetValueAsInt());
 }
+
+TEST(Metrics, ReadReport)
+{
+   FileRaii fileGuard("test_ntuple_metrics_read_report.root");
+   {
+      auto model = RNTupleModel::Create();
+      auto fldPt = model->MakeField<float>("pt");
+      auto fldJets = model->MakeField<std::vector<float>>("jets");
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntpl", fileGuard.GetPath());
+      for (int i = 0; i < 1000; ++i) {
+         *fldPt = i;
+         fldJets->assign(i % 3, float(i));
+         ntuple->Fill();
+         if (i == 499)
+            ntuple->CommitCluster();
+      }
+   }
+
+   for (auto clusterCache : {RNTupleReadOptions::EClusterCache::kOff, RNTupleReadOptions::EClusterCache::kOn}) {
+      RNTupleReadOptions options;
+      options.SetClusterCache(clusterCache);
+      // Nothing is recorded unless the metrics are enabled
+      auto disabledReader = RNTupleReader::Open("ntpl", fileGuard.GetPath(), options);
+      disabledReader->LoadEntry(0);
+      std::ostringstream osDisabled;
+      disabledReader->PrintInfo(ROOT::Experimental::ENTupleInfo::kMetricsJSON, osDisabled);
+      EXPECT_THAT(osDisabled.str(), testing::HasSubstr("\"columns\": []"));
+
+      auto reader = RNTupleReader::Open("ntpl", fileGuard.GetPath(), options);
+      reader->EnableMetrics();
+      auto viewPt = reader->GetView<float>("pt");
+      auto viewJets = reader->GetView<std::vector<float>>("jets");
+      for (auto i : reader->GetEntryRange()) {
+         viewPt(i);
+         viewJets(i);
+      }
+
+      std::ostringstream osJSON;
+      reader->PrintInfo(ROOT::Experimental::ENTupleInfo::kMetricsJSON, osJSON);
+      const auto json = osJSON.str();
+      EXPECT_THAT(json, testing::HasSubstr("{\"ntuple\": \"ntpl\""));
+      EXPECT_THAT(json, testing::HasSubstr("\"name\": \"RNTupleReader.RPageSourceFile.szUnzip\", \"unit\": \"B\""));
+      EXPECT_THAT(json, testing::HasSubstr("\"field\": \"pt\""));
+      EXPECT_THAT(json, testing::HasSubstr("\"field\": \"jets._0\""));
+      EXPECT_THAT(json, testing::HasSubstr("\"phase\": \"read\""));
+      EXPECT_THAT(json, testing::HasSubstr("\"phase\": \"unzip\""));
+      EXPECT_THAT(json, testing::Not(testing::HasSubstr("nan")));
+
+      std::ostringstream osCSV;
+      reader->PrintInfo(ROOT::Experimental::ENTupleInfo::kMetricsCSV, osCSV);
+      const auto csv = osCSV.str();
+      EXPECT_EQ(0u, csv.find("ntuple,location,kind,id,field,name,unit,value\n"));
+      EXPECT_THAT(csv, testing::HasSubstr("ntpl,,column,"));
+      EXPECT_THAT(csv, testing::HasSubstr(",pt,nPages,,2\n"));
+      EXPECT_THAT(csv, testing::HasSubstr("ntpl,,cluster,1,,read.busy,ns,"));
+   }
+
+   // The report of a page source contains one entry per unsealed column and per cluster phase
+   auto source = RPageSource::Create("ntpl", fileGuard.GetPath());
+   source->GetMetrics().Enable();
+   auto reader = std::make_unique<RNTupleReader>(std::move(source));
+   auto viewPt = reader->GetView<float>("pt");
+   for (auto i : reader->GetEntryRange())
+      viewPt(i);
+   std::ostringstream osJSON;
+   reader->PrintInfo(ROOT::Experimental::ENTupleInfo::kMetricsJSON, osJSON);
+   EXPECT_THAT(osJSON.str(), testing::HasSubstr("\"nPages\": 2"));
+   EXPECT_THAT(osJSON.str(), testing::Not(testing::HasSubstr("jets")));
+}
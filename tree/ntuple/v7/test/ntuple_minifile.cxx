@@ -1,4 +1,5 @@
 #include "ntuple_test.hxx"
+#include <TKey.h>
 #include <TTree.h>
 
 namespace ROOT {
@@ -168,6 +169,79 @@ TEST(MiniFile, Multi)
 }
 
 
+TEST(MiniFile, Update)
+{
+   FileRaii fileGuard("test_ntuple_minifile_update.root");
+
+   char header = 'h';
+   char footer = 'f';
+   std::uint64_t offHeader;
+   std::uint64_t offFooter;
+   {
+      std::unique_ptr<TFile> file;
+      auto writer =
+         std::unique_ptr<RNTupleFileWriter>(RNTupleFileWriter::Recreate("MyNTuple", fileGuard.GetPath(), file));
+      offHeader = writer->WriteNTupleHeader(&header, 1, 1);
+      offFooter = writer->WriteNTupleFooter(&footer, 1, 1);
+      writer->Commit();
+   }
+
+   // An update that is not committed must leave the previous anchor in place
+   char blob = 'b';
+   char newFooter = 'F';
+   {
+      auto file = std::unique_ptr<TFile>(TFile::Open(fileGuard.GetPath().c_str(), "UPDATE"));
+      auto writer = std::unique_ptr<RNTupleFileWriter>(RNTupleFileWriter::Update("MyNTuple", *file));
+      EXPECT_EQ(offFooter, writer->GetNTupleAnchor().fSeekFooter);
+      writer->WriteBlob(&blob, 1, 1);
+      writer->WriteNTupleFooter(&newFooter, 1, 1);
+      writer.reset();
+      file->Close();
+   }
+   {
+      auto rawFile = RRawFile::Create(fileGuard.GetPath());
+      RMiniFileReader reader(rawFile.get());
+      auto ntuple = reader.GetNTuple("MyNTuple").Inspect();
+      EXPECT_EQ(offHeader, ntuple.fSeekHeader);
+      EXPECT_EQ(offFooter, ntuple.fSeekFooter);
+      char buf;
+      reader.ReadBuffer(&buf, 1, ntuple.fSeekFooter);
+      EXPECT_EQ(footer, buf);
+   }
+
+   // A committed update replaces the anchor; the previous anchor key is deleted only after the new one is written
+   std::uint64_t offNewFooter;
+   {
+      auto file = std::unique_ptr<TFile>(TFile::Open(fileGuard.GetPath().c_str(), "UPDATE"));
+      auto writer = std::unique_ptr<RNTupleFileWriter>(RNTupleFileWriter::Update("MyNTuple", *file));
+      writer->WriteBlob(&blob, 1, 1);
+      offNewFooter = writer->WriteNTupleFooter(&newFooter, 1, 1);
+      writer->Commit();
+      writer.reset();
+      file->Close();
+   }
+   {
+      auto file = std::unique_ptr<TFile>(TFile::Open(fileGuard.GetPath().c_str()));
+      int nAnchorKeys = 0;
+      for (auto key : TRangeDynCast<TKey>(file->GetListOfKeys())) {
+         if (key && std::string(key->GetName()) == "MyNTuple")
+            nAnchorKeys++;
+      }
+      EXPECT_EQ(1, nAnchorKeys);
+   }
+   auto rawFile = RRawFile::Create(fileGuard.GetPath());
+   RMiniFileReader reader(rawFile.get());
+   auto ntuple = reader.GetNTuple("MyNTuple").Inspect();
+   EXPECT_EQ(offHeader, ntuple.fSeekHeader);
+   EXPECT_EQ(offNewFooter, ntuple.fSeekFooter);
+   char buf;
+   reader.ReadBuffer(&buf, 1, ntuple.fSeekHeader);
+   EXPECT_EQ(header, buf);
+   reader.ReadBuffer(&buf, 1, ntuple.fSeekFooter);
+   EXPECT_EQ(newFooter, buf);
+}
+
+
 TEST(MiniFile, Failures)
 {
    // TODO(jblomer): failures should be exceptions
@@ -6,6 +6,7 @@
 #include <limits>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 template <typename PodT, typename NarrowT, ROOT::Experimental::EColumnType ColumnT>
 struct Helper {
@@ -57,6 +58,23 @@ using PackingIndexTypes = ::testing::Types<
    Helper<ROOT::Experimental::ClusterSize_t, std::uint64_t, ROOT::Experimental::EColumnType::kSplitIndex64>>;
 TYPED_TEST_SUITE(PackingIndex, PackingIndexTypes);
 
+template <typename HelperT>
+class PackingBitPacked : public ::testing::Test {
+public:
+   using Helper_t = HelperT;
+};
+
+using PackingBitPackedTypes = ::testing::Types<
+   Helper<std::int64_t, std::int64_t, ROOT::Experimental::EColumnType::kPackedInt64>,
+   Helper<std::uint64_t, std::int64_t, ROOT::Experimental::EColumnType::kPackedInt64>,
+   Helper<std::int32_t, std::int32_t, ROOT::Experimental::EColumnType::kPackedInt32>,
+   Helper<std::uint32_t, std::int32_t, ROOT::Experimental::EColumnType::kPackedInt32>,
+   Helper<std::int16_t, std::int16_t, ROOT::Experimental::EColumnType::kPackedInt16>,
+   Helper<std::uint16_t, std::int16_t, ROOT::Experimental::EColumnType::kPackedInt16>,
+   Helper<ROOT::Experimental::ClusterSize_t, std::uint32_t, ROOT::Experimental::EColumnType::kPackedIndex32>,
+   Helper<ROOT::Experimental::ClusterSize_t, std::uint64_t, ROOT::Experimental::EColumnType::kPackedIndex64>>;
+TYPED_TEST_SUITE(PackingBitPacked, PackingBitPackedTypes);
+
 TEST(Packing, Bitfield)
 {
    ROOT::Experimental::Detail::RColumnElement<bool, ROOT::Experimental::EColumnType::kBit> element;
@@ -174,6 +192,145 @@ TYPED_TEST(PackingIndex, SplitIndex)
    EXPECT_EQ(mem, cmp);
 }
 
+TYPED_TEST(PackingBitPacked, BitPacked)
+{
+   using Pod_t = typename TestFixture::Helper_t::Pod_t;
+   using Narrow_t = typename TestFixture::Helper_t::Narrow_t;
+   // The in-memory type of index columns is ClusterSize_t, which is bitwise identical to Pod_t
+   using Element_t = std::conditional_t<TestFixture::Helper_t::kColumnType == EColumnType::kPackedIndex32 ||
+                                           TestFixture::Helper_t::kColumnType == EColumnType::kPackedIndex64,
+                                        ClusterSize_t, Pod_t>;
+   constexpr std::size_t kNBits = sizeof(Narrow_t) * 8;
+
+   ROOT::Experimental::Detail::RColumnElement<Element_t, TestFixture::Helper_t::kColumnType> element;
+   EXPECT_EQ(kNBits + 1, element.GetBitsOnStorage());
+   element.Pack(nullptr, nullptr, 0);
+   element.Unpack(nullptr, nullptr, 0);
+
+   std::array<Pod_t, 9> extremes{0,
+                                 1,
+                                 42,
+                                 static_cast<Pod_t>(std::numeric_limits<Narrow_t>::min()),
+                                 static_cast<Pod_t>(std::numeric_limits<Narrow_t>::min() + 1),
+                                 static_cast<Pod_t>(std::numeric_limits<Narrow_t>::max()),
+                                 static_cast<Pod_t>(std::numeric_limits<Narrow_t>::max() - 1),
+                                 7,
+                                 7};
+   std::vector<unsigned char> packed(element.GetPackedSize(extremes.size()));
+   std::array<Pod_t, 9> cmp;
+   element.Pack(packed.data(), extremes.data(), extremes.size());
+   element.Unpack(cmp.data(), packed.data(), extremes.size());
+   EXPECT_EQ(extremes, cmp);
+
+   // Monotonic sequence with small deltas: 0, 1, 3, 6, ... needs only a few bits per element
+   std::vector<Pod_t> offsets(100);
+   for (unsigned i = 1; i < offsets.size(); ++i)
+      offsets[i] = offsets[i - 1] + (i % 5);
+   packed.assign(element.GetPackedSize(offsets.size()), 0xff);
+   element.Pack(packed.data(), offsets.data(), offsets.size());
+   // Deltas up to 4 need 3 bits, or 4 bits when zigzag encoded
+   const bool isIndex = std::is_same_v<Element_t, ClusterSize_t>;
+   EXPECT_EQ(isIndex ? 3 : 4, packed[0]);
+   const std::size_t nBytesUsed = 1 + (offsets.size() * packed[0] + 7) / 8;
+   for (std::size_t i = nBytesUsed; i < packed.size(); ++i)
+      EXPECT_EQ(0, packed[i]);
+   std::vector<Pod_t> cmpOffsets(offsets.size());
+   element.Unpack(cmpOffsets.data(), packed.data(), offsets.size());
+   EXPECT_EQ(offsets, cmpOffsets);
+
+   // Exercise all bit widths, including the ones where elements straddle 64bit boundaries
+   for (std::size_t width = 0; width <= kNBits; ++width) {
+      std::vector<Pod_t> values(67);
+      std::uint64_t state = 0x9E3779B97F4A7C15ULL;
+      for (auto &v : values) {
+         state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+         v = static_cast<Pod_t>(static_cast<Narrow_t>((width == 0) ? 0 : (state >> (64 - width))));
+      }
+      packed.assign(element.GetPackedSize(values.size()), 0);
+      element.Pack(packed.data(), values.data(), values.size());
+      std::vector<Pod_t> cmpValues(values.size());
+      element.Unpack(cmpValues.data(), packed.data(), values.size());
+      EXPECT_EQ(values, cmpValues) << "width " << width;
+   }
+}
+
+template <typename PodT>
+class PackingLossyReal : public ::testing::Test {};
+
+using PackingLossyRealTypes = ::testing::Types<float, double>;
+TYPED_TEST_SUITE(PackingLossyReal, PackingLossyRealTypes);
+
+TYPED_TEST(PackingLossyReal, Truncated)
+{
+   using Pod_t = TypeParam;
+   ROOT::Experimental::Detail::RColumnElement<Pod_t, EColumnType::kReal32Trunc> element;
+   EXPECT_EQ(32U, element.GetBitsOnStorage());
+   EXPECT_THROW(element.SetBitsOnStorage(9), RException);
+   EXPECT_THROW(element.SetBitsOnStorage(33), RException);
+   EXPECT_THROW(element.SetValueRange(0., 1.), RException);
+   element.Pack(nullptr, nullptr, 0);
+   element.Unpack(nullptr, nullptr, 0);
+
+   std::vector<Pod_t> values{0.0, -0.0, 1.0, -1.0, 3.14159, -2.71828e10, 1.5e-20, 42.4242,
+                             std::numeric_limits<float>::infinity()};
+   for (std::size_t nBits = 10; nBits <= 32; ++nBits) {
+      element.SetBitsOnStorage(nBits);
+      EXPECT_EQ((values.size() * nBits + 7) / 8, element.GetPackedSize(values.size()));
+      std::vector<unsigned char> packed(element.GetPackedSize(values.size()));
+      element.Pack(packed.data(), values.data(), values.size());
+      std::vector<Pod_t> cmp(values.size());
+      element.Unpack(cmp.data(), packed.data(), values.size());
+      // Truncation rounds towards zero with a relative error below 2^-(nBits - 9)
+      const double maxRelError = std::ldexp(1.0, -static_cast<int>(nBits - 9));
+      for (std::size_t i = 0; i < values.size(); ++i) {
+         const double expected = static_cast<float>(values[i]);
+         if (std::isinf(expected) || expected == 0.0) {
+            EXPECT_EQ(expected, cmp[i]);
+            EXPECT_EQ(std::signbit(expected), std::signbit(cmp[i]));
+            continue;
+         }
+         EXPECT_LE(std::abs(cmp[i]), std::abs(expected));
+         EXPECT_LE(std::abs(cmp[i] - expected) / std::abs(expected), maxRelError) << nBits << " bits";
+      }
+   }
+}
+
+TYPED_TEST(PackingLossyReal, Quantized)
+{
+   using Pod_t = TypeParam;
+   ROOT::Experimental::Detail::RColumnElement<Pod_t, EColumnType::kReal32Quant> element;
+   EXPECT_THROW(element.SetBitsOnStorage(0), RException);
+   EXPECT_THROW(element.SetBitsOnStorage(33), RException);
+   EXPECT_THROW(element.SetValueRange(1., 1.), RException);
+   EXPECT_THROW(element.SetValueRange(1., -1.), RException);
+   element.SetValueRange(-5., 5.);
+
+   std::vector<Pod_t> values{-5.0, 5.0, 0.0, 1.0, -1.25, 4.99, -3.3333};
+   for (std::size_t nBits = 1; nBits <= 32; ++nBits) {
+      element.SetBitsOnStorage(nBits);
+      std::vector<unsigned char> packed(element.GetPackedSize(values.size()));
+      element.Pack(packed.data(), values.data(), values.size());
+      std::vector<Pod_t> cmp(values.size());
+      element.Unpack(cmp.data(), packed.data(), values.size());
+      // The range boundaries are represented exactly; otherwise the error is at most half a quantization step
+      EXPECT_FLOAT_EQ(-5.0, cmp[0]);
+      EXPECT_FLOAT_EQ(5.0, cmp[1]);
+      const double halfStep = 5.0 / static_cast<double>((std::uint64_t(1) << nBits) - 1);
+      for (std::size_t i = 0; i < values.size(); ++i) {
+         EXPECT_GE(cmp[i], -5.0);
+         EXPECT_LE(cmp[i], 5.0);
+         EXPECT_NEAR(values[i], cmp[i], halfStep + 1e-6) << nBits << " bits";
+      }
+   }
+
+   // Values outside of the range cannot be stored
+   std::vector<Pod_t> outOfRange{0.0, 5.5};
+   std::vector<unsigned char> packed(element.GetPackedSize(outOfRange.size()));
+   EXPECT_THROW(element.Pack(packed.data(), outOfRange.data(), outOfRange.size()), RException);
+   outOfRange[1] = std::numeric_limits<Pod_t>::quiet_NaN();
+   EXPECT_THROW(element.Pack(packed.data(), outOfRange.data(), outOfRange.size()), RException);
+}
+
 namespace {
 
 template <typename PodT, ROOT::Experimental::EColumnType ColumnT>
@@ -303,3 +460,275 @@ TEST(Packing, OnDiskEncoding)
    EXPECT_EQ(std::string("abc"), viewStr(0));
    EXPECT_EQ(std::string("de"), viewStr(1));
 }
+
+TEST(Packing, BitPackedColumns)
+{
+   FileRaii fileGuard("test_ntuple_packing_bitpacked.root");
+
+   auto model = RNTupleModel::Create();
+   auto fldChannels = std::make_unique<RField<std::vector<std::int32_t>>>("channels");
+   fldChannels->SetColumnRepresentative({EColumnType::kPackedIndex64});
+   fldChannels->GetSubFields()[0]->SetColumnRepresentative({EColumnType::kPackedInt32});
+   model->AddField(std::move(fldChannels));
+   {
+      auto writer = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuard.GetPath());
+      auto channels = writer->GetModel()->GetDefaultEntry()->Get<std::vector<std::int32_t>>("channels");
+      for (int i = 0; i < 1000; ++i) {
+         channels->clear();
+         for (int j = 0; j < i % 11; ++j)
+            channels->emplace_back(100000 + 3 * j - (i % 4));
+         writer->Fill();
+      }
+   }
+
+   auto reader = RNTupleReader::Open("ntuple", fileGuard.GetPath());
+   EXPECT_EQ(EColumnType::kPackedIndex64, reader->GetModel()->GetField("channels")->GetColumnRepresentative()[0]);
+   EXPECT_EQ(EColumnType::kPackedInt32,
+             reader->GetModel()->GetField("channels")->GetSubFields()[0]->GetColumnRepresentative()[0]);
+   ASSERT_EQ(1000U, reader->GetNEntries());
+   auto viewChannels = reader->GetView<std::vector<std::int32_t>>("channels");
+   for (int i = 0; i < 1000; ++i) {
+      const auto &channels = viewChannels(i);
+      ASSERT_EQ(static_cast<std::size_t>(i % 11), channels.size());
+      for (int j = 0; j < i % 11; ++j)
+         EXPECT_EQ(100000 + 3 * j - (i % 4), channels[j]);
+   }
+}
+
+TEST(Packing, LossyRealColumns)
+{
+   FileRaii fileGuard("test_ntuple_packing_lossy.root");
+
+   auto model = RNTupleModel::Create();
+   auto fldPt = std::make_unique<RField<float>>("pt");
+   fldPt->SetTruncated(16);
+   model->AddField(std::move(fldPt));
+   auto fldEta = std::make_unique<RField<double>>("eta");
+   fldEta->SetQuantized(-5.0, 5.0, 20);
+   model->AddField(std::move(fldEta));
+   auto fldPhi = std::make_unique<RField<float>>("phi");
+   EXPECT_THROW(fldPhi->SetTruncated(40), RException);
+   EXPECT_THROW(fldPhi->SetQuantized(1.0, 0.0, 8), RException);
+   model->AddField(std::move(fldPhi));
+   {
+      auto writer = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuard.GetPath());
+      auto entry = writer->GetModel()->GetDefaultEntry();
+      for (int i = 0; i < 1000; ++i) {
+         *entry->Get<float>("pt") = 1.0f + i * 0.731f;
+         *entry->Get<double>("eta") = -5.0 + i * 0.01;
+         *entry->Get<float>("phi") = i * 0.001f;
+         writer->Fill();
+      }
+   }
+
+   auto reader = RNTupleReader::Open("ntuple", fileGuard.GetPath());
+   {
+      auto desc = reader->GetDescriptor();
+      const auto &ptModel =
+         desc->GetColumnDescriptor(desc->FindLogicalColumnId(desc->FindFieldId("pt"), 0)).GetModel();
+      EXPECT_EQ(EColumnType::kReal32Trunc, ptModel.GetType());
+      EXPECT_EQ(16U, ptModel.GetBitsOnStorage());
+      EXPECT_FALSE(ptModel.GetValueRange());
+      const auto &etaModel =
+         desc->GetColumnDescriptor(desc->FindLogicalColumnId(desc->FindFieldId("eta"), 0)).GetModel();
+      EXPECT_EQ(EColumnType::kReal32Quant, etaModel.GetType());
+      EXPECT_EQ(20U, etaModel.GetBitsOnStorage());
+      ASSERT_TRUE(etaModel.GetValueRange());
+      EXPECT_EQ(-5.0, etaModel.GetValueRange()->first);
+      EXPECT_EQ(5.0, etaModel.GetValueRange()->second);
+   }
+
+   ASSERT_EQ(1000U, reader->GetNEntries());
+   auto viewPt = reader->GetView<float>("pt");
+   auto viewEta = reader->GetView<double>("eta");
+   auto viewPhi = reader->GetView<float>("phi");
+   for (int i = 0; i < 1000; ++i) {
+      const float pt = 1.0f + i * 0.731f;
+      EXPECT_NEAR(pt, viewPt(i), pt / 128.);
+      EXPECT_NEAR(-5.0 + i * 0.01, viewEta(i), 10.0 / ((1 << 20) - 1));
+      EXPECT_FLOAT_EQ(i * 0.001f, viewPhi(i));
+   }
+}
+
+TEST(Packing, QuantizedOutOfRange)
+{
+   FileRaii fileGuard("test_ntuple_packing_quantized_out_of_range.root");
+
+   auto model = RNTupleModel::Create();
+   auto fldEta = std::make_unique<RField<double>>("eta");
+   fldEta->SetQuantized(-5.0, 5.0, 20);
+   model->AddField(std::move(fldEta));
+   {
+      auto writer = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuard.GetPath());
+      auto eta = writer->GetModel()->GetDefaultEntry()->Get<double>("eta");
+      *eta = 1.0;
+      writer->Fill();
+      // The error is reported by Fill(), not when the page is sealed on commit
+      *eta = 5.5;
+      try {
+         writer->Fill();
+         FAIL() << "filling a value outside of the range of a quantized field should throw";
+      } catch (const RException &err) {
+         EXPECT_THAT(err.what(), testing::HasSubstr("quantized field `eta` outside of the range"));
+      }
+      *eta = std::numeric_limits<double>::quiet_NaN();
+      EXPECT_THROW(writer->Fill(), RException);
+      *eta = -2.0;
+      writer->Fill();
+   }
+
+   auto reader = RNTupleReader::Open("ntuple", fileGuard.GetPath());
+   ASSERT_EQ(2U, reader->GetNEntries());
+   auto viewEta = reader->GetView<double>("eta");
+   EXPECT_NEAR(1.0, viewEta(0), 10.0 / ((1 << 20) - 1));
+   EXPECT_NEAR(-2.0, viewEta(1), 10.0 / ((1 << 20) - 1));
+}
+
+TEST(Packing, ValueStatistics)
+{
+   RValueStatistics statistics;
+   float values[] = {1.5f, std::numeric_limits<float>::quiet_NaN(), -3.25f, 2.0f};
+   ROOT::Experimental::Detail::RColumnElement<float, EColumnType::kReal32> elementReal32;
+   EXPECT_TRUE(elementReal32.GetValueStatistics(values, 4, statistics));
+   EXPECT_EQ((RValueStatistics{-3.25, 2.0, 1}), statistics);
+   EXPECT_TRUE(elementReal32.GetValueStatistics(&values[1], 1, statistics));
+   EXPECT_FALSE(statistics.HasRange());
+   EXPECT_EQ(1U, statistics.fNNaN);
+
+   // The range refers to the values on storage
+   ROOT::Experimental::Detail::RColumnElement<float, EColumnType::kReal32Trunc> elementTrunc;
+   elementTrunc.SetBitsOnStorage(10);
+   float truncValues[] = {1.9f, 3.9f};
+   EXPECT_TRUE(elementTrunc.GetValueStatistics(truncValues, 2, statistics));
+   EXPECT_EQ((RValueStatistics{1.5, 3.0, 0}), statistics);
+
+   std::int64_t intValues[] = {42, -7, 13};
+   ROOT::Experimental::Detail::RColumnElement<std::int64_t, EColumnType::kSplitInt64> elementInt64;
+   EXPECT_TRUE(elementInt64.GetValueStatistics(intValues, 3, statistics));
+   EXPECT_EQ((RValueStatistics{-7.0, 42.0, 0}), statistics);
+
+   ClusterSize_t offsets[] = {ClusterSize_t{1}, ClusterSize_t{2}};
+   ROOT::Experimental::Detail::RColumnElement<ClusterSize_t, EColumnType::kSplitIndex64> elementIndex;
+   EXPECT_FALSE(elementIndex.GetValueStatistics(offsets, 2, statistics));
+
+   FileRaii fileGuard("test_ntuple_packing_statistics.root");
+   {
+      auto model = RNTupleModel::Create();
+      auto fldPt = model->MakeField<float>("pt");
+      auto fldJets = model->MakeField<std::vector<float>>("jets");
+      auto fldTag = model->MakeField<std::string>("tag");
+      RNTupleWriteOptions options;
+      options.SetApproxUnzippedPageSize(64);
+      options.SetHasPageStatistics(true);
+      auto writer = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuard.GetPath(), options);
+      for (int i = 0; i < 200; ++i) {
+         *fldPt = (i < 100) ? i : -i;
+         *fldJets = std::vector<float>(i % 3, 0.5f * i);
+         *fldTag = "abc";
+         writer->Fill();
+         if (i == 99)
+            writer->CommitCluster();
+      }
+   }
+
+   auto reader = RNTupleReader::Open("ntuple", fileGuard.GetPath());
+   auto desc = reader->GetDescriptor();
+   ASSERT_EQ(2U, desc->GetNClusters());
+   const auto ptColumnId = desc->FindPhysicalColumnId(desc->FindFieldId("pt"), 0);
+   const auto jetsColumnId = desc->FindPhysicalColumnId(desc->FindFieldId("jets"), 0);
+   const auto jetItemsColumnId = desc->FindPhysicalColumnId(desc->FindFieldId("_0", desc->FindFieldId("jets")), 0);
+   const auto tagCharsColumnId = desc->FindPhysicalColumnId(desc->FindFieldId("tag"), 1);
+
+   const auto &cluster0 = desc->GetClusterDescriptor(desc->FindClusterId(ptColumnId, 0));
+   const auto &cluster1 = desc->GetClusterDescriptor(desc->FindClusterId(ptColumnId, 100));
+   ASSERT_TRUE(cluster0.GetColumnRange(ptColumnId).fStatistics);
+   EXPECT_EQ((RValueStatistics{0.0, 99.0, 0}), *cluster0.GetColumnRange(ptColumnId).fStatistics);
+   EXPECT_EQ((RValueStatistics{-199.0, -100.0, 0}), *cluster1.GetColumnRange(ptColumnId).fStatistics);
+   EXPECT_EQ((RValueStatistics{0.5, 49.0, 0}), *cluster0.GetColumnRange(jetItemsColumnId).fStatistics);
+   EXPECT_FALSE(cluster0.GetColumnRange(jetsColumnId).fStatistics);
+   EXPECT_FALSE(cluster0.GetColumnRange(tagCharsColumnId).fStatistics);
+
+   const auto &pageInfos = cluster0.GetPageRange(ptColumnId).fPageInfos;
+   ASSERT_GT(pageInfos.size(), 1U);
+   EXPECT_EQ((RValueStatistics{0.0, pageInfos[0].fNElements - 1.0, 0}), *pageInfos[0].fStatistics);
+}
+
+TEST(Packing, SIMDKernels)
+{
+   using ROOT::Experimental::Internal::EColumnElementSIMDLevel;
+   using ROOT::Experimental::Internal::GetMaxColumnElementSIMDLevel;
+   using ROOT::Experimental::Internal::SetColumnElementSIMDLevel;
+
+   // Every supported level must produce exactly the output of the scalar kernels, including the remainders of the
+   // vector widths
+   const std::size_t counts[] = {0, 1, 15, 16, 17, 33, 64, 65, 1000};
+   std::vector<unsigned char> bytes(8 * 1000);
+   for (std::size_t i = 0; i < bytes.size(); ++i)
+      bytes[i] = static_cast<unsigned char>((i * 7919) >> 3);
+   std::vector<float> floats(1000);
+   for (std::size_t i = 0; i < floats.size(); ++i)
+      floats[i] = (i % 2 ? -1.f : 1.f) * i * 3.14159f;
+   bool bools[1000];
+   for (std::size_t i = 0; i < 1000; ++i)
+      bools[i] = (i % 3 == 0) || (i % 7 == 0);
+
+   const auto maxLevel = static_cast<int>(GetMaxColumnElementSIMDLevel());
+   for (int level = 0; level <= maxLevel; ++level) {
+      for (auto count : counts) {
+         for (std::size_t N : {2, 4, 8}) {
+            std::vector<unsigned char> expected(N * count), split(N * count), unsplit(N * count);
+            SetColumnElementSIMDLevel(EColumnElementSIMDLevel::kScalar);
+            ROOT::Experimental::Internal::SplitBytes(expected.data(), bytes.data(), count, N);
+            SetColumnElementSIMDLevel(static_cast<EColumnElementSIMDLevel>(level));
+            ROOT::Experimental::Internal::SplitBytes(split.data(), bytes.data(), count, N);
+            EXPECT_EQ(expected, split) << "level " << level << ", count " << count << ", element size " << N;
+            ROOT::Experimental::Internal::UnsplitBytes(unsplit.data(), split.data(), count, N);
+            EXPECT_EQ(0, memcmp(bytes.data(), unsplit.data(), N * count));
+         }
+
+         std::vector<unsigned char> expectedBits((count + 7) / 8), bits((count + 7) / 8);
+         SetColumnElementSIMDLevel(EColumnElementSIMDLevel::kScalar);
+         ROOT::Experimental::Internal::PackBits(expectedBits.data(), bools, count);
+         SetColumnElementSIMDLevel(static_cast<EColumnElementSIMDLevel>(level));
+         ROOT::Experimental::Internal::PackBits(bits.data(), bools, count);
+         EXPECT_EQ(expectedBits, bits) << "level " << level << ", count " << count;
+         bool unpackedBools[1000];
+         ROOT::Experimental::Internal::UnpackBits(unpackedBools, bits.data(), count);
+         for (std::size_t i = 0; i < count; ++i)
+            EXPECT_EQ(bools[i], unpackedBools[i]);
+
+         std::vector<std::uint16_t> expectedHalves(count), halves(count);
+         SetColumnElementSIMDLevel(EColumnElementSIMDLevel::kScalar);
+         ROOT::Experimental::Internal::TruncateFloatsTo16Bits(expectedHalves.data(), floats.data(), count);
+         SetColumnElementSIMDLevel(static_cast<EColumnElementSIMDLevel>(level));
+         ROOT::Experimental::Internal::TruncateFloatsTo16Bits(halves.data(), floats.data(), count);
+         EXPECT_EQ(expectedHalves, halves) << "level " << level << ", count " << count;
+         std::vector<float> expanded(count);
+         ROOT::Experimental::Internal::ExpandFloatsFrom16Bits(expanded.data(), halves.data(), count);
+         for (std::size_t i = 0; i < count; ++i) {
+            std::uint32_t bitsIn, bitsOut;
+            memcpy(&bitsIn, &floats[i], sizeof(bitsIn));
+            memcpy(&bitsOut, &expanded[i], sizeof(bitsOut));
+            EXPECT_EQ(bitsIn & 0xffff0000, bitsOut);
+         }
+
+         for (std::size_t width : {1, 7, 17, 32, 33, 56, 57, 64}) {
+            const std::uint64_t mask = (width == 64) ? ~std::uint64_t(0) : ((std::uint64_t(1) << width) - 1);
+            std::vector<std::uint64_t> values(count);
+            for (std::size_t i = 0; i < count; ++i)
+               values[i] = (i * 0x9E3779B97F4A7C15ull) & mask;
+            std::vector<unsigned char> expectedStream((count * width + 7) / 8), stream((count * width + 7) / 8);
+            SetColumnElementSIMDLevel(EColumnElementSIMDLevel::kScalar);
+            ROOT::Experimental::Internal::PackBitStream(expectedStream.data(), values.data(), count, width);
+            SetColumnElementSIMDLevel(static_cast<EColumnElementSIMDLevel>(level));
+            ROOT::Experimental::Internal::PackBitStream(stream.data(), values.data(), count, width);
+            EXPECT_EQ(expectedStream, stream) << "level " << level << ", count " << count << ", width " << width;
+            std::vector<std::uint64_t> unpackedValues(count);
+            ROOT::Experimental::Internal::UnpackBitStream(unpackedValues.data(), stream.data(), count, width);
+            EXPECT_EQ(values, unpackedValues) << "level " << level << ", count " << count << ", width " << width;
+         }
+      }
+   }
+   SetColumnElementSIMDLevel(static_cast<EColumnElementSIMDLevel>(maxLevel));
+   EXPECT_EQ(static_cast<EColumnElementSIMDLevel>(maxLevel), ROOT::Experimental::Internal::GetColumnElementSIMDLevel());
+}
@@ -0,0 +1,137 @@
+#include "ntuple_test.hxx"
+
+TEST(RNTupleParallelWriter, Basics)
+{
+   FileRaii fileGuard("test_ntuple_parallel_basics.root");
+
+   {
+      auto model = RNTupleModel::CreateBare();
+      model->MakeField<float>("pt");
+      auto writer = RNTupleParallelWriter::Recreate(std::move(model), "f", fileGuard.GetPath());
+
+      auto fillContext = writer->CreateFillContext();
+      auto entry = fillContext->CreateEntry();
+      *entry->Get<float>("pt") = 1.0;
+      fillContext->Fill(*entry);
+      *entry->Get<float>("pt") = 2.0;
+      fillContext->Fill(*entry);
+      EXPECT_EQ(2, fillContext->GetNEntries());
+   }
+
+   auto reader = RNTupleReader::Open("f", fileGuard.GetPath());
+   EXPECT_EQ(2, reader->GetNEntries());
+   EXPECT_EQ(1, reader->GetDescriptor()->GetNClusters());
+   auto viewPt = reader->GetView<float>("pt");
+   EXPECT_FLOAT_EQ(1.0, viewPt(0));
+   EXPECT_FLOAT_EQ(2.0, viewPt(1));
+}
+
+TEST(RNTupleParallelWriter, NoEntries)
+{
+   FileRaii fileGuard("test_ntuple_parallel_empty.root");
+
+   {
+      auto model = RNTupleModel::CreateBare();
+      model->MakeField<float>("pt");
+      auto writer = RNTupleParallelWriter::Recreate(std::move(model), "f", fileGuard.GetPath());
+      auto fillContext = writer->CreateFillContext();
+   }
+
+   auto reader = RNTupleReader::Open("f", fileGuard.GetPath());
+   EXPECT_EQ(0, reader->GetNEntries());
+}
+
+TEST(RNTupleParallelWriter, Options)
+{
+   FileRaii fileGuard("test_ntuple_parallel_options.root");
+
+   auto model = RNTupleModel::CreateBare();
+   RNTupleWriteOptions options;
+   options.SetUseBufferedWrite(false);
+   EXPECT_THROW(RNTupleParallelWriter::Recreate(std::move(model), "f", fileGuard.GetPath(), options), RException);
+}
+
+TEST(RNTupleParallelWriter, Staged)
+{
+   FileRaii fileGuard("test_ntuple_parallel_staged.root");
+
+   {
+      auto model = RNTupleModel::CreateBare();
+      model->MakeField<std::vector<float>>("vec");
+      auto writer = RNTupleParallelWriter::Recreate(std::move(model), "f", fileGuard.GetPath());
+
+      // Two fill contexts that commit their clusters in an interleaved order
+      auto c1 = writer->CreateFillContext();
+      auto c2 = writer->CreateFillContext();
+      auto e1 = c1->CreateEntry();
+      auto e2 = c2->CreateEntry();
+
+      *e1->Get<std::vector<float>>("vec") = {1.0};
+      c1->Fill(*e1);
+      *e2->Get<std::vector<float>>("vec") = {2.0, 2.0};
+      c2->Fill(*e2);
+      c2->Fill(*e2);
+      c2->CommitCluster();
+      c1->CommitCluster();
+      EXPECT_EQ(1, c1->GetLastCommitted());
+      EXPECT_EQ(2, c2->GetLastCommitted());
+   }
+
+   auto reader = RNTupleReader::Open("f", fileGuard.GetPath());
+   EXPECT_EQ(3, reader->GetNEntries());
+   EXPECT_EQ(2, reader->GetDescriptor()->GetNClusters());
+   auto viewVec = reader->GetView<std::vector<float>>("vec");
+   EXPECT_EQ(std::vector<float>({2.0, 2.0}), viewVec(0));
+   EXPECT_EQ(std::vector<float>({2.0, 2.0}), viewVec(1));
+   EXPECT_EQ(std::vector<float>({1.0}), viewVec(2));
+}
+
+TEST(RNTupleParallelWriter, Threads)
+{
+   FileRaii fileGuard("test_ntuple_parallel_threads.root");
+
+   static constexpr int kNThreads = 4;
+   static constexpr int kNEntriesPerThread = 10000;
+   {
+      auto model = RNTupleModel::CreateBare();
+      model->MakeField<std::uint32_t>("id");
+      model->MakeField<std::vector<std::uint32_t>>("vec");
+      RNTupleWriteOptions options;
+      options.SetApproxZippedClusterSize(8 * 1024);
+      auto writer = RNTupleParallelWriter::Recreate(std::move(model), "f", fileGuard.GetPath(), options);
+
+      std::vector<std::thread> threads;
+      for (int t = 0; t < kNThreads; ++t) {
+         threads.emplace_back([&writer, t]() {
+            auto fillContext = writer->CreateFillContext();
+            auto entry = fillContext->CreateEntry();
+            auto id = entry->Get<std::uint32_t>("id");
+            auto vec = entry->Get<std::vector<std::uint32_t>>("vec");
+            for (int i = 0; i < kNEntriesPerThread; ++i) {
+               *id = t;
+               *vec = std::vector<std::uint32_t>(i % 5, t);
+               fillContext->Fill(*entry);
+            }
+         });
+      }
+      for (auto &thread : threads)
+         thread.join();
+   }
+
+   auto reader = RNTupleReader::Open("f", fileGuard.GetPath());
+   EXPECT_EQ(kNThreads * kNEntriesPerThread, reader->GetNEntries());
+   EXPECT_GT(reader->GetDescriptor()->GetNClusters(), static_cast<std::size_t>(kNThreads));
+
+   // The order of entries depends on the order of cluster commits but every cluster comes from a single thread
+   auto viewId = reader->GetView<std::uint32_t>("id");
+   auto viewVec = reader->GetView<std::vector<std::uint32_t>>("vec");
+   std::array<int, kNThreads> nEntries{};
+   for (auto i : reader->GetEntryRange()) {
+      auto id = viewId(i);
+      ASSERT_LT(id, static_cast<std::uint32_t>(kNThreads));
+      EXPECT_EQ(std::vector<std::uint32_t>(nEntries[id] % 5, id), viewVec(i));
+      nEntries[id]++;
+   }
+   for (auto n : nEntries)
+      EXPECT_EQ(kNEntriesPerThread, n);
+}
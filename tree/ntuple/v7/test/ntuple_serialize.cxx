@@ -602,7 +602,8 @@ TEST(RNTuple, SerializeFooter)
    EXPECT_EQ(42u, clusterGroupDesc.GetPageListLocator().fBytesOnStorage);
 
    std::vector<RClusterDescriptorBuilder> clusters = RClusterGroupDescriptorBuilder::GetClusterSummaries(desc, 0);
-   RNTupleSerializer::DeserializePageListV1(bufPageList.get(), sizePageList, clusters);
+   EXPECT_FALSE(desc.HasPageStatistics());
+   RNTupleSerializer::DeserializePageListV1(bufPageList.get(), sizePageList, clusters, desc.HasPageStatistics());
    EXPECT_EQ(physClusterIDs.size(), clusters.size());
    for (std::size_t i = 0; i < clusters.size(); ++i) {
       desc.AddClusterDetails(clusters[i].MoveDescriptor().Unwrap());
@@ -624,6 +625,153 @@ TEST(RNTuple, SerializeFooter)
    EXPECT_EQ(7000u, pageRange.fPageInfos[0].fLocator.GetPosition<std::uint64_t>());
 }
 
+TEST(RNTuple, SerializePageStatistics)
+{
+   RNTupleDescriptorBuilder builder;
+   builder.SetNTuple("ntpl", "");
+   builder.SetHasPageStatistics(true);
+   builder.AddField(
+      RFieldDescriptorBuilder().FieldId(0).FieldName("").Structure(ENTupleStructure::kRecord).MakeDescriptor().Unwrap());
+   builder.AddField(
+      RFieldDescriptorBuilder().FieldId(1).FieldName("pt").Structure(ENTupleStructure::kLeaf).MakeDescriptor().Unwrap());
+   builder.AddFieldLink(0, 1);
+   builder.AddColumn(0, 0, 1, RColumnModel(EColumnType::kReal32, false), 0);
+   builder.AddField(
+      RFieldDescriptorBuilder().FieldId(2).FieldName("id").Structure(ENTupleStructure::kLeaf).MakeDescriptor().Unwrap());
+   builder.AddFieldLink(0, 2);
+   builder.AddColumn(1, 1, 2, RColumnModel(EColumnType::kInt32, false), 0);
+
+   RClusterDescriptorBuilder clusterBuilder(0, 0, 100);
+   ROOT::Experimental::RClusterDescriptor::RPageRange pageRange;
+   pageRange.fPhysicalColumnId = 0;
+   ROOT::Experimental::RClusterDescriptor::RPageRange::RPageInfo pageInfo;
+   pageInfo.fNElements = 60;
+   pageInfo.fLocator.fPosition = 1000U;
+   pageInfo.fStatistics = RValueStatistics{-1.0, 2.0, 0};
+   pageRange.fPageInfos.emplace_back(pageInfo);
+   pageInfo.fNElements = 40;
+   pageInfo.fLocator.fPosition = 2000U;
+   pageInfo.fStatistics = RValueStatistics{5.0, 7.0, 3};
+   pageRange.fPageInfos.emplace_back(pageInfo);
+   clusterBuilder.CommitColumnRange(0, 0, 0, pageRange);
+   // Pages without statistics, as written by older versions
+   pageRange.fPhysicalColumnId = 1;
+   pageRange.fPageInfos.clear();
+   pageInfo.fNElements = 100;
+   pageInfo.fLocator.fPosition = 3000U;
+   pageInfo.fStatistics.reset();
+   pageRange.fPageInfos.emplace_back(pageInfo);
+   clusterBuilder.CommitColumnRange(1, 0, 0, pageRange);
+   builder.AddClusterWithDetails(clusterBuilder.MoveDescriptor().Unwrap());
+
+   auto desc = builder.MoveDescriptor();
+   const auto &columnRange = desc.GetClusterDescriptor(0).GetColumnRange(0);
+   ASSERT_TRUE(columnRange.fStatistics);
+   EXPECT_EQ((RValueStatistics{-1.0, 7.0, 3}), *columnRange.fStatistics);
+   EXPECT_FALSE(desc.GetClusterDescriptor(0).GetColumnRange(1).fStatistics);
+
+   auto context = RNTupleSerializer::SerializeHeaderV1(nullptr, desc);
+   std::vector<DescriptorId_t> physClusterIDs{context.MapClusterId(0)};
+   auto sizePageList = RNTupleSerializer::SerializePageListV1(nullptr, desc, physClusterIDs, context);
+   auto bufPageList = std::make_unique<unsigned char[]>(sizePageList);
+   EXPECT_EQ(sizePageList, RNTupleSerializer::SerializePageListV1(bufPageList.get(), desc, physClusterIDs, context));
+
+   // The presence of the page statistics is signaled by a footer feature flag
+   auto sizeFooter = RNTupleSerializer::SerializeFooterV1(nullptr, desc, context);
+   auto bufFooter = std::make_unique<unsigned char[]>(sizeFooter);
+   RNTupleSerializer::SerializeFooterV1(bufFooter.get(), desc, context);
+   RNTupleDescriptorBuilder footerBuilder;
+   RNTupleSerializer::DeserializeFooterV1(bufFooter.get(), sizeFooter, footerBuilder).ThrowOnError();
+   EXPECT_TRUE(footerBuilder.GetDescriptor().HasPageStatistics());
+
+   std::vector<RClusterDescriptorBuilder> clusters;
+   clusters.emplace_back(0, 0, 100);
+   RNTupleSerializer::DeserializePageListV1(bufPageList.get(), sizePageList, clusters, true).ThrowOnError();
+   auto clusterDesc = clusters[0].MoveDescriptor().Unwrap();
+   EXPECT_EQ(desc.GetClusterDescriptor(0).GetColumnRange(0), clusterDesc.GetColumnRange(0));
+   EXPECT_EQ(desc.GetClusterDescriptor(0).GetColumnRange(1), clusterDesc.GetColumnRange(1));
+   const auto &pageInfos = clusterDesc.GetPageRange(0).fPageInfos;
+   ASSERT_EQ(2u, pageInfos.size());
+   EXPECT_EQ((RValueStatistics{-1.0, 2.0, 0}), *pageInfos[0].fStatistics);
+   EXPECT_EQ((RValueStatistics{5.0, 7.0, 3}), *pageInfos[1].fStatistics);
+   EXPECT_FALSE(clusterDesc.GetPageRange(1).fPageInfos[0].fStatistics);
+}
+
+TEST(RNTuple, DeserializePageListExtensions)
+{
+   // Builds the page list of one cluster with one column of two pages.  The column frame optionally contains a page
+   // statistics block and the given number of bytes of a future extension of the format.
+   auto fnMakePageList = [](bool withStatistics, std::uint32_t nExtensionBytes) {
+      std::vector<unsigned char> buffer(1024);
+      auto base = buffer.data();
+      auto pos = base;
+      pos += RNTupleSerializer::SerializeEnvelopePreamble(pos);
+      auto topMostFrame = pos;
+      pos += RNTupleSerializer::SerializeListFramePreamble(1, pos);
+      auto outerFrame = pos;
+      pos += RNTupleSerializer::SerializeListFramePreamble(1, pos);
+      auto innerFrame = pos;
+      pos += RNTupleSerializer::SerializeListFramePreamble(2, pos);
+      for (std::uint64_t position : {1000U, 2000U}) {
+         RNTupleLocator locator;
+         locator.fPosition = position;
+         pos += RNTupleSerializer::SerializeUInt32(50, pos);
+         pos += RNTupleSerializer::SerializeLocator(locator, pos);
+      }
+      pos += RNTupleSerializer::SerializeUInt64(0, pos);
+      pos += RNTupleSerializer::SerializeUInt32(0, pos);
+      if (withStatistics) {
+         pos += RNTupleSerializer::SerializeUInt32(2, pos);
+         for (double min : {1.0, 2.0}) {
+            pos += RNTupleSerializer::SerializeDouble(min, pos);
+            pos += RNTupleSerializer::SerializeDouble(min + 1.0, pos);
+            pos += RNTupleSerializer::SerializeUInt64(0, pos);
+         }
+      }
+      std::fill_n(pos, nExtensionBytes, 0x42);
+      pos += nExtensionBytes;
+      RNTupleSerializer::SerializeFramePostscript(innerFrame, pos - innerFrame);
+      RNTupleSerializer::SerializeFramePostscript(outerFrame, pos - outerFrame);
+      RNTupleSerializer::SerializeFramePostscript(topMostFrame, pos - topMostFrame);
+      pos += RNTupleSerializer::SerializeEnvelopePostscript(base, pos - base, pos);
+      buffer.resize(pos - base);
+      return buffer;
+   };
+   auto fnDeserialize = [](const std::vector<unsigned char> &pageList, bool hasPageStatistics) {
+      std::vector<RClusterDescriptorBuilder> clusters;
+      clusters.emplace_back(0, 0, 100);
+      RNTupleSerializer::DeserializePageListV1(pageList.data(), pageList.size(), clusters, hasPageStatistics)
+         .ThrowOnError();
+      return clusters[0].MoveDescriptor().Unwrap();
+   };
+   // The size of the statistics of two pages; older readers guessed the presence of statistics from the frame size
+   constexpr std::uint32_t kExtensionSize = 2 * (2 * sizeof(double) + sizeof(std::uint64_t));
+
+   // Page list written without statistics
+   auto clusterDesc = fnDeserialize(fnMakePageList(false, 0), false);
+   EXPECT_EQ(100u, clusterDesc.GetColumnRange(0).fNElements);
+   EXPECT_FALSE(clusterDesc.GetColumnRange(0).fStatistics);
+   EXPECT_FALSE(clusterDesc.GetPageRange(0).fPageInfos[1].fStatistics);
+
+   // Unknown trailing information must not be taken for statistics
+   clusterDesc = fnDeserialize(fnMakePageList(false, kExtensionSize), false);
+   ASSERT_EQ(2u, clusterDesc.GetPageRange(0).fPageInfos.size());
+   EXPECT_EQ(2000u, clusterDesc.GetPageRange(0).fPageInfos[1].fLocator.GetPosition<std::uint64_t>());
+   EXPECT_FALSE(clusterDesc.GetColumnRange(0).fStatistics);
+   EXPECT_FALSE(clusterDesc.GetPageRange(0).fPageInfos[0].fStatistics);
+
+   clusterDesc = fnDeserialize(fnMakePageList(true, kExtensionSize), true);
+   ASSERT_TRUE(clusterDesc.GetColumnRange(0).fStatistics);
+   EXPECT_EQ((RValueStatistics{1.0, 3.0, 0}), *clusterDesc.GetColumnRange(0).fStatistics);
+   EXPECT_EQ((RValueStatistics{2.0, 3.0, 0}), *clusterDesc.GetPageRange(0).fPageInfos[1].fStatistics);
+
+   // If the footer announces statistics, the statistics block must be present
+   std::vector<RClusterDescriptorBuilder> clusters;
+   clusters.emplace_back(0, 0, 100);
+   auto pageList = fnMakePageList(false, 0);
+   EXPECT_FALSE(RNTupleSerializer::DeserializePageListV1(pageList.data(), pageList.size(), clusters, true));
+}
+
 TEST(RNTuple, SerializeFooterXHeader)
 {
    RNTupleDescriptorBuilder builder;
@@ -450,6 +450,27 @@ TEST(RPageSinkBuf, CommitSealedPageV)
       EXPECT_EQ(0, counters.fNCommitSealedPage);
       EXPECT_EQ(0, counters.fNCommitSealedPageV);
    }
+   {
+      auto eagerOptions = options.Clone();
+      eagerOptions->SetSealPagesEagerly(true);
+      std::unique_ptr<RPageSink> sink(new RPageSinkMock(*eagerOptions));
+      auto &counters = static_cast<RPageSinkMock *>(sink.get())->fCounters;
+
+      auto model = RNTupleModel::Create();
+      auto u64Field = model->MakeField<std::uint64_t>("u64");
+      auto u32Field = model->MakeField<std::uint16_t>("u32");
+      auto strField = model->MakeField<std::string>("str");
+      auto ntuple = std::make_unique<RNTupleWriter>(std::move(model), std::make_unique<RPageSinkBuf>(std::move(sink)));
+      ntuple->Fill();
+      ntuple->Fill();
+      ntuple->Fill();
+      ntuple->CommitCluster();
+      // Parallel zip not available but eager sealing requested; the pages are sealed by the calling thread and
+      // committed in a single call
+      EXPECT_EQ(0, counters.fNCommitPage);
+      EXPECT_EQ(0, counters.fNCommitSealedPage);
+      EXPECT_EQ(1, counters.fNCommitSealedPageV);
+   }
 #ifdef R__USE_IMT
    ROOT::EnableImplicitMT();
 #endif
@@ -477,6 +498,114 @@ TEST(RPageSinkBuf, CommitSealedPageV)
    }
 }
 
+TEST(RPageSinkBuf, PageBufferBudget)
+{
+   FileRaii fileGuard("test_ntuple_page_buffer_budget.root");
+
+   RNTupleWriteOptions options;
+   options.SetCompression(0);
+   options.SetApproxUnzippedPageSize(4096);
+   options.SetPageBufferBudget(64 * 1024);
+   {
+      // With eager sealing, every batch is committed as a vector of sealed pages
+      auto eagerOptions = options.Clone();
+      eagerOptions->SetSealPagesEagerly(true);
+      std::unique_ptr<RPageSink> sink(new RPageSinkMock(*eagerOptions));
+      auto &counters = static_cast<RPageSinkMock *>(sink.get())->fCounters;
+
+      auto model = RNTupleModel::Create();
+      auto wrPt = model->MakeField<float>("pt");
+      auto ntuple = std::make_unique<RNTupleWriter>(std::move(model), std::make_unique<RPageSinkBuf>(std::move(sink)));
+      for (int i = 0; i < 100000; ++i) {
+         *wrPt = i;
+         ntuple->Fill();
+      }
+      ntuple->CommitCluster();
+      // 400kB of data in a single cluster are committed in several batches
+      EXPECT_GT(counters.fNCommitSealedPageV, 5U);
+      EXPECT_EQ(0U, counters.fNCommitPage);
+   }
+
+   {
+      auto model = RNTupleModel::Create();
+      auto wrPt = model->MakeField<float>("pt");
+      auto wrVec = model->MakeField<std::vector<std::int32_t>>("vec");
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntpl", fileGuard.GetPath(), options);
+      ntuple->EnableMetrics();
+      for (int i = 0; i < 100000; ++i) {
+         *wrPt = i;
+         *wrVec = std::vector<std::int32_t>(i % 4, i);
+         ntuple->Fill();
+         if (i == 59999)
+            ntuple->CommitCluster();
+      }
+      ntuple->CommitCluster();
+
+      const auto &metrics = ntuple->GetMetrics();
+      EXPECT_GT(metrics.GetCounter("RNTupleWriter.RPageSinkBuf.nPartialCommit")->GetValueAsInt(), 0);
+      // The budget can be exceeded by at most one page and its compression buffer
+      EXPECT_LE(metrics.GetCounter("RNTupleWriter.RPageSinkBuf.szBufferedPeak")->GetValueAsInt(),
+                64 * 1024 + 4 * 4096);
+   }
+
+   auto ntuple = RNTupleReader::Open("ntpl", fileGuard.GetPath());
+   EXPECT_EQ(100000U, ntuple->GetNEntries());
+   EXPECT_EQ(2U, ntuple->GetDescriptor()->GetNClusters());
+   auto viewPt = ntuple->GetView<float>("pt");
+   auto viewVec = ntuple->GetView<std::vector<std::int32_t>>("vec");
+   for (auto i : ntuple->GetEntryRange()) {
+      EXPECT_FLOAT_EQ(i, viewPt(i));
+      const auto &vec = viewVec(i);
+      ASSERT_EQ(i % 4, vec.size());
+      for (auto v : vec)
+         EXPECT_EQ(static_cast<std::int32_t>(i), v);
+   }
+}
+
+TEST(RPageSinkBuf, AdaptivePageSize)
+{
+   FileRaii fileGuard("test_ntuple_adaptive_page_size.root");
+
+   RNTupleWriteOptions options;
+   options.SetApproxUnzippedPageSize(4096);
+   options.SetApproxZippedPageSize(4096);
+   {
+      auto model = RNTupleModel::Create();
+      auto wrFlag = model->MakeField<bool>("flag");
+      auto wrPt = model->MakeField<float>("pt");
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntpl", fileGuard.GetPath(), options);
+      for (int i = 0; i < 200000; ++i) {
+         *wrFlag = (i % 2) == 0;
+         *wrPt = i;
+         ntuple->Fill();
+         if (i % 50000 == 49999)
+            ntuple->CommitCluster();
+      }
+   }
+
+   auto ntuple = RNTupleReader::Open("ntpl", fileGuard.GetPath());
+   const auto &desc = *ntuple->GetDescriptor();
+   EXPECT_EQ(4U, desc.GetNClusters());
+   const auto flagColumnId = desc.FindPhysicalColumnId(desc.FindFieldId("flag"), 0);
+   const auto firstClusterId = desc.FindClusterId(flagColumnId, 0);
+   const auto lastClusterId = desc.FindClusterId(flagColumnId, 199999);
+   const auto &firstPages = desc.GetClusterDescriptor(firstClusterId).GetPageRange(flagColumnId).fPageInfos;
+   const auto &lastPages = desc.GetClusterDescriptor(lastClusterId).GetPageRange(flagColumnId).fPageInfos;
+   // The first cluster uses the initial page size; afterwards, pages of the well-compressible bit column grow
+   EXPECT_LE(firstPages[0].fNElements, 4096U);
+   EXPECT_GT(lastPages[0].fNElements, 4096U);
+   EXPECT_LT(lastPages.size(), firstPages.size());
+
+   auto viewFlag = ntuple->GetView<bool>("flag");
+   auto viewPt = ntuple->GetView<float>("pt");
+   for (auto i : ntuple->GetEntryRange()) {
+      EXPECT_EQ((i % 2) == 0, viewFlag(i));
+      EXPECT_FLOAT_EQ(i, viewPt(i));
+   }
+
+   EXPECT_THROW(options.SetMaxUnzippedPageSize(1024), RException);
+}
+
 TEST(RPageSink, Empty)
 {
    FileRaii fileGuard("test_ntuple_empty.ntuple");
@@ -528,3 +657,192 @@ TEST(RPageSink, MultipleClusterGroups)
    ntuple->LoadEntry(2);
    EXPECT_EQ(12.0, *rdPt);
 }
+
+TEST(RPageSourceFile, SharedPageCache)
+{
+   FileRaii fileGuard("test_ntuple_shared_page_cache.root");
+   {
+      auto model = RNTupleModel::Create();
+      auto wrPt = model->MakeField<float>("pt");
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntpl", fileGuard.GetPath());
+      for (int i = 0; i < 100; ++i) {
+         *wrPt = i;
+         ntuple->Fill();
+         if (i % 25 == 24)
+            ntuple->CommitCluster();
+      }
+   }
+
+   auto &cache = RSharedPageCache::Get();
+   cache.Clear();
+   RNTupleReadOptions options;
+   options.SetUseSharedPageCache(true);
+
+   auto nMisses = cache.GetNMisses();
+   auto nHits = cache.GetNHits();
+   {
+      auto ntuple = RNTupleReader::Open("ntpl", fileGuard.GetPath(), options);
+      auto viewPt = ntuple->GetView<float>("pt");
+      for (auto i : ntuple->GetEntryRange())
+         EXPECT_FLOAT_EQ(i, viewPt(i));
+   }
+   EXPECT_EQ(4U, cache.GetNMisses() - nMisses);
+   EXPECT_EQ(nHits, cache.GetNHits());
+   EXPECT_GT(cache.GetNBytes(), 0U);
+
+   // A second reader of the same ntuple finds all the pages in the cache
+   nMisses = cache.GetNMisses();
+   {
+      auto ntuple = RNTupleReader::Open("ntpl", fileGuard.GetPath(), options);
+      auto viewPt = ntuple->GetView<float>("pt");
+      for (auto i : ntuple->GetEntryRange())
+         EXPECT_FLOAT_EQ(i, viewPt(i));
+   }
+   EXPECT_EQ(nMisses, cache.GetNMisses());
+   EXPECT_EQ(4U, cache.GetNHits() - nHits);
+
+   // Shrinking the cache evicts the pages; reading continues to work
+   const auto maxBytes = cache.GetMaxBytes();
+   cache.SetMaxBytes(0);
+   EXPECT_EQ(0U, cache.GetNBytes());
+   {
+      auto ntuple = RNTupleReader::Open("ntpl", fileGuard.GetPath(), options);
+      auto viewPt = ntuple->GetView<float>("pt");
+      for (auto i : ntuple->GetEntryRange())
+         EXPECT_FLOAT_EQ(i, viewPt(i));
+   }
+   EXPECT_EQ(0U, cache.GetNBytes());
+   cache.SetMaxBytes(maxBytes);
+}
+
+TEST(RPageSourceFile, Mmap)
+{
+   FileRaii fileGuard("test_ntuple_mmap.root");
+   {
+      auto model = RNTupleModel::Create();
+      auto wrEnergy = model->MakeField<double>("energy");
+      auto wrTag = model->MakeField<std::string>("tag");
+      RNTupleWriteOptions options;
+      options.SetCompression(0);
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntpl", fileGuard.GetPath(), options);
+      for (int i = 0; i < 1000; ++i) {
+         *wrEnergy = i;
+         *wrTag = std::to_string(i);
+         ntuple->Fill();
+         if (i % 250 == 249)
+            ntuple->CommitCluster();
+      }
+   }
+
+   for (auto clusterCache : {RNTupleReadOptions::EClusterCache::kOn, RNTupleReadOptions::EClusterCache::kOff}) {
+      RNTupleReadOptions options;
+      options.SetUseMmap(true);
+      options.SetClusterCache(clusterCache);
+      auto ntuple = RNTupleReader::Open("ntpl", fileGuard.GetPath(), options);
+      ntuple->EnableMetrics();
+      auto viewEnergy = ntuple->GetView<double>("energy");
+      auto viewTag = ntuple->GetView<std::string>("tag");
+      for (auto i : ntuple->GetEntryRange()) {
+         EXPECT_DOUBLE_EQ(i, viewEnergy(i));
+         EXPECT_EQ(std::to_string(i), viewTag(i));
+      }
+      // All the pages are taken from the mapping
+      EXPECT_EQ(0, ntuple->GetMetrics().GetCounter("RNTupleReader.RPageSourceFile.nRead")->GetValueAsInt());
+      EXPECT_EQ(0, ntuple->GetMetrics().GetCounter("RNTupleReader.RPageSourceFile.nReadV")->GetValueAsInt());
+      EXPECT_GT(ntuple->GetMetrics().GetCounter("RNTupleReader.RPageSourceFile.nPageLoaded")->GetValueAsInt(), 0);
+   }
+}
+
+TEST(RPageSourceFile, ReadCounters)
+{
+   FileRaii fileGuard("test_ntuple_read_counters.root");
+   {
+      auto model = RNTupleModel::Create();
+      auto wrPt = model->MakeField<float>("pt");
+      RNTupleWriteOptions options;
+      options.SetCompression(0);
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntpl", fileGuard.GetPath(), options);
+      for (int i = 0; i < 300; ++i) {
+         *wrPt = i;
+         ntuple->Fill();
+         if (i % 100 == 99)
+            ntuple->CommitCluster();
+      }
+   }
+
+   RPageSourceFile source("ntpl", fileGuard.GetPath(), RNTupleReadOptions());
+   source.Attach();
+   source.GetMetrics().Enable();
+   DescriptorId_t colId;
+   {
+      auto descriptorGuard = source.GetSharedDescriptorGuard();
+      colId = descriptorGuard->FindPhysicalColumnId(descriptorGuard->FindFieldId("pt"), 0);
+   }
+   auto fnGetCounter = [&source](const std::string &name) {
+      return source.GetMetrics().GetCounter("RPageSourceFile." + name)->GetValueAsInt();
+   };
+
+   // Two clusters are loaded by a single vector read
+   std::vector<ROOT::Experimental::Detail::RCluster::RKey> clusterKeys{{0, {colId}}, {1, {colId}}};
+   auto clusters = source.LoadClusters(clusterKeys);
+   EXPECT_EQ(2, fnGetCounter("nClusterLoaded"));
+   EXPECT_EQ(1, fnGetCounter("nReadV"));
+   EXPECT_EQ(2, fnGetCounter("nRead"));
+   EXPECT_EQ(2, fnGetCounter("nPageLoaded"));
+
+   // A cluster without any pages to load issues no read
+   clusterKeys = {{2, {}}};
+   clusters = source.LoadClusters(clusterKeys);
+   EXPECT_EQ(3, fnGetCounter("nClusterLoaded"));
+   EXPECT_EQ(1, fnGetCounter("nReadV"));
+   EXPECT_EQ(2, fnGetCounter("nRead"));
+
+   // Without the cluster cache, the pages are read one by one
+   RNTupleReadOptions options;
+   options.SetClusterCache(RNTupleReadOptions::EClusterCache::kOff);
+   auto ntuple = RNTupleReader::Open("ntpl", fileGuard.GetPath(), options);
+   ntuple->EnableMetrics();
+   auto viewPt = ntuple->GetView<float>("pt");
+   for (auto i : ntuple->GetEntryRange())
+      EXPECT_FLOAT_EQ(i, viewPt(i));
+   const auto &metrics = ntuple->GetMetrics();
+   EXPECT_EQ(0, metrics.GetCounter("RNTupleReader.RPageSourceFile.nReadV")->GetValueAsInt());
+   EXPECT_EQ(3, metrics.GetCounter("RNTupleReader.RPageSourceFile.nRead")->GetValueAsInt());
+   EXPECT_EQ(3, metrics.GetCounter("RNTupleReader.RPageSourceFile.nPageLoaded")->GetValueAsInt());
+}
+
+TEST(RPageSourceFile, CloneAttached)
+{
+   FileRaii fileGuard("test_ntuple_clone_attached.root");
+   {
+      auto model = RNTupleModel::Create();
+      auto wrPt = model->MakeField<float>("pt");
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntpl", fileGuard.GetPath());
+      for (int i = 0; i < 20; ++i) {
+         *wrPt = i;
+         ntuple->Fill();
+         if (i % 10 == 9)
+            ntuple->CommitCluster();
+      }
+   }
+
+   RPageSourceFile source("ntpl", fileGuard.GetPath(), RNTupleReadOptions());
+   source.Attach();
+   auto clone = source.Clone();
+   // The clone of an attached page source does not read the meta-data again
+   const std::string movedPath = fileGuard.GetPath() + ".moved";
+   ASSERT_EQ(0, std::rename(fileGuard.GetPath().c_str(), movedPath.c_str()));
+   clone->Attach();
+   ASSERT_EQ(0, std::rename(movedPath.c_str(), fileGuard.GetPath().c_str()));
+
+   auto descriptorGuard = source.GetSharedDescriptorGuard();
+   auto cloneGuard = clone->GetSharedDescriptorGuard();
+   EXPECT_EQ(2u, cloneGuard->GetNClusters());
+   EXPECT_EQ(20u, cloneGuard->GetNEntries());
+   const auto colId = cloneGuard->FindPhysicalColumnId(cloneGuard->FindFieldId("pt"), 0);
+   for (const auto &clusterDesc : descriptorGuard->GetClusterIterable()) {
+      const auto &cloneClusterDesc = cloneGuard->GetClusterDescriptor(clusterDesc.GetId());
+      EXPECT_TRUE(cloneClusterDesc.HasPageLocations());
+      EXPECT_EQ(clusterDesc.GetPageRange(colId), cloneClusterDesc.GetPageRange(colId));
+   }
+}
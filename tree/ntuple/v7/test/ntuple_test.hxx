@@ -8,10 +8,13 @@
 #include <ROOT/RMiniFile.hxx>
 #include <ROOT/RNTuple.hxx>
 #include <ROOT/RNTupleDescriptor.hxx>
+#include <ROOT/RNTupleIndex.hxx>
 #include <ROOT/RNTupleMerger.hxx>
 #include <ROOT/RNTupleMetrics.hxx>
 #include <ROOT/RNTupleModel.hxx>
 #include <ROOT/RNTupleOptions.hxx>
+#include <ROOT/RNTupleParallelWriter.hxx>
+#include <ROOT/RNTupleReadProfile.hxx>
 #include <ROOT/RNTupleSerialize.hxx>
 #include <ROOT/RNTupleZip.hxx>
 #include <ROOT/RPageAllocator.hxx>
@@ -21,6 +24,7 @@
 #include <ROOT/RPageStorage.hxx>
 #include <ROOT/RPageStorageFile.hxx>
 #include <ROOT/RRawFile.hxx>
+#include <ROOT/RSharedPageCache.hxx>
 #include <ROOT/TestSupport.hxx>
 
 #include <RZip.h>
@@ -38,6 +42,7 @@
 
 #include "CustomStruct.hxx"
 
+#include <algorithm>
 #include <array>
 #include <chrono>
 #include <cstdio>
@@ -81,13 +86,19 @@ using RNTupleDecompressor = ROOT::Experimental::Detail::RNTupleDecompressor;
 using RNTupleDescriptor = ROOT::Experimental::RNTupleDescriptor;
 using RNTupleDescriptorBuilder = ROOT::Experimental::RNTupleDescriptorBuilder;
 using RNTupleFileWriter = ROOT::Experimental::Internal::RNTupleFileWriter;
+using RNTupleFillContext = ROOT::Experimental::RNTupleFillContext;
+using RNTupleIndex = ROOT::Experimental::RNTupleIndex;
 using RNTupleReader = ROOT::Experimental::RNTupleReader;
 using RNTupleReadOptions = ROOT::Experimental::RNTupleReadOptions;
+using RNTupleReadProfile = ROOT::Experimental::Detail::RNTupleReadProfile;
+using RNTupleReadReport = ROOT::Experimental::Detail::RNTupleReadReport;
 using RNTupleWriter = ROOT::Experimental::RNTupleWriter;
 using RNTupleWriteOptions = ROOT::Experimental::RNTupleWriteOptions;
 using RNTupleWriteOptionsDaos = ROOT::Experimental::RNTupleWriteOptionsDaos;
+using RNTupleMerger = ROOT::Experimental::Internal::RNTupleMerger;
 using RNTupleMetrics = ROOT::Experimental::Detail::RNTupleMetrics;
 using RNTupleModel = ROOT::Experimental::RNTupleModel;
+using RNTupleParallelWriter = ROOT::Experimental::RNTupleParallelWriter;
 using RNTuplePlainCounter = ROOT::Experimental::Detail::RNTuplePlainCounter;
 using RNTuplePlainTimer = ROOT::Experimental::Detail::RNTuplePlainTimer;
 using RNTupleSerializer = ROOT::Experimental::Internal::RNTupleSerializer;
@@ -107,6 +118,8 @@ using RPrintSchemaVisitor = ROOT::Experimental::RPrintSchemaVisitor;
 using RRawFile = ROOT::Internal::RRawFile;
 template <class T>
 using RResult = ROOT::Experimental::RResult<T>;
+using RSharedPageCache = ROOT::Experimental::Detail::RSharedPageCache;
+using RValueStatistics = ROOT::Experimental::RValueStatistics;
 
 /**
  * An RAII wrapper around an open temporary file on disk. It cleans up the guarded file when the wrapper object
@@ -6,8 +6,10 @@
 #include <bitset>
 #include <cstring>
 #include <limits>
+#include <map>
 #include <memory>
 #include <type_traits>
+#include <unordered_map>
 #include <utility>
 
 TEST(RNTuple, TypeName) {
@@ -370,6 +372,115 @@ TEST(RNTuple, StdSet)
    EXPECT_EQ(pairSet, *mySet2);
 }
 
+TEST(RNTuple, StdMap)
+{
+   auto field = RField<std::map<int, float>>("mapField");
+   EXPECT_STREQ("std::map<std::int32_t,float>", field.GetType().c_str());
+   auto otherField = RFieldBase::Create("test", "std::map<int, float>").Unwrap();
+   EXPECT_STREQ(field.GetType().c_str(), otherField->GetType().c_str());
+   EXPECT_EQ((sizeof(std::map<int, float>)), field.GetValueSize());
+   EXPECT_EQ((sizeof(std::map<int, float>)), otherField->GetValueSize());
+   EXPECT_EQ((alignof(std::map<int, float>)), field.GetAlignment());
+   EXPECT_LE((alignof(std::map<int, float>)), otherField->GetAlignment());
+   // Keys and values are stored in the subfields of a std::pair item field
+   auto itemField = field.GetSubFields()[0];
+   EXPECT_STREQ("std::pair<std::int32_t,float>", itemField->GetType().c_str());
+   EXPECT_STREQ("std::pair<std::int32_t,float>", otherField->GetSubFields()[0]->GetType().c_str());
+
+   auto unorderedField = RField<std::unordered_map<std::int64_t, double>>("unorderedMapField");
+   EXPECT_STREQ("std::unordered_map<std::int64_t,double>", unorderedField.GetType().c_str());
+
+   FileRaii fileGuard("test_ntuple_rfield_stdmap.root");
+   {
+      auto model = RNTupleModel::Create();
+      auto mapField = model->MakeField<std::map<int, float>>({"myMap", "int to float map"});
+      auto mapField2 = model->MakeField<std::map<std::string, std::vector<float>>>("myMap2");
+      auto mapField3 = model->MakeField<std::unordered_map<std::int64_t, double>>("myMap3");
+      model->AddField(RFieldBase::Create("myMap4", "std::map<char, std::string>").Unwrap());
+
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "map_ntuple", fileGuard.GetPath());
+      auto mapField4 = ntuple->GetModel()->GetDefaultEntry()->Get<std::map<char, std::string>>("myMap4");
+      for (int i = 0; i < 3; i++) {
+         *mapField = {{i, 1.f}, {-1, 2.f}, {42, 3.f}};
+         *mapField2 = {{"a", {}}, {std::to_string(i), {static_cast<float>(i), 0.5}}};
+         mapField3->clear();
+         for (int j = 0; j < i; ++j)
+            (*mapField3)[j] = j * 0.5;
+         *mapField4 = {{'x', "foo"}, {static_cast<char>('a' + i), std::string(i, 'b')}};
+         ntuple->Fill();
+      }
+   }
+
+   auto ntuple = RNTupleReader::Open("map_ntuple", fileGuard.GetPath());
+   EXPECT_EQ(3, ntuple->GetNEntries());
+
+   auto viewMap = ntuple->GetView<std::map<int, float>>("myMap");
+   auto viewMap2 = ntuple->GetView<std::map<std::string, std::vector<float>>>("myMap2");
+   auto viewMap3 = ntuple->GetView<std::unordered_map<std::int64_t, double>>("myMap3");
+   auto viewMap4 = ntuple->GetView<std::map<char, std::string>>("myMap4");
+   for (auto i : ntuple->GetEntryRange()) {
+      const int j = i;
+      EXPECT_EQ((std::map<int, float>{{j, 1.f}, {-1, 2.f}, {42, 3.f}}), viewMap(i));
+      std::map<std::string, std::vector<float>> stringMap{{"a", {}}, {std::to_string(j), {static_cast<float>(j), 0.5}}};
+      EXPECT_EQ(stringMap, viewMap2(i));
+      std::unordered_map<std::int64_t, double> unorderedMap;
+      for (int k = 0; k < j; ++k)
+         unorderedMap[k] = k * 0.5;
+      EXPECT_EQ(unorderedMap, viewMap3(i));
+      EXPECT_EQ((std::map<char, std::string>{{'x', "foo"}, {static_cast<char>('a' + j), std::string(j, 'b')}}),
+                viewMap4(i));
+   }
+
+   // The model created from the descriptor uses the generic map fields
+   ntuple->LoadEntry(2);
+   auto myMap = ntuple->GetModel()->GetDefaultEntry()->Get<std::map<int, float>>("myMap");
+   EXPECT_EQ((std::map<int, float>{{2, 1.f}, {-1, 2.f}, {42, 3.f}}), *myMap);
+   auto myMap3 = ntuple->GetModel()->GetDefaultEntry()->Get<std::unordered_map<std::int64_t, double>>("myMap3");
+   EXPECT_EQ((std::unordered_map<std::int64_t, double>{{0, 0.}, {1, 0.5}}), *myMap3);
+}
+
+TEST(RNTuple, StdMapEmptyAtClusterBoundary)
+{
+   FileRaii fileGuard("test_ntuple_rfield_stdmap_empty.root");
+   {
+      auto model = RNTupleModel::Create();
+      auto mapField = model->MakeField<std::map<int, float>>("myMap");
+      auto mapField2 = model->MakeField<std::unordered_map<std::int64_t, double>>("myMap2");
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "map_ntuple", fileGuard.GetPath());
+      // The last entry of the first cluster, the first entry of the second cluster, and the entire third cluster
+      // hold empty maps
+      *mapField = {{1, 1.f}, {2, 2.f}};
+      *mapField2 = {{1, 1.}};
+      ntuple->Fill();
+      mapField->clear();
+      mapField2->clear();
+      ntuple->Fill();
+      ntuple->CommitCluster();
+      ntuple->Fill();
+      *mapField = {{3, 3.f}};
+      *mapField2 = {{3, 3.}, {4, 4.}};
+      ntuple->Fill();
+      ntuple->CommitCluster();
+      mapField->clear();
+      mapField2->clear();
+      ntuple->Fill();
+      ntuple->Fill();
+   }
+
+   auto ntuple = RNTupleReader::Open("map_ntuple", fileGuard.GetPath());
+   EXPECT_EQ(3U, ntuple->GetDescriptor()->GetNClusters());
+   auto viewMap = ntuple->GetView<std::map<int, float>>("myMap");
+   auto viewMap2 = ntuple->GetView<std::unordered_map<std::int64_t, double>>("myMap2");
+   EXPECT_EQ((std::map<int, float>{{1, 1.f}, {2, 2.f}}), viewMap(0));
+   EXPECT_EQ((std::unordered_map<std::int64_t, double>{{1, 1.}}), viewMap2(0));
+   for (auto i : {1, 2, 4, 5}) {
+      EXPECT_TRUE(viewMap(i).empty());
+      EXPECT_TRUE(viewMap2(i).empty());
+   }
+   EXPECT_EQ((std::map<int, float>{{3, 3.f}}), viewMap(3));
+   EXPECT_EQ((std::unordered_map<std::int64_t, double>{{3, 3.}, {4, 4.}}), viewMap2(3));
+}
+
 TEST(RNTuple, Int64)
 {
    auto field = RFieldBase::Create("test", "std::int64_t").Unwrap();